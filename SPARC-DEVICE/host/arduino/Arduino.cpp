@@ -0,0 +1,83 @@
+#include "Arduino.h"
+
+#include "../sim/sim_clock.h"
+#include "../sim/sim_gpio.h"
+#include "../sim/sim_tasks.h"
+
+unsigned long millis() {
+  return (unsigned long)simClockMillis();
+}
+
+unsigned long micros() {
+  return (unsigned long)simClockMicros();
+}
+
+void delay(uint32_t ms) {
+  simTaskSleepUntil(simClockMicros() + ms * 1000ULL);
+}
+
+void delayMicroseconds(uint32_t us) {
+  simTaskSleepUntil(simClockMicros() + us);
+}
+
+void yield() {
+  simTaskSleepUntil(simClockMicros());
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  simGpioMode(pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  simGpioWrite(pin, val);
+}
+
+int digitalRead(uint8_t pin) {
+  return simGpioRead(pin);
+}
+
+// A floating ADC pin: noise, which is what randomSeed(analogRead(0))
+// wants.
+uint16_t analogRead(uint8_t pin) {
+  (void)pin;
+  return esp_random() & 0x0FFF;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode) {
+  simGpioAttachInterrupt(pin, isr, mode);
+}
+
+void detachInterrupt(uint8_t pin) {
+  simGpioDetachInterrupt(pin);
+}
+
+// xorshift32, fixed seed.
+static uint32_t randomState = 0x2545F491;
+
+uint32_t esp_random(void) {
+  uint32_t x = randomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  randomState = x;
+  return x;
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return esp_random() % howbig;
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) randomState = (uint32_t)seed;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  if (in_max == in_min) return out_min;
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
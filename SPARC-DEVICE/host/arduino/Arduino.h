@@ -0,0 +1,99 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// The parts of the ESP32 Arduino core the firmware uses, for the host
+// build. Time is the simulator's virtual clock, pins are simulated and
+// FreeRTOS tasks take turns on host threads; see host/sim.
+
+#include <ctype.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+#define PULLDOWN 0x08
+#define INPUT_PULLDOWN 0x09
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+
+#define SERIAL_8N1 0x800001c
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define digitalPinToInterrupt(p) (p)
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int word;
+
+using std::min;
+using std::max;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+
+// esp_system.h. Seeded the same on every run, so runs repeat.
+uint32_t esp_random(void);
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// The sketch.
+void setup(void);
+void loop(void);
+// Start the loopTask that runs them, as the core's main() does. It
+// first runs when the caller waits.
+void arduinoLoopTaskStart();
+
+inline bool isAlphaNumeric(int c) { return isalnum(c) != 0; }
+inline bool isAlpha(int c) { return isalpha(c) != 0; }
+inline bool isDigit(int c) { return isdigit(c) != 0; }
+inline bool isSpace(int c) { return isspace(c) != 0; }
+inline bool isWhitespace(int c) { return isblank(c) != 0; }
+inline bool isPrintable(int c) { return isprint(c) != 0; }
+inline bool isUpperCase(int c) { return isupper(c) != 0; }
+inline bool isLowerCase(int c) { return islower(c) != 0; }
+inline bool isHexadecimalDigit(int c) { return isxdigit(c) != 0; }
+inline int toLowerCase(int c) { return tolower(c); }
+inline int toUpperCase(int c) { return toupper(c); }
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "HardwareSerial.h"
+#include "Esp.h"
+
+#endif // Arduino_h
@@ -0,0 +1,25 @@
+#include "DFRobotDFPlayerMini.h"
+
+#include "../sim/sim_audio.h"
+
+bool DFRobotDFPlayerMini::begin(Stream &stream, bool isACK, bool doReset) {
+  (void)stream; (void)isACK; (void)doReset;
+  _present = simAudioPresent();
+  return _present;
+}
+
+bool DFRobotDFPlayerMini::available() {
+  uint16_t track;
+  if (!_present || !simAudioTakeFinished(&track)) return false;
+  _handleType = DFPlayerPlayFinished;
+  _handleParameter = track;
+  return true;
+}
+
+void DFRobotDFPlayerMini::play(int fileNumber) {
+  if (_present) simAudioPlay((uint16_t)fileNumber);
+}
+
+void DFRobotDFPlayerMini::stop() {
+  if (_present) simAudioStop();
+}
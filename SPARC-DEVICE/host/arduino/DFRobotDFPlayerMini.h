@@ -0,0 +1,42 @@
+#ifndef DFRobotDFPlayerMini_cpp
+#define DFRobotDFPlayerMini_cpp
+
+#include "Arduino.h"
+
+// DFPlayer Mini driver on the simulated player (host/sim/sim_audio.h)
+// instead of a UART.
+
+#define TimeOut 0
+#define WrongStack 1
+#define DFPlayerCardInserted 2
+#define DFPlayerCardRemoved 3
+#define DFPlayerCardOnline 4
+#define DFPlayerPlayFinished 5
+#define DFPlayerError 6
+#define DFPlayerUSBInserted 7
+#define DFPlayerUSBRemoved 8
+#define DFPlayerUSBOnline 9
+#define DFPlayerCardUSBOnline 10
+#define DFPlayerFeedBack 11
+
+class DFRobotDFPlayerMini {
+ public:
+  bool begin(Stream &stream, bool isACK = true, bool doReset = true);
+  void setTimeOut(unsigned long timeOutDuration) { (void)timeOutDuration; }
+  bool available();
+  uint8_t readType() { return _handleType; }
+  uint16_t read() { return _handleParameter; }
+
+  void volume(uint8_t volume) { _volume = volume; }
+  void play(int fileNumber = 1);
+  void stop();
+  void pause() { stop(); }
+
+ private:
+  bool _present = false;
+  uint8_t _volume = 0;
+  uint8_t _handleType = 0;
+  uint16_t _handleParameter = 0;
+};
+
+#endif // DFRobotDFPlayerMini_cpp
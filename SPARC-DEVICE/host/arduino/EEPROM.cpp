@@ -0,0 +1,46 @@
+#include "EEPROM.h"
+
+EEPROMClass EEPROM;
+
+// What was committed, kept across end()/begin() like the flash sector.
+static uint8_t flash[4096];
+static bool flashErased = false;
+
+EEPROMClass::~EEPROMClass() {
+  end();
+}
+
+bool EEPROMClass::begin(size_t size) {
+  if (size == 0 || size > sizeof(flash)) return false;
+  if (!flashErased) {
+    memset(flash, 0xFF, sizeof(flash));
+    flashErased = true;
+  }
+  end();
+  _data = new uint8_t[size];
+  memcpy(_data, flash, size);
+  _size = size;
+  return true;
+}
+
+uint8_t EEPROMClass::read(int address) {
+  if (!_data || address < 0 || (size_t)address >= _size) return 0;
+  return _data[address];
+}
+
+void EEPROMClass::write(int address, uint8_t val) {
+  if (!_data || address < 0 || (size_t)address >= _size) return;
+  _data[address] = val;
+}
+
+bool EEPROMClass::commit() {
+  if (!_data) return false;
+  memcpy(flash, _data, _size);
+  return true;
+}
+
+void EEPROMClass::end() {
+  delete[] _data;
+  _data = nullptr;
+  _size = 0;
+}
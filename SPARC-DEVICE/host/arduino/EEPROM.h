@@ -0,0 +1,26 @@
+#ifndef EEPROM_h
+#define EEPROM_h
+
+#include "Arduino.h"
+
+// EEPROM emulation, in memory for the host build: erased (0xFF) at the
+// start of every run.
+class EEPROMClass {
+ public:
+  ~EEPROMClass();
+
+  bool begin(size_t size);
+  uint8_t read(int address);
+  void write(int address, uint8_t val);
+  bool commit();
+  void end();
+  size_t length() { return _size; }
+
+ private:
+  uint8_t *_data = nullptr;
+  size_t _size = 0;
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // EEPROM_h
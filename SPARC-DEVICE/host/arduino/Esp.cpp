@@ -0,0 +1,44 @@
+#include "Esp.h"
+
+#include "esp_heap_caps.h"
+
+#include <stdio.h>
+#include <unistd.h>
+#include <chrono>
+
+EspClass ESP;
+
+static multi_heap_info_t heapInfo() {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+  return info;
+}
+
+uint32_t EspClass::getHeapSize() {
+  multi_heap_info_t info = heapInfo();
+  return info.total_free_bytes + info.total_allocated_bytes;
+}
+
+uint32_t EspClass::getFreeHeap() {
+  return heapInfo().total_free_bytes;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+  return heapInfo().minimum_free_bytes;
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  return heapInfo().largest_free_block;
+}
+
+uint32_t EspClass::getCycleCount() {
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  return (uint32_t)(ns * 240 / 1000);
+}
+
+void EspClass::restart() {
+  fflush(stdout);
+  fprintf(stderr, "ESP.restart() called\n");
+  _exit(0);
+}
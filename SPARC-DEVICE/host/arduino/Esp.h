@@ -0,0 +1,23 @@
+#ifndef ESP_H
+#define ESP_H
+
+#include <stdint.h>
+
+// Heap figures are the host allocator's. The cycle counter runs at
+// 240 MHz on host time, so cycle-based timings compare with the board's.
+class EspClass {
+ public:
+  uint32_t getHeapSize();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() { return 240; }
+  const char *getChipModel() { return "ESP32 (host)"; }
+  // Ends the process: there is no reboot to come back from.
+  void restart();
+};
+
+extern EspClass ESP;
+
+#endif // ESP_H
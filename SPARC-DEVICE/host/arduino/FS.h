@@ -0,0 +1,72 @@
+#ifndef FS_H
+#define FS_H
+
+#include <memory>
+
+#include "Arduino.h"
+
+// File and FS of the ESP32 core over an in-memory file tree. Writes are
+// visible to other handles at once; each run starts from a blank,
+// formatted partition.
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FileImpl;
+typedef std::shared_ptr<FileImpl> FileImplPtr;
+
+class File : public Stream {
+ public:
+  File(FileImplPtr p = FileImplPtr()) : _p(p) {}
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override {}
+  size_t read(uint8_t *buf, size_t size);
+  size_t readBytes(char *buffer, size_t length) override { return read((uint8_t*)buffer, length); }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void close();
+  const char *path() const;
+  operator bool() const { return _p != nullptr; }
+
+ private:
+  FileImplPtr _p;
+};
+
+struct FSImpl;
+
+class FS {
+ public:
+  File open(const char *path, const char *mode = FILE_READ, const bool create = false);
+  File open(const String &path, const char *mode = FILE_READ, const bool create = false) {
+    return open(path.c_str(), mode, create);
+  }
+  bool exists(const char *path);
+  bool remove(const char *path);
+  bool rename(const char *pathFrom, const char *pathTo);
+
+ protected:
+  bool _mounted = false;
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+using fs::SeekSet;
+
+#endif // FS_H
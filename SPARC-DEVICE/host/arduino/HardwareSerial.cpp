@@ -0,0 +1,56 @@
+#include "HardwareSerial.h"
+
+#include "../sim/sim_console.h"
+
+HardwareSerial Serial(0);
+
+HardwareSerial::HardwareSerial(int uart_nr) : _uart_nr(uart_nr) {}
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config, int8_t rxPin, int8_t txPin,
+                           bool invert, unsigned long timeout_ms, uint8_t rxfifo_full_thrhd) {
+  (void)baud; (void)config; (void)rxPin; (void)txPin;
+  (void)invert; (void)timeout_ms; (void)rxfifo_full_thrhd;
+}
+
+void HardwareSerial::end() {
+  if (_uart_nr == 0) simConsoleOnReceive(nullptr, nullptr);
+}
+
+void HardwareSerial::receive(void *arg) {
+  HardwareSerial *self = (HardwareSerial*)arg;
+  if (self->_onReceive) self->_onReceive();
+}
+
+void HardwareSerial::onReceive(OnReceiveCb function, bool onlyOnTimeout) {
+  (void)onlyOnTimeout;
+  _onReceive = function;
+  if (_uart_nr == 0) simConsoleOnReceive(receive, this);
+}
+
+int HardwareSerial::available() {
+  return _uart_nr == 0 ? simConsoleAvailable() : 0;
+}
+
+int HardwareSerial::peek() {
+  return _uart_nr == 0 ? simConsolePeek() : -1;
+}
+
+int HardwareSerial::read() {
+  return _uart_nr == 0 ? simConsoleRead() : -1;
+}
+
+size_t HardwareSerial::read(uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  int c;
+  while (n < size && (c = read()) >= 0) buffer[n++] = (uint8_t)c;
+  return n;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  if (_uart_nr == 0) simConsoleWrite(buffer, size);
+  return size;
+}
@@ -0,0 +1,40 @@
+#ifndef HardwareSerial_h
+#define HardwareSerial_h
+
+#include <functional>
+
+#include "Stream.h"
+
+typedef std::function<void(void)> OnReceiveCb;
+
+// UART0 is the console (host/sim/sim_console.h). The other UARTs are not
+// wired to anything: the DFPlayer is simulated behind its library.
+class HardwareSerial : public Stream {
+ public:
+  explicit HardwareSerial(int uart_nr);
+
+  void begin(unsigned long baud, uint32_t config = 0x800001c, int8_t rxPin = -1, int8_t txPin = -1,
+             bool invert = false, unsigned long timeout_ms = 20000UL, uint8_t rxfifo_full_thrhd = 112);
+  void end();
+  void onReceive(OnReceiveCb function, bool onlyOnTimeout = false);
+
+  int available() override;
+  int peek() override;
+  int read() override;
+  size_t read(uint8_t *buffer, size_t size);
+  void flush() override {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  operator bool() const { return true; }
+
+ private:
+  static void receive(void *arg);
+
+  int _uart_nr;
+  OnReceiveCb _onReceive;
+};
+
+extern HardwareSerial Serial;
+
+#endif // HardwareSerial_h
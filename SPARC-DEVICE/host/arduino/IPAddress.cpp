@@ -0,0 +1,54 @@
+#include "IPAddress.h"
+
+#include "Print.h"
+
+#include <stdio.h>
+#include <string.h>
+
+IPAddress::IPAddress() {
+  _address.dword = 0;
+}
+
+IPAddress::IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth) {
+  _address.bytes[0] = first;
+  _address.bytes[1] = second;
+  _address.bytes[2] = third;
+  _address.bytes[3] = fourth;
+}
+
+IPAddress::IPAddress(uint32_t address) {
+  _address.dword = address;
+}
+
+IPAddress::IPAddress(const uint8_t *address) {
+  memcpy(_address.bytes, address, sizeof(_address.bytes));
+}
+
+IPAddress &IPAddress::operator=(uint32_t address) {
+  _address.dword = address;
+  return *this;
+}
+
+bool IPAddress::operator==(const uint8_t *addr) const {
+  return memcmp(addr, _address.bytes, sizeof(_address.bytes)) == 0;
+}
+
+bool IPAddress::fromString(const char *address) {
+  unsigned a, b, c, d;
+  char tail;
+  if (sscanf(address, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) != 4) return false;
+  if (a > 255 || b > 255 || c > 255 || d > 255) return false;
+  *this = IPAddress(a, b, c, d);
+  return true;
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _address.bytes[0], _address.bytes[1],
+           _address.bytes[2], _address.bytes[3]);
+  return String(buf);
+}
+
+size_t IPAddress::printTo(Print &p) const {
+  return p.print(toString());
+}
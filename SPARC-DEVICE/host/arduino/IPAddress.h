@@ -0,0 +1,39 @@
+#ifndef IPAddress_h
+#define IPAddress_h
+
+#include <stdint.h>
+
+#include "Printable.h"
+#include "WString.h"
+
+// IPv4 only. The uint32_t form is in network byte order, as in
+// sockaddr_in and the ESP32 core.
+class IPAddress : public Printable {
+ public:
+  IPAddress();
+  IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth);
+  IPAddress(uint32_t address);
+  IPAddress(const uint8_t *address);
+
+  bool fromString(const char *address);
+  bool fromString(const String &address) { return fromString(address.c_str()); }
+  String toString() const;
+
+  operator uint32_t() const { return _address.dword; }
+  bool operator==(const IPAddress &addr) const { return _address.dword == addr._address.dword; }
+  bool operator!=(const IPAddress &addr) const { return !(*this == addr); }
+  bool operator==(const uint8_t *addr) const;
+  uint8_t operator[](int index) const { return _address.bytes[index]; }
+  uint8_t &operator[](int index) { return _address.bytes[index]; }
+  IPAddress &operator=(uint32_t address);
+
+  size_t printTo(Print &p) const override;
+
+ private:
+  union {
+    uint8_t bytes[4];
+    uint32_t dword;
+  } _address;
+};
+
+#endif // IPAddress_h
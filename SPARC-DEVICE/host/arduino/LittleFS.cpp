@@ -0,0 +1,151 @@
+#include "LittleFS.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+fs::LittleFSFS LittleFS;
+
+// The "spiffs" partition of the default partition table.
+static const size_t PARTITION_BYTES = 1408 * 1024;
+
+typedef std::shared_ptr<std::vector<uint8_t>> Contents;
+
+// Path to contents. A renamed or removed file keeps its contents for the
+// handles still open on it, as on LittleFS.
+static std::map<std::string, Contents> files;
+
+namespace fs {
+
+struct FileImpl {
+  std::string path;
+  Contents data;
+  size_t pos;
+  bool readable;
+  bool writable;
+};
+
+size_t File::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t *buf, size_t size) {
+  if (!_p || !_p->writable) return 0;
+  std::vector<uint8_t> &d = *_p->data;
+  if (_p->pos > d.size()) d.resize(_p->pos);
+  size_t overlap = std::min(size, d.size() - _p->pos);
+  std::copy(buf, buf + overlap, d.begin() + _p->pos);
+  d.insert(d.end(), buf + overlap, buf + size);
+  _p->pos += size;
+  return size;
+}
+
+int File::available() {
+  if (!_p || !_p->readable) return 0;
+  return _p->pos < _p->data->size() ? (int)(_p->data->size() - _p->pos) : 0;
+}
+
+int File::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+  if (!available()) return -1;
+  return (*_p->data)[_p->pos];
+}
+
+size_t File::read(uint8_t *buf, size_t size) {
+  size_t n = std::min(size, (size_t)available());
+  if (n) memcpy(buf, _p->data->data() + _p->pos, n);
+  if (_p) _p->pos += n;
+  return n;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_p) return false;
+  size_t base = mode == SeekSet ? 0 : mode == SeekCur ? _p->pos : _p->data->size();
+  _p->pos = base + pos;
+  return true;
+}
+
+size_t File::position() const {
+  return _p ? _p->pos : 0;
+}
+
+size_t File::size() const {
+  return _p ? _p->data->size() : 0;
+}
+
+void File::close() {
+  _p.reset();
+}
+
+const char *File::path() const {
+  return _p ? _p->path.c_str() : nullptr;
+}
+
+File FS::open(const char *path, const char *mode, const bool create) {
+  (void)create;
+  if (!_mounted || !path || !mode) return File();
+  auto it = files.find(path);
+  bool reading = mode[0] == 'r';
+  if (reading && it == files.end()) return File();
+
+  FileImplPtr f = std::make_shared<FileImpl>();
+  f->path = path;
+  if (reading) {
+    f->data = it->second;
+  } else if (mode[0] == 'w' || it == files.end()) {
+    f->data = std::make_shared<std::vector<uint8_t>>();
+    files[path] = f->data;
+  } else {
+    f->data = it->second;
+  }
+  f->pos = mode[0] == 'a' ? f->data->size() : 0;
+  f->readable = reading || strchr(mode, '+');
+  f->writable = !reading || strchr(mode, '+');
+  return File(f);
+}
+
+bool FS::exists(const char *path) {
+  return _mounted && path && files.count(path) > 0;
+}
+
+bool FS::remove(const char *path) {
+  return _mounted && path && files.erase(path) > 0;
+}
+
+bool FS::rename(const char *pathFrom, const char *pathTo) {
+  if (!_mounted || !pathFrom || !pathTo) return false;
+  auto it = files.find(pathFrom);
+  if (it == files.end()) return false;
+  Contents data = it->second;
+  files.erase(it);
+  files[pathTo] = data;
+  return true;
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles,
+                       const char *partitionLabel) {
+  (void)formatOnFail; (void)basePath; (void)maxOpenFiles; (void)partitionLabel;
+  _mounted = true;
+  return true;
+}
+
+bool LittleFSFS::format() {
+  files.clear();
+  return true;
+}
+
+size_t LittleFSFS::totalBytes() {
+  return PARTITION_BYTES;
+}
+
+size_t LittleFSFS::usedBytes() {
+  size_t used = 0;
+  for (const auto &f : files) used += f.second->size();
+  return used;
+}
+
+}  // namespace fs
@@ -0,0 +1,22 @@
+#ifndef _LITTLEFS_H_
+#define _LITTLEFS_H_
+
+#include "FS.h"
+
+namespace fs {
+
+class LittleFSFS : public FS {
+ public:
+  bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+             const char *partitionLabel = "spiffs");
+  bool format();
+  size_t totalBytes();
+  size_t usedBytes();
+  void end() { _mounted = false; }
+};
+
+}  // namespace fs
+
+extern fs::LittleFSFS LittleFS;
+
+#endif // _LITTLEFS_H_
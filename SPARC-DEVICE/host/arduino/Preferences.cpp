@@ -0,0 +1,150 @@
+#include "Preferences.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+static const size_t NVS_KEY_NAME_MAX = 15;
+static const size_t NVS_ENTRIES = 630;  // a 20 KB nvs partition
+
+struct PreferencesEntry {
+  PreferenceType type;
+  std::vector<uint8_t> data;
+};
+
+struct PreferencesNamespace {
+  std::map<std::string, PreferencesEntry> entries;
+};
+
+static std::map<std::string, PreferencesNamespace> flash;
+
+static bool validName(const char *name) {
+  return name && *name && strlen(name) <= NVS_KEY_NAME_MAX;
+}
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partition_label) {
+  (void)partition_label;
+  if (_ns) return false;
+  if (!validName(name)) return false;
+  _ns = &flash[name];
+  _readOnly = readOnly;
+  return true;
+}
+
+void Preferences::end() {
+  _ns = nullptr;
+}
+
+bool Preferences::clear() {
+  if (!_ns || _readOnly) return false;
+  _ns->entries.clear();
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!_ns || _readOnly || !key) return false;
+  return _ns->entries.erase(key) > 0;
+}
+
+size_t Preferences::put(const char *key, PreferenceType type, const void *value, size_t len) {
+  if (!_ns || _readOnly || !validName(key)) return 0;
+  PreferencesEntry &e = _ns->entries[key];
+  e.type = type;
+  e.data.assign((const uint8_t*)value, (const uint8_t*)value + len);
+  return len;
+}
+
+bool Preferences::get(const char *key, PreferenceType type, void *value, size_t len) {
+  if (!_ns || !key) return false;
+  auto it = _ns->entries.find(key);
+  if (it == _ns->entries.end() || it->second.type != type || it->second.data.size() != len) return false;
+  memcpy(value, it->second.data.data(), len);
+  return true;
+}
+
+size_t Preferences::putChar(const char *key, int8_t value) { return put(key, PT_I8, &value, sizeof(value)); }
+size_t Preferences::putUChar(const char *key, uint8_t value) { return put(key, PT_U8, &value, sizeof(value)); }
+size_t Preferences::putShort(const char *key, int16_t value) { return put(key, PT_I16, &value, sizeof(value)); }
+size_t Preferences::putUShort(const char *key, uint16_t value) { return put(key, PT_U16, &value, sizeof(value)); }
+size_t Preferences::putInt(const char *key, int32_t value) { return put(key, PT_I32, &value, sizeof(value)); }
+size_t Preferences::putUInt(const char *key, uint32_t value) { return put(key, PT_U32, &value, sizeof(value)); }
+size_t Preferences::putLong(const char *key, int32_t value) { return putInt(key, value); }
+size_t Preferences::putULong(const char *key, uint32_t value) { return putUInt(key, value); }
+size_t Preferences::putLong64(const char *key, int64_t value) { return put(key, PT_I64, &value, sizeof(value)); }
+size_t Preferences::putULong64(const char *key, uint64_t value) { return put(key, PT_U64, &value, sizeof(value)); }
+size_t Preferences::putFloat(const char *key, float value) { return put(key, PT_BLOB, &value, sizeof(value)); }
+size_t Preferences::putDouble(const char *key, double value) { return put(key, PT_BLOB, &value, sizeof(value)); }
+size_t Preferences::putBool(const char *key, bool value) { return putUChar(key, value ? 1 : 0); }
+
+size_t Preferences::putString(const char *key, const char *value) {
+  if (!value) return 0;
+  return put(key, PT_STR, value, strlen(value) + 1) ? strlen(value) : 0;
+}
+
+size_t Preferences::putString(const char *key, String value) {
+  return putString(key, value.c_str());
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  if (!value || !len) return 0;
+  return put(key, PT_BLOB, value, len);
+}
+
+bool Preferences::isKey(const char *key) {
+  return _ns && key && _ns->entries.count(key) > 0;
+}
+
+PreferenceType Preferences::getType(const char *key) {
+  if (!isKey(key)) return PT_INVALID;
+  return _ns->entries[key].type;
+}
+
+int8_t Preferences::getChar(const char *key, int8_t d) { int8_t v; return get(key, PT_I8, &v, sizeof(v)) ? v : d; }
+uint8_t Preferences::getUChar(const char *key, uint8_t d) { uint8_t v; return get(key, PT_U8, &v, sizeof(v)) ? v : d; }
+int16_t Preferences::getShort(const char *key, int16_t d) { int16_t v; return get(key, PT_I16, &v, sizeof(v)) ? v : d; }
+uint16_t Preferences::getUShort(const char *key, uint16_t d) { uint16_t v; return get(key, PT_U16, &v, sizeof(v)) ? v : d; }
+int32_t Preferences::getInt(const char *key, int32_t d) { int32_t v; return get(key, PT_I32, &v, sizeof(v)) ? v : d; }
+uint32_t Preferences::getUInt(const char *key, uint32_t d) { uint32_t v; return get(key, PT_U32, &v, sizeof(v)) ? v : d; }
+int32_t Preferences::getLong(const char *key, int32_t d) { return getInt(key, d); }
+uint32_t Preferences::getULong(const char *key, uint32_t d) { return getUInt(key, d); }
+int64_t Preferences::getLong64(const char *key, int64_t d) { int64_t v; return get(key, PT_I64, &v, sizeof(v)) ? v : d; }
+uint64_t Preferences::getULong64(const char *key, uint64_t d) { uint64_t v; return get(key, PT_U64, &v, sizeof(v)) ? v : d; }
+float Preferences::getFloat(const char *key, float d) { float v; return get(key, PT_BLOB, &v, sizeof(v)) ? v : d; }
+double Preferences::getDouble(const char *key, double d) { double v; return get(key, PT_BLOB, &v, sizeof(v)) ? v : d; }
+bool Preferences::getBool(const char *key, bool d) { return getUChar(key, d ? 1 : 0) == 1; }
+
+size_t Preferences::getString(const char *key, char *value, size_t maxLen) {
+  if (!isKey(key)) return 0;
+  const PreferencesEntry &e = _ns->entries[key];
+  if (e.type != PT_STR) return 0;
+  if (!value) return e.data.size();
+  if (maxLen < e.data.size()) return 0;
+  memcpy(value, e.data.data(), e.data.size());
+  return e.data.size();
+}
+
+String Preferences::getString(const char *key, String defaultValue) {
+  if (!isKey(key)) return defaultValue;
+  const PreferencesEntry &e = _ns->entries[key];
+  if (e.type != PT_STR) return defaultValue;
+  return String((const char*)e.data.data());
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  if (!isKey(key)) return 0;
+  const PreferencesEntry &e = _ns->entries[key];
+  return e.type == PT_BLOB ? e.data.size() : 0;
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  size_t len = getBytesLength(key);
+  if (!len || !buf || len > maxLen) return 0;
+  memcpy(buf, _ns->entries[key].data.data(), len);
+  return len;
+}
+
+size_t Preferences::freeEntries() {
+  size_t used = 0;
+  for (const auto &ns : flash) used += ns.second.entries.size();
+  return used < NVS_ENTRIES ? NVS_ENTRIES - used : 0;
+}
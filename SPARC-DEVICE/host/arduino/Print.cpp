@@ -0,0 +1,147 @@
+#include "Print.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    if (!write(*buffer++)) break;
+    n++;
+  }
+  return n;
+}
+
+size_t Print::printf(const char *format, ...) {
+  char loc[64];
+  va_list arg;
+  va_start(arg, format);
+  int len = vsnprintf(loc, sizeof(loc), format, arg);
+  va_end(arg);
+  if (len < 0) return 0;
+  if ((size_t)len < sizeof(loc)) return write((const uint8_t*)loc, len);
+  char *temp = new char[len + 1];
+  va_start(arg, format);
+  vsnprintf(temp, len + 1, format, arg);
+  va_end(arg);
+  size_t n = write((const uint8_t*)temp, len);
+  delete[] temp;
+  return n;
+}
+
+size_t Print::print(const __FlashStringHelper *ifsh) {
+  return print(reinterpret_cast<const char*>(ifsh));
+}
+
+size_t Print::print(const String &s) {
+  return write(s.c_str(), s.length());
+}
+
+size_t Print::print(const char str[]) {
+  return write(str);
+}
+
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+
+size_t Print::print(unsigned char n, int base) {
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(int n, int base) {
+  return print((long)n, base);
+}
+
+size_t Print::print(unsigned int n, int base) {
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(long n, int base) {
+  return print((long long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  return print((unsigned long long)n, base);
+}
+
+size_t Print::print(long long n, int base) {
+  if (base == 0) return write((uint8_t)n);
+  if (base == 10 && n < 0) {
+    size_t t = print('-');
+    return t + printNumber(-(unsigned long long)n, 10);
+  }
+  return printNumber((unsigned long long)n, base);
+}
+
+size_t Print::print(unsigned long long n, int base) {
+  if (base == 0) return write((uint8_t)n);
+  return printNumber(n, base);
+}
+
+size_t Print::print(double n, int digits) {
+  return printFloat(n, digits);
+}
+
+size_t Print::print(const Printable &x) {
+  return x.printTo(*this);
+}
+
+size_t Print::println(void) {
+  return print("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper *ifsh) { size_t n = print(ifsh); return n + println(); }
+size_t Print::println(const String &s) { size_t n = print(s); return n + println(); }
+size_t Print::println(const char str[]) { size_t n = print(str); return n + println(); }
+size_t Print::println(char c) { size_t n = print(c); return n + println(); }
+size_t Print::println(unsigned char b, int base) { size_t n = print(b, base); return n + println(); }
+size_t Print::println(int num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(unsigned int num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(long num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(unsigned long num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(long long num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(unsigned long long num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(double num, int digits) { size_t n = print(num, digits); return n + println(); }
+size_t Print::println(const Printable &x) { size_t n = print(x); return n + println(); }
+
+size_t Print::printNumber(unsigned long long n, uint8_t base) {
+  char buf[8 * sizeof(n) + 1];
+  char *str = &buf[sizeof(buf) - 1];
+  *str = '\0';
+  if (base < 2) base = 10;
+  do {
+    char c = n % base;
+    n /= base;
+    *--str = c < 10 ? c + '0' : c + 'A' - 10;
+  } while (n);
+  return write(str);
+}
+
+size_t Print::printFloat(double number, uint8_t digits) {
+  if (isnan(number)) return print("nan");
+  if (isinf(number)) return print("inf");
+  if (number > 4294967040.0 || number < -4294967040.0) return print("ovf");
+
+  size_t n = 0;
+  if (number < 0.0) {
+    n += print('-');
+    number = -number;
+  }
+  double rounding = 0.5;
+  for (uint8_t i = 0; i < digits; ++i) rounding /= 10.0;
+  number += rounding;
+
+  unsigned long int_part = (unsigned long)number;
+  double remainder = number - (double)int_part;
+  n += print(int_part);
+  if (digits > 0) n += print('.');
+  while (digits-- > 0) {
+    remainder *= 10.0;
+    int toPrint = (int)remainder;
+    n += print(toPrint);
+    remainder -= toPrint;
+  }
+  return n;
+}
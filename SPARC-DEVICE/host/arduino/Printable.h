@@ -0,0 +1,15 @@
+#ifndef Printable_h
+#define Printable_h
+
+#include <stddef.h>
+
+class Print;
+
+// Something Print::print() can print, e.g. IPAddress.
+class Printable {
+ public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print &p) const = 0;
+};
+
+#endif // Printable_h
@@ -0,0 +1,8 @@
+#ifndef _SPI_H_INCLUDED
+#define _SPI_H_INCLUDED
+
+// The display is simulated behind TFT_eSPI; nothing uses the SPI bus
+// directly.
+#include "Arduino.h"
+
+#endif // _SPI_H_INCLUDED
@@ -0,0 +1,279 @@
+#include "TFT_eSPI.h"
+
+#include "../sim/sim_display.h"
+
+// 5x7 glyphs for ' ' to '~', one byte per column, bit 0 at the top.
+static const uint8_t font5x7[95][5] = {
+  { 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x5F, 0x00, 0x00 }, { 0x00, 0x07, 0x00, 0x07, 0x00 },
+  { 0x14, 0x7F, 0x14, 0x7F, 0x14 }, { 0x24, 0x2A, 0x7F, 0x2A, 0x12 }, { 0x23, 0x13, 0x08, 0x64, 0x62 },
+  { 0x36, 0x49, 0x55, 0x22, 0x50 }, { 0x00, 0x05, 0x03, 0x00, 0x00 }, { 0x00, 0x1C, 0x22, 0x41, 0x00 },
+  { 0x00, 0x41, 0x22, 0x1C, 0x00 }, { 0x08, 0x2A, 0x1C, 0x2A, 0x08 }, { 0x08, 0x08, 0x3E, 0x08, 0x08 },
+  { 0x00, 0x50, 0x30, 0x00, 0x00 }, { 0x08, 0x08, 0x08, 0x08, 0x08 }, { 0x00, 0x60, 0x60, 0x00, 0x00 },
+  { 0x20, 0x10, 0x08, 0x04, 0x02 }, { 0x3E, 0x51, 0x49, 0x45, 0x3E }, { 0x00, 0x42, 0x7F, 0x40, 0x00 },
+  { 0x42, 0x61, 0x51, 0x49, 0x46 }, { 0x21, 0x41, 0x45, 0x4B, 0x31 }, { 0x18, 0x14, 0x12, 0x7F, 0x10 },
+  { 0x27, 0x45, 0x45, 0x45, 0x39 }, { 0x3C, 0x4A, 0x49, 0x49, 0x30 }, { 0x01, 0x71, 0x09, 0x05, 0x03 },
+  { 0x36, 0x49, 0x49, 0x49, 0x36 }, { 0x06, 0x49, 0x49, 0x29, 0x1E }, { 0x00, 0x36, 0x36, 0x00, 0x00 },
+  { 0x00, 0x56, 0x36, 0x00, 0x00 }, { 0x08, 0x14, 0x22, 0x41, 0x00 }, { 0x14, 0x14, 0x14, 0x14, 0x14 },
+  { 0x00, 0x41, 0x22, 0x14, 0x08 }, { 0x02, 0x01, 0x51, 0x09, 0x06 }, { 0x32, 0x49, 0x79, 0x41, 0x3E },
+  { 0x7E, 0x11, 0x11, 0x11, 0x7E }, { 0x7F, 0x49, 0x49, 0x49, 0x36 }, { 0x3E, 0x41, 0x41, 0x41, 0x22 },
+  { 0x7F, 0x41, 0x41, 0x22, 0x1C }, { 0x7F, 0x49, 0x49, 0x49, 0x41 }, { 0x7F, 0x09, 0x09, 0x01, 0x01 },
+  { 0x3E, 0x41, 0x41, 0x51, 0x32 }, { 0x7F, 0x08, 0x08, 0x08, 0x7F }, { 0x00, 0x41, 0x7F, 0x41, 0x00 },
+  { 0x20, 0x40, 0x41, 0x3F, 0x01 }, { 0x7F, 0x08, 0x14, 0x22, 0x41 }, { 0x7F, 0x40, 0x40, 0x40, 0x40 },
+  { 0x7F, 0x02, 0x04, 0x02, 0x7F }, { 0x7F, 0x04, 0x08, 0x10, 0x7F }, { 0x3E, 0x41, 0x41, 0x41, 0x3E },
+  { 0x7F, 0x09, 0x09, 0x09, 0x06 }, { 0x3E, 0x41, 0x51, 0x21, 0x5E }, { 0x7F, 0x09, 0x19, 0x29, 0x46 },
+  { 0x46, 0x49, 0x49, 0x49, 0x31 }, { 0x01, 0x01, 0x7F, 0x01, 0x01 }, { 0x3F, 0x40, 0x40, 0x40, 0x3F },
+  { 0x1F, 0x20, 0x40, 0x20, 0x1F }, { 0x7F, 0x20, 0x18, 0x20, 0x7F }, { 0x63, 0x14, 0x08, 0x14, 0x63 },
+  { 0x03, 0x04, 0x78, 0x04, 0x03 }, { 0x61, 0x51, 0x49, 0x45, 0x43 }, { 0x00, 0x00, 0x7F, 0x41, 0x41 },
+  { 0x02, 0x04, 0x08, 0x10, 0x20 }, { 0x41, 0x41, 0x7F, 0x00, 0x00 }, { 0x04, 0x02, 0x01, 0x02, 0x04 },
+  { 0x40, 0x40, 0x40, 0x40, 0x40 }, { 0x00, 0x01, 0x02, 0x04, 0x00 }, { 0x20, 0x54, 0x54, 0x54, 0x78 },
+  { 0x7F, 0x48, 0x44, 0x44, 0x38 }, { 0x38, 0x44, 0x44, 0x44, 0x20 }, { 0x38, 0x44, 0x44, 0x48, 0x7F },
+  { 0x38, 0x54, 0x54, 0x54, 0x18 }, { 0x08, 0x7E, 0x09, 0x01, 0x02 }, { 0x08, 0x14, 0x54, 0x54, 0x3C },
+  { 0x7F, 0x08, 0x04, 0x04, 0x78 }, { 0x00, 0x44, 0x7D, 0x40, 0x00 }, { 0x20, 0x40, 0x44, 0x3D, 0x00 },
+  { 0x00, 0x7F, 0x10, 0x28, 0x44 }, { 0x00, 0x41, 0x7F, 0x40, 0x00 }, { 0x7C, 0x04, 0x18, 0x04, 0x78 },
+  { 0x7C, 0x08, 0x04, 0x04, 0x78 }, { 0x38, 0x44, 0x44, 0x44, 0x38 }, { 0x7C, 0x14, 0x14, 0x14, 0x08 },
+  { 0x08, 0x14, 0x14, 0x18, 0x7C }, { 0x7C, 0x08, 0x04, 0x04, 0x08 }, { 0x48, 0x54, 0x54, 0x54, 0x20 },
+  { 0x04, 0x3F, 0x44, 0x40, 0x20 }, { 0x3C, 0x40, 0x40, 0x20, 0x7C }, { 0x1C, 0x20, 0x40, 0x20, 0x1C },
+  { 0x3C, 0x40, 0x30, 0x40, 0x3C }, { 0x44, 0x28, 0x10, 0x28, 0x44 }, { 0x0C, 0x50, 0x50, 0x50, 0x3C },
+  { 0x44, 0x64, 0x54, 0x4C, 0x44 }, { 0x00, 0x08, 0x36, 0x41, 0x00 }, { 0x00, 0x00, 0x7F, 0x00, 0x00 },
+  { 0x00, 0x41, 0x36, 0x08, 0x00 }, { 0x08, 0x08, 0x2A, 0x1C, 0x08 },
+};
+
+// Bytes outside the font (UTF-8 parts) draw as a box.
+static const uint8_t unknownGlyph[5] = { 0x7F, 0x41, 0x41, 0x41, 0x7F };
+
+static const int CHAR_W = 6;
+static const int CHAR_H = 8;
+
+TFT_eSPI::TFT_eSPI(int16_t _W, int16_t _H) {
+  (void)_W;
+  (void)_H;
+}
+
+void TFT_eSPI::init(uint8_t tc) {
+  (void)tc;
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  rotation = r & 3;
+  if (!_img) simDisplaySetRotation(rotation);
+}
+
+int16_t TFT_eSPI::width() {
+  return _img ? _iwidth : simDisplayWidth();
+}
+
+int16_t TFT_eSPI::height() {
+  return _img ? _iheight : simDisplayHeight();
+}
+
+uint32_t TFT_eSPI::put(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+  int32_t W = width(), H = height();
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > W) w = W - x;
+  if (y + h > H) h = H - y;
+  if (w <= 0 || h <= 0) return 0;
+  uint16_t *px = _img ? _img : simDisplayPixels();
+  for (int32_t j = 0; j < h; j++) {
+    uint16_t *row = px + (y + j) * W + x;
+    for (int32_t i = 0; i < w; i++) row[i] = color;
+  }
+  return (uint32_t)(w * h);
+}
+
+uint32_t TFT_eSPI::blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+  if (!data) return 0;
+  int32_t W = width(), H = height();
+  uint16_t *px = _img ? _img : simDisplayPixels();
+  uint32_t n = 0;
+  for (int32_t j = 0; j < h; j++) {
+    if (y + j < 0 || y + j >= H) continue;
+    for (int32_t i = 0; i < w; i++) {
+      if (x + i < 0 || x + i >= W) continue;
+      uint16_t c = data[j * w + i];
+      if (_swapBytes) c = (uint16_t)((c << 8) | (c >> 8));
+      px[(y + j) * W + x + i] = c;
+      n++;
+    }
+  }
+  return n;
+}
+
+void TFT_eSPI::drawn(uint32_t pixels) {
+  if (!_img) simDisplayCount(pixels);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  drawn(put(x, y, 1, 1, color));
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  drawn(put(x, y, w, h, color));
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, width(), height(), color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  uint32_t n = put(x, y, w, 1, color);
+  n += put(x, y + h - 1, w, 1, color);
+  n += put(x, y + 1, 1, h - 2, color);
+  n += put(x + w - 1, y + 1, 1, h - 2, color);
+  drawn(n);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+  drawn(put(x, y, w, 1, color));
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+  drawn(put(x, y, 1, h, color));
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+  int32_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  int32_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  uint32_t n = 0;
+  for (;;) {
+    n += put(x0, y0, 1, 1, color);
+    if (x0 == x1 && y0 == y1) break;
+    int32_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+  drawn(n);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data) {
+  drawn(blit(x, y, w, h, data));
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+  drawn(blit(x, y, w, h, data));
+}
+
+uint16_t TFT_eSPI::color565(uint8_t r, uint8_t g, uint8_t b) {
+  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+}
+
+void TFT_eSPI::setCursor(int16_t x, int16_t y) {
+  cursor_x = x;
+  cursor_y = y;
+}
+
+void TFT_eSPI::setTextColor(uint16_t color) {
+  textcolor = textbgcolor = color;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill) {
+  (void)bgfill;
+  textcolor = fgcolor;
+  textbgcolor = bgcolor;
+}
+
+void TFT_eSPI::setTextSize(uint8_t size) {
+  textsize = size ? size : 1;
+}
+
+void TFT_eSPI::setTextWrap(bool wrapX, bool wrapY) {
+  textwrapX = wrapX;
+  textwrapY = wrapY;
+}
+
+int16_t TFT_eSPI::textWidth(const char *string) {
+  return string ? (int16_t)(strlen(string) * CHAR_W * textsize) : 0;
+}
+
+int16_t TFT_eSPI::fontHeight() {
+  return CHAR_H * textsize;
+}
+
+uint32_t TFT_eSPI::drawChar(uint8_t c) {
+  const uint8_t *glyph = c >= ' ' && c <= '~' ? font5x7[c - ' '] : unknownGlyph;
+  uint32_t n = 0;
+  if (textbgcolor != textcolor) n += put(cursor_x, cursor_y, CHAR_W * textsize, CHAR_H * textsize, textbgcolor);
+  for (int i = 0; i < 5; i++) {
+    for (int j = 0; j < 7; j++) {
+      if (glyph[i] & (1 << j)) {
+        n += put(cursor_x + i * textsize, cursor_y + j * textsize, textsize, textsize, textcolor);
+      }
+    }
+  }
+  return n;
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+  if (c == '\r') return 1;
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += CHAR_H * textsize;
+    return 1;
+  }
+  if (textwrapX && cursor_x + CHAR_W * textsize > width()) {
+    cursor_x = 0;
+    cursor_y += CHAR_H * textsize;
+  }
+  if (textwrapY && cursor_y >= height()) cursor_y = 0;
+  drawn(drawChar(c));
+  cursor_x += CHAR_W * textsize;
+  return 1;
+}
+
+void TFT_eSPI::setTouch(uint16_t *data) {
+  (void)data;
+}
+
+uint8_t TFT_eSPI::getTouch(uint16_t *x, uint16_t *y, uint16_t threshold) {
+  (void)threshold;
+  return simDisplayTouched(x, y) ? 1 : 0;
+}
+
+bool TFT_eSPI::initDMA(bool ctrl_cs) {
+  (void)ctrl_cs;
+  return true;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer) {
+  (void)buffer;
+  drawn(blit(x, y, w, h, data));
+  if (!_img) simDisplayCountDma((uint32_t)(w * h * 2));
+}
+
+// --- TFT_eSprite ---
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft) : _tft(tft) {}
+
+TFT_eSprite::~TFT_eSprite() {
+  deleteSprite();
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  (void)frames;
+  if (_img) return _img;
+  if (w <= 0 || h <= 0) return nullptr;
+  _img = new uint16_t[w * h]();
+  _iwidth = w;
+  _iheight = h;
+  return _img;
+}
+
+void TFT_eSprite::deleteSprite() {
+  delete[] _img;
+  _img = nullptr;
+  _iwidth = _iheight = 0;
+}
+
+void *TFT_eSprite::setColorDepth(int8_t b) {
+  (void)b;
+  return _img;
+}
+
+void TFT_eSprite::fillSprite(uint32_t color) {
+  put(0, 0, _iwidth, _iheight, color);
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  if (_img) _tft->pushImage(x, y, _iwidth, _iheight, _img);
+}
@@ -0,0 +1,134 @@
+#ifndef _TFT_eSPIH_
+#define _TFT_eSPIH_
+
+#include "Arduino.h"
+
+// TFT_eSPI for the host build: draws into the simulated panel
+// (host/sim/sim_display.h), or a sprite's own buffer, and counts what
+// reaches the panel. Text uses a 5x7 font in a 6x8 cell, the size of
+// the library's default font 1. DMA pushes complete at once.
+
+#define TFT_WIDTH 320
+#define TFT_HEIGHT 480
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+
+class TFT_eSPI : public Print {
+ public:
+  TFT_eSPI(int16_t _W = TFT_WIDTH, int16_t _H = TFT_HEIGHT);
+  virtual ~TFT_eSPI() {}
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0) { init(tc); }
+  void setRotation(uint8_t r);
+  uint8_t getRotation() { return rotation; }
+  int16_t width();
+  int16_t height();
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void fillScreen(uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+  uint16_t color565(uint8_t red, uint8_t green, uint8_t blue);
+
+  void setCursor(int16_t x, int16_t y);
+  int16_t getCursorX() { return cursor_x; }
+  int16_t getCursorY() { return cursor_y; }
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+  void setTextSize(uint8_t size);
+  void setTextWrap(bool wrapX, bool wrapY = false);
+  int16_t textWidth(const char *string);
+  int16_t textWidth(const String &string) { return textWidth(string.c_str()); }
+  int16_t fontHeight();
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+  // Calibration data is ignored: the simulated touch layer reports
+  // screen coordinates.
+  void setTouch(uint16_t *data);
+  uint8_t getTouch(uint16_t *x, uint16_t *y, uint16_t threshold = 600);
+
+  bool initDMA(bool ctrl_cs = false);
+  void deInitDMA() {}
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer = nullptr);
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+  void startWrite() {}
+  void endWrite() {}
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() { return _swapBytes; }
+
+ protected:
+  // Fill a clipped rectangle of the drawing surface; returns the pixels
+  // written.
+  uint32_t put(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+  uint32_t blit(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+  // Count a finished drawing call if it reached the panel.
+  void drawn(uint32_t pixels);
+  uint32_t drawChar(uint8_t c);
+
+  // Sprite pixels; null when drawing to the panel.
+  uint16_t *_img = nullptr;
+  int32_t _iwidth = 0;
+  int32_t _iheight = 0;
+
+  uint8_t rotation = 0;
+  int32_t cursor_x = 0;
+  int32_t cursor_y = 0;
+  uint16_t textcolor = TFT_WHITE;
+  uint16_t textbgcolor = TFT_WHITE;  // same as textcolor: transparent
+  uint8_t textsize = 1;
+  bool textwrapX = true;
+  bool textwrapY = false;
+  bool _swapBytes = false;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+ public:
+  explicit TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite();
+  TFT_eSprite(const TFT_eSprite &) = delete;
+  TFT_eSprite &operator=(const TFT_eSprite &) = delete;
+
+  void *createSprite(int16_t width, int16_t height, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() { return _img != nullptr; }
+  void *getPointer() { return _img; }
+  void *setColorDepth(int8_t b);
+  void fillSprite(uint32_t color);
+  void pushSprite(int32_t x, int32_t y);
+
+ private:
+  TFT_eSPI *_tft;
+};
+
+#endif // _TFT_eSPIH_
@@ -0,0 +1,219 @@
+#include "WString.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <utility>
+
+// Digits of value in base 2..36, as the core's ultoa.
+static std::string toBase(unsigned long long value, unsigned char base) {
+  if (base < 2 || base > 36) base = 10;
+  char tmp[66];
+  int i = sizeof(tmp) - 1;
+  tmp[i] = '\0';
+  do {
+    unsigned digit = value % base;
+    tmp[--i] = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+    value /= base;
+  } while (value);
+  return std::string(tmp + i);
+}
+
+static std::string toBaseSigned(long long value, unsigned char base) {
+  if (value < 0 && base == 10) return "-" + toBase(-(unsigned long long)value, base);
+  return toBase((unsigned long long)value, base);
+}
+
+static std::string toDecimals(double value, unsigned int decimalPlaces) {
+  char tmp[64];
+  snprintf(tmp, sizeof(tmp), "%.*f", (int)decimalPlaces, value);
+  return tmp;
+}
+
+String::String(const char *cstr) : buf(cstr ? cstr : "") {}
+String::String(const char *cstr, unsigned int length) : buf(cstr ? std::string(cstr, length) : "") {}
+String::String(char c) : buf(1, c) {}
+String::String(unsigned char value, unsigned char base) : buf(toBase(value, base)) {}
+String::String(int value, unsigned char base) : buf(toBaseSigned(value, base)) {}
+String::String(unsigned int value, unsigned char base) : buf(toBase(value, base)) {}
+String::String(long value, unsigned char base) : buf(toBaseSigned(value, base)) {}
+String::String(unsigned long value, unsigned char base) : buf(toBase(value, base)) {}
+String::String(long long value, unsigned char base) : buf(toBaseSigned(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : buf(toBase(value, base)) {}
+String::String(float value, unsigned int decimalPlaces) : buf(toDecimals(value, decimalPlaces)) {}
+String::String(double value, unsigned int decimalPlaces) : buf(toDecimals(value, decimalPlaces)) {}
+
+String &String::operator=(const char *cstr) {
+  buf = cstr ? cstr : "";
+  return *this;
+}
+
+bool String::reserve(unsigned int size) {
+  buf.reserve(size);
+  return true;
+}
+
+bool String::concat(const String &str) { buf += str.buf; return true; }
+bool String::concat(const char *cstr) { if (!cstr) return false; buf += cstr; return true; }
+bool String::concat(const char *cstr, unsigned int length) { if (!cstr) return false; buf.append(cstr, length); return true; }
+bool String::concat(char c) { buf += c; return true; }
+bool String::concat(unsigned char num) { buf += toBase(num, 10); return true; }
+bool String::concat(int num) { buf += toBaseSigned(num, 10); return true; }
+bool String::concat(unsigned int num) { buf += toBase(num, 10); return true; }
+bool String::concat(long num) { buf += toBaseSigned(num, 10); return true; }
+bool String::concat(unsigned long num) { buf += toBase(num, 10); return true; }
+bool String::concat(long long num) { buf += toBaseSigned(num, 10); return true; }
+bool String::concat(unsigned long long num) { buf += toBase(num, 10); return true; }
+bool String::concat(float num) { buf += toDecimals(num, 2); return true; }
+bool String::concat(double num) { buf += toDecimals(num, 2); return true; }
+
+int String::compareTo(const String &s) const {
+  return strcmp(buf.c_str(), s.buf.c_str());
+}
+
+bool String::equalsIgnoreCase(const String &s) const {
+  return buf.size() == s.buf.size() && strcasecmp(buf.c_str(), s.buf.c_str()) == 0;
+}
+
+bool String::startsWith(const String &prefix) const {
+  return startsWith(prefix, 0);
+}
+
+bool String::startsWith(const String &prefix, unsigned int offset) const {
+  return offset + prefix.buf.size() <= buf.size() && buf.compare(offset, prefix.buf.size(), prefix.buf) == 0;
+}
+
+bool String::endsWith(const String &suffix) const {
+  return suffix.buf.size() <= buf.size() &&
+         buf.compare(buf.size() - suffix.buf.size(), suffix.buf.size(), suffix.buf) == 0;
+}
+
+char String::charAt(unsigned int index) const {
+  return index < buf.size() ? buf[index] : '\0';
+}
+
+void String::setCharAt(unsigned int index, char c) {
+  if (index < buf.size()) buf[index] = c;
+}
+
+char &String::operator[](unsigned int index) {
+  static char dummy;
+  if (index >= buf.size()) {
+    dummy = '\0';
+    return dummy;
+  }
+  return buf[index];
+}
+
+void String::getBytes(unsigned char *out, unsigned int bufsize, unsigned int index) const {
+  if (!bufsize || !out) return;
+  if (index >= buf.size()) {
+    out[0] = '\0';
+    return;
+  }
+  unsigned int n = buf.size() - index;
+  if (n > bufsize - 1) n = bufsize - 1;
+  memcpy(out, buf.data() + index, n);
+  out[n] = '\0';
+}
+
+static int position(size_t p) {
+  return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const {
+  return position(buf.find(ch, fromIndex));
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const {
+  return position(buf.find(str.buf, fromIndex));
+}
+
+int String::lastIndexOf(char ch) const {
+  return position(buf.rfind(ch));
+}
+
+int String::lastIndexOf(char ch, unsigned int fromIndex) const {
+  return position(buf.rfind(ch, fromIndex));
+}
+
+int String::lastIndexOf(const String &str) const {
+  return position(buf.rfind(str.buf));
+}
+
+int String::lastIndexOf(const String &str, unsigned int fromIndex) const {
+  return position(buf.rfind(str.buf, fromIndex));
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) std::swap(beginIndex, endIndex);
+  if (beginIndex >= buf.size()) return String();
+  if (endIndex > buf.size()) endIndex = buf.size();
+  String out;
+  out.buf = buf.substr(beginIndex, endIndex - beginIndex);
+  return out;
+}
+
+void String::replace(char find, char replace) {
+  for (char &c : buf) {
+    if (c == find) c = replace;
+  }
+}
+
+void String::replace(const String &find, const String &replace) {
+  if (find.buf.empty()) return;
+  size_t p = 0;
+  while ((p = buf.find(find.buf, p)) != std::string::npos) {
+    buf.replace(p, find.buf.size(), replace.buf);
+    p += replace.buf.size();
+  }
+}
+
+void String::remove(unsigned int index) {
+  remove(index, (unsigned int)-1);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index >= buf.size()) return;
+  buf.erase(index, count);
+}
+
+void String::toLowerCase() {
+  for (char &c : buf) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (char &c : buf) c = (char)toupper((unsigned char)c);
+}
+
+void String::trim() {
+  size_t first = 0;
+  while (first < buf.size() && isspace((unsigned char)buf[first])) first++;
+  size_t last = buf.size();
+  while (last > first && isspace((unsigned char)buf[last - 1])) last--;
+  buf = buf.substr(first, last - first);
+}
+
+long String::toInt() const {
+  return atol(buf.c_str());
+}
+
+float String::toFloat() const {
+  return (float)atof(buf.c_str());
+}
+
+double String::toDouble() const {
+  return atof(buf.c_str());
+}
+
+String operator+(const String &lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, const char *rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const char *lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, char rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, int rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, unsigned int rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, long rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, unsigned long rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, float rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, double rhs) { String s(lhs); s.concat(rhs); return s; }
@@ -0,0 +1,123 @@
+#ifndef String_class_h
+#define String_class_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+// Arduino String on std::string, same interface as the ESP32 core's.
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper*>(pstr_pointer))
+#define F(string_literal) (FPSTR(string_literal))
+
+class String {
+ public:
+  String(const char *cstr = "");
+  String(const char *cstr, unsigned int length);
+  String(const String &str) = default;
+  String(String &&str) = default;
+  String(const __FlashStringHelper *str) : String(reinterpret_cast<const char*>(str)) {}
+  explicit String(char c);
+  explicit String(unsigned char value, unsigned char base = 10);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(long long value, unsigned char base = 10);
+  explicit String(unsigned long long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimalPlaces = 2);
+  explicit String(double value, unsigned int decimalPlaces = 2);
+
+  String &operator=(const String &rhs) = default;
+  String &operator=(String &&rhs) = default;
+  String &operator=(const char *cstr);
+
+  bool reserve(unsigned int size);
+  unsigned int length() const { return buf.size(); }
+  bool isEmpty() const { return buf.empty(); }
+  const char *c_str() const { return buf.c_str(); }
+
+  bool concat(const String &str);
+  bool concat(const char *cstr);
+  bool concat(const char *cstr, unsigned int length);
+  bool concat(char c);
+  bool concat(unsigned char num);
+  bool concat(int num);
+  bool concat(unsigned int num);
+  bool concat(long num);
+  bool concat(unsigned long num);
+  bool concat(long long num);
+  bool concat(unsigned long long num);
+  bool concat(float num);
+  bool concat(double num);
+  template <typename T> String &operator+=(const T &rhs) {
+    concat(rhs);
+    return *this;
+  }
+
+  int compareTo(const String &s) const;
+  bool equals(const String &s) const { return buf == s.buf; }
+  bool equals(const char *cstr) const { return buf == (cstr ? cstr : ""); }
+  bool equalsIgnoreCase(const String &s) const;
+  bool operator==(const String &rhs) const { return equals(rhs); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String &rhs) const { return !equals(rhs); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+  bool operator<(const String &rhs) const { return compareTo(rhs) < 0; }
+  bool operator>(const String &rhs) const { return compareTo(rhs) > 0; }
+  bool operator<=(const String &rhs) const { return compareTo(rhs) <= 0; }
+  bool operator>=(const String &rhs) const { return compareTo(rhs) >= 0; }
+  bool startsWith(const String &prefix) const;
+  bool startsWith(const String &prefix, unsigned int offset) const;
+  bool endsWith(const String &suffix) const;
+
+  char charAt(unsigned int index) const;
+  void setCharAt(unsigned int index, char c);
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index);
+  void getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index = 0) const;
+  void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const {
+    getBytes((unsigned char*)buf, bufsize, index);
+  }
+  const char *begin() const { return c_str(); }
+  const char *end() const { return c_str() + length(); }
+
+  int indexOf(char ch, unsigned int fromIndex = 0) const;
+  int indexOf(const String &str, unsigned int fromIndex = 0) const;
+  int lastIndexOf(char ch) const;
+  int lastIndexOf(char ch, unsigned int fromIndex) const;
+  int lastIndexOf(const String &str) const;
+  int lastIndexOf(const String &str, unsigned int fromIndex) const;
+  String substring(unsigned int beginIndex) const { return substring(beginIndex, length()); }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+  void replace(char find, char replace);
+  void replace(const String &find, const String &replace);
+  void remove(unsigned int index);
+  void remove(unsigned int index, unsigned int count);
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+
+  long toInt() const;
+  float toFloat() const;
+  double toDouble() const;
+
+ private:
+  std::string buf;
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, char rhs);
+String operator+(const String &lhs, int rhs);
+String operator+(const String &lhs, unsigned int rhs);
+String operator+(const String &lhs, long rhs);
+String operator+(const String &lhs, unsigned long rhs);
+String operator+(const String &lhs, float rhs);
+String operator+(const String &lhs, double rhs);
+inline bool operator==(const char *lhs, const String &rhs) { return rhs == lhs; }
+inline bool operator!=(const char *lhs, const String &rhs) { return rhs != lhs; }
+
+#endif // String_class_h
@@ -0,0 +1,262 @@
+#include "WiFi.h"
+
+#include "../sim/sim_clock.h"
+#include "../sim/sim_net.h"
+#include "../sim/sim_tasks.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <vector>
+
+WiFiClass WiFi;
+
+// How long write() waits for room in the send window, as the core's
+// WIFI_CLIENT_SELECT_TIMEOUT_US.
+static const uint64_t WRITE_TIMEOUT_US = 1000000;
+
+// --- WiFiClient ---
+
+class WiFiClientSocketHandle {
+ public:
+  explicit WiFiClientSocketHandle(int fd) : sockfd(fd) {}
+  ~WiFiClientSocketHandle() { simNetClose(sockfd); }
+  int fd() const { return sockfd; }
+
+ private:
+  int sockfd;
+};
+
+static bool writable(void *fd) {
+  return simNetWritable((int)(intptr_t)fd);
+}
+
+WiFiClient::WiFiClient() : _connected(false) {}
+
+WiFiClient::WiFiClient(int fd) : clientSocketHandle(new WiFiClientSocketHandle(fd)), _connected(true) {}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) {
+  return connect(ip, port, 3000);
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeout_ms) {
+  stop();
+  int fd = simNetSocket(simNetDeviceAddr(), SOCK_STREAM);
+  if (fd < 0) return 0;
+  simNetConnect(fd, (uint32_t)ip, port);
+  simTaskWait(writable, (void*)(intptr_t)fd, simClockMicros() + timeout_ms * 1000ULL);
+  if (!simNetWritable(fd) || simNetError(fd) != 0) {
+    simNetClose(fd);
+    return 0;
+  }
+  clientSocketHandle.reset(new WiFiClientSocketHandle(fd));
+  _connected = true;
+  return 1;
+}
+
+size_t WiFiClient::write(uint8_t data) {
+  return write(&data, 1);
+}
+
+size_t WiFiClient::write(const uint8_t *buf, size_t size) {
+  if (!_connected || !clientSocketHandle) return 0;
+  int sock = fd();
+  size_t total = 0;
+  while (total < size) {
+    ssize_t n = simNetSend(sock, buf + total, size - total);
+    if (n > 0) {
+      total += n;
+      continue;
+    }
+    if (n < 0 && errno != EAGAIN) {
+      stop();
+      break;
+    }
+    if (!simTaskWait(writable, (void*)(intptr_t)sock, simClockMicros() + WRITE_TIMEOUT_US)) break;
+  }
+  return total;
+}
+
+int WiFiClient::available() {
+  if (!_connected || !clientSocketHandle) return 0;
+  return simNetAvailable(fd());
+}
+
+int WiFiClient::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t *buf, size_t size) {
+  if (!_connected || !clientSocketHandle) return -1;
+  ssize_t n = simNetRecv(fd(), buf, size, false);
+  if (n < 0) {
+    if (errno == EAGAIN) return 0;
+    stop();
+    return -1;
+  }
+  return (int)n;
+}
+
+int WiFiClient::peek() {
+  if (!_connected || !clientSocketHandle) return -1;
+  uint8_t c;
+  return simNetRecv(fd(), &c, 1, true) == 1 ? c : -1;
+}
+
+void WiFiClient::stop() {
+  clientSocketHandle.reset();
+  _connected = false;
+}
+
+uint8_t WiFiClient::connected() {
+  if (!_connected || !clientSocketHandle) return 0;
+  uint8_t dummy;
+  ssize_t n = simNetRecv(fd(), &dummy, 1, true);
+  if (n == 0) _connected = false;
+  else if (n < 0 && errno != EAGAIN) _connected = false;
+  return _connected;
+}
+
+int WiFiClient::fd() const {
+  return clientSocketHandle ? clientSocketHandle->fd() : -1;
+}
+
+IPAddress WiFiClient::remoteIP() const {
+  uint32_t addr = 0;
+  uint16_t port = 0;
+  if (clientSocketHandle) simNetPeer(fd(), &addr, &port);
+  return IPAddress(addr);
+}
+
+uint16_t WiFiClient::remotePort() const {
+  uint32_t addr = 0;
+  uint16_t port = 0;
+  if (clientSocketHandle) simNetPeer(fd(), &addr, &port);
+  return port;
+}
+
+// --- WiFiServer ---
+
+void WiFiServer::begin(uint16_t port) {
+  if (_sockfd >= 0) return;
+  if (port) _port = port;
+  int fd = simNetSocket(simNetDeviceAddr(), SOCK_STREAM);
+  if (fd < 0) return;
+  if (simNetBind(fd, 0, _port) < 0 || simNetListen(fd, _maxClients) < 0) {
+    simNetClose(fd);
+    return;
+  }
+  _sockfd = fd;
+}
+
+WiFiClient WiFiServer::available() {
+  if (_sockfd < 0) return WiFiClient();
+  int fd = simNetAccept(_sockfd, nullptr, nullptr);
+  if (fd < 0) return WiFiClient();
+  return WiFiClient(fd);
+}
+
+bool WiFiServer::hasClient() {
+  return _sockfd >= 0 && simNetReadable(_sockfd);
+}
+
+void WiFiServer::end() {
+  if (_sockfd < 0) return;
+  simNetClose(_sockfd);
+  _sockfd = -1;
+}
+
+// --- WiFiClass ---
+
+struct EventHandler {
+  WiFiEventCb cb;
+  arduino_event_id_t event;
+};
+
+static std::vector<EventHandler> handlers;
+
+// Runs where the link changed (a clock event or the disconnecting
+// task), standing in for the core's event task.
+static void raise(arduino_event_id_t event) {
+  for (const EventHandler &h : handlers) {
+    if (h.cb && (h.event == ARDUINO_EVENT_MAX || h.event == event)) h.cb(event);
+  }
+}
+
+void WiFiClass::linkChanged() {
+  if (simNetLinkUp()) {
+    raise(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+    raise(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  } else {
+    raise(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+  }
+}
+
+bool WiFiClass::mode(wifi_mode_t m) {
+  if (m == WIFI_MODE_NULL) disconnect();
+  _mode = m;
+  return true;
+}
+
+bool WiFiClass::config(IPAddress local_ip, IPAddress gateway, IPAddress subnet,
+                       IPAddress dns1, IPAddress dns2) {
+  (void)gateway; (void)subnet; (void)dns1; (void)dns2;
+  if ((uint32_t)local_ip != 0) simNetSetDeviceAddr(local_ip);
+  return true;
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase) {
+  (void)passphrase;
+  if (!ssid || !*ssid) return WL_CONNECT_FAILED;
+  if (_mode == WIFI_MODE_NULL) _mode = WIFI_MODE_STA;
+  _ssid = ssid;
+  _started = true;
+  simNetOnLinkChange(linkChanged);
+  simNetJoin();
+  return status();
+}
+
+bool WiFiClass::disconnect(bool wifioff, bool eraseap) {
+  (void)eraseap;
+  simNetLeave();
+  if (wifioff) _mode = WIFI_MODE_NULL;
+  return true;
+}
+
+bool WiFiClass::setAutoReconnect(bool autoReconnect) {
+  _autoReconnect = autoReconnect;
+  return true;
+}
+
+wl_status_t WiFiClass::status() {
+  if (simNetLinkUp()) return WL_CONNECTED;
+  return _started ? WL_DISCONNECTED : WL_IDLE_STATUS;
+}
+
+IPAddress WiFiClass::localIP() {
+  return IPAddress(simNetLinkUp() ? simNetDeviceAddr() : 0);
+}
+
+IPAddress WiFiClass::subnetMask() {
+  return IPAddress(255, 255, 255, 0);
+}
+
+IPAddress WiFiClass::gatewayIP() {
+  IPAddress gw(simNetDeviceAddr());
+  gw[3] = 1;
+  return gw;
+}
+
+IPAddress WiFiClass::broadcastIP() {
+  return IPAddress(simNetLinkUp() ? simNetBroadcastAddr() : 0);
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventCb cbEvent, arduino_event_id_t event) {
+  handlers.push_back({ cbEvent, event });
+  return handlers.size();
+}
+
+void WiFiClass::removeEvent(wifi_event_id_t id) {
+  if (id >= 1 && id <= handlers.size()) handlers[id - 1].cb = nullptr;
+}
@@ -0,0 +1,150 @@
+#ifndef WiFi_h
+#define WiFi_h
+
+#include <memory>
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+// WiFi station, TCP client and server of the ESP32 core, on the simulated
+// network (host/sim/sim_net.h). The simulated access point takes any
+// SSID and password.
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_MODE_NULL = 0,
+  WIFI_MODE_STA,
+  WIFI_MODE_AP,
+  WIFI_MODE_APSTA,
+  WIFI_MODE_MAX
+} wifi_mode_t;
+
+#define WIFI_OFF WIFI_MODE_NULL
+#define WIFI_STA WIFI_MODE_STA
+#define WIFI_AP WIFI_MODE_AP
+#define WIFI_AP_STA WIFI_MODE_APSTA
+
+typedef enum {
+  ARDUINO_EVENT_WIFI_READY = 0,
+  ARDUINO_EVENT_WIFI_SCAN_DONE,
+  ARDUINO_EVENT_WIFI_STA_START,
+  ARDUINO_EVENT_WIFI_STA_STOP,
+  ARDUINO_EVENT_WIFI_STA_CONNECTED,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+  ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP6,
+  ARDUINO_EVENT_WIFI_STA_LOST_IP,
+  ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef arduino_event_id_t WiFiEvent_t;
+typedef void (*WiFiEventCb)(WiFiEvent_t event);
+typedef size_t wifi_event_id_t;
+
+class WiFiClientSocketHandle;
+
+class WiFiClient : public Stream {
+ public:
+  WiFiClient();
+  explicit WiFiClient(int fd);
+
+  int connect(IPAddress ip, uint16_t port);
+  int connect(IPAddress ip, uint16_t port, int32_t timeout_ms);
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int read(uint8_t *buf, size_t size);
+  int peek() override;
+  void flush() override {}
+  void stop();
+  uint8_t connected();
+  int setNoDelay(bool nodelay) { (void)nodelay; return 0; }
+
+  int fd() const;
+  IPAddress remoteIP() const;
+  uint16_t remotePort() const;
+
+  operator bool() { return connected(); }
+  bool operator==(const WiFiClient &rhs) const { return clientSocketHandle == rhs.clientSocketHandle; }
+  bool operator!=(const WiFiClient &rhs) const { return !(*this == rhs); }
+
+ private:
+  // Shared by copies; the socket closes when the last copy lets go.
+  std::shared_ptr<WiFiClientSocketHandle> clientSocketHandle;
+  bool _connected;
+};
+
+class WiFiServer {
+ public:
+  explicit WiFiServer(uint16_t port = 80, uint8_t max_clients = 4)
+      : _port(port), _maxClients(max_clients) {}
+  ~WiFiServer() { end(); }
+
+  void begin(uint16_t port = 0);
+  // The next pending connection, or a client that is not connected.
+  WiFiClient available();
+  WiFiClient accept() { return available(); }
+  bool hasClient();
+  void setNoDelay(bool nodelay) { (void)nodelay; }
+  void end();
+  void stop() { end(); }
+  operator bool() { return _sockfd >= 0; }
+
+ private:
+  uint16_t _port;
+  uint8_t _maxClients;
+  int _sockfd = -1;
+};
+
+class WiFiClass {
+ public:
+  bool mode(wifi_mode_t m);
+  wifi_mode_t getMode() { return _mode; }
+  bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet,
+              IPAddress dns1 = (uint32_t)0, IPAddress dns2 = (uint32_t)0);
+  wl_status_t begin(const char *ssid, const char *passphrase = nullptr);
+  wl_status_t begin(const String &ssid, const String &passphrase = String()) {
+    return begin(ssid.c_str(), passphrase.c_str());
+  }
+  bool disconnect(bool wifioff = false, bool eraseap = false);
+  bool setAutoReconnect(bool autoReconnect);
+  bool getAutoReconnect() { return _autoReconnect; }
+  wl_status_t status();
+  bool isConnected() { return status() == WL_CONNECTED; }
+
+  IPAddress localIP();
+  IPAddress subnetMask();
+  IPAddress gatewayIP();
+  IPAddress broadcastIP();
+  String SSID() { return _ssid; }
+  int8_t RSSI() { return isConnected() ? -55 : 0; }
+  void setSleep(bool enabled) { (void)enabled; }
+
+  wifi_event_id_t onEvent(WiFiEventCb cbEvent, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+  void removeEvent(wifi_event_id_t id);
+
+ private:
+  static void linkChanged();
+
+  wifi_mode_t _mode = WIFI_MODE_NULL;
+  bool _autoReconnect = true;
+  bool _started = false;
+  String _ssid;
+};
+
+extern WiFiClass WiFi;
+
+#endif // WiFi_h
@@ -0,0 +1,94 @@
+#include "WiFiUdp.h"
+
+#include "../sim/sim_net.h"
+
+#include <sys/socket.h>
+
+// The largest datagram the core's receive buffer takes.
+static const size_t UDP_MAX = 1460;
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+  stop();
+  int fd = simNetSocket(simNetDeviceAddr(), SOCK_DGRAM);
+  if (fd < 0) return 0;
+  if (simNetBind(fd, 0, port) < 0) {
+    simNetClose(fd);
+    return 0;
+  }
+  _sockfd = fd;
+  return 1;
+}
+
+void WiFiUDP::stop() {
+  _tx.clear();
+  _rx.clear();
+  _rxPos = 0;
+  if (_sockfd < 0) return;
+  simNetClose(_sockfd);
+  _sockfd = -1;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+  // Like the core, sending works without begin(): it opens a socket on
+  // an ephemeral port.
+  if (_sockfd < 0 && !begin(0)) return 0;
+  _txAddr = (uint32_t)ip;
+  _txPort = port;
+  _tx.clear();
+  return 1;
+}
+
+int WiFiUDP::endPacket() {
+  if (_sockfd < 0) return 0;
+  ssize_t sent = simNetSendTo(_sockfd, _tx.data(), _tx.size(), _txAddr, _txPort);
+  _tx.clear();
+  return sent < 0 ? 0 : 1;
+}
+
+size_t WiFiUDP::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t WiFiUDP::write(const uint8_t *buffer, size_t size) {
+  if (_tx.size() + size > UDP_MAX) size = UDP_MAX - _tx.size();
+  _tx.append((const char *)buffer, size);
+  return size;
+}
+
+int WiFiUDP::parsePacket() {
+  _rx.clear();
+  _rxPos = 0;
+  if (_sockfd < 0 || !simNetReadable(_sockfd)) return 0;
+  char buf[UDP_MAX];
+  ssize_t n = simNetRecvFrom(_sockfd, buf, sizeof(buf), &_remoteAddr, &_remotePort);
+  if (n <= 0) return 0;
+  _rx.assign(buf, n);
+  return (int)n;
+}
+
+int WiFiUDP::available() {
+  return (int)(_rx.size() - _rxPos);
+}
+
+int WiFiUDP::read() {
+  if (_rxPos >= _rx.size()) return -1;
+  return (uint8_t)_rx[_rxPos++];
+}
+
+int WiFiUDP::read(unsigned char *buffer, size_t len) {
+  size_t n = _rx.size() - _rxPos;
+  if (n > len) n = len;
+  memcpy(buffer, _rx.data() + _rxPos, n);
+  _rxPos += n;
+  return (int)n;
+}
+
+int WiFiUDP::peek() {
+  if (_rxPos >= _rx.size()) return -1;
+  return (uint8_t)_rx[_rxPos];
+}
+
+void WiFiUDP::flush() {
+  _rx.clear();
+  _rxPos = 0;
+}
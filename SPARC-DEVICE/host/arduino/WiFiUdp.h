@@ -0,0 +1,51 @@
+#ifndef _WIFIUDP_H_
+#define _WIFIUDP_H_
+
+#include <string>
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+// The core's WiFiUDP on the simulated network (host/sim/sim_net.h): one
+// datagram socket on the device, a packet assembled between
+// beginPacket() and endPacket(), and the last packet parsePacket() took
+// in read back through the Stream calls.
+
+class WiFiUDP : public Stream {
+ public:
+  WiFiUDP() {}
+  ~WiFiUDP() { stop(); }
+
+  uint8_t begin(uint16_t port);
+  void stop();
+
+  int beginPacket(IPAddress ip, uint16_t port);
+  int endPacket();
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+
+  // Size of the next waiting packet, or 0; drops the one before it.
+  int parsePacket();
+  int available() override;
+  int read() override;
+  int read(unsigned char *buffer, size_t len);
+  int read(char *buffer, size_t len) { return read((unsigned char *)buffer, len); }
+  int peek() override;
+  void flush() override;
+
+  IPAddress remoteIP() { return IPAddress(_remoteAddr); }
+  uint16_t remotePort() { return _remotePort; }
+
+ private:
+  int _sockfd = -1;
+  uint32_t _txAddr = 0;
+  uint16_t _txPort = 0;
+  std::string _tx;
+  std::string _rx;
+  size_t _rxPos = 0;
+  uint32_t _remoteAddr = 0;
+  uint16_t _remotePort = 0;
+};
+
+#endif // _WIFIUDP_H_
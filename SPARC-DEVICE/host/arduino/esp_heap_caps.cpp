@@ -0,0 +1,103 @@
+#include "esp_heap_caps.h"
+
+#include <malloc.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+static size_t lowWater = SIZE_MAX;
+
+// Live blocks and bytes from operator new/delete, which is how the
+// firmware allocates; both deltas in STATUS come from these two.
+static std::atomic<size_t> liveBlocks(0);
+static std::atomic<size_t> liveBytes(0);
+
+static void *countedAlloc(size_t size) {
+  void *p = malloc(size ? size : 1);
+  if (!p) return nullptr;
+  liveBlocks++;
+  liveBytes += malloc_usable_size(p);
+  return p;
+}
+
+static void countedFree(void *p) {
+  if (!p) return;
+  liveBlocks--;
+  liveBytes -= malloc_usable_size(p);
+  free(p);
+}
+
+void *operator new(size_t size) {
+  void *p = countedAlloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void *operator new[](size_t size) {
+  return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  return countedAlloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  return countedAlloc(size);
+}
+
+void operator delete(void *p) noexcept {
+  countedFree(p);
+}
+
+void operator delete[](void *p) noexcept {
+  countedFree(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+  countedFree(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+  countedFree(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  countedFree(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  countedFree(p);
+}
+
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps) {
+  (void)caps;
+  struct mallinfo2 mi = mallinfo2();
+  info->total_free_bytes = mi.fordblks;
+  info->total_allocated_bytes = liveBytes;
+  // glibc grows its heap on demand, so the host's fragmentation says
+  // nothing about the board's: report the free space as one block.
+  info->largest_free_block = mi.fordblks;
+  if (mi.fordblks < lowWater) lowWater = mi.fordblks;
+  info->minimum_free_bytes = lowWater;
+  info->allocated_blocks = liveBlocks;
+  info->free_blocks = mi.ordblks;
+  info->total_blocks = mi.ordblks;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, caps);
+  return info.total_free_bytes;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, caps);
+  return info.minimum_free_bytes;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, caps);
+  return info.largest_free_block;
+}
@@ -0,0 +1,9 @@
+#include "esp_vfs_eventfd.h"
+
+esp_err_t esp_vfs_eventfd_register(const esp_vfs_eventfd_config_t *config) {
+  return config ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_vfs_eventfd_unregister(void) {
+  return ESP_OK;
+}
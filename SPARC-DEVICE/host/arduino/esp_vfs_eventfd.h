@@ -0,0 +1,23 @@
+#ifndef ESP_VFS_EVENTFD_H
+#define ESP_VFS_EVENTFD_H
+
+#include <stddef.h>
+#include <sys/eventfd.h>
+
+// eventfd() in the host build is the simulated network's
+// (host/sim/sim_net.h); there is no VFS to register with.
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef struct {
+  size_t max_fds;
+} esp_vfs_eventfd_config_t;
+
+#define ESP_VFS_EVENTD_CONFIG_DEFAULT() { .max_fds = 5 }
+
+esp_err_t esp_vfs_eventfd_register(const esp_vfs_eventfd_config_t *config);
+esp_err_t esp_vfs_eventfd_unregister(void);
+
+#endif // ESP_VFS_EVENTFD_H
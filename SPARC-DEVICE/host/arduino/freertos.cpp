@@ -0,0 +1,171 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+#include "../sim/sim_clock.h"
+#include "../sim/sim_tasks.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static uint64_t deadlineAfter(TickType_t ticks) {
+  if (ticks == portMAX_DELAY) return SIM_FOREVER;
+  return simClockMicros() + ticks * 1000ULL;
+}
+
+// --- Tasks ---
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                                   void *param, UBaseType_t priority, TaskHandle_t *created,
+                                   BaseType_t coreId) {
+  (void)stackDepth;
+  (void)coreId;
+  SimTask *task = simTaskCreate(fn, param, name, priority);
+  if (created) *created = task;
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                       void *param, UBaseType_t priority, TaskHandle_t *created) {
+  return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, created, 0);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  if (task && task != simTaskCurrent()) abort();
+  simTaskDelete();
+}
+
+void vTaskDelay(TickType_t ticks) {
+  simTaskSleepUntil(deadlineAfter(ticks));
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)simClockMillis();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return simTaskCurrent();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait) {
+  return simTaskNotifyTake(clearOnExit != pdFALSE, deadlineAfter(ticksToWait));
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  simTaskNotify(task);
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken) {
+  simTaskNotify(task);
+  if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+}
+
+// --- Queues ---
+// A ring of fixed-size items. Only one task runs at a time, so no lock.
+
+struct SimQueue {
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  UBaseType_t head;
+  UBaseType_t count;
+  uint8_t *items;
+};
+
+static bool hasItem(void *arg) {
+  return ((SimQueue*)arg)->count > 0;
+}
+
+static bool hasRoom(void *arg) {
+  SimQueue *q = (SimQueue*)arg;
+  return q->count < q->length;
+}
+
+static uint8_t *slot(SimQueue *q, UBaseType_t i) {
+  return q->items + ((q->head + i) % q->length) * q->itemSize;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  if (length == 0) return nullptr;
+  SimQueue *q = new SimQueue();
+  q->length = length;
+  q->itemSize = itemSize;
+  q->items = new uint8_t[length * itemSize];
+  return q;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+  if (!q) return;
+  delete[] q->items;
+  delete q;
+}
+
+static BaseType_t send(SimQueue *q, const void *item, TickType_t ticks, bool front) {
+  if (!hasRoom(q) && (ticks == 0 || !simTaskWait(hasRoom, q, deadlineAfter(ticks)))) {
+    return errQUEUE_FULL;
+  }
+  if (front) {
+    q->head = (q->head + q->length - 1) % q->length;
+    memcpy(slot(q, 0), item, q->itemSize);
+  } else {
+    memcpy(slot(q, q->count), item, q->itemSize);
+  }
+  q->count++;
+  return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks) {
+  return send(q, item, ticks, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t q, const void *item, TickType_t ticks) {
+  return send(q, item, ticks, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t q, const void *item, TickType_t ticks) {
+  return send(q, item, ticks, true);
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *higherPriorityTaskWoken) {
+  if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+  return send(q, item, 0, false);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t q, const void *item) {
+  q->count = 0;
+  return send(q, item, 0, false);
+}
+
+static BaseType_t receive(SimQueue *q, void *item, TickType_t ticks, bool remove) {
+  if (!hasItem(q) && (ticks == 0 || !simTaskWait(hasItem, q, deadlineAfter(ticks)))) {
+    return pdFALSE;
+  }
+  memcpy(item, slot(q, 0), q->itemSize);
+  if (remove) {
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+  }
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks) {
+  return receive(q, item, ticks, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t ticks) {
+  return receive(q, item, ticks, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+  return q->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q) {
+  return q->length - q->count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t q) {
+  q->head = 0;
+  q->count = 0;
+  return pdPASS;
+}
@@ -0,0 +1,30 @@
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+// FreeRTOS types for the host build, on top of host/sim/sim_tasks.h.
+// One tick is one millisecond of virtual time, as configured on the
+// board.
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define errQUEUE_EMPTY ((BaseType_t)0)
+#define errQUEUE_FULL ((BaseType_t)0)
+
+#define portMAX_DELAY ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(xTimeInMs) ((TickType_t)(((TickType_t)(xTimeInMs) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000U))
+
+// Tasks only switch where they wait, so there is nothing to yield to
+// from an ISR.
+#define portYIELD_FROM_ISR(...) do {} while (0)
+
+#endif // INC_FREERTOS_H
@@ -0,0 +1,27 @@
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+struct SimTask;
+typedef SimTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+// Stack size and core are ignored: host threads have their own stacks
+// and only one task runs at a time.
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                                   void *param, UBaseType_t priority, TaskHandle_t *created,
+                                   BaseType_t coreId);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth,
+                       void *param, UBaseType_t priority, TaskHandle_t *created);
+// Only a task deleting itself (NULL), which is all the firmware does.
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken);
+
+#endif // INC_TASK_H
@@ -0,0 +1,15 @@
+#ifndef LWIP_HDR_SOCKETS_H
+#define LWIP_HDR_SOCKETS_H
+
+// The BSD socket API of lwIP. The host build uses the host's headers;
+// the calls themselves land in the simulated network (host/sim/sim_net.h).
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#endif // LWIP_HDR_SOCKETS_H
@@ -0,0 +1,22 @@
+#include "Arduino.h"
+
+#include "../sim/sim_clock.h"
+#include "../sim/sim_tasks.h"
+
+// The core's main.cpp: setup() once, then loop() for ever, on the
+// loopTask at the priority the board gives it.
+static const unsigned LOOP_TASK_PRIORITY = 1;
+
+static void loopTask(void*) {
+  setup();
+  for (;;) {
+    loop();
+    // On the board loop() spins. Here the clock only moves while every
+    // task waits, so each pass waits for the next 1 ms tick.
+    simTaskSleepUntil((simClockMillis() + 1) * 1000ULL);
+  }
+}
+
+void arduinoLoopTaskStart() {
+  simTaskCreate(loopTask, nullptr, "loopTask", LOOP_TASK_PRIORITY);
+}
@@ -0,0 +1,332 @@
+#include "bench_peers.h"
+
+#include "../sim/sim_clock.h"
+#include "../sim/sim_net.h"
+#include "../sim/sim_tasks.h"
+#include "../../src/network/link_protocol.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+
+static const uint16_t DISCOVERY_PORT = 45455;
+static const uint16_t CLIENT_PORT = 45454;
+static const unsigned long SERVER_BEACON_MS = 2000;
+static const unsigned long RETRY_MS = 1000;
+static const unsigned PC_PRIORITY = 1;
+
+static bool serverOn = false;
+static bool clientOn = false;
+static BenchPeerStats stats;
+static std::vector<BenchBlink> blinks;
+static std::vector<BenchAlert> alerts;
+
+// --- Notification server ---
+
+struct HttpConn {
+  int fd;
+  std::string rx;
+};
+
+static int udpFd = -1;
+static uint64_t nextBeaconUs = 0;
+static uint32_t deviceAddr = 0;     // from the device's beacon
+static uint16_t deviceNotifyPort = 0;
+static int regFd = -1;
+static bool regConnecting = false;
+static uint64_t regRetryUs = 0;
+static int httpFd = -1;
+static std::vector<HttpConn> conns;
+
+// --- Desktop client ---
+
+static int clientFd = -1;
+static bool clientConnecting = false;
+static uint64_t clientRetryUs = 0;
+static std::string clientConfig;
+static uint8_t clientRx[1024];
+static size_t clientRxLen = 0;
+
+uint32_t benchPcAddr() {
+  return (simNetDeviceAddr() & htonl(0xFFFFFF00)) | htonl(10);
+}
+
+const std::vector<BenchBlink> &benchBlinks() {
+  return blinks;
+}
+
+const std::vector<BenchAlert> &benchAlerts() {
+  return alerts;
+}
+
+const BenchPeerStats &benchPeerStats() {
+  return stats;
+}
+
+const std::string &benchClientConfig() {
+  return clientConfig;
+}
+
+static void sendBeacon(uint32_t addr) {
+  char msg[32];
+  int n = snprintf(msg, sizeof(msg), "SPARC-NOTIFY 1 %u", BENCH_HTTP_PORT);
+  simNetSendTo(udpFd, msg, n, addr, DISCOVERY_PORT);
+}
+
+// server.py's ServerAnnouncer: a beacon every 2 s, an answer to every
+// DISCOVER, and the device's own beacons noted for the hardware check.
+static void pollDiscovery() {
+  char buf[128];
+  uint32_t from;
+  uint16_t port;
+  ssize_t n;
+  while ((n = simNetRecvFrom(udpFd, buf, sizeof(buf) - 1, &from, &port)) >= 0) {
+    buf[n] = '\0';
+    unsigned clientPort, notifyPort;
+    if (sscanf(buf, "SPARC-DEVICE 1 %*s %u %u", &clientPort, &notifyPort) == 2) {
+      stats.deviceBeacons++;
+      deviceAddr = from;
+      deviceNotifyPort = (uint16_t)notifyPort;
+    } else if (strcmp(buf, "SPARC-DISCOVER 1") == 0) {
+      stats.discovers++;
+      sendBeacon(from);
+    }
+  }
+  if (simClockMicros() >= nextBeaconUs) {
+    sendBeacon(simNetBroadcastAddr());
+    nextBeaconUs = simClockMicros() + SERVER_BEACON_MS * 1000ULL;
+  }
+}
+
+// server.py's hardware check: once the device has announced itself,
+// connect to its notify port and hang up. The device keeps the address
+// it was called from and answers a line; the call counts once that line
+// is in.
+static void pollRegister() {
+  if (stats.registered || !deviceAddr) return;
+  if (regFd < 0) {
+    if (simClockMicros() < regRetryUs) return;
+    regFd = simNetSocket(benchPcAddr(), SOCK_STREAM);
+    simNetConnect(regFd, deviceAddr, deviceNotifyPort);
+    regConnecting = true;
+    return;
+  }
+  if (regConnecting) {
+    if (!simNetWritable(regFd)) return;
+    regConnecting = false;
+    if (simNetError(regFd) == 0) return;
+  } else {
+    if (!simNetReadable(regFd)) return;
+    // A reset (the device's WiFi restarting) is no answer: call again.
+    char buf[64];
+    stats.registered = simNetRecv(regFd, buf, sizeof(buf), false) > 0;
+  }
+  simNetClose(regFd);
+  regFd = -1;
+  regRetryUs = simClockMicros() + RETRY_MS * 1000ULL;
+}
+
+static void logAlert(const char *query) {
+  const char *type = strstr(query, "type=");
+  if (!type) return;
+  type += 5;
+  BenchAlert a;
+  size_t len = strcspn(type, "& \n");
+  if (len >= sizeof(a.type)) len = sizeof(a.type) - 1;
+  memcpy(a.type, type, len);
+  a.type[len] = '\0';
+  a.atUs = simClockMicros();
+  alerts.push_back(a);
+}
+
+// One complete request at the front of c.rx, if there is one: log its
+// alerts (one, or a line each for /batch) and answer 200. Returns false when there is none yet, or when
+// the request asked for the connection to be closed after it.
+static bool handleRequest(HttpConn &c, bool *close) {
+  size_t headerEnd = c.rx.find("\r\n\r\n");
+  if (headerEnd == std::string::npos) return false;
+  size_t bodyLen = 0;
+  size_t cl = c.rx.find("Content-Length:");
+  if (cl != std::string::npos && cl < headerEnd) bodyLen = strtoul(c.rx.c_str() + cl + 15, nullptr, 10);
+  size_t total = headerEnd + 4 + bodyLen;
+  if (c.rx.size() < total) return false;
+
+  std::string requestLine = c.rx.substr(0, c.rx.find("\r\n"));
+  if (requestLine.compare(0, 11, "POST /batch") == 0) {
+    std::string body = c.rx.substr(headerEnd + 4, bodyLen);
+    size_t start = 0;
+    while (start < body.size()) {
+      size_t end = body.find('\n', start);
+      if (end == std::string::npos) end = body.size();
+      logAlert(body.substr(start, end - start).c_str());
+      start = end + 1;
+    }
+  } else {
+    logAlert(requestLine.c_str());
+  }
+  size_t conn = c.rx.find("Connection: close");
+  *close = conn != std::string::npos && conn < headerEnd;
+  stats.httpRequests++;
+  c.rx.erase(0, total);
+
+  static const char reply[] = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+  simNetSend(c.fd, reply, sizeof(reply) - 1);
+  return !*close;
+}
+
+static void pollHttp() {
+  int fd;
+  while ((fd = simNetAccept(httpFd, nullptr, nullptr)) >= 0) {
+    conns.push_back({ fd, std::string() });
+    stats.httpConnections++;
+  }
+  for (size_t i = 0; i < conns.size();) {
+    HttpConn &c = conns[i];
+    char buf[512];
+    ssize_t n;
+    bool close = false;
+    while ((n = simNetRecv(c.fd, buf, sizeof(buf), false)) > 0) c.rx.append(buf, n);
+    while (handleRequest(c, &close)) {}
+    if (close || n == 0 || (n < 0 && errno != EAGAIN)) {
+      simNetClose(c.fd);
+      conns.erase(conns.begin() + i);
+      continue;
+    }
+    i++;
+  }
+}
+
+static void clientSend(uint8_t type, uint16_t seq, const uint8_t *payload, uint16_t len) {
+  uint8_t frame[LINK_MAX_FRAME];
+  size_t n = linkEncodeFrame(frame, type, seq, payload, len);
+  simNetSend(clientFd, frame, n);
+}
+
+static void clientDrop() {
+  simNetClose(clientFd);
+  clientFd = -1;
+  clientConnecting = false;
+  stats.clientReady = false;
+  clientRetryUs = simClockMicros() + RETRY_MS * 1000ULL;
+}
+
+// CONFIG, kept as "duration;gap;userId;ssid" for the report.
+static void clientConfigFrame(const LinkFrame &f) {
+  if (f.len < 4) return;
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u;%u", linkGet16(f.payload), linkGet16(f.payload + 2));
+  clientConfig = buf;
+  size_t at = 4;
+  for (int i = 0; i < 2 && at < f.len; i++) {
+    uint8_t len = f.payload[at++];
+    if (at + len > f.len) break;
+    clientConfig += ';';
+    clientConfig.append((const char *)f.payload + at, len);
+    at += len;
+  }
+  stats.clientReady = true;
+}
+
+static void clientFrame(const LinkFrame &f) {
+  switch (f.type) {
+    case LF_CONFIG:
+      clientConfigFrame(f);
+      break;
+    case LF_BLINK:
+      // Gestures number 1, 2 and 4 as on the legacy link.
+      if (f.len >= 5) blinks.push_back({ f.payload[0], simClockMicros() });
+      clientSend(LF_ACK, f.seq, nullptr, 0);
+      break;
+    default:
+      break;
+  }
+}
+
+// The desktop client on the binary protocol: "SPRC", a HELLO with no
+// previous session, then frames.
+static void pollClient() {
+  if (clientFd < 0) {
+    if ((serverOn && !stats.registered) || simClockMicros() < clientRetryUs) return;
+    clientFd = simNetSocket(benchPcAddr(), SOCK_STREAM);
+    simNetConnect(clientFd, simNetDeviceAddr(), CLIENT_PORT);
+    clientConnecting = true;
+    clientRxLen = 0;
+    return;
+  }
+  if (clientConnecting) {
+    if (!simNetWritable(clientFd)) return;
+    if (simNetError(clientFd) != 0) {
+      clientDrop();
+      return;
+    }
+    clientConnecting = false;
+    stats.clientConnects++;
+    uint8_t hello[7] = { LINK_VERSION };
+    simNetSend(clientFd, LINK_MAGIC, sizeof(LINK_MAGIC));
+    clientSend(LF_HELLO, 0, hello, sizeof(hello));
+  }
+  ssize_t n;
+  while ((n = simNetRecv(clientFd, clientRx + clientRxLen, sizeof(clientRx) - clientRxLen, false)) > 0) {
+    clientRxLen += n;
+    LinkFrame f;
+    int used;
+    while ((used = linkDecodeFrame(clientRx, clientRxLen, f)) > 0) {
+      clientFrame(f);
+      memmove(clientRx, clientRx + used, clientRxLen - used);
+      clientRxLen -= used;
+    }
+    if (used < 0) {
+      clientDrop();
+      return;
+    }
+  }
+  if (n == 0 || (n < 0 && errno != EAGAIN)) clientDrop();
+}
+
+static bool pcReady(void*) {
+  if (udpFd >= 0 && simNetReadable(udpFd)) return true;
+  if (regFd >= 0 && (regConnecting ? simNetWritable(regFd) : simNetReadable(regFd))) return true;
+  if (httpFd >= 0 && simNetReadable(httpFd)) return true;
+  for (const HttpConn &c : conns) {
+    if (simNetReadable(c.fd)) return true;
+  }
+  if (clientFd >= 0 && (clientConnecting ? simNetWritable(clientFd) : simNetReadable(clientFd))) return true;
+  // benchClientStart() was called while the task waited.
+  if (clientOn && clientFd < 0 && (!serverOn || stats.registered) && simClockMicros() >= clientRetryUs) return true;
+  return false;
+}
+
+static void pcTask(void*) {
+  for (;;) {
+    uint64_t wake = SIM_FOREVER;
+    if (serverOn) wake = nextBeaconUs;
+    if (serverOn && !stats.registered && deviceAddr && regFd < 0 && regRetryUs < wake) wake = regRetryUs;
+    if (clientOn && clientFd < 0 && (!serverOn || stats.registered) && clientRetryUs < wake) wake = clientRetryUs;
+    simTaskWait(pcReady, nullptr, wake);
+    if (serverOn) {
+      pollDiscovery();
+      pollRegister();
+      pollHttp();
+    }
+    if (clientOn) pollClient();
+  }
+}
+
+void benchPeersStart(bool server) {
+  serverOn = server;
+  if (serverOn) {
+    udpFd = simNetSocket(benchPcAddr(), SOCK_DGRAM);
+    simNetBind(udpFd, 0, DISCOVERY_PORT);
+    httpFd = simNetSocket(benchPcAddr(), SOCK_STREAM);
+    simNetBind(httpFd, 0, BENCH_HTTP_PORT);
+    simNetListen(httpFd, 4);
+  }
+  simTaskCreate(pcTask, nullptr, "pc", PC_PRIORITY);
+}
+
+void benchClientStart() {
+  clientOn = true;
+}
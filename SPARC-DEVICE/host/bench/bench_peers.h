@@ -0,0 +1,52 @@
+#ifndef BENCH_PEERS_H
+#define BENCH_PEERS_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// The PC side of a bench run, on the simulated network: the
+// notification server (notif-server/server.py: it finds the device and
+// makes itself known through UDP discovery on port 45455, then takes
+// alerts as HTTP POSTs) and a desktop client on the 45454 binary link.
+// Both run as one low priority task and log when things reach them, in
+// virtual time.
+
+static const uint16_t BENCH_HTTP_PORT = 8080;
+
+struct BenchBlink {
+  uint8_t blinks;  // the BLINK frame's gesture: 1, 2 or 4
+  uint64_t atUs;
+};
+
+struct BenchAlert {
+  char type[16];
+  uint64_t atUs;
+};
+
+struct BenchPeerStats {
+  uint32_t deviceBeacons;
+  uint32_t discovers;      // DISCOVER requests answered
+  bool registered;         // the device took the server's hardware check call
+  uint32_t httpRequests;
+  uint32_t httpConnections;
+  uint32_t clientConnects;
+  bool clientReady;        // CONFIG received on the current connection
+};
+
+// On the device's subnet, so only valid once WiFi.config() has run.
+uint32_t benchPcAddr();
+// Start the PC task, with the notification server if `server`.
+void benchPeersStart(bool server);
+// Connect the desktop client, once the server has registered: the
+// device only takes registrations while no client is connected, and
+// runs its own GUI until one is.
+void benchClientStart();
+
+const std::vector<BenchBlink> &benchBlinks();
+const std::vector<BenchAlert> &benchAlerts();
+const BenchPeerStats &benchPeerStats();
+// The CONFIG frame the client got, as "duration;gap;userId;ssid".
+const std::string &benchClientConfig();
+
+#endif // BENCH_PEERS_H
@@ -0,0 +1,371 @@
+// Benchmark driver for the host build: boots the firmware on the
+// simulated board, blinks scripted gestures at the IR sensor and reports
+// how long each one took to reach the PC client, what every task's loop
+// costs in host time, and how much the display, network and audio did.
+// Everything runs in virtual time, so a run is repeatable and the
+// numbers do not depend on the machine, except the host ns per task.
+//
+// Exits non-zero if the device missed or misread a gesture or the
+// emergency alert, so it can gate CI.
+
+#include "bench_peers.h"
+
+#include "../sim/sim_audio.h"
+#include "../sim/sim_clock.h"
+#include "../sim/sim_console.h"
+#include "../sim/sim_display.h"
+#include "../sim/sim_gpio.h"
+#include "../sim/sim_net.h"
+#include "../sim/sim_tasks.h"
+#include "../../include/common_variables.h"
+
+#include <EEPROM.h>
+#include <Preferences.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// --- Options ---
+
+static unsigned rounds = 10;          // letters typed, then single/double cycles
+static unsigned idleSeconds = 60;
+static uint32_t latencyUs = 2000;
+static bool echo = false;
+static const char *ppmPath = nullptr;
+
+static const unsigned BENCH_PRIORITY = 10;  // above every firmware task
+static const uint64_t BOOT_TIMEOUT_US = 60000000ULL;
+static const uint64_t ARRIVAL_TIMEOUT_US = 3000000ULL;
+
+// Blink shape: eye closed for BLINK_CLOSED_MS, open BLINK_OPEN_MS between
+// the blinks of one gesture. Long enough for blinkDuration (400 ms) and
+// well inside blinkGap (1200 ms).
+static const uint32_t BLINK_CLOSED_MS = 500;
+static const uint32_t BLINK_OPEN_MS = 300;
+static const uint32_t GESTURE_PAUSE_MS = 2000;  // eye open between gestures
+static const char *BENCH_USER_ID = "A1B2C";
+static const int USERID_ADDR = 140;    // settings.cpp
+static const int EEPROM_SIZE = 200;
+
+// --- Console capture ---
+
+static std::vector<std::string> bootLines;
+
+static std::vector<std::string> statusLines;
+static bool capturingStatus = false;
+
+static void onConsoleLine(const char *line) {
+  if (strncmp(line, "[BOOT] ", 7) == 0) bootLines.push_back(line + 7);
+  if (capturingStatus) statusLines.push_back(line);
+}
+
+// --- Latency samples ---
+
+struct Sample {
+  unsigned blinks;
+  uint64_t decidableUs;  // when the classifier could first know
+};
+
+struct LatencyStats {
+  uint32_t count = 0;
+  uint64_t minUs = UINT64_MAX;
+  uint64_t maxUs = 0;
+  uint64_t sumUs = 0;
+
+  void add(uint64_t us) {
+    count++;
+    sumUs += us;
+    if (us < minUs) minUs = us;
+    if (us > maxUs) maxUs = us;
+  }
+};
+
+static std::vector<Sample> expected;
+static LatencyStats gestureLatency;
+static LatencyStats alertLatency;
+static unsigned failures = 0;
+
+static void fail(const char *what) {
+  printf("FAIL: %s\n", what);
+  failures++;
+}
+
+static uint64_t nowUs() {
+  return simClockMicros();
+}
+
+static void sleepMs(uint32_t ms) {
+  simTaskSleepUntil(nowUs() + ms * 1000ULL);
+}
+
+static bool linkUp(void*) {
+  return simNetLinkUp();
+}
+
+static bool registered(void*) {
+  return benchPeerStats().registered;
+}
+
+static bool clientReady(void*) {
+  return benchPeerStats().clientReady;
+}
+
+static bool blinksArrived(void *count) {
+  return benchBlinks().size() >= *(size_t*)count;
+}
+
+static bool alertsArrived(void *count) {
+  return benchAlerts().size() >= *(size_t*)count;
+}
+
+// Blink `count` times; returns when the eye opened for the last time.
+static uint64_t blink(unsigned count) {
+  uint64_t openedUs = 0;
+  for (unsigned i = 0; i < count; i++) {
+    if (i > 0) sleepMs(BLINK_OPEN_MS);
+    simGpioDrive(SIM_PIN_IR_SENSOR, 0);  // reads LOW while the eye is closed
+    sleepMs(BLINK_CLOSED_MS);
+    simGpioDrive(SIM_PIN_IR_SENSOR, 1);
+    openedUs = nowUs();
+  }
+  return openedUs;
+}
+
+// Typing on the T9 grid, before the client connects and the device
+// leaves its GUI. Each round moves the highlight to the next letter
+// cell (0-8; 9-11 hold alerts, digits and nothing), opens its popup,
+// steps once and picks the second character.
+static unsigned guiCell = 0;
+
+static void guiGesture(unsigned blinks) {
+  blink(blinks);
+  sleepMs(blinkGap + GESTURE_PAUSE_MS);
+}
+
+static void runGuiRound(unsigned r) {
+  unsigned target = (r + 1) % 9;
+  while (guiCell != target) {
+    guiGesture(1);
+    guiCell = (guiCell + 1) % 12;
+  }
+  guiGesture(2);
+  guiGesture(1);
+  guiGesture(2);
+}
+
+static const char *gestureName(unsigned blinks) {
+  switch (blinks) {
+    case 1: return "single";
+    case 2: return "double";
+    case 4: return "emergency";
+    default: return "unknown";
+  }
+}
+
+// Blink a gesture and wait for the PC client to receive it.
+static void runGesture(unsigned blinks) {
+  uint64_t openedUs = blink(blinks);
+  // Reported once the eye has stayed open for blinkGap.
+  uint64_t decidableUs = openedUs + blinkGap * 1000ULL;
+  expected.push_back({ blinks, decidableUs });
+
+  size_t want = expected.size();
+  simTaskWait(blinksArrived, &want, decidableUs + ARRIVAL_TIMEOUT_US);
+  if (benchBlinks().size() < want) {
+    char msg[64];
+    snprintf(msg, sizeof(msg), "%s gesture never reached the client", gestureName(blinks));
+    fail(msg);
+    // Keep later gestures lined up with their samples.
+    expected.pop_back();
+    return;
+  }
+  const BenchBlink &b = benchBlinks()[want - 1];
+  if (b.blinks != blinks) {
+    char msg[64];
+    snprintf(msg, sizeof(msg), "sent %s, client got %s", gestureName(blinks), gestureName(b.blinks));
+    fail(msg);
+  }
+  gestureLatency.add(b.atUs - decidableUs);
+  sleepMs(GESTURE_PAUSE_MS);
+}
+
+// Four blinks raise the alert, on the 4th opening; the device then
+// flashes until the button is pressed.
+static void runEmergency() {
+  size_t want = benchAlerts().size() + 1;
+  uint64_t raisedUs = blink(4);
+  simTaskWait(alertsArrived, &want, raisedUs + ARRIVAL_TIMEOUT_US);
+  if (benchAlerts().size() < want) {
+    fail("EMERGENCY notification never reached the server");
+  } else {
+    const BenchAlert &a = benchAlerts()[want - 1];
+    if (strcmp(a.type, "EMERGENCY") != 0) fail("first alert after the quad is not EMERGENCY");
+    alertLatency.add(a.atUs - raisedUs);
+  }
+
+  sleepMs(1000);
+  uint32_t ledToggles = simGpioToggles(SIM_PIN_EMERGENCY_LED);
+  simGpioDrive(SIM_PIN_EMERGENCY_BUTTON, 1);
+  sleepMs(100);
+  simGpioDrive(SIM_PIN_EMERGENCY_BUTTON, 0);
+  if (ledToggles == 0) fail("emergency LED never flashed");
+  sleepMs(GESTURE_PAUSE_MS);
+  // Whatever the client got for the quad is not a sample.
+  while (expected.size() < benchBlinks().size()) expected.push_back({ 0, 0 });
+}
+
+static void printLatency(const char *name, const LatencyStats &s) {
+  if (s.count == 0) {
+    printf("  %-10s none\n", name);
+    return;
+  }
+  printf("  %-10s n=%-4u min %6.1f ms  mean %6.1f ms  max %6.1f ms\n", name, s.count,
+         s.minUs / 1000.0, s.sumUs / 1000.0 / s.count, s.maxUs / 1000.0);
+}
+
+static void printTasks() {
+  SimTaskStats tasks[16];
+  int n = simTaskStats(tasks, 16);
+  if (n > 16) n = 16;
+  printf("Task loop cost (host time):\n");
+  for (int i = 0; i < n; i++) {
+    const SimTaskStats &t = tasks[i];
+    printf("  %-8s prio %2u  runs %8u  mean %8.0f ns  max %9llu ns  total %8.1f ms\n", t.name, t.priority, t.runs,
+           t.runs ? (double)t.hostNs / t.runs : 0.0, (unsigned long long)t.maxRunNs, t.hostNs / 1e6);
+  }
+}
+
+static void usage(const char *argv0) {
+  printf("Usage: %s [options]\n"
+         "  --rounds N       letters to type, then single/double cycles to blink (default %u)\n"
+         "  --seconds N      idle time at the end, virtual seconds (default %u)\n"
+         "  --latency-us N   one-way network latency (default %u)\n"
+         "  --ppm PATH       save the final screen as a PPM image\n"
+         "  --echo           echo the device console to stdout\n",
+         argv0, rounds, idleSeconds, latencyUs);
+}
+
+static bool parseArgs(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (strcmp(arg, "--rounds") == 0 && hasValue) rounds = strtoul(argv[++i], nullptr, 10);
+    else if (strcmp(arg, "--seconds") == 0 && hasValue) idleSeconds = strtoul(argv[++i], nullptr, 10);
+    else if (strcmp(arg, "--latency-us") == 0 && hasValue) latencyUs = strtoul(argv[++i], nullptr, 10);
+    else if (strcmp(arg, "--ppm") == 0 && hasValue) ppmPath = argv[++i];
+    else if (strcmp(arg, "--echo") == 0) echo = true;
+    else {
+      usage(argv[0]);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Flash contents a provisioned device would have: WiFi credentials and
+// a user id, so boot goes straight to the network.
+static void provision() {
+  Preferences prefs;
+  prefs.begin("blinkcfg", false);
+  prefs.putString("ssid", "bench");
+  prefs.putString("pass", "benchpass");
+  prefs.end();
+
+  EEPROM.begin(EEPROM_SIZE);
+  for (int i = 0; i <= 5; i++) EEPROM.write(USERID_ADDR + i, BENCH_USER_ID[i]);
+  EEPROM.commit();
+  EEPROM.end();
+}
+
+int main(int argc, char **argv) {
+  if (!parseArgs(argc, argv)) return 2;
+
+  simTaskAdopt("bench", BENCH_PRIORITY);
+  simConsoleEcho(echo);
+  simConsoleOnLine(onConsoleLine);
+  simNetSetLatencyUs(latencyUs);
+  simGpioDrive(SIM_PIN_IR_SENSOR, 1);  // eye open
+  provision();
+
+  arduinoLoopTaskStart();
+  simTaskWait(linkUp, nullptr, BOOT_TIMEOUT_US);
+  benchPeersStart(true);
+  simTaskWait(registered, nullptr, BOOT_TIMEOUT_US);
+  if (!benchPeerStats().registered) {
+    fail("the device never took the server's registration");
+    fflush(stdout);
+    _exit(1);
+  }
+  printf("Boot (virtual time):\n");
+  for (const std::string &line : bootLines) printf("  %s\n", line.c_str());
+  printf("  server registered at %llu ms\n", (unsigned long long)(nowUs() / 1000));
+
+  simDisplayResetStats();
+  for (unsigned r = 0; r < rounds; r++) runGuiRound(r);
+  SimDisplayStats gui = simDisplayStats();
+
+  benchClientStart();
+  simTaskWait(clientReady, nullptr, nowUs() + BOOT_TIMEOUT_US);
+  if (!benchPeerStats().clientReady) {
+    fail("the PC client never got the CONFIG frame");
+    fflush(stdout);
+    _exit(1);
+  }
+  printf("  client link up at %llu ms, config \"%s\"\n", (unsigned long long)(nowUs() / 1000),
+         benchClientConfig().c_str());
+
+  simTaskResetStats();
+  simDisplayResetStats();
+  uint64_t startUs = nowUs();
+  auto hostStart = std::chrono::steady_clock::now();
+
+  for (unsigned r = 0; r < rounds; r++) {
+    runGesture(1);
+    runGesture(2);
+  }
+  runEmergency();
+  sleepMs(idleSeconds * 1000);
+
+  capturingStatus = true;
+  simConsoleInput("STATUS\n");
+  sleepMs(100);
+  capturingStatus = false;
+
+  double hostMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - hostStart).count();
+  double virtualMs = (nowUs() - startUs) / 1000.0;
+
+  printf("Gesture latency (decidable -> PC client, virtual time):\n");
+  printLatency("gestures", gestureLatency);
+  printLatency("emergency", alertLatency);
+  printTasks();
+
+  const SimDisplayStats &d = simDisplayStats();
+  const SimNetStats &n = simNetStats();
+  const SimAudioStats &a = simAudioStats();
+  const BenchPeerStats &p = benchPeerStats();
+  printf("GUI typing, %u rounds: %u draws, %llu pixels, %u DMA pushes (%llu bytes)\n", rounds, gui.draws,
+         (unsigned long long)gui.pixels, gui.dmaPushes, (unsigned long long)gui.dmaBytes);
+  printf("Display: %u draws, %llu pixels, %u DMA pushes (%llu bytes)\n", d.draws, (unsigned long long)d.pixels,
+         d.dmaPushes, (unsigned long long)d.dmaBytes);
+  printf("Network: %llu TCP bytes, %u datagrams, %u connects, %u refused\n", (unsigned long long)n.tcpBytes,
+         n.datagrams, n.connects, n.refused);
+  printf("PC: %s, %u device beacons, %u discovers, %u HTTP requests on %u connections, %u client connects\n",
+         p.registered ? "registered" : "not registered", p.deviceBeacons, p.discovers, p.httpRequests,
+         p.httpConnections, p.clientConnects);
+  printf("Audio: %u plays, %u cut short\n", a.plays, a.interrupted);
+  printf("Device STATUS:\n");
+  for (const std::string &line : statusLines) printf("  %s\n", line.c_str());
+  printf("Ran %.1f s of virtual time in %.1f ms of host time (%.0fx)\n", virtualMs / 1000.0, hostMs,
+         hostMs > 0 ? virtualMs / hostMs : 0.0);
+
+  if (ppmPath && !simDisplaySavePpm(ppmPath)) fail("could not write the PPM");
+  printf(failures ? "%u check(s) failed\n" : "OK\n", failures);
+  fflush(stdout);
+  // The firmware's tasks never return; leave without joining them.
+  _exit(failures ? 1 : 0);
+}
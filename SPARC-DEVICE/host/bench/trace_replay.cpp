@@ -0,0 +1,199 @@
+// Replays recorded IR traces (TRACE:ON / TRACE_LABEL on the device, see
+// src/sensor/blink_trace.h) through the firmware's gesture classifier on
+// the host, and reports how well it matched the labels: detection
+// latency percentiles, false positives and negatives, and the cost of
+// feeding one edge.
+//
+// Each file runs on its own GestureContext in 1 ms steps of virtual
+// time, the way the sensor task ticks it. Latency is measured from the
+// label (the last edge of the intended gesture) to the detection, so it
+// does not depend on the machine; cycles per edge are the host time of
+// gestureFeedEdge() counted at the board's 240 MHz (halCycleCount()).
+//
+// Exits non-zero if a file cannot be read or has a malformed line.
+
+#include "../../include/common_variables.h"
+#include "../../src/hal/hal.h"
+#include "../../src/sensor/gesture.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+// A detection counts for a label if it is reported within this window
+// after the label time.
+static const uint32_t MATCH_WINDOW_MS = 5000;
+
+struct TraceEdge {
+  uint32_t timeMs;
+  bool eyeOpen;
+};
+
+struct TraceLabel {
+  uint32_t timeMs;
+  BlinkGesture gesture;
+  bool matched;
+};
+
+struct Trace {
+  std::vector<TraceEdge> edges;
+  std::vector<TraceLabel> labels;
+};
+
+struct ReplayStats {
+  std::vector<uint32_t> latencies;
+  unsigned edges = 0;
+  unsigned labels = 0;
+  unsigned falsePositives = 0;
+  unsigned falseNegatives = 0;
+  uint64_t cycles = 0;
+};
+
+// --- Loading ---
+
+// "<letter> <time> <token>"; blank lines and # comments are skipped.
+static bool loadTrace(const char *path, Trace &trace) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "%s: cannot open\n", path);
+    return false;
+  }
+  char line[128];
+  unsigned lineNo = 0;
+  bool ok = true;
+  uint32_t lastEdge = 0;
+  while (ok && fgets(line, sizeof(line), f)) {
+    lineNo++;
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] == '\0' || line[0] == '#') continue;
+    char kind;
+    unsigned long timeMs;
+    char token[16];
+    if (sscanf(line, "%c %lu %15s", &kind, &timeMs, token) != 3) {
+      ok = false;
+    } else if (kind == 'E' && (strcmp(token, "0") == 0 || strcmp(token, "1") == 0)) {
+      // Edges must come in time order, as the classifier takes them.
+      ok = trace.edges.empty() || timeMs >= lastEdge;
+      lastEdge = timeMs;
+      trace.edges.push_back({ (uint32_t)timeMs, token[0] == '1' });
+    } else if (kind == 'L' && gestureFromName(token) != GESTURE_NONE) {
+      trace.labels.push_back({ (uint32_t)timeMs, gestureFromName(token), false });
+    } else {
+      ok = false;
+    }
+    if (!ok) fprintf(stderr, "%s:%u: invalid trace line \"%s\"\n", path, lineNo, line);
+  }
+  fclose(f);
+  return ok;
+}
+
+// --- Replay ---
+
+// Match a detection to the oldest open label of the same gesture.
+static bool matchDetection(Trace &trace, BlinkGesture g, uint32_t tMs, ReplayStats &stats) {
+  for (TraceLabel &l : trace.labels) {
+    if (l.matched || l.gesture != g) continue;
+    if (tMs < l.timeMs || tMs - l.timeMs > MATCH_WINDOW_MS) continue;
+    l.matched = true;
+    stats.latencies.push_back(tMs - l.timeMs);
+    return true;
+  }
+  return false;
+}
+
+static void detected(Trace &trace, BlinkGesture g, uint32_t tMs, ReplayStats &stats) {
+  if (g != GESTURE_NONE && !matchDetection(trace, g, tMs, stats)) stats.falsePositives++;
+}
+
+static void replay(Trace &trace, ReplayStats &stats) {
+  GestureContext ctx;
+  gestureReset(ctx, false);
+  size_t next = 0;
+  if (!trace.edges.empty()) {
+    uint32_t end = trace.edges.back().timeMs + MATCH_WINDOW_MS;
+    for (uint32_t t = trace.edges.front().timeMs; t <= end; t++) {
+      for (; next < trace.edges.size() && trace.edges[next].timeMs <= t; next++) {
+        uint32_t start = halCycleCount();
+        BlinkGesture g = gestureFeedEdge(ctx, trace.edges[next].eyeOpen, trace.edges[next].timeMs);
+        stats.cycles += halCycleCount() - start;
+        detected(trace, g, t, stats);
+      }
+      detected(trace, gestureTick(ctx, t), t, stats);
+    }
+  }
+  stats.edges += trace.edges.size();
+  stats.labels += trace.labels.size();
+  for (const TraceLabel &l : trace.labels) {
+    if (!l.matched) stats.falseNegatives++;
+  }
+}
+
+// --- Report ---
+
+static uint32_t percentile(const std::vector<uint32_t> &sorted, unsigned p) {
+  if (sorted.empty()) return 0;
+  size_t idx = (sorted.size() * p + 99) / 100;
+  return sorted[idx ? idx - 1 : 0];
+}
+
+static void printStats(const char *name, ReplayStats &stats) {
+  std::sort(stats.latencies.begin(), stats.latencies.end());
+  printf("%s: %u edges, %u labels\n", name, stats.edges, stats.labels);
+  printf("  latency ms p50/p90/p99/max: %u/%u/%u/%u (n=%zu)\n", percentile(stats.latencies, 50),
+         percentile(stats.latencies, 90), percentile(stats.latencies, 99),
+         stats.latencies.empty() ? 0 : stats.latencies.back(), stats.latencies.size());
+  printf("  false positives: %u, false negatives: %u\n", stats.falsePositives, stats.falseNegatives);
+  printf("  cycles per edge: %llu\n", (unsigned long long)(stats.edges ? stats.cycles / stats.edges : 0));
+}
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+          "usage: %s [options] <trace>...\n"
+          "  --duration <ms>  blinkDuration to classify with (default %d)\n"
+          "  --gap <ms>       blinkGap to classify with (default %d)\n",
+          argv0, blinkDuration.load(), blinkGap.load());
+}
+
+static bool parseArgs(int argc, char **argv, std::vector<const char*> &paths) {
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (strcmp(arg, "--duration") == 0 && hasValue) blinkDuration = atoi(argv[++i]);
+    else if (strcmp(arg, "--gap") == 0 && hasValue) blinkGap = atoi(argv[++i]);
+    else if (arg[0] != '-') paths.push_back(arg);
+    else return false;
+  }
+  return !paths.empty();
+}
+
+int main(int argc, char **argv) {
+  std::vector<const char*> paths;
+  if (!parseArgs(argc, argv, paths)) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  printf("Classifier: blinkDuration %d ms, blinkGap %d ms\n", blinkDuration.load(), blinkGap.load());
+  ReplayStats total;
+  bool ok = true;
+  for (const char *path : paths) {
+    Trace trace;
+    if (!loadTrace(path, trace)) {
+      ok = false;
+      continue;
+    }
+    ReplayStats stats;
+    replay(trace, stats);
+    total.latencies.insert(total.latencies.end(), stats.latencies.begin(), stats.latencies.end());
+    total.edges += stats.edges;
+    total.labels += stats.labels;
+    total.falsePositives += stats.falsePositives;
+    total.falseNegatives += stats.falseNegatives;
+    total.cycles += stats.cycles;
+    printStats(path, stats);
+  }
+  if (paths.size() > 1) printStats("All traces", total);
+  return ok ? 0 : 1;
+}
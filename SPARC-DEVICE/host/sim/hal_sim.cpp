@@ -0,0 +1,57 @@
+#include "../../src/hal/hal.h"
+
+#include "sim_clock.h"
+#include "sim_gpio.h"
+#include "sim_tasks.h"
+
+#include <Arduino.h>
+
+// hal.h for the host build: the virtual clock and the simulated pins.
+
+unsigned long halMillis() {
+  return simClockMillis();
+}
+
+unsigned long halMicros() {
+  return simClockMicros();
+}
+
+void halDelay(unsigned long ms) {
+  simTaskSleepUntil(simClockMicros() + ms * 1000ULL);
+}
+
+uint32_t halCycleCount() {
+  return ESP.getCycleCount();
+}
+
+void halPinsSetup() {
+  simGpioMode(SIM_PIN_IR_SENSOR, INPUT);
+  simGpioMode(SIM_PIN_BLINK_LED, OUTPUT);
+  simGpioMode(SIM_PIN_EMERGENCY_LED, OUTPUT);
+  simGpioMode(SIM_PIN_BUZZER, OUTPUT);
+  simGpioMode(SIM_PIN_EMERGENCY_BUTTON, INPUT_PULLUP);
+  simGpioWrite(SIM_PIN_BLINK_LED, LOW);
+  simGpioWrite(SIM_PIN_EMERGENCY_LED, LOW);
+  simGpioWrite(SIM_PIN_BUZZER, LOW);
+}
+
+bool halIrSensorRead() {
+  return simGpioRead(SIM_PIN_IR_SENSOR);
+}
+
+void halAttachIrInterrupt(void (*isr)()) {
+  simGpioAttachInterrupt(SIM_PIN_IR_SENSOR, isr, CHANGE);
+}
+
+void halSetBlinkLed(bool on) {
+  simGpioWrite(SIM_PIN_BLINK_LED, on ? HIGH : LOW);
+}
+
+void halSetEmergencyOutputs(bool on) {
+  simGpioWrite(SIM_PIN_EMERGENCY_LED, on ? HIGH : LOW);
+  simGpioWrite(SIM_PIN_BUZZER, on ? HIGH : LOW);
+}
+
+bool halEmergencyButtonPressed() {
+  return simGpioRead(SIM_PIN_EMERGENCY_BUTTON) == HIGH;
+}
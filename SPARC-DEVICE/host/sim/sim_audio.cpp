@@ -0,0 +1,58 @@
+#include "sim_audio.h"
+
+#include "sim_clock.h"
+
+static const uint16_t TRACK_COUNT = 256;
+
+static bool present = true;
+static uint32_t trackMs[TRACK_COUNT];
+static uint32_t trackPlays[TRACK_COUNT];
+static SimAudioStats stats;
+
+static bool playing = false;
+static uint16_t playingTrack = 0;
+static uint64_t finishUs = 0;
+
+void simAudioSetPresent(bool on) {
+  present = on;
+}
+
+void simAudioSetTrackMs(uint16_t track, uint32_t ms) {
+  if (track < TRACK_COUNT) trackMs[track] = ms;
+}
+
+bool simAudioPresent() {
+  return present;
+}
+
+void simAudioPlay(uint16_t track) {
+  if (!present) return;
+  if (playing && simClockMicros() < finishUs) stats.interrupted++;
+  uint32_t ms = track < TRACK_COUNT && trackMs[track] ? trackMs[track] : SIM_AUDIO_DEFAULT_TRACK_MS;
+  playing = true;
+  playingTrack = track;
+  finishUs = simClockMicros() + ms * 1000ULL;
+  stats.plays++;
+  stats.lastTrack = track;
+  if (track < TRACK_COUNT) trackPlays[track]++;
+}
+
+void simAudioStop() {
+  if (playing && simClockMicros() < finishUs) stats.interrupted++;
+  playing = false;
+}
+
+bool simAudioTakeFinished(uint16_t *track) {
+  if (!playing || simClockMicros() < finishUs) return false;
+  playing = false;
+  *track = playingTrack;
+  return true;
+}
+
+const SimAudioStats &simAudioStats() {
+  return stats;
+}
+
+uint32_t simAudioPlays(uint16_t track) {
+  return track < TRACK_COUNT ? trackPlays[track] : 0;
+}
@@ -0,0 +1,34 @@
+#ifndef SIM_AUDIO_H
+#define SIM_AUDIO_H
+
+#include <stdint.h>
+
+// Simulated DFPlayer Mini behind the host DFRobotDFPlayerMini. A track
+// plays for its set length in virtual time, then the player reports
+// "play finished" like the real module. Every play is counted, so the
+// bench can check what the device said.
+static const uint32_t SIM_AUDIO_DEFAULT_TRACK_MS = 600;
+
+// Bench: whether the module answers at boot, and how long track `track`
+// plays (0 = SIM_AUDIO_DEFAULT_TRACK_MS).
+void simAudioSetPresent(bool present);
+void simAudioSetTrackMs(uint16_t track, uint32_t ms);
+
+// DFRobotDFPlayerMini side.
+bool simAudioPresent();
+void simAudioPlay(uint16_t track);
+void simAudioStop();
+// The next "finished" event due by now: true and the track number, or
+// false if there is none.
+bool simAudioTakeFinished(uint16_t *track);
+
+struct SimAudioStats {
+  uint32_t plays;
+  uint32_t interrupted;  // plays cut short by the next play or a stop
+  uint16_t lastTrack;
+};
+const SimAudioStats &simAudioStats();
+// Plays of one track since boot.
+uint32_t simAudioPlays(uint16_t track);
+
+#endif // SIM_AUDIO_H
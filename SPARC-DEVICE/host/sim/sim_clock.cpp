@@ -0,0 +1,44 @@
+#include "sim_clock.h"
+
+#include <queue>
+#include <vector>
+
+struct ClockEvent {
+  uint64_t us;
+  uint64_t order;  // keeps events for the same time in the order they were set
+  void (*fn)(void*);
+  void *arg;
+  bool operator>(const ClockEvent &o) const {
+    return us != o.us ? us > o.us : order > o.order;
+  }
+};
+
+static uint64_t nowUs = 0;
+static uint64_t nextOrder = 0;
+static std::priority_queue<ClockEvent, std::vector<ClockEvent>, std::greater<ClockEvent>> events;
+
+uint64_t simClockMicros() {
+  return nowUs;
+}
+
+uint64_t simClockMillis() {
+  return nowUs / 1000;
+}
+
+void simClockAt(uint64_t us, void (*fn)(void*), void *arg) {
+  events.push({ us < nowUs ? nowUs : us, nextOrder++, fn, arg });
+}
+
+uint64_t simClockNextEvent() {
+  return events.empty() ? SIM_FOREVER : events.top().us;
+}
+
+void simClockAdvanceTo(uint64_t us) {
+  while (!events.empty() && events.top().us <= us) {
+    ClockEvent e = events.top();
+    events.pop();
+    if (e.us > nowUs) nowUs = e.us;
+    if (e.fn) e.fn(e.arg);
+  }
+  if (us > nowUs) nowUs = us;
+}
@@ -0,0 +1,28 @@
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <stdint.h>
+
+// Virtual time for the host build, in microseconds since power-on.
+// Running code takes no virtual time; only waiting does. The task
+// scheduler (sim_tasks.h) moves the clock forward when every task is
+// waiting, straight to the next deadline or scheduled event, so a
+// simulated hour takes as long as the work done in it.
+static const uint64_t SIM_FOREVER = UINT64_MAX;
+
+uint64_t simClockMicros();
+uint64_t simClockMillis();
+
+// Run fn(arg) once the clock reaches `us` (now if it already has).
+// fn may be null: the clock then just stops there, so tasks waiting on
+// something that changes at that time (a packet arriving) see it on
+// time. Callbacks run inside the scheduler and must not block.
+void simClockAt(uint64_t us, void (*fn)(void*), void *arg);
+
+// Scheduler: the earliest scheduled event, or SIM_FOREVER.
+uint64_t simClockNextEvent();
+// Scheduler: move the clock to `us`, running the events due on the way
+// in time order.
+void simClockAdvanceTo(uint64_t us);
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,60 @@
+#include "sim_console.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <deque>
+#include <string>
+
+static bool echo = false;
+static void (*lineFn)(const char*) = nullptr;
+static std::string line;
+static std::deque<uint8_t> input;
+static void (*receiveFn)(void*) = nullptr;
+static void *receiveArg = nullptr;
+
+void simConsoleWrite(const uint8_t *data, size_t len) {
+  if (echo) fwrite(data, 1, len, stdout);
+  for (size_t i = 0; i < len; i++) {
+    char c = (char)data[i];
+    if (c == '\r') continue;
+    if (c != '\n') {
+      line += c;
+      continue;
+    }
+    if (lineFn) lineFn(line.c_str());
+    line.clear();
+  }
+}
+
+int simConsoleAvailable() {
+  return (int)input.size();
+}
+
+int simConsoleRead() {
+  if (input.empty()) return -1;
+  uint8_t c = input.front();
+  input.pop_front();
+  return c;
+}
+
+int simConsolePeek() {
+  return input.empty() ? -1 : input.front();
+}
+
+void simConsoleOnReceive(void (*fn)(void*), void *arg) {
+  receiveFn = fn;
+  receiveArg = arg;
+}
+
+void simConsoleEcho(bool on) {
+  echo = on;
+}
+
+void simConsoleOnLine(void (*fn)(const char*)) {
+  lineFn = fn;
+}
+
+void simConsoleInput(const char *text) {
+  input.insert(input.end(), text, text + strlen(text));
+  if (receiveFn) receiveFn(receiveArg);
+}
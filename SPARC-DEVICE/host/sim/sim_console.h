@@ -0,0 +1,28 @@
+#ifndef SIM_CONSOLE_H
+#define SIM_CONSOLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The USB serial console (Serial) of the host build. What the firmware
+// prints is split into lines for the bench, and echoed to stdout only
+// when asked, so a benchmark run is not slowed down by the terminal.
+// Typed commands are queued as received bytes.
+
+// HardwareSerial(0) side.
+void simConsoleWrite(const uint8_t *data, size_t len);
+int simConsoleAvailable();
+int simConsoleRead();
+int simConsolePeek();
+void simConsoleOnReceive(void (*fn)(void *arg), void *arg);
+
+// Bench side.
+void simConsoleEcho(bool on);
+// Called with every complete line the firmware prints, without the
+// line ending.
+void simConsoleOnLine(void (*fn)(const char *line));
+// Type text into the console; the firmware's onReceive callback runs
+// right away, as the UART driver's would.
+void simConsoleInput(const char *text);
+
+#endif // SIM_CONSOLE_H
@@ -0,0 +1,76 @@
+#include "sim_display.h"
+
+#include <stdio.h>
+
+static uint16_t pixels[SIM_DISPLAY_WIDTH * SIM_DISPLAY_HEIGHT];
+static bool landscape = false;
+static SimDisplayStats stats;
+static bool touched = false;
+static uint16_t touchX = 0;
+static uint16_t touchY = 0;
+
+void simDisplaySetRotation(uint8_t rotation) {
+  landscape = rotation & 1;
+}
+
+int simDisplayWidth() {
+  return landscape ? SIM_DISPLAY_HEIGHT : SIM_DISPLAY_WIDTH;
+}
+
+int simDisplayHeight() {
+  return landscape ? SIM_DISPLAY_WIDTH : SIM_DISPLAY_HEIGHT;
+}
+
+uint16_t *simDisplayPixels() {
+  return pixels;
+}
+
+void simDisplayCount(uint32_t n) {
+  stats.pixels += n;
+  stats.draws++;
+}
+
+void simDisplayCountDma(uint32_t bytes) {
+  stats.dmaPushes++;
+  stats.dmaBytes += bytes;
+}
+
+const SimDisplayStats &simDisplayStats() {
+  return stats;
+}
+
+void simDisplayResetStats() {
+  stats = SimDisplayStats();
+}
+
+void simDisplayTouch(int x, int y) {
+  touched = true;
+  touchX = x;
+  touchY = y;
+}
+
+void simDisplayRelease() {
+  touched = false;
+}
+
+bool simDisplayTouched(uint16_t *x, uint16_t *y) {
+  if (!touched) return false;
+  *x = touchX;
+  *y = touchY;
+  return true;
+}
+
+bool simDisplaySavePpm(const char *path) {
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", simDisplayWidth(), simDisplayHeight());
+  for (uint16_t c : pixels) {
+    uint8_t rgb[3] = {
+      (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+      (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+      (uint8_t)((c & 0x1F) * 255 / 31),
+    };
+    fwrite(rgb, 1, sizeof(rgb), f);
+  }
+  return fclose(f) == 0;
+}
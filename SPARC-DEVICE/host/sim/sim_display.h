@@ -0,0 +1,41 @@
+#ifndef SIM_DISPLAY_H
+#define SIM_DISPLAY_H
+
+#include <stdint.h>
+
+// Simulated 320x480 RGB565 panel with a resistive touch layer, for the
+// TFT_eSPI of the host build. The framebuffer is kept in the
+// orientation the GUI draws in (its setRotation), so a dump looks like
+// the device held the way the GUI expects.
+static const int SIM_DISPLAY_WIDTH = 320;   // portrait
+static const int SIM_DISPLAY_HEIGHT = 480;
+
+// TFT_eSPI::setRotation(): odd rotations are landscape.
+void simDisplaySetRotation(uint8_t rotation);
+int simDisplayWidth();
+int simDisplayHeight();
+uint16_t *simDisplayPixels();  // simDisplayWidth() pixels per row
+
+struct SimDisplayStats {
+  uint64_t pixels;      // pixels written to the panel
+  uint32_t draws;       // drawing calls that reached the panel
+  uint32_t dmaPushes;   // pushImageDMA transfers
+  uint64_t dmaBytes;
+};
+
+// TFT_eSPI: count a drawing call that wrote `pixels` pixels.
+void simDisplayCount(uint32_t pixels);
+void simDisplayCountDma(uint32_t bytes);
+const SimDisplayStats &simDisplayStats();
+void simDisplayResetStats();
+
+// Bench: touch the panel at (x, y) in screen coordinates, or let go.
+void simDisplayTouch(int x, int y);
+void simDisplayRelease();
+bool simDisplayTouched(uint16_t *x, uint16_t *y);
+
+// Write the panel as a binary PPM. Returns false if the file could not
+// be written.
+bool simDisplaySavePpm(const char *path);
+
+#endif // SIM_DISPLAY_H
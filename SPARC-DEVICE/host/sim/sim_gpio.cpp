@@ -0,0 +1,59 @@
+#include "sim_gpio.h"
+
+#include <Arduino.h>
+
+struct SimPin {
+  int mode;
+  int level;
+  uint32_t toggles;
+  void (*isr)();
+  int isrMode;
+};
+
+static SimPin pins[SIM_GPIO_COUNT];
+
+static bool validPin(int pin) {
+  return pin >= 0 && pin < SIM_GPIO_COUNT;
+}
+
+void simGpioMode(int pin, int mode) {
+  if (validPin(pin)) pins[pin].mode = mode;
+}
+
+int simGpioRead(int pin) {
+  return validPin(pin) ? pins[pin].level : LOW;
+}
+
+void simGpioWrite(int pin, int level) {
+  if (!validPin(pin)) return;
+  level = level ? HIGH : LOW;
+  if (pins[pin].level != level) pins[pin].toggles++;
+  pins[pin].level = level;
+}
+
+void simGpioAttachInterrupt(int pin, void (*isr)(), int mode) {
+  if (!validPin(pin)) return;
+  pins[pin].isr = isr;
+  pins[pin].isrMode = mode;
+}
+
+void simGpioDetachInterrupt(int pin) {
+  if (validPin(pin)) pins[pin].isr = nullptr;
+}
+
+void simGpioDrive(int pin, int level) {
+  if (!validPin(pin)) return;
+  SimPin &p = pins[pin];
+  level = level ? HIGH : LOW;
+  if (p.level == level) return;
+  p.level = level;
+  if (!p.isr) return;
+  if (p.isrMode == CHANGE || (p.isrMode == RISING && level == HIGH) ||
+      (p.isrMode == FALLING && level == LOW)) {
+    p.isr();
+  }
+}
+
+uint32_t simGpioToggles(int pin) {
+  return validPin(pin) ? pins[pin].toggles : 0;
+}
@@ -0,0 +1,34 @@
+#ifndef SIM_GPIO_H
+#define SIM_GPIO_H
+
+#include <stdint.h>
+
+// Simulated GPIO bank. Outputs keep what the firmware wrote and count
+// level changes; inputs read what the bench drives. Pull-ups are not
+// modelled: an input nobody drove reads LOW.
+
+// Board pins, as wired in src/hal/hal_esp32.cpp.
+static const int SIM_PIN_IR_SENSOR = 36;
+static const int SIM_PIN_BLINK_LED = 25;
+static const int SIM_PIN_EMERGENCY_LED = 27;
+static const int SIM_PIN_BUZZER = 26;
+static const int SIM_PIN_EMERGENCY_BUTTON = 12;
+
+static const int SIM_GPIO_COUNT = 40;
+
+// Firmware side (Arduino pin calls and the sim HAL).
+void simGpioMode(int pin, int mode);
+int simGpioRead(int pin);
+void simGpioWrite(int pin, int level);
+// mode is the Arduino RISING / FALLING / CHANGE.
+void simGpioAttachInterrupt(int pin, void (*isr)(), int mode);
+void simGpioDetachInterrupt(int pin);
+
+// Bench side: set an input level. An attached interrupt that matches
+// the edge runs right away, as it would on the board.
+void simGpioDrive(int pin, int level);
+
+// Output level changes since boot.
+uint32_t simGpioToggles(int pin);
+
+#endif // SIM_GPIO_H
@@ -0,0 +1,639 @@
+#include "sim_net.h"
+
+#include "sim_clock.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <deque>
+#include <vector>
+
+// Simulated fds sit above anything the host process opens and below
+// FD_SETSIZE, so the firmware's fd_sets hold them.
+static const int FIRST_FD = 512;
+// Bytes a TCP receiver holds (unread plus in flight), as lwIP's window.
+static const size_t TCP_WINDOW = 5744;
+// Datagrams a UDP socket holds before new ones are dropped.
+static const size_t UDP_QUEUE = 16;
+static const uint16_t FIRST_EPHEMERAL_PORT = 49152;
+
+enum SockKind : uint8_t { SK_TCP, SK_UDP, SK_EVENT };
+enum TcpState : uint8_t { TS_NEW, TS_LISTEN, TS_CONNECTING, TS_OPEN, TS_CLOSED };
+
+struct Packet {
+  uint64_t at;  // arrival time
+  uint32_t fromAddr;
+  uint16_t fromPort;
+  std::vector<uint8_t> data;
+};
+
+struct Sock {
+  SockKind kind;
+  int flags;
+  uint32_t host;
+  uint32_t addr;
+  uint16_t port;
+  bool bound;
+  // TCP
+  TcpState state;
+  uint64_t readyAt;   // connect completes (or fails) at
+  int error;          // pending SO_ERROR
+  Sock *peer;
+  uint32_t peerAddr;
+  uint16_t peerPort;
+  uint64_t finAt;     // peer closed: EOF once everything before it is read
+  bool fin;
+  int backlog;
+  std::deque<Packet> rx;     // TCP chunks or UDP datagrams
+  size_t rxBytes;            // TCP: bytes in rx
+  size_t rxOffset;           // TCP: bytes of rx.front() already read
+  std::deque<std::pair<uint64_t, Sock*>> accepts;
+  // eventfd
+  uint64_t counter;
+};
+
+static Sock *fds[FD_SETSIZE];
+static uint32_t deviceAddr = 0;
+static uint32_t latencyUs = 2000;
+static uint16_t nextEphemeral = FIRST_EPHEMERAL_PORT;
+static SimNetStats stats;
+
+static uint32_t joinMs = 1200;
+static bool apUp = true;
+static bool wantJoin = false;
+static bool linkUp = false;
+static uint32_t joinGeneration = 0;
+static void (*linkChange)() = nullptr;
+
+uint32_t simNetAddr(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+  return htonl((uint32_t)a << 24 | (uint32_t)b << 16 | (uint32_t)c << 8 | d);
+}
+
+uint32_t simNetDeviceAddr() {
+  if (!deviceAddr) deviceAddr = simNetAddr(192, 168, 4, 2);
+  return deviceAddr;
+}
+
+void simNetSetDeviceAddr(uint32_t addr) {
+  deviceAddr = addr;
+}
+
+uint32_t simNetBroadcastAddr() {
+  return simNetDeviceAddr() | htonl(0xFF);
+}
+
+void simNetSetLatencyUs(uint32_t us) {
+  latencyUs = us;
+}
+
+const SimNetStats &simNetStats() {
+  return stats;
+}
+
+// --- Helpers ---
+
+static Sock *lookup(int fd) {
+  if (fd < FIRST_FD || fd >= FD_SETSIZE || !fds[fd]) {
+    errno = EBADF;
+    return nullptr;
+  }
+  return fds[fd];
+}
+
+static int allocFd(Sock *s) {
+  for (int fd = FIRST_FD; fd < FD_SETSIZE; fd++) {
+    if (!fds[fd]) {
+      fds[fd] = s;
+      return fd;
+    }
+  }
+  delete s;
+  errno = EMFILE;
+  return -1;
+}
+
+static Sock *newSock(SockKind kind, uint32_t host) {
+  Sock *s = new Sock();
+  s->kind = kind;
+  s->host = host;
+  return s;
+}
+
+static uint64_t arrival() {
+  uint64_t at = simClockMicros() + latencyUs;
+  simClockAt(at, nullptr, nullptr);  // wake whoever waits for it
+  return at;
+}
+
+static bool isDevice(const Sock *s) {
+  return s->host == simNetDeviceAddr();
+}
+
+// A host that cannot send or receive: the device without its link.
+static bool offline(uint32_t host) {
+  return host == simNetDeviceAddr() && !linkUp;
+}
+
+static bool portTaken(uint32_t host, SockKind kind, uint16_t port) {
+  for (Sock *s : fds) {
+    if (s && s->kind == kind && s->bound && s->host == host && s->port == port) return true;
+  }
+  return false;
+}
+
+static uint16_t ephemeralPort(uint32_t host, SockKind kind) {
+  while (portTaken(host, kind, nextEphemeral)) {
+    nextEphemeral = nextEphemeral == 65535 ? FIRST_EPHEMERAL_PORT : nextEphemeral + 1;
+  }
+  return nextEphemeral++;
+}
+
+static void autoBind(Sock *s) {
+  if (s->bound) return;
+  s->addr = s->host;
+  s->port = ephemeralPort(s->host, s->kind);
+  s->bound = true;
+}
+
+// Connect finished (or failed) by now?
+static void settle(Sock *s) {
+  if (s->state != TS_CONNECTING || simClockMicros() < s->readyAt) return;
+  s->state = s->error ? TS_CLOSED : TS_OPEN;
+}
+
+// The other end goes away: the peer reads what it has, then EOF.
+static void detachPeer(Sock *s) {
+  Sock *p = s->peer;
+  if (!p) return;
+  p->peer = nullptr;
+  p->fin = true;
+  p->finAt = arrival();
+  s->peer = nullptr;
+}
+
+static void resetPeer(Sock *s) {
+  Sock *p = s->peer;
+  if (p) {
+    p->peer = nullptr;
+    p->error = ECONNRESET;
+    p->state = TS_CLOSED;
+  }
+  s->peer = nullptr;
+  s->error = ECONNRESET;
+  s->state = TS_CLOSED;
+  stats.resets++;
+}
+
+static void destroy(Sock *s) {
+  if (s->kind == SK_TCP) {
+    detachPeer(s);
+    for (auto &a : s->accepts) destroy(a.second);  // never accepted
+  }
+  delete s;
+}
+
+static size_t arrivedBytes(const Sock *s) {
+  uint64_t now = simClockMicros();
+  size_t n = 0;
+  for (const Packet &p : s->rx) {
+    if (p.at > now) break;
+    n += p.data.size();
+  }
+  return n - (s->rx.empty() ? 0 : s->rxOffset);
+}
+
+static bool hasDatagram(const Sock *s) {
+  return !s->rx.empty() && s->rx.front().at <= simClockMicros();
+}
+
+static void deliverDatagram(Sock *to, const Sock *from, const void *data, size_t len) {
+  if (to->rx.size() >= UDP_QUEUE || offline(to->host)) return;
+  Packet p;
+  p.at = arrival();
+  p.fromAddr = from->addr;
+  p.fromPort = from->port;
+  p.data.assign((const uint8_t*)data, (const uint8_t*)data + len);
+  to->rx.push_back(std::move(p));
+  stats.datagrams++;
+}
+
+// --- WiFi station ---
+
+static void setLink(bool up) {
+  if (linkUp == up) return;
+  linkUp = up;
+  stats.linkChanges++;
+  if (!up) {
+    for (Sock *s : fds) {
+      if (s && s->kind == SK_TCP && isDevice(s) && (s->peer || s->state == TS_CONNECTING)) resetPeer(s);
+    }
+  }
+  if (linkChange) linkChange();
+}
+
+static void joined(void *generation) {
+  if ((uintptr_t)generation != joinGeneration || !wantJoin || !apUp) return;
+  setLink(true);
+}
+
+static void startJoin() {
+  joinGeneration++;
+  simClockAt(simClockMicros() + joinMs * 1000ULL, joined, (void*)(uintptr_t)joinGeneration);
+}
+
+void simNetSetJoinMs(uint32_t ms) {
+  joinMs = ms;
+}
+
+void simNetJoin() {
+  wantJoin = true;
+  if (apUp && !linkUp) startJoin();
+}
+
+void simNetLeave() {
+  wantJoin = false;
+  joinGeneration++;
+  setLink(false);
+}
+
+bool simNetLinkUp() {
+  return linkUp;
+}
+
+void simNetOnLinkChange(void (*fn)()) {
+  linkChange = fn;
+}
+
+void simNetSetApUp(bool up) {
+  if (apUp == up) return;
+  apUp = up;
+  if (!up) {
+    joinGeneration++;
+    setLink(false);
+  } else if (wantJoin) {
+    startJoin();
+  }
+}
+
+// --- Sockets ---
+
+int simNetSocket(uint32_t host, int type) {
+  if (type != SOCK_STREAM && type != SOCK_DGRAM) {
+    errno = EPROTONOSUPPORT;
+    return -1;
+  }
+  return allocFd(newSock(type == SOCK_STREAM ? SK_TCP : SK_UDP, host));
+}
+
+int simNetBind(int fd, uint32_t addr, uint16_t port) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind == SK_EVENT || s->bound) {
+    errno = EINVAL;
+    return -1;
+  }
+  if (addr != htonl(INADDR_ANY) && addr != s->host) {
+    errno = EADDRNOTAVAIL;
+    return -1;
+  }
+  if (port == 0) port = ephemeralPort(s->host, s->kind);
+  else if (portTaken(s->host, s->kind, port)) {
+    errno = EADDRINUSE;
+    return -1;
+  }
+  s->addr = s->host;
+  s->port = port;
+  s->bound = true;
+  return 0;
+}
+
+int simNetListen(int fd, int backlog) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind != SK_TCP || s->state != TS_NEW) {
+    errno = EINVAL;
+    return -1;
+  }
+  autoBind(s);
+  s->state = TS_LISTEN;
+  s->backlog = backlog > 0 ? backlog : 1;
+  return 0;
+}
+
+static Sock *findListener(uint32_t addr, uint16_t port) {
+  for (Sock *s : fds) {
+    if (s && s->kind == SK_TCP && s->state == TS_LISTEN && s->host == addr && s->port == port) return s;
+  }
+  return nullptr;
+}
+
+int simNetConnect(int fd, uint32_t addr, uint16_t port) {
+  Sock *c = lookup(fd);
+  if (!c) return -1;
+  if (c->kind != SK_TCP || c->state != TS_NEW) {
+    errno = c->kind == SK_TCP ? EISCONN : EINVAL;
+    return -1;
+  }
+  autoBind(c);
+  stats.connects++;
+  uint64_t now = simClockMicros();
+  c->state = TS_CONNECTING;
+  c->readyAt = now + 2ULL * latencyUs;
+  c->peerAddr = addr;
+  c->peerPort = port;
+  simClockAt(c->readyAt, nullptr, nullptr);
+
+  Sock *l = offline(c->host) || offline(addr) ? nullptr : findListener(addr, port);
+  if (!l || (int)l->accepts.size() >= l->backlog) {
+    c->error = offline(c->host) || offline(addr) ? EHOSTUNREACH : ECONNREFUSED;
+    stats.refused++;
+    errno = EINPROGRESS;
+    return -1;
+  }
+  Sock *s = newSock(SK_TCP, l->host);
+  s->state = TS_OPEN;
+  s->addr = l->addr;
+  s->port = l->port;
+  s->bound = true;
+  s->peer = c;
+  s->peerAddr = c->addr;
+  s->peerPort = c->port;
+  c->peer = s;
+  l->accepts.push_back({ now + latencyUs, s });
+  simClockAt(now + latencyUs, nullptr, nullptr);
+  errno = EINPROGRESS;
+  return -1;
+}
+
+int simNetAccept(int fd, uint32_t *peerAddr, uint16_t *peerPort) {
+  Sock *l = lookup(fd);
+  if (!l) return -1;
+  if (l->kind != SK_TCP || l->state != TS_LISTEN) {
+    errno = EINVAL;
+    return -1;
+  }
+  if (l->accepts.empty() || l->accepts.front().first > simClockMicros()) {
+    errno = EAGAIN;
+    return -1;
+  }
+  Sock *s = l->accepts.front().second;
+  l->accepts.pop_front();
+  int newFd = allocFd(s);
+  if (newFd < 0) return -1;
+  if (peerAddr) *peerAddr = s->peerAddr;
+  if (peerPort) *peerPort = s->peerPort;
+  return newFd;
+}
+
+ssize_t simNetSend(int fd, const void *data, size_t len) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind == SK_UDP) {
+    if (s->state != TS_OPEN) {
+      errno = EDESTADDRREQ;
+      return -1;
+    }
+    return simNetSendTo(fd, data, len, s->peerAddr, s->peerPort);
+  }
+  if (s->kind != SK_TCP) {
+    errno = ENOTSOCK;
+    return -1;
+  }
+  settle(s);
+  if (s->state == TS_CONNECTING) {
+    errno = EAGAIN;
+    return -1;
+  }
+  if (s->state != TS_OPEN || s->error) {
+    errno = s->error ? s->error : ENOTCONN;
+    return -1;
+  }
+  Sock *p = s->peer;
+  if (!p) {
+    errno = EPIPE;
+    return -1;
+  }
+  size_t room = TCP_WINDOW - p->rxBytes;
+  size_t n = len < room ? len : room;
+  if (n == 0) {
+    errno = EAGAIN;
+    return -1;
+  }
+  Packet pkt;
+  pkt.at = arrival();
+  pkt.fromAddr = s->addr;
+  pkt.fromPort = s->port;
+  pkt.data.assign((const uint8_t*)data, (const uint8_t*)data + n);
+  p->rx.push_back(std::move(pkt));
+  p->rxBytes += n;
+  stats.tcpBytes += n;
+  return n;
+}
+
+ssize_t simNetRecv(int fd, void *buf, size_t len, bool peek) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind == SK_UDP) {
+    if (!hasDatagram(s)) {
+      errno = EAGAIN;
+      return -1;
+    }
+    Packet &p = s->rx.front();
+    size_t n = p.data.size() < len ? p.data.size() : len;
+    memcpy(buf, p.data.data(), n);
+    if (!peek) s->rx.pop_front();
+    return n;
+  }
+  if (s->kind != SK_TCP) {
+    errno = ENOTSOCK;
+    return -1;
+  }
+  settle(s);
+  size_t avail = arrivedBytes(s);
+  if (avail == 0) {
+    if (s->error) {
+      errno = s->error;
+      return -1;
+    }
+    if (s->fin && simClockMicros() >= s->finAt) return 0;
+    errno = s->state == TS_OPEN || s->state == TS_CONNECTING ? EAGAIN : ENOTCONN;
+    return -1;
+  }
+  size_t want = len < avail ? len : avail;
+  size_t done = 0;
+  size_t offset = s->rxOffset;
+  for (auto it = s->rx.begin(); done < want; ++it) {
+    size_t chunk = it->data.size() - offset;
+    if (chunk > want - done) chunk = want - done;
+    memcpy((uint8_t*)buf + done, it->data.data() + offset, chunk);
+    done += chunk;
+    offset = 0;
+  }
+  if (!peek) {
+    s->rxBytes -= done;
+    size_t left = done;
+    while (left) {
+      size_t chunk = s->rx.front().data.size() - s->rxOffset;
+      if (chunk > left) {
+        s->rxOffset += left;
+        break;
+      }
+      left -= chunk;
+      s->rx.pop_front();
+      s->rxOffset = 0;
+    }
+  }
+  return done;
+}
+
+ssize_t simNetSendTo(int fd, const void *data, size_t len, uint32_t addr, uint16_t port) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind != SK_UDP) return simNetSend(fd, data, len);
+  if (offline(s->host)) {
+    errno = EHOSTUNREACH;
+    return -1;
+  }
+  autoBind(s);
+  bool broadcast = addr == htonl(INADDR_BROADCAST) || addr == simNetBroadcastAddr();
+  for (Sock *to : fds) {
+    if (!to || to == s || to->kind != SK_UDP || !to->bound || to->port != port) continue;
+    if (broadcast ? to->host != s->host : to->host == addr) deliverDatagram(to, s, data, len);
+  }
+  return len;
+}
+
+ssize_t simNetRecvFrom(int fd, void *buf, size_t len, uint32_t *addr, uint16_t *port) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind == SK_UDP && hasDatagram(s)) {
+    if (addr) *addr = s->rx.front().fromAddr;
+    if (port) *port = s->rx.front().fromPort;
+  } else if (s->kind == SK_TCP) {
+    if (addr) *addr = s->peerAddr;
+    if (port) *port = s->peerPort;
+  }
+  return simNetRecv(fd, buf, len, false);
+}
+
+int simNetClose(int fd) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  fds[fd] = nullptr;
+  destroy(s);
+  return 0;
+}
+
+int simNetError(int fd) {
+  Sock *s = lookup(fd);
+  if (!s) return EBADF;
+  settle(s);
+  if (s->state == TS_CONNECTING) return 0;
+  int err = s->error;
+  if (s->state != TS_CLOSED) s->error = 0;
+  return err;
+}
+
+int simNetPeer(int fd, uint32_t *addr, uint16_t *port) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind != SK_TCP || !(s->state == TS_OPEN || s->state == TS_CONNECTING)) {
+    errno = ENOTCONN;
+    return -1;
+  }
+  if (addr) *addr = s->peerAddr;
+  if (port) *port = s->peerPort;
+  return 0;
+}
+
+int simNetAvailable(int fd) {
+  Sock *s = lookup(fd);
+  if (!s) return 0;
+  if (s->kind == SK_UDP) return hasDatagram(s) ? s->rx.front().data.size() : 0;
+  return s->kind == SK_TCP ? arrivedBytes(s) : 0;
+}
+
+int simNetGetFlags(int fd) {
+  Sock *s = lookup(fd);
+  return s ? (s->flags | O_RDWR) : -1;
+}
+
+int simNetSetFlags(int fd, int flags) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  s->flags = flags & O_NONBLOCK;
+  return 0;
+}
+
+// --- eventfd ---
+
+int simNetEventFd(unsigned int initial) {
+  Sock *s = newSock(SK_EVENT, 0);
+  s->counter = initial;
+  return allocFd(s);
+}
+
+ssize_t simNetEventWrite(int fd, const void *buf, size_t len) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  uint64_t v;
+  if (s->kind != SK_EVENT || len < sizeof(v)) {
+    errno = EINVAL;
+    return -1;
+  }
+  memcpy(&v, buf, sizeof(v));
+  s->counter += v;
+  return sizeof(v);
+}
+
+ssize_t simNetEventRead(int fd, void *buf, size_t len) {
+  Sock *s = lookup(fd);
+  if (!s) return -1;
+  if (s->kind != SK_EVENT || len < sizeof(s->counter)) {
+    errno = EINVAL;
+    return -1;
+  }
+  if (s->counter == 0) {
+    errno = EAGAIN;
+    return -1;
+  }
+  memcpy(buf, &s->counter, sizeof(s->counter));
+  s->counter = 0;
+  return sizeof(s->counter);
+}
+
+// --- Readiness ---
+
+bool simNetIsSocket(int fd) {
+  return fd >= FIRST_FD && fd < FD_SETSIZE && fds[fd];
+}
+
+bool simNetReadable(int fd) {
+  if (!simNetIsSocket(fd)) return false;
+  Sock *s = fds[fd];
+  switch (s->kind) {
+    case SK_EVENT:
+      return s->counter > 0;
+    case SK_UDP:
+      return hasDatagram(s);
+    case SK_TCP:
+      settle(s);
+      if (s->state == TS_LISTEN) return !s->accepts.empty() && s->accepts.front().first <= simClockMicros();
+      return arrivedBytes(s) > 0 || s->error || s->state == TS_CLOSED ||
+             (s->fin && simClockMicros() >= s->finAt);
+  }
+  return false;
+}
+
+bool simNetWritable(int fd) {
+  if (!simNetIsSocket(fd)) return false;
+  Sock *s = fds[fd];
+  if (s->kind != SK_TCP) return true;
+  settle(s);
+  if (s->state == TS_CLOSED || s->error || (s->state == TS_OPEN && !s->peer)) return true;
+  return s->state == TS_OPEN && s->peer->rxBytes < TCP_WINDOW;
+}
@@ -0,0 +1,83 @@
+#ifndef SIM_NET_H
+#define SIM_NET_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+// In-memory IPv4 network for the host build: the device and simulated
+// PC peers on one WiFi subnet, TCP and UDP, every packet delayed by a
+// fixed one-way latency of virtual time. The firmware reaches it through
+// the WiFi library stand-ins (host/arduino/WiFi.h) and through its own
+// socket calls (socket, connect, send, select, eventfd, ...), which the
+// linker routes here (--wrap, see sim_net_wrap.cpp), so net_events.cpp
+// and the modules on top of it run unchanged. The bench opens its peer
+// sockets with simNetSocket(). Nothing reaches the host's real network.
+//
+// Calls never block, except select() from the firmware, which waits in
+// virtual time. Errors come back as -1 with errno set. Addresses are in
+// network byte order, as in sockaddr_in and IPAddress.
+
+uint32_t simNetAddr(uint8_t a, uint8_t b, uint8_t c, uint8_t d);
+
+// The device, on 192.168.4.0/24 unless WiFi.config() says otherwise.
+uint32_t simNetDeviceAddr();
+void simNetSetDeviceAddr(uint32_t addr);
+uint32_t simNetBroadcastAddr();
+
+void simNetSetLatencyUs(uint32_t us);  // one way; default 2 ms
+
+// --- WiFi station ---
+// Joining takes simNetSetJoinMs() of virtual time while the access point
+// is up. Losing the link resets the device's TCP connections; while it
+// is down the device can neither send nor be reached.
+void simNetSetJoinMs(uint32_t ms);
+void simNetJoin();                    // WiFi.begin()
+void simNetLeave();                   // WiFi.disconnect()
+bool simNetLinkUp();
+void simNetOnLinkChange(void (*fn)());
+// Bench: take the access point away (and back; the station rejoins).
+void simNetSetApUp(bool up);
+
+// --- Sockets ---
+// type is SOCK_STREAM or SOCK_DGRAM; host is the address the socket
+// lives on (a PC peer, or the device for the firmware's sockets).
+int simNetSocket(uint32_t host, int type);
+int simNetBind(int fd, uint32_t addr, uint16_t port);  // addr INADDR_ANY = host
+int simNetListen(int fd, int backlog);
+int simNetAccept(int fd, uint32_t *peerAddr, uint16_t *peerPort);
+// Always EINPROGRESS; the socket turns writable when the connection is
+// up or has failed (then simNetError() says why).
+int simNetConnect(int fd, uint32_t addr, uint16_t port);
+ssize_t simNetSend(int fd, const void *data, size_t len);
+ssize_t simNetRecv(int fd, void *buf, size_t len, bool peek);
+ssize_t simNetSendTo(int fd, const void *data, size_t len, uint32_t addr, uint16_t port);
+ssize_t simNetRecvFrom(int fd, void *buf, size_t len, uint32_t *addr, uint16_t *port);
+int simNetClose(int fd);
+// Pending error (SO_ERROR), cleared by reading it.
+int simNetError(int fd);
+int simNetPeer(int fd, uint32_t *addr, uint16_t *port);
+int simNetAvailable(int fd);  // bytes that have arrived
+int simNetGetFlags(int fd);
+int simNetSetFlags(int fd, int flags);
+
+// eventfd(2) counter.
+int simNetEventFd(unsigned int initial);
+ssize_t simNetEventWrite(int fd, const void *buf, size_t len);
+ssize_t simNetEventRead(int fd, void *buf, size_t len);
+
+bool simNetIsSocket(int fd);  // a simulated fd, as opposed to a host one
+bool simNetReadable(int fd);
+bool simNetWritable(int fd);
+
+struct SimNetStats {
+  uint64_t tcpBytes;       // delivered into receive buffers
+  uint32_t datagrams;
+  uint32_t connects;
+  uint32_t refused;
+  uint32_t resets;         // connections lost with the WiFi link
+  uint32_t linkChanges;
+};
+const SimNetStats &simNetStats();
+
+#endif // SIM_NET_H
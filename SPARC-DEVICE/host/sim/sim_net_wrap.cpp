@@ -0,0 +1,210 @@
+#include "sim_net.h"
+
+#include "sim_tasks.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stdarg.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <string.h>
+#include <unistd.h>
+
+// The firmware's socket calls, diverted here with the linker's --wrap
+// (CMakeLists.txt): a call to socket() in the firmware objects lands in
+// __wrap_socket(). Sockets the firmware opens live on the device
+// address. read/write/close/fcntl on host fds still reach the host
+// through __real_*.
+
+extern "C" {
+
+ssize_t __real_read(int fd, void *buf, size_t len);
+ssize_t __real_write(int fd, const void *buf, size_t len);
+int __real_close(int fd);
+int __real_fcntl(int fd, int cmd, ...);
+
+int __wrap_socket(int domain, int type, int protocol) {
+  (void)protocol;
+  if (domain != AF_INET) {
+    errno = EAFNOSUPPORT;
+    return -1;
+  }
+  return simNetSocket(simNetDeviceAddr(), type & ~(SOCK_NONBLOCK | SOCK_CLOEXEC));
+}
+
+static bool toSim(const struct sockaddr *sa, socklen_t len, uint32_t &addr, uint16_t &port) {
+  if (!sa || len < (socklen_t)sizeof(sockaddr_in) || sa->sa_family != AF_INET) {
+    errno = EINVAL;
+    return false;
+  }
+  const sockaddr_in *in = (const sockaddr_in*)sa;
+  addr = in->sin_addr.s_addr;
+  port = ntohs(in->sin_port);
+  return true;
+}
+
+static void fromSim(struct sockaddr *sa, socklen_t *len, uint32_t addr, uint16_t port) {
+  if (!sa || !len) return;
+  sockaddr_in in = {};
+  in.sin_family = AF_INET;
+  in.sin_addr.s_addr = addr;
+  in.sin_port = htons(port);
+  socklen_t n = *len < (socklen_t)sizeof(in) ? *len : (socklen_t)sizeof(in);
+  memcpy(sa, &in, n);
+  *len = sizeof(in);
+}
+
+int __wrap_bind(int fd, const struct sockaddr *sa, socklen_t len) {
+  uint32_t addr;
+  uint16_t port;
+  if (!toSim(sa, len, addr, port)) return -1;
+  return simNetBind(fd, addr, port);
+}
+
+int __wrap_listen(int fd, int backlog) {
+  return simNetListen(fd, backlog);
+}
+
+int __wrap_accept(int fd, struct sockaddr *sa, socklen_t *len) {
+  uint32_t addr;
+  uint16_t port;
+  int newFd = simNetAccept(fd, &addr, &port);
+  if (newFd >= 0) fromSim(sa, len, addr, port);
+  return newFd;
+}
+
+int __wrap_connect(int fd, const struct sockaddr *sa, socklen_t len) {
+  uint32_t addr;
+  uint16_t port;
+  if (!toSim(sa, len, addr, port)) return -1;
+  return simNetConnect(fd, addr, port);
+}
+
+ssize_t __wrap_send(int fd, const void *data, size_t len, int flags) {
+  (void)flags;
+  return simNetSend(fd, data, len);
+}
+
+ssize_t __wrap_recv(int fd, void *buf, size_t len, int flags) {
+  return simNetRecv(fd, buf, len, flags & MSG_PEEK);
+}
+
+ssize_t __wrap_sendto(int fd, const void *data, size_t len, int flags,
+                      const struct sockaddr *sa, socklen_t saLen) {
+  (void)flags;
+  if (!sa) return simNetSend(fd, data, len);
+  uint32_t addr;
+  uint16_t port;
+  if (!toSim(sa, saLen, addr, port)) return -1;
+  return simNetSendTo(fd, data, len, addr, port);
+}
+
+ssize_t __wrap_recvfrom(int fd, void *buf, size_t len, int flags,
+                        struct sockaddr *sa, socklen_t *saLen) {
+  (void)flags;
+  uint32_t addr = 0;
+  uint16_t port = 0;
+  ssize_t n = simNetRecvFrom(fd, buf, len, &addr, &port);
+  if (n >= 0) fromSim(sa, saLen, addr, port);
+  return n;
+}
+
+int __wrap_setsockopt(int fd, int level, int name, const void *value, socklen_t len) {
+  (void)level; (void)name; (void)value; (void)len;
+  return simNetIsSocket(fd) ? 0 : (errno = EBADF, -1);
+}
+
+int __wrap_getsockopt(int fd, int level, int name, void *value, socklen_t *len) {
+  if (!simNetIsSocket(fd)) {
+    errno = EBADF;
+    return -1;
+  }
+  int v = level == SOL_SOCKET && name == SO_ERROR ? simNetError(fd) : 0;
+  if (value && len && *len >= (socklen_t)sizeof(v)) {
+    memcpy(value, &v, sizeof(v));
+    *len = sizeof(v);
+  }
+  return 0;
+}
+
+int __wrap_eventfd(unsigned int initial, int flags) {
+  (void)flags;
+  return simNetEventFd(initial);
+}
+
+ssize_t __wrap_read(int fd, void *buf, size_t len) {
+  if (!simNetIsSocket(fd)) return __real_read(fd, buf, len);
+  ssize_t n = simNetEventRead(fd, buf, len);
+  if (n < 0 && errno == EINVAL) n = simNetRecv(fd, buf, len, false);
+  return n;
+}
+
+ssize_t __wrap_write(int fd, const void *buf, size_t len) {
+  if (!simNetIsSocket(fd)) return __real_write(fd, buf, len);
+  ssize_t n = simNetEventWrite(fd, buf, len);
+  if (n < 0 && errno == EINVAL) n = simNetSend(fd, buf, len);
+  return n;
+}
+
+int __wrap_close(int fd) {
+  return simNetIsSocket(fd) ? simNetClose(fd) : __real_close(fd);
+}
+
+int __wrap_fcntl(int fd, int cmd, ...) {
+  va_list ap;
+  va_start(ap, cmd);
+  long arg = va_arg(ap, long);
+  va_end(ap);
+  if (!simNetIsSocket(fd)) return __real_fcntl(fd, cmd, arg);
+  if (cmd == F_GETFL) return simNetGetFlags(fd);
+  if (cmd == F_SETFL) return simNetSetFlags(fd, (int)arg);
+  return 0;
+}
+
+// select() over simulated fds only. With nothing ready it waits in
+// virtual time, letting the other tasks run, until something is or the
+// timeout passes.
+struct SelectArgs {
+  int nfds;
+  const fd_set *read;
+  const fd_set *write;
+};
+
+static int readyCount(const SelectArgs &a, fd_set *readOut, fd_set *writeOut) {
+  int n = 0;
+  if (readOut) FD_ZERO(readOut);
+  if (writeOut) FD_ZERO(writeOut);
+  for (int fd = 0; fd < a.nfds; fd++) {
+    if (a.read && FD_ISSET(fd, a.read) && simNetReadable(fd)) {
+      if (readOut) FD_SET(fd, readOut);
+      n++;
+    }
+    if (a.write && FD_ISSET(fd, a.write) && simNetWritable(fd)) {
+      if (writeOut) FD_SET(fd, writeOut);
+      n++;
+    }
+  }
+  return n;
+}
+
+static bool anyReady(void *arg) {
+  return readyCount(*(const SelectArgs*)arg, nullptr, nullptr) > 0;
+}
+
+int __wrap_select(int nfds, fd_set *readSet, fd_set *writeSet, fd_set *exceptSet, struct timeval *timeout) {
+  fd_set want[2];
+  if (readSet) want[0] = *readSet;
+  if (writeSet) want[1] = *writeSet;
+  SelectArgs args = { nfds, readSet ? &want[0] : nullptr, writeSet ? &want[1] : nullptr };
+  if (exceptSet) FD_ZERO(exceptSet);
+
+  if (readyCount(args, nullptr, nullptr) == 0) {
+    uint64_t deadline = SIM_FOREVER;
+    if (timeout) deadline = simClockMicros() + timeout->tv_sec * 1000000ULL + timeout->tv_usec;
+    if (deadline > simClockMicros()) simTaskWait(anyReady, &args, deadline);
+  }
+  return readyCount(args, readSet, writeSet);
+}
+
+}  // extern "C"
@@ -0,0 +1,203 @@
+#include "sim_tasks.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+struct SimTask {
+  const char *name;
+  unsigned priority;
+  void (*fn)(void*);
+  void *arg;
+  std::condition_variable cv;
+  bool started;
+  bool deleted;
+  bool waiting;
+  bool (*ready)(void*);
+  void *readyArg;
+  uint64_t deadline;
+  uint64_t turn;  // when it last got the CPU, for round robin
+  uint32_t notifyCount;
+  std::chrono::steady_clock::time_point resumedAt;
+  uint32_t runs;
+  uint64_t hostNs;
+  uint64_t maxRunNs;
+};
+
+// Only the current task's thread runs; the lock just hands the turn over.
+static std::mutex turnLock;
+static std::vector<SimTask*> tasks;
+static SimTask *current = nullptr;
+static uint64_t turns = 0;
+
+static SimTask *newTask(const char *name, unsigned priority) {
+  SimTask *t = new SimTask();
+  t->name = name;
+  t->priority = priority;
+  t->deadline = SIM_FOREVER;
+  tasks.push_back(t);
+  return t;
+}
+
+static void resumed(SimTask *t) {
+  t->runs++;
+  t->resumedAt = std::chrono::steady_clock::now();
+}
+
+static void paused(SimTask *t) {
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - t->resumedAt).count();
+  t->hostNs += ns;
+  if (ns > t->maxRunNs) t->maxRunNs = ns;
+}
+
+static bool runnable(SimTask *t, uint64_t now) {
+  if (t->deleted) return false;
+  if (!t->started) return true;
+  if (!t->waiting) return false;
+  return now >= t->deadline || (t->ready && t->ready(t->readyArg));
+}
+
+static SimTask *pickNext() {
+  for (;;) {
+    uint64_t now = simClockMicros();
+    SimTask *best = nullptr;
+    for (SimTask *t : tasks) {
+      if (!runnable(t, now)) continue;
+      if (!best || t->priority > best->priority ||
+          (t->priority == best->priority && t->turn < best->turn)) {
+        best = t;
+      }
+    }
+    if (best) return best;
+
+    uint64_t next = simClockNextEvent();
+    for (SimTask *t : tasks) {
+      if (!t->deleted && t->waiting && t->deadline < next) next = t->deadline;
+    }
+    if (next == SIM_FOREVER) {
+      fprintf(stderr, "sim: every task is waiting with no deadline\n");
+      abort();
+    }
+    simClockAdvanceTo(next);
+  }
+}
+
+static void taskMain(SimTask *t) {
+  {
+    std::unique_lock<std::mutex> lk(turnLock);
+    t->cv.wait(lk, [t] { return current == t; });
+  }
+  resumed(t);
+  t->fn(t->arg);
+  simTaskDelete();  // FreeRTOS tasks must not return; treat it as a delete
+}
+
+// Called with turnLock held by the current task once it is waiting (or
+// deleted). Returns when it is this task's turn again.
+static void switchAway(SimTask *self, std::unique_lock<std::mutex> &lk) {
+  SimTask *next = pickNext();
+  next->turn = ++turns;
+  if (next == self) return;
+  current = next;
+  if (!next->started) {
+    next->started = true;
+    std::thread(taskMain, next).detach();
+  } else {
+    next->cv.notify_one();
+  }
+  self->cv.wait(lk, [self] { return current == self; });
+}
+
+SimTask *simTaskAdopt(const char *name, unsigned priority) {
+  std::lock_guard<std::mutex> lk(turnLock);
+  SimTask *t = newTask(name, priority);
+  t->started = true;
+  t->turn = ++turns;
+  current = t;
+  resumed(t);
+  return t;
+}
+
+SimTask *simTaskCreate(void (*fn)(void*), void *arg, const char *name, unsigned priority) {
+  std::lock_guard<std::mutex> lk(turnLock);
+  SimTask *t = newTask(name, priority);
+  t->fn = fn;
+  t->arg = arg;
+  return t;
+}
+
+SimTask *simTaskCurrent() {
+  return current;
+}
+
+void simTaskDelete() {
+  SimTask *self = current;
+  paused(self);
+  std::unique_lock<std::mutex> lk(turnLock);
+  self->deleted = true;
+  switchAway(self, lk);
+  abort();  // a deleted task is never picked again
+}
+
+bool simTaskWait(bool (*ready)(void*), void *arg, uint64_t deadlineUs) {
+  SimTask *self = current;
+  paused(self);
+  {
+    std::unique_lock<std::mutex> lk(turnLock);
+    self->ready = ready;
+    self->readyArg = arg;
+    self->deadline = deadlineUs;
+    self->waiting = true;
+    switchAway(self, lk);
+    self->waiting = false;
+    self->ready = nullptr;
+    self->deadline = SIM_FOREVER;
+  }
+  resumed(self);
+  return ready && ready(arg);
+}
+
+void simTaskSleepUntil(uint64_t us) {
+  simTaskWait(nullptr, nullptr, us);
+}
+
+void simTaskNotify(SimTask *task) {
+  if (task) task->notifyCount++;
+}
+
+static bool notified(void *task) {
+  return static_cast<SimTask*>(task)->notifyCount > 0;
+}
+
+uint32_t simTaskNotifyTake(bool clear, uint64_t deadlineUs) {
+  SimTask *self = current;
+  if (self->notifyCount == 0 && deadlineUs > simClockMicros()) {
+    simTaskWait(notified, self, deadlineUs);
+  }
+  uint32_t count = self->notifyCount;
+  if (clear) self->notifyCount = 0;
+  else if (count) self->notifyCount--;
+  return count;
+}
+
+int simTaskStats(SimTaskStats *out, int max) {
+  int n = 0;
+  for (SimTask *t : tasks) {
+    if (n < max) out[n] = { t->name, t->priority, t->runs, t->hostNs, t->maxRunNs };
+    n++;
+  }
+  return n;
+}
+
+void simTaskResetStats() {
+  for (SimTask *t : tasks) {
+    t->runs = 0;
+    t->hostNs = 0;
+    t->maxRunNs = 0;
+  }
+}
@@ -0,0 +1,51 @@
+#ifndef SIM_TASKS_H
+#define SIM_TASKS_H
+
+#include <stdint.h>
+
+#include "sim_clock.h"
+
+// FreeRTOS tasks for the host build. Every task is a host thread, but
+// they take turns: exactly one runs at a time, and it keeps running
+// until it waits (queue receive, notify take, delay, select). Then the
+// highest priority task whose wait is over runs next, oldest turn first
+// among equals; when none is, the virtual clock jumps to the earliest
+// deadline. The firmware's tasks run unchanged, and a run is the same
+// every time.
+//
+// Host time spent in each task between waits is measured, which is the
+// cost of one pass of that task's loop.
+struct SimTask;
+
+// Make the calling thread a task (the one that runs setup()).
+SimTask *simTaskAdopt(const char *name, unsigned priority);
+// New task; it first runs when the current one waits.
+SimTask *simTaskCreate(void (*fn)(void*), void *arg, const char *name, unsigned priority);
+SimTask *simTaskCurrent();
+// End the current task. Does not return.
+void simTaskDelete();
+
+// Wait until ready(arg) holds or the clock reaches deadlineUs
+// (SIM_FOREVER: no deadline). ready may be null for a plain sleep; it is
+// checked in the scheduler, so it must only look at simulator state.
+// Returns whether ready(arg) held.
+bool simTaskWait(bool (*ready)(void*), void *arg, uint64_t deadlineUs);
+void simTaskSleepUntil(uint64_t us);
+
+// Task notification counter (xTaskNotifyGive / ulTaskNotifyTake).
+void simTaskNotify(SimTask *task);
+uint32_t simTaskNotifyTake(bool clear, uint64_t deadlineUs);
+
+struct SimTaskStats {
+  const char *name;
+  unsigned priority;
+  uint32_t runs;        // times it got the CPU
+  uint64_t hostNs;      // host time spent running
+  uint64_t maxRunNs;    // longest single run
+};
+
+// Copies up to max entries, in creation order; returns the task count.
+int simTaskStats(SimTaskStats *out, int max);
+void simTaskResetStats();
+
+#endif // SIM_TASKS_H
@@ -2,23 +2,23 @@
 #define VARIABLE_H
 #include <Arduino.h>
 #include<WiFi.h>
+#include <atomic>
 
 extern String userId;
 
 extern String ssid;
 extern String password;
 
-extern int blinkDuration;
-extern int blinkGap;
+// Read by the sensor task's classifier, written by the settings page,
+// commands and calibration on other tasks.
+extern std::atomic<int> blinkDuration;
+extern std::atomic<int> blinkGap;
 
 extern bool clientConnected;
-extern bool clientFound;
-extern WiFiClient tempClient;
-extern WiFiClient client;
-extern WiFiServer server;
 
 #include <IPAddress.h>
 
+extern bool useStaticIP;
 extern IPAddress local_IP;
 extern IPAddress gateway;
 extern IPAddress subnet;
@@ -0,0 +1,28 @@
+// Auto-generated by tools/emoji_pack.py - do not edit
+
+#ifndef EMOJI_ASSETS_H
+#define EMOJI_ASSETS_H
+
+#include <stdint.h>
+
+// Palette + run-length compressed RGB565 icon. Each data byte is one
+// run: high nibble = length - 1, low nibble = palette index.
+struct EmojiAsset {
+  uint8_t width;
+  uint8_t height;
+  const uint16_t *palette;
+  const uint8_t *data;
+  uint16_t dataLen;
+};
+
+enum EmojiId : uint8_t {
+  EMOJI_DOCTOR,
+  EMOJI_FOOD,
+  EMOJI_SETTINGS,
+  EMOJI_TOILET,
+  EMOJI_COUNT
+};
+
+extern const EmojiAsset emojiAssets[EMOJI_COUNT];
+
+#endif // EMOJI_ASSETS_H
@@ -0,0 +1,56 @@
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <Arduino.h>
+
+// Text with its storage inline, for anything rebuilt while the firmware
+// runs (typed message, popup labels). Never touches the heap; appends
+// past the capacity are cut off and return false.
+template <size_t N>
+class FixedString {
+ public:
+  FixedString() { clear(); }
+  FixedString(const char *s) { assign(s); }
+
+  FixedString &operator=(const char *s) {
+    assign(s);
+    return *this;
+  }
+
+  void clear() {
+    len = 0;
+    buf[0] = '\0';
+  }
+  bool assign(const char *s) {
+    clear();
+    return append(s);
+  }
+  bool append(char c) {
+    if (len >= N) return false;
+    buf[len++] = c;
+    buf[len] = '\0';
+    return true;
+  }
+  bool append(const char *s) {
+    while (*s) {
+      if (!append(*s++)) return false;
+    }
+    return true;
+  }
+  void removeLast() {
+    if (len) buf[--len] = '\0';
+  }
+
+  const char *c_str() const { return buf; }
+  size_t length() const { return len; }
+  bool isEmpty() const { return len == 0; }
+  static constexpr size_t capacity() { return N; }
+  char operator[](size_t i) const { return buf[i]; }
+  bool operator==(const char *s) const { return strcmp(buf, s) == 0; }
+
+ private:
+  char buf[N + 1];
+  size_t len;
+};
+
+#endif // FIXED_STRING_H
@@ -0,0 +1,33 @@
+// Auto-generated by tools/lexicon_pack.py - do not edit
+
+#ifndef LEXICON_ASSETS_H
+#define LEXICON_ASSETS_H
+
+#include <stdint.h>
+
+// Letter trie, one node after another (root at offset 0):
+//   header  bit 7 = a word ends here, bits 0-5 = number of children
+//   best    highest word frequency at or below this node
+//   [freq, id lo, id hi] when a word ends here
+//   children * [letter, offset 3 bytes little endian], best first
+// Frequencies are log-quantised to 1..255; ids index lexiconWordOffsets.
+static const uint8_t LEXICON_TERMINAL = 0x80;
+static const uint8_t LEXICON_CHILD_MASK = 0x3F;
+static const uint16_t LEXICON_WORD_COUNT = 661;
+static const uint16_t LEXICON_BIGRAM_COUNT = 121;
+// Previous word id for pairs that open a message.
+static const uint16_t LEXICON_START = 0xFFFF;
+
+// Sorted by prev, then by falling freq.
+struct LexiconBigram {
+  uint16_t prev;
+  uint16_t next;
+  uint8_t freq;
+};
+
+extern const uint8_t lexiconTrie[];
+extern const char lexiconWords[];  // NUL separated
+extern const uint16_t lexiconWordOffsets[LEXICON_WORD_COUNT];
+extern const LexiconBigram lexiconBigrams[LEXICON_BIGRAM_COUNT];
+
+#endif // LEXICON_ASSETS_H
@@ -0,0 +1,158 @@
+#include "audio.h"
+
+#include <Arduino.h>
+#include <DFRobotDFPlayerMini.h>
+#include <HardwareSerial.h>
+
+HardwareSerial myDFSerial(2);  // Use UART2 (pins 16, 17)
+DFRobotDFPlayerMini myDFPlayer;
+
+struct AudioCommand {
+  uint8_t track;
+  AudioKind kind;
+};
+
+static const uint8_t AUDIO_QUEUE_SIZE = 8;
+// audioLoop() sleeps on the request queue for at most this long so the
+// "finished" feedback is still polled regularly.
+static const TickType_t AUDIO_POLL_TICKS = pdMS_TO_TICKS(10);
+// Give up waiting for "play finished" after this long, in case the
+// feedback frame is lost. Startup prompts are long.
+static const unsigned long CLICK_MAX_MS = 1000;
+static const unsigned long SPEECH_MAX_MS = 3000;
+static const unsigned long PROMPT_MAX_MS = 30000;
+
+// Requests from other tasks; only the audio task touches the play queue.
+static QueueHandle_t requestQueue = nullptr;
+
+static AudioCommand queue[AUDIO_QUEUE_SIZE];
+static uint8_t queueHead = 0;
+static uint8_t queueCount = 0;
+
+static bool audioReady = false;
+static bool playing = false;
+static AudioCommand current;
+static unsigned long playStartTime = 0;
+
+static unsigned long maxDuration(AudioKind kind) {
+  switch (kind) {
+    case AUDIO_CLICK: return CLICK_MAX_MS;
+    case AUDIO_SPEECH: return SPEECH_MAX_MS;
+    default: return PROMPT_MAX_MS;
+  }
+}
+
+// Drop queued commands that a newer click/speech makes stale.
+static void dropStale() {
+  uint8_t kept = 0;
+  for (uint8_t i = 0; i < queueCount; i++) {
+    AudioCommand c = queue[(queueHead + i) % AUDIO_QUEUE_SIZE];
+    if (c.kind == AUDIO_SPEECH) queue[(queueHead + kept++) % AUDIO_QUEUE_SIZE] = c;
+  }
+  queueCount = kept;
+}
+
+static void startPlayback(const AudioCommand &c) {
+  myDFPlayer.play(c.track);
+  current = c;
+  playing = true;
+  playStartTime = millis();
+}
+
+void audioTaskSetup() {
+  requestQueue = xQueueCreate(AUDIO_QUEUE_SIZE, sizeof(AudioCommand));
+}
+
+bool audioSetup() {
+  Serial.println("*** INITIALIZING DFPLAYER AUDIO MODULE ***");
+  myDFSerial.begin(9600, SERIAL_8N1, 16, 17);
+  Serial.println("*** DFPLAYER SERIAL PORT INITIALIZED ***");
+  // No ACK and no reset handshake: commands are fire-and-forget so
+  // neither begin() nor play() ever waits on the player.
+  if (!myDFPlayer.begin(myDFSerial, false, false)) {
+    Serial.println("*** ERROR: DFPlayer Mini not detected! ***");
+    Serial.println("*** CHECK WIRING: TX->16, RX->17, VCC->5V, GND->GND ***");
+    // Don't use while(1) - just continue without audio
+    return false;
+  }
+  myDFPlayer.volume(30);
+  audioReady = true;
+  Serial.println("*** DFPLAYER READY - AUDIO MODULE INITIALIZED SUCCESSFULLY ***");
+  return true;
+}
+
+void audioPlay(uint8_t track, AudioKind kind) {
+  AudioCommand c = { track, kind };
+  // The audio task drains the request queue at least every poll, so
+  // speech can afford to wait that long for a slot.
+  TickType_t wait = kind == AUDIO_SPEECH ? AUDIO_POLL_TICKS : 0;
+  if (requestQueue) xQueueSend(requestQueue, &c, wait);
+}
+
+// Drop the oldest queued click to make room. False if there is none.
+static bool evictClick() {
+  for (uint8_t i = 0; i < queueCount; i++) {
+    if (queue[(queueHead + i) % AUDIO_QUEUE_SIZE].kind != AUDIO_CLICK) continue;
+    for (uint8_t j = i; j + 1 < queueCount; j++) {
+      queue[(queueHead + j) % AUDIO_QUEUE_SIZE] = queue[(queueHead + j + 1) % AUDIO_QUEUE_SIZE];
+    }
+    queueCount--;
+    return true;
+  }
+  return false;
+}
+
+static void push(const AudioCommand &c) {
+  // Full of speech and prompts: the new request loses, not what the
+  // patient is already waiting to hear.
+  if (queueCount == AUDIO_QUEUE_SIZE && !evictClick()) return;
+  queue[(queueHead + queueCount) % AUDIO_QUEUE_SIZE] = c;
+  queueCount++;
+}
+
+// Apply the queueing rules to a request taken off requestQueue.
+static void enqueue(const AudioCommand &c) {
+  if (c.kind != AUDIO_PROMPT) {
+    dropStale();
+    if (playing && current.kind != AUDIO_SPEECH) {
+      // Cut off the click/prompt that is playing right now. Speech
+      // already waiting goes first so it stays in order.
+      if (c.kind == AUDIO_SPEECH && queueCount > 0) {
+        AudioCommand next = queue[queueHead];
+        queueHead = (queueHead + 1) % AUDIO_QUEUE_SIZE;
+        queueCount--;
+        startPlayback(next);
+        push(c);
+      } else {
+        startPlayback(c);
+      }
+      return;
+    }
+  }
+  push(c);
+}
+
+void audioLoop() {
+  AudioCommand c;
+  if (xQueueReceive(requestQueue, &c, AUDIO_POLL_TICKS) == pdTRUE) {
+    do {
+      if (audioReady) enqueue(c);
+    } while (xQueueReceive(requestQueue, &c, 0) == pdTRUE);
+  }
+  if (!audioReady) return;
+  while (myDFPlayer.available()) {
+    uint8_t type = myDFPlayer.readType();
+    if (type == DFPlayerPlayFinished || type == DFPlayerError) playing = false;
+  }
+  if (playing && millis() - playStartTime > maxDuration(current.kind)) playing = false;
+  if (!playing && queueCount > 0) {
+    c = queue[queueHead];
+    queueHead = (queueHead + 1) % AUDIO_QUEUE_SIZE;
+    queueCount--;
+    startPlayback(c);
+  }
+}
+
+bool audioBusy() {
+  return playing || queueCount > 0 || uxQueueMessagesWaiting(requestQueue) > 0;
+}
@@ -0,0 +1,28 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <Arduino.h>
+
+// What a track is for; decides queueing and preemption.
+enum AudioKind : uint8_t {
+  AUDIO_PROMPT,  // startup/status sounds, played in order, cut short by anything
+  AUDIO_CLICK,   // navigation feedback, only the newest one matters
+  AUDIO_SPEECH,  // spoken character/word, never dropped once queued
+};
+
+// Non-blocking DFPlayer front end. audioPlay() may be called from any
+// task and only posts a request; audioLoop() runs on the audio task,
+// tracks playback from the player's "finished" feedback and starts the
+// next command. Rules:
+//  - a new click or speech drops queued clicks/prompts (they are stale)
+//    and cuts off a playing click/prompt
+//  - speech waits for speech already playing or queued
+//  - a full queue makes room by dropping its oldest click; if it holds
+//    none, the new request is dropped instead
+void audioTaskSetup();  // before any audioPlay(); creates the request queue
+bool audioSetup();      // DFPlayer, on the audio task
+void audioPlay(uint8_t track, AudioKind kind);
+void audioLoop();       // blocks up to 10 ms waiting for requests
+bool audioBusy();
+
+#endif // AUDIO_H
@@ -0,0 +1,98 @@
+#include "auto_scan.h"
+
+#include <Preferences.h>
+
+static const uint16_t DWELL_START_MS = 1500;
+static const uint16_t DWELL_MIN_MS = 600;
+static const uint16_t DWELL_MAX_MS = 5000;
+static const uint16_t DEVIATION_FACTOR = 4;
+static const unsigned long SAVE_DELAY_MS = 30000;
+
+// Reaction time and its mean deviation are running averages (gains 1/8
+// and 1/4); the dwell moves a quarter of the way to its target per
+// selection, so a single slow or quick one does not jerk the pace.
+struct DwellState {
+  uint16_t dwell;
+  uint16_t reaction;
+  uint16_t deviation;
+  uint16_t samples;
+  uint16_t late;
+};
+static DwellState state = { DWELL_START_MS, 0, 0, 0, 0 };
+static volatile bool enabled = false;
+static bool stateDirty = false;
+static unsigned long stateChangedAt = 0;
+static Preferences dwellPrefs;
+
+void autoScanSetup() {
+  Preferences prefs;
+  prefs.begin("blinkcfg", true);
+  enabled = prefs.getUChar("autoScan", 0);
+  prefs.end();
+  dwellPrefs.begin("scan", true);
+  if (dwellPrefs.getBytesLength("dwell") == sizeof(state)) dwellPrefs.getBytes("dwell", &state, sizeof(state));
+  dwellPrefs.end();
+}
+
+bool autoScanEnabled() {
+  return enabled;
+}
+
+void autoScanSetEnabled(bool on) {
+  enabled = on;
+  Preferences prefs;  // network and UI task both get here
+  prefs.begin("blinkcfg", false);
+  prefs.putUChar("autoScan", on ? 1 : 0);
+  prefs.end();
+}
+
+uint16_t autoScanDwell() {
+  return state.dwell;
+}
+
+static void setDwell(uint32_t dwell) {
+  if (dwell < DWELL_MIN_MS) dwell = DWELL_MIN_MS;
+  if (dwell > DWELL_MAX_MS) dwell = DWELL_MAX_MS;
+  state.dwell = dwell;
+  stateDirty = true;
+  stateChangedAt = millis();
+}
+
+void autoScanReaction(uint32_t ms) {
+  if (ms > DWELL_MAX_MS) ms = DWELL_MAX_MS;
+  if (state.samples == 0) {
+    state.reaction = ms;
+    state.deviation = ms / 2;
+  } else {
+    int32_t err = (int32_t)ms - state.reaction;
+    state.reaction += err / 8;
+    state.deviation += ((err < 0 ? -err : err) - (int32_t)state.deviation) / 4;
+  }
+  if (state.samples < 0xFFFF) state.samples++;
+  int32_t target = state.reaction + DEVIATION_FACTOR * state.deviation;
+  setDwell(state.dwell + (target - (int32_t)state.dwell) / 4);
+}
+
+void autoScanLate() {
+  state.late++;
+  // Widen the spread too, or the next selections pull the dwell straight back.
+  state.deviation += state.dwell / 16;
+  setDwell(state.dwell + state.dwell / 8);
+}
+
+void autoScanLoop() {
+  if (!stateDirty || millis() - stateChangedAt < SAVE_DELAY_MS) return;
+  dwellPrefs.begin("scan", false);
+  dwellPrefs.putBytes("dwell", &state, sizeof(state));
+  dwellPrefs.end();
+  stateDirty = false;
+}
+
+void autoScanPrintStatus(Stream &out) {
+  out.print("Auto scan: "); out.print(enabled ? "ON" : "OFF");
+  out.print(", dwell ms: "); out.print(state.dwell);
+  out.print(", reaction ms: "); out.print(state.reaction); out.print(" +/- "); out.print(state.deviation);
+  out.print(", selections: "); out.print(state.samples);
+  out.print(", late blinks: "); out.print(state.late);
+  out.print(stateDirty ? " (unsaved)\n" : "\n");
+}
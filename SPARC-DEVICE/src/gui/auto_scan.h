@@ -0,0 +1,31 @@
+#ifndef AUTO_SCAN_H
+#define AUTO_SCAN_H
+
+#include <Arduino.h>
+
+// Timed scanning: the highlight moves on by itself after a dwell time and
+// any blink selects what is highlighted, so moving costs no blinks. The
+// dwell follows the patient's reaction time, measured from the highlight
+// arriving on a stop to the eye closing to select it:
+//   dwell = mean reaction + 4 * mean deviation, within DWELL_MIN..MAX,
+// and a blink that starts right after the highlight moved on (it was
+// meant for the stop before) lengthens it. The on/off setting and the
+// dwell are kept in NVS.
+
+void autoScanSetup();  // load the setting and dwell from NVS
+
+bool autoScanEnabled();
+void autoScanSetEnabled(bool on);  // saved to NVS
+
+uint16_t autoScanDwell();  // ms the highlight stays on a stop
+
+// The eye closed `ms` after the highlight reached the stop it selected.
+void autoScanReaction(uint32_t ms);
+// The eye closed just after the highlight left the stop it was meant for.
+void autoScanLate();
+
+void autoScanLoop();  // UI task: writes the dwell back to NVS after a quiet spell
+
+void autoScanPrintStatus(Stream &out);
+
+#endif // AUTO_SCAN_H
@@ -0,0 +1,30 @@
+#include "emoji.h"
+
+#include <TFT_eSPI.h>
+
+// Widest icon we can stream; emoji_pack.py icons are 24 or 48 px.
+static const int MAX_EMOJI_WIDTH = 64;
+
+void drawEmoji(TFT_eSPI &g, int x, int y, EmojiId id) {
+    if (id >= EMOJI_COUNT) return;
+    const EmojiAsset &a = emojiAssets[id];
+    if (a.width > MAX_EMOJI_WIDTH) return;
+
+    static uint16_t line[MAX_EMOJI_WIDTH];
+    uint16_t pos = 0;     // next byte in a.data
+    uint8_t runLeft = 0;  // pixels left in the current run
+    uint16_t color = 0;
+    for (int row = 0; row < a.height; row++) {
+        for (int col = 0; col < a.width; col++) {
+            if (runLeft == 0) {
+                if (pos >= a.dataLen) return; // truncated asset
+                uint8_t run = a.data[pos++];
+                runLeft = (run >> 4) + 1;
+                color = a.palette[run & 0x0F];
+            }
+            line[col] = color;
+            runLeft--;
+        }
+        g.pushImage(x, y + row, a.width, 1, line);
+    }
+}
@@ -0,0 +1,11 @@
+#ifndef EMOJI_H
+#define EMOJI_H
+
+#include "../../include/emoji/emoji_assets.h"
+
+#include <TFT_eSPI.h>
+
+// Decode a compressed icon line by line and push it at (x, y).
+void drawEmoji(TFT_eSPI &g, int x, int y, EmojiId id);
+
+#endif // EMOJI_H
@@ -0,0 +1,65 @@
+// Auto-generated by tools/emoji_pack.py - do not edit
+
+#include "../../include/emoji/emoji_assets.h"
+
+static const uint16_t doctorPalette[8] = {
+  0x0010, 0xFFFF, 0xF79F, 0xEF5E, 0xFFDF, 0xE71D, 0x6316, 0x6B56,
+};
+static const uint8_t doctorData[89] = {
+  0xF0, 0xF0, 0x00, 0x51, 0xF0, 0x00, 0x71, 0xE0, 0x91, 0xD0, 0x91, 0x02, 0xB0, 0xB1, 0xB0, 0xB1,
+  0xB0, 0xB1, 0xC0, 0x91, 0x03, 0xC0, 0x91, 0xE0, 0x71, 0xF0, 0x00, 0x51, 0xF0, 0xF0, 0xF0, 0xF0,
+  0x01, 0x70, 0x01, 0xA0, 0x01, 0x10, 0x91, 0x04, 0x00, 0x01, 0x50, 0x05, 0x11, 0x10, 0x91, 0x20,
+  0x11, 0x20, 0x31, 0x20, 0x61, 0x03, 0x40, 0x11, 0x10, 0x31, 0x00, 0x01, 0x10, 0x51, 0x10, 0x21,
+  0x00, 0x11, 0x00, 0x41, 0x30, 0x51, 0x10, 0x21, 0x00, 0x81, 0x10, 0x61, 0x10, 0x11, 0x10, 0xF1,
+  0x21, 0x06, 0x11, 0x06, 0x07, 0xF1, 0xF1, 0xF1, 0x21,
+};
+
+static const uint16_t foodPalette[7] = {
+  0x0010, 0xFFFF, 0x8438, 0x9CF9, 0xEF5E, 0x4A74, 0xEF7E,
+};
+static const uint8_t foodData[112] = {
+  0x40, 0x01, 0xF0, 0x50, 0x11, 0xB0, 0x31, 0x30, 0x11, 0x00, 0x11, 0x90, 0x51, 0x30, 0x01, 0x10,
+  0x11, 0x70, 0x61, 0x02, 0x11, 0x00, 0x11, 0x10, 0x11, 0x50, 0x81, 0x00, 0x11, 0x00, 0x11, 0x00,
+  0x21, 0x30, 0x81, 0x03, 0x00, 0x04, 0x11, 0x00, 0x41, 0x30, 0x81, 0x20, 0x11, 0x00, 0x41, 0x30,
+  0x81, 0x30, 0x61, 0x30, 0x71, 0x50, 0x51, 0x30, 0x61, 0x70, 0x51, 0x10, 0x61, 0xC0, 0x21, 0x00,
+  0x21, 0xF0, 0x00, 0x31, 0x00, 0x01, 0xF0, 0x20, 0x21, 0xF0, 0x50, 0x21, 0xF0, 0x20, 0x01, 0x10,
+  0x21, 0xF0, 0x00, 0x21, 0x00, 0x31, 0xE0, 0x31, 0x10, 0x31, 0xC0, 0x05, 0x21, 0x30, 0x31, 0xB0,
+  0x21, 0x06, 0x40, 0x31, 0x90, 0x31, 0x60, 0x21, 0x90, 0x21, 0x70, 0x21, 0xF0, 0xF0, 0xF0, 0x40,
+};
+
+static const uint16_t settingsPalette[2] = {
+  0x0000, 0xFFFF,
+};
+static const uint8_t settingsData[196] = {
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x40, 0x71, 0xF0,
+  0xF0, 0x60, 0x91, 0xF0, 0xF0, 0x40, 0xB1, 0xF0, 0xF0, 0x30, 0xB1, 0xF0, 0xF0, 0x30, 0xB1, 0xF0,
+  0xF0, 0x30, 0xB1, 0xF0, 0xB0, 0x11, 0x40, 0xD1, 0x40, 0x11, 0xF0, 0x10, 0xF1, 0xF1, 0xE0, 0xF1,
+  0xF1, 0x11, 0xD0, 0xF1, 0xF1, 0x11, 0xC0, 0xF1, 0xF1, 0x31, 0xB0, 0xF1, 0xF1, 0x31, 0xA0, 0xF1,
+  0xF1, 0x51, 0x90, 0xF1, 0xF1, 0x51, 0x90, 0xF1, 0x01, 0x30, 0xF1, 0x01, 0x90, 0xE1, 0x70, 0xE1,
+  0xA0, 0xC1, 0x90, 0xC1, 0xC0, 0xB1, 0x90, 0xA1, 0xF0, 0x91, 0xB0, 0x91, 0xF0, 0x00, 0x81, 0xB0,
+  0x81, 0xF0, 0x10, 0x81, 0xB0, 0x81, 0xF0, 0x00, 0x91, 0xB0, 0x91, 0xE0, 0xB1, 0x90, 0xB1, 0xC0,
+  0xC1, 0x90, 0xC1, 0xA0, 0xE1, 0x70, 0xE1, 0x90, 0xF1, 0x01, 0x30, 0xF1, 0x01, 0x90, 0xF1, 0xF1,
+  0x51, 0x90, 0xF1, 0xF1, 0x51, 0xA0, 0xF1, 0xF1, 0x31, 0xB0, 0xF1, 0xF1, 0x31, 0xC0, 0xF1, 0xF1,
+  0x11, 0xD0, 0xF1, 0xF1, 0x11, 0xE0, 0xF1, 0xF1, 0xF0, 0x10, 0x11, 0x40, 0xD1, 0x40, 0x11, 0xF0,
+  0xB0, 0xB1, 0xF0, 0xF0, 0x30, 0xB1, 0xF0, 0xF0, 0x30, 0xB1, 0xF0, 0xF0, 0x30, 0xB1, 0xF0, 0xF0,
+  0x40, 0x91, 0xF0, 0xF0, 0x60, 0x71, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0x20,
+};
+
+static const uint16_t toiletPalette[4] = {
+  0x0010, 0xFFFF, 0x8418, 0x18D1,
+};
+static const uint8_t toiletData[66] = {
+  0x40, 0x41, 0xF0, 0x20, 0x41, 0xF0, 0x20, 0x11, 0x10, 0x01, 0xF0, 0x20, 0x11, 0x10, 0x01, 0xF0,
+  0x20, 0x41, 0xF0, 0x20, 0x41, 0xF0, 0x20, 0x41, 0xF0, 0x20, 0x41, 0xF0, 0x20, 0x41, 0x00, 0xA2,
+  0x60, 0x41, 0x00, 0xA1, 0xF0, 0xF0, 0xF1, 0x70, 0xF1, 0x70, 0xE1, 0xA0, 0xB1, 0xC0, 0x81, 0xE0,
+  0x71, 0x03, 0xE0, 0x71, 0xF0, 0x61, 0xF0, 0x00, 0x61, 0xF0, 0x00, 0x61, 0xF0, 0x71, 0xF0, 0xF0,
+  0xF0, 0x70,
+};
+
+const EmojiAsset emojiAssets[EMOJI_COUNT] = {
+  { 24, 24, doctorPalette, doctorData, 89 },
+  { 24, 24, foodPalette, foodData, 112 },
+  { 48, 48, settingsPalette, settingsData, 196 },
+  { 24, 24, toiletPalette, toiletData, 66 },
+};
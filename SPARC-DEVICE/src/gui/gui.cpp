@@ -1,48 +1,41 @@
 #include "gui.h"
 
-#include "../../include/emoji/emoji_arrays.h"
-#include "../../include/emoji/emoji_arrays3.h"
+#include "auto_scan.h"
+#include "emoji.h"
+#include "scan_order.h"
+#include "timer_wheel.h"
 
+#include "../network/blink_wifi.h"
+#include "../network/client_link.h"
 #include "../notifications/notif.h"
+#include "../phrases/phrases.h"
+#include "../predict/predict.h"
+#include "../sensor/blink_events.h"
 
 #include "../../include/common_variables.h"
+#include "../../include/fixed_string.h"
 
-#include <TFT_eSPI.h>
-#include <DFRobotDFPlayerMini.h>
-#include <HardwareSerial.h>
+#include "../audio/audio.h"
 
-HardwareSerial myDFSerial(2);  // Use UART2 (pins 16, 17)
-DFRobotDFPlayerMini myDFPlayer;
+#include <Preferences.h>
+#include <TFT_eSPI.h>
 
 void gui3InitAudio() {
-    Serial.println("*** INITIALIZING DFPLAYER AUDIO MODULE ***");
-    myDFSerial.begin(9600, SERIAL_8N1, 16, 17);
-    Serial.println("*** DFPLAYER SERIAL PORT INITIALIZED ***");
-    delay(500);
-    
-    if (!myDFPlayer.begin(myDFSerial)) {
-        Serial.println("*** ERROR: DFPlayer Mini not detected! ***");
-        Serial.println("*** CHECK WIRING: TX->16, RX->17, VCC->5V, GND->GND ***");
-        // Don't use while(1) - just continue without audio
-        return;
-    }
-    
-    myDFPlayer.volume(30);
-    Serial.println("*** DFPLAYER READY - AUDIO MODULE INITIALIZED SUCCESSFULLY ***");
+    if (!audioSetup()) return;
     Serial.println("*** PLAYING GUI STARTUP SOUND ***");
-    myDFPlayer.play(46); // Using track 46 for startup sound
-    delay(27000); // Wait for startup sound to play
-    myDFPlayer.play(47); // Using track 46 for startup sound
-    delay(1000); // Wait for startup sound to play
+    audioPlay(46, AUDIO_PROMPT); // Using track 46 for startup sound
+    audioPlay(47, AUDIO_PROMPT);
 }
 
 extern void openSettingsInterface();
 // --- Static variables for T9 state and UI ---
 static TFT_eSPI tft = TFT_eSPI();
-static String typedMessage = "";
+static const size_t MESSAGE_MAX = 96;
+static FixedString<MESSAGE_MAX> typedMessage;
 static bool cursorVisible = true;
-static unsigned long lastCursorBlink = 0;
 static const unsigned long cursorBlinkInterval = 500; // ms
+static void blinkCursor();
+static WheelTimer cursorTimer = { blinkCursor, nullptr, 0, false };
 static int cursorX = 0; // Global cursor X position
 
 // T9 layout and state
@@ -52,12 +45,73 @@ static const char* labels[12] = {
   "STU 7", "VWX 8", "YZ. 9",
   "", "0 _<-", ""
 };
-static int selectedCell = 0; // 0-11
+// Word completions sit in a row under the grid, scanned after cell 11
+// while there are any.
+static const int WORD_ROW = 12;
+static const int SCAN_STOPS = 13;
+static char predictions[PREDICT_MAX][PREDICT_WORD_MAX];
+static uint8_t predictionCount = 0;
+static int selectedCell = 0; // 0-11, or WORD_ROW
+// Phrase page (phrases.h): cells 0-8 hold phrases, cell 9 turns the page
+// and cell 10 goes back to the keyboard. Page 0 has the best ranked
+// phrases of the whole library, then each category gets as many pages
+// as it needs. There are no popups: a phrase goes out when its cell is
+// selected.
+static const int PHRASE_CELLS = 9;
+static const int PHRASE_MORE = 9;
+static const int PHRASE_BACK = 10;
+static bool phrasePage = false;
+static int phrasePageNo = 0;
+static uint8_t pagePhrases[PHRASE_CELLS]; // library indexes
+static int pagePhraseCount = 0;
+static void showKeyboard();
+static WheelTimer phraseTimer = { showKeyboard, nullptr, 0, false }; // back after a phrase is sent
+// Row and halves scanning highlight a group of stops (see ScanMode).
+static ScanMode scanMode = SCAN_LINEAR;
+static int scanRow = 0;        // rows: highlighted row, 4 = the word row
+static int rowSelected = -1;   // rows: row whose cells are stepped, -1 = stepping rows
+static int setFirst = 0;       // halves: stops still in play
+static int setCount = 0;
+// Timed scanning (auto_scan.h): stepTimer moves the highlight and any
+// blink selects. It holds still while the eye is closed or a gesture is
+// being blinked, so the gesture lands on what the patient saw.
+static const int AUTO_PASSES = 2;                // unanswered passes over a popup or row
+static const unsigned long LATE_BLINK_MS = 200;  // quicker than a reaction to the step
+static void autoStep();
+static WheelTimer stepTimer = { autoStep, nullptr, 0, false };
+static bool autoRunning = false;
+static unsigned long highlightAt = 0; // when the highlight got where it is
+static unsigned long gestureAt = 0;   // when the eye closed for the gesture being blinked
+static bool gestureActive = false;
+static int autoSteps = 0;             // steps since the last gesture
+// Where the highlight was before the last timed step, to go back to.
+struct ScanStep {
+    bool valid;
+    int cell, row, popup;
+    unsigned long at;
+};
+static ScanStep lastStep;
 static bool popupActive = false;
 static bool popupSelecting = false; // New: true when navigating popup
 static int popupIndex = 0; // index in popup
 static int popupCount = 0;
-static String lastPopupChars[6];
+// What a popup button does; the text is only for display and speech logs.
+enum PopupAction : uint8_t {
+  POPUP_CHAR,       // append text[0]
+  POPUP_SPACE,
+  POPUP_BACKSPACE,
+  POPUP_CLEAR,
+  POPUP_TOILET,
+  POPUP_FOOD,
+  POPUP_DOCTOR,
+  POPUP_WORD,       // complete the word being typed with text
+  POPUP_PHRASES,    // open the phrase page
+};
+struct PopupItem {
+  PopupAction action;
+  char text[PREDICT_WORD_MAX];
+};
+static PopupItem popupItems[6];
 static int popupXPositions[6];
 static int popupWidth = 50;
 static int popupSpacing = 5;
@@ -65,31 +119,86 @@ static const int popupBarY = 130;
 static const int popupBarHeight = 30;
 static unsigned long popupStartTime = 0;
 static const unsigned long popupTimeout = 5000; // 5 seconds
+static unsigned long popupCloseTime = 0;   // when a shown selection is cleared
+static const unsigned long popupSelectionFlash = 150; // ms of green feedback
+
+// Cell and popup button rings; cyan marks the second half in halves mode.
+enum BorderState : uint8_t { BORDER_NONE, BORDER_WHITE, BORDER_YELLOW, BORDER_GREEN, BORDER_CYAN };
 
 // --- Forward declarations for static helper functions ---
 static void drawMessageBox();
+static void updateMessageBox();
 static void drawT9Grid();
-static void highlightCell(int index);
 static void drawButton(int index, bool highlightYellow, bool highlightGreen);
+static void setCellBorder(int index, uint8_t border);
 static void setupPopup(int index);
 static void drawPopup();
+static void movePopupHighlight(int from, int to);
 static void drawPopupSelection(int idx);
 static void clearPopupText();
+static void guiSpritesSetup();
+static void tftSync();
+static void endFrame();
+static void closePopup();
+static void finishPopupSelection();
+static void refreshPredictions();
+static void restartScan(int stop);
+static void paintScan();
+static void openPopup();
+static void autoRestart();
+static void watchGesture();
+static void showPhrasePage(int page);
+static void drawPhraseTitle();
 
 // --- Setup ---
 void gui3Setup() {
     Serial.begin(115200);
+    tftSync();
     tft.init();
     tft.setRotation(2);
     uint16_t calData[5] = { 471, 2859, 366, 3388, 2 };
     tft.setTouch(calData);
+    guiSpritesSetup();
     tft.fillScreen(TFT_BLACK);
+    Preferences prefs;
+    prefs.begin("blinkcfg", false);
+    scanMode = (ScanMode)prefs.getUChar("scanMode", SCAN_LINEAR);
+    prefs.end();
+    if (scanMode >= SCAN_MODE_COUNT) scanMode = SCAN_LINEAR;
+    refreshPredictions();
     drawMessageBox();
     drawT9Grid();
-    highlightCell(selectedCell);
+    drawPhraseTitle();
+    restartScan(selectedCell);
+    paintScan();
+    timerWheelStart(cursorTimer, cursorBlinkInterval);
+    autoRunning = autoScanEnabled();
+    autoRestart();
 
    // gui3InitAudio();
 }
+ScanMode gui3ScanMode() {
+    return scanMode;
+}
+
+void gui3SetScanMode(ScanMode mode) {
+    if (mode >= SCAN_MODE_COUNT) return;
+    scanMode = mode;
+    restartScan(selectedCell); // the grid is repainted when it comes back
+    Preferences prefs;
+    prefs.begin("blinkcfg", false);
+    prefs.putUChar("scanMode", mode);
+    prefs.end();
+}
+
+const char *gui3ScanModeName(ScanMode mode) {
+    switch (mode) {
+        case SCAN_ROWS:   return "ROWS";
+        case SCAN_HALVES: return "HALVES";
+        default:          return "LINEAR";
+    }
+}
+
 void playSound(int track){
     Serial.print("[DFPlayer] playSound: Playing track ");
     Serial.print(track);
@@ -111,29 +220,29 @@ void playSound(int track){
             }
     }
     Serial.println(")");
-    myDFPlayer.play(track);
-    
+    audioPlay(track, AUDIO_CLICK);
 }
 // --- Main loop: handles periodic tasks (should be called in Arduino loop) ---
 void gui3Loop() {
+    endFrame();
     gui3CheckPopupTimeout();
-    // Handle cursor blinking
-    if (millis() - lastCursorBlink > cursorBlinkInterval) {
-        cursorVisible = !cursorVisible;
-        int cursorY = 25;
-        int cursorHeight = 24;
-        if (cursorVisible) {
-            tft.drawLine(cursorX, cursorY, cursorX, cursorY + cursorHeight, TFT_WHITE);
-        } else {
-            // Erase the cursor by overdrawing with background color
-            tft.drawLine(cursorX, cursorY, cursorX, cursorY + cursorHeight, TFT_NAVY);
-        }
-        lastCursorBlink = millis();
+    predictLoop();
+    scanOrderLoop();
+    autoScanLoop();
+    // A library loaded by a client replaces the page on show.
+    if (phrasesLoop() && phrasePage) showPhrasePage(phrasePageNo);
+    // Settings and the AUTOSCAN command switch timed scanning from other tasks.
+    if (autoRunning != autoScanEnabled()) {
+        autoRunning = !autoRunning;
+        autoRestart();
     }
+    if (autoRunning) watchGesture();
+    timerWheelRun();
 
     
     // --- Touch handling for settings cell (index 11) ---
     uint16_t x, y;
+    tftSync(); // touch controller shares the SPI bus
     if (tft.getTouch(&x, &y)) {
         // Settings cell (index 11) position
         int col = 2;
@@ -149,199 +258,901 @@ void gui3Loop() {
     }
 }
 
-void speakCharacter(String c) {
-    int track = 0;
-    Serial.print("[DFPlayer] speakCharacter called with: ");
-    Serial.println(c);
+// Handle cursor blinking
+static void blinkCursor() {
+    tftSync();
+    cursorVisible = !cursorVisible;
+    int cursorY = 25;
+    int cursorHeight = 24;
+    if (cursorVisible) {
+        tft.drawLine(cursorX, cursorY, cursorX, cursorY + cursorHeight, TFT_WHITE);
+    } else {
+        // Erase the cursor by overdrawing with background color
+        tft.drawLine(cursorX, cursorY, cursorX, cursorY + cursorHeight, TFT_NAVY);
+    }
+    timerWheelStart(cursorTimer, cursorBlinkInterval);
+}
 
-    if (c.length() == 1 && isAlpha(c[0])) {
-        track = (toupper(c[0]) - 'A') + 1;         // 001–026
-    } 
-    else if (c.length() == 1 && isDigit(c[0])) {
-        track = (c[0] - '0') + 33;                // 033–042
+// Audio track for a popup button: letters 1-26, space 27, backspace 28,
+// message cleared 29, toilet/food/doctor 30-32, digits 33-42.
+static int popupTrack(const PopupItem &item) {
+    switch (item.action) {
+        case POPUP_SPACE:     return 27;
+        case POPUP_BACKSPACE: return 28;
+        case POPUP_CLEAR:     return 29;
+        case POPUP_TOILET:    return 30;
+        case POPUP_FOOD:      return 31;
+        case POPUP_DOCTOR:    return 32;
+        case POPUP_WORD:      return 0;
+        case POPUP_PHRASES:   return 0;
+        case POPUP_CHAR: break;
     }
-    else if (c == "_") {
-        track = 27;  // space
+    char c = item.text[0];
+    if (isAlpha(c)) return (toupper(c) - 'A') + 1;
+    if (isDigit(c)) return (c - '0') + 33;
+    return 0;
+}
+
+static void speakPopupItem(const PopupItem &item) {
+    Serial.print("[DFPlayer] speakPopupItem called with: ");
+    Serial.println(item.text);
+    int track = popupTrack(item);
+    if (track == 0) return;
+    Serial.print("[DFPlayer] speakPopupItem: Playing track ");
+    Serial.print(track);
+    Serial.print(" (audio: ");
+    Serial.print(item.text);
+    Serial.println(")");
+    audioPlay(track, AUDIO_SPEECH);
+}
+
+// Notification type sent for a request button, or nullptr.
+static const char *popupNotification(PopupAction action) {
+    switch (action) {
+        case POPUP_TOILET: return "RESTROOM";
+        case POPUP_FOOD:   return "FOOD";
+        case POPUP_DOCTOR: return "DOCTOR_CALL";
+        default:           return nullptr;
     }
-    else if (c == "<") {
-        track = 28;  // backspace
+}
+
+
+// Start of the word at the end of the message.
+static size_t lastWordStart() {
+    size_t start = typedMessage.length();
+    while (start > 0 && typedMessage[start - 1] != ' ') start--;
+    return start;
+}
+
+static void learnLastWord() {
+    size_t start = lastWordStart();
+    size_t len = typedMessage.length() - start;
+    if (len == 0 || len >= PREDICT_WORD_MAX) return;
+    char word[PREDICT_WORD_MAX];
+    memcpy(word, typedMessage.c_str() + start, len);
+    word[len] = '\0';
+    predictLearn(word);
+}
+
+// Replace the partly typed word with a completion and start the next one.
+static void completeWord(const char *word) {
+    size_t start = lastWordStart();
+    while (typedMessage.length() > start) typedMessage.removeLast();
+    typedMessage.append(word);
+    typedMessage.append(' ');
+    predictLearn(word);
+}
+
+// --- Scanning ---
+// Completions in the word row; the phrase page has none.
+static uint8_t shownWords() {
+    return phrasePage ? 0 : predictionCount;
+}
+
+static int visibleStops() {
+    return shownWords() ? SCAN_STOPS : WORD_ROW;
+}
+
+// Cells a selection does something with. The settings cell is touch
+// only and phrase page cells past the last phrase are empty, so the scan
+// passes over them.
+static bool isStop(int cell) {
+    if (cell >= visibleStops()) return false;
+    if (phrasePage) return cell < pagePhraseCount || cell == PHRASE_MORE || cell == PHRASE_BACK;
+    return cell == WORD_ROW || labels[cell][0] != '\0';
+}
+
+// The first stop from cell on, wrapping round.
+static int nextStop(int cell) {
+    for (int i = 0; i < SCAN_STOPS; i++) {
+        int c = (cell + i) % visibleStops();
+        if (isStop(c)) return c;
     }
-    else if (c == ".") {
-        track = 29;  // message cleared
+    return 0;
+}
+
+// Halves mode counts stops, not cells.
+static int stopCount() {
+    int n = 0;
+    for (int c = 0; c < visibleStops(); c++) n += isStop(c);
+    return n;
+}
+
+static int stopIndex(int cell) {
+    int n = 0;
+    for (int c = 0; c < cell; c++) n += isStop(c);
+    return n;
+}
+
+static int stopAt(int index) {
+    for (int c = 0; c < visibleStops(); c++) {
+        if (isStop(c) && index-- == 0) return c;
     }
-    else if (c == "toilet") {
-        track = 30;
+    return 0;
+}
+
+static int rowCount() {
+    return shownWords() ? 5 : 4;
+}
+
+static int rowFirst(int row) {
+    return row * 3;
+}
+
+static int rowSize(int row) {
+    return row * 3 == WORD_ROW ? 1 : 3;
+}
+
+static int rowStops(int row) {
+    int n = 0;
+    for (int c = rowFirst(row); c < rowFirst(row) + rowSize(row); c++) n += isStop(c);
+    return n;
+}
+
+// Where scanning picks up: stop in linear mode, its row in row mode and
+// every stop again in halves mode.
+static void restartScan(int stop) {
+    stop = nextStop(stop);
+    selectedCell = stop;
+    scanRow = stop / 3;
+    rowSelected = -1;
+    setFirst = 0;
+    setCount = stopCount();
+}
+
+// Border a stop should have for the current scan position.
+static uint8_t scanBorder(int stop) {
+    switch (scanMode) {
+        case SCAN_ROWS:
+            if (rowSelected >= 0) return stop == selectedCell ? BORDER_YELLOW : BORDER_WHITE;
+            return isStop(stop) && stop >= rowFirst(scanRow) && stop < rowFirst(scanRow) + rowSize(scanRow)
+                ? BORDER_YELLOW : BORDER_WHITE;
+        case SCAN_HALVES: {
+            if (!isStop(stop)) return BORDER_WHITE;
+            int n = stopIndex(stop);
+            int half = (setCount + 1) / 2;
+            if (n >= setFirst && n < setFirst + half) return BORDER_YELLOW;
+            if (n >= setFirst + half && n < setFirst + setCount) return BORDER_CYAN;
+            return BORDER_WHITE;
+        }
+        default:
+            return stop == selectedCell ? BORDER_YELLOW : BORDER_WHITE;
     }
-    else if (c == "food") {
-        track = 31;
+}
+
+// Only the rings that change are repainted.
+static void paintScan() {
+    for (int i = 0; i < SCAN_STOPS; i++) setCellBorder(i, scanBorder(i));
+}
+
+// Halves mode: keep the yellow (first) or the cyan (second) half.
+static void keepHalf(bool second) {
+    int half = (setCount + 1) / 2;
+    if (second) {
+        setFirst += half;
+        setCount -= half;
+    } else {
+        setCount = half;
     }
-    else if (c == "doctor") {
-        track = 32;
+    if (setCount > 1) {
+        paintScan();
+        playSound(43);
+        return;
     }
+    selectedCell = stopAt(setFirst);
+    openPopup();
+}
 
-    if (track > 0) {
-        Serial.print("[DFPlayer] speakCharacter: Playing track ");
-        Serial.print(track);
-        Serial.print(" (audio: ");
-        if (c.length() == 1 && isAlpha(c[0])) {
-            Serial.print("letter "); Serial.print((char)toupper(c[0]));
-        } else if (c.length() == 1 && isDigit(c[0])) {
-            Serial.print("number "); Serial.print(c);
-        } else if (c == "_") {
-            Serial.print("space");
-        } else if (c == "<") {
-            Serial.print("backspace");
-        } else if (c == ".") {
-            Serial.print("message cleared");
-        } else if (c == "toilet" || c == "food" || c == "doctor") {
-            Serial.print(c);
-        } else {
-            Serial.print("unknown");
+// Rows mode: back to stepping rows, from the row the scan is on. Halves
+// mode: every stop is in play again.
+static void leaveRow() {
+    int row = scanRow;
+    restartScan(selectedCell);
+    scanRow = row;
+    paintScan();
+}
+
+// A row is being stepped or the halving has narrowed the stops down.
+static bool scanNarrowed() {
+    if (scanMode == SCAN_ROWS) return rowSelected >= 0;
+    if (scanMode == SCAN_HALVES) return setCount < stopCount();
+    return false;
+}
+
+// Highlight the next popup button, row, or cell of the row or grid.
+// Halving has no steps.
+static void stepScan() {
+    if (popupActive) {
+        // Move to next popup button (cyclic)
+        int prevPopup = popupIndex;
+        popupIndex = (popupIndex + 1) % popupCount;
+        movePopupHighlight(prevPopup, popupIndex);
+    } else if (scanMode == SCAN_ROWS && rowSelected < 0) {
+        do scanRow = (scanRow + 1) % rowCount(); while (rowStops(scanRow) == 0);
+        paintScan();
+    } else if (scanMode == SCAN_ROWS) {
+        int first = rowFirst(rowSelected);
+        do selectedCell = first + (selectedCell - first + 1) % rowSize(rowSelected);
+        while (!isStop(selectedCell));
+        paintScan();
+    } else {
+        // Move to next cell (cyclic)
+        selectedCell = nextStop(selectedCell + 1);
+        paintScan();
+    }
+    playSound(43);
+}
+
+// --- Timed scanning ---
+// Each gesture and each new popup or row starts a fresh dwell; the first
+// stop gets half as long again so the patient can find the highlight.
+static void autoRestart() {
+    autoSteps = 0;
+    lastStep.valid = false;
+    highlightAt = millis();
+    if (autoRunning) timerWheelStart(stepTimer, autoScanDwell() + autoScanDwell() / 2);
+    else timerWheelStop(stepTimer);
+}
+
+static void autoStep() {
+    if (blinkEventsGestureActive()) {
+        // Hold until the gesture is reported; its handler restarts the dwell.
+        timerWheelStart(stepTimer, TIMER_WHEEL_TICK_MS);
+        return;
+    }
+    int limit = 0; // steps before a popup or row is given up on
+    if (popupActive) {
+        if (!popupSelecting) return; // a selection is on show, closePopup restarts
+        limit = AUTO_PASSES * popupCount;
+    } else if (scanMode == SCAN_HALVES) {
+        return; // halving is blinked, only its popups are timed
+    } else if (scanMode == SCAN_ROWS && rowSelected >= 0) {
+        limit = AUTO_PASSES * rowStops(rowSelected);
+    }
+    if (limit && ++autoSteps >= limit) {
+        // Nothing wanted here: back out as a triple blink would.
+        if (popupActive) closePopup();
+        else leaveRow();
+        autoRestart();
+        return;
+    }
+    lastStep = { true, selectedCell, scanRow, popupIndex, highlightAt };
+    stepScan();
+    highlightAt = millis();
+    timerWheelStart(stepTimer, autoScanDwell());
+}
+
+// The eye closed sooner after a step than anyone reacts: the blink was
+// meant for the stop before, so the highlight goes back to it.
+static void undoStep() {
+    if (popupActive) {
+        int prevPopup = popupIndex;
+        popupIndex = lastStep.popup;
+        movePopupHighlight(prevPopup, popupIndex);
+    } else {
+        selectedCell = lastStep.cell;
+        scanRow = lastStep.row;
+        paintScan();
+    }
+    highlightAt = lastStep.at;
+    lastStep.valid = false;
+    autoScanLate();
+}
+
+// Note when the eye closed for a gesture; UI task, every frame. The time
+// comes from the debounced edge, so sensor noise never moves the scan.
+static void watchGesture() {
+    unsigned long since;
+    bool pending = blinkEventsPending(since);
+    if (pending && !gestureActive) {
+        gestureAt = since;
+        if (lastStep.valid && (long)(gestureAt - highlightAt) < (long)LATE_BLINK_MS) undoStep();
+    }
+    gestureActive = pending;
+}
+
+// A selection on a timed highlight: time from its arrival to the eye closing.
+static void noteReaction() {
+    if (!autoRunning || (!popupActive && scanMode == SCAN_HALVES)) return;
+    if ((long)(gestureAt - highlightAt) >= 0) autoScanReaction(gestureAt - highlightAt);
+}
+
+// --- Phrase page ---
+static int categorySize(int category) {
+    int n = 0;
+    for (uint8_t i = 0; i < phraseCount(); i++) n += phraseAt(i).category == category;
+    return n;
+}
+
+// Category (-1 = best of all) and part of page `page`, counting from
+// part 0 of `parts`. False past the last page.
+static bool phrasePageAt(int page, int &category, int &part, int &parts) {
+    category = -1;
+    part = 0;
+    parts = 1;
+    if (page == 0) return true;
+    page--;
+    for (int c = 0; c < phraseCategoryCount(); c++) {
+        parts = (categorySize(c) + PHRASE_CELLS - 1) / PHRASE_CELLS;
+        if (page < parts) {
+            category = c;
+            part = page;
+            return true;
         }
-        Serial.println(")");
-        myDFPlayer.play(track);
-        
+        page -= parts;
     }
+    return false;
 }
 
+// "TOP", "NEEDS" or "NEEDS 2/3"; past the last page it is page 0 again.
+// "<category> <part>/<parts>"; a category has at most PHRASE_MAX pages.
+static const size_t PHRASE_PAGE_NAME_SIZE = PHRASE_CATEGORY_NAME_MAX + sizeof(" 255/255");
+
+static void phrasePageName(int page, char *out, size_t size) {
+    int category, part, parts;
+    if (!phrasePageAt(page, category, part, parts)) phrasePageAt(0, category, part, parts);
+    if (category < 0) snprintf(out, size, "TOP");
+    else if (parts > 1) snprintf(out, size, "%.*s %u/%u", (int)PHRASE_CATEGORY_NAME_MAX, phraseCategoryName(category),
+                                 (uint8_t)(part + 1), (uint8_t)parts);
+    else snprintf(out, size, "%.*s", (int)PHRASE_CATEGORY_NAME_MAX, phraseCategoryName(category));
+}
+
+static void showPhrasePage(int page) {
+    int category, part, parts;
+    if (!phrasePageAt(page, category, part, parts)) {
+        page = 0;
+        phrasePageAt(page, category, part, parts);
+    }
+    uint8_t ranked[PHRASE_MAX];
+    int n = phrasesRanked(category, ranked);
+    pagePhraseCount = 0;
+    for (int i = part * PHRASE_CELLS; i < n && pagePhraseCount < PHRASE_CELLS; i++) {
+        pagePhrases[pagePhraseCount++] = ranked[i];
+    }
+    phrasePage = true;
+    phrasePageNo = page;
+    drawPhraseTitle();
+    drawT9Grid();
+    restartScan(0);
+    paintScan();
+    autoRestart();
+}
+
+static void showKeyboard() {
+    timerWheelStop(phraseTimer);
+    phrasePage = false;
+    drawPhraseTitle();
+    drawT9Grid();
+    restartScan(scanOrderHome(9, predictionCount > 0)); // the page is opened from cell 9
+    paintScan();
+    autoRestart();
+}
+
+// Audio track for a phrase: the request tracks 30-32 where there is one.
+static int phraseTrack(const Phrase &p) {
+    switch (p.kind) {
+        case PHRASE_RESTROOM:    return 30;
+        case PHRASE_FOOD:        return 31;
+        case PHRASE_DOCTOR_CALL: return 32;
+        default:                 return 0;
+    }
+}
+
+// The selected stop of the phrase page: send the phrase, turn the page
+// or go back. A sent phrase raises its alert or goes to the PC clients
+// as a text message, and is shown in the message box.
+static void choosePhraseStop() {
+    playSound(44);
+    if (selectedCell == PHRASE_MORE) {
+        showPhrasePage(phrasePageNo + 1);
+        return;
+    }
+    if (selectedCell == PHRASE_BACK) {
+        showKeyboard();
+        return;
+    }
+    if (selectedCell >= pagePhraseCount) {
+        leaveRow(); // an empty cell, or settings (touch only)
+        return;
+    }
+    uint8_t i = pagePhrases[selectedCell];
+    const Phrase &p = phraseAt(i);
+    const char *type = phraseNotification(p);
+    if (p.kind == PHRASE_EMERGENCY) emergencyRaise(); // alerts the room too
+    else if (type) sendNotificationRequest(userId.c_str(), type);
+    else clientLinkPostText(p.text);
+    phraseUsed(i);
+    typedMessage.assign(p.text);
+    updateMessageBox();
+    refreshPredictions();
+    int track = phraseTrack(p);
+    if (track) audioPlay(track, AUDIO_SPEECH);
+    // Leave the green ring up briefly; phraseTimer goes back to the keyboard.
+    timerWheelStop(stepTimer);
+    timerWheelStart(phraseTimer, popupSelectionFlash);
+}
 
 // --- Blink event: single blink ---
 void gui3OnSingleBlink() {
   //  Serial.println("[DEBUG] gui3OnSingleBlink() called: Single blink navigation in GUI.");
+    finishPopupSelection();
+    // Timed scanning does the stepping, so any blink selects; halving
+    // keeps its two gestures for the two halves.
+    if (autoRunning && (popupActive || scanMode != SCAN_HALVES)) {
+        gui3OnDoubleBlink();
+        return;
+    }
+    autoRestart();
     if (popupActive && popupSelecting) {
-        // Move to next popup button (cyclic)
-        int prevPopup = popupIndex;
-        popupIndex = (popupIndex + 1) % popupCount;
-        drawPopup(); // redraw all, only one is navy blue
+        stepScan();
         popupStartTime = millis(); // reset timer
-        playSound(43);
     } else if (!popupActive) {
-        // Move to next cell (cyclic)
-        int prevCell = selectedCell;
-        selectedCell = (selectedCell + 1) % 12;
-        drawButton(prevCell, false, false); // white border
-        highlightCell(selectedCell); // yellow border
-        playSound(43);
+        if (scanMode == SCAN_HALVES) keepHalf(false);
+        else stepScan();
     }
 }
 
+// Select current cell, show popup, turn cell green
+static void openPopup() {
+    if (!phrasePage) {
+        setupPopup(selectedCell);
+        if (popupCount == 0) {
+            // Nothing to choose from (isStop() keeps the scan off such
+            // cells): stay on the grid.
+            leaveRow();
+            return;
+        }
+    }
+    paintScan();
+    drawButton(selectedCell, false, true); // green border
+    if (phrasePage) {
+        choosePhraseStop();
+        return;
+    }
+    popupActive = true;
+    popupSelecting = true; // Now in popup selection mode
+    popupIndex = scanOrderPopupStart(selectedCell, popupCount);
+    drawPopup();
+    popupStartTime = millis();
+    playSound(44);
+}
+
 // --- Blink event: double blink ---
 void gui3OnDoubleBlink() {
   //  Serial.println("[DEBUG] gui3OnDoubleBlink() called: Double blink selection in GUI.");
+    finishPopupSelection();
+    noteReaction();
+    autoRestart();
     if (!popupActive) {
-        // Select current cell, show popup, turn cell yellow
-        drawButton(selectedCell, false, true); // green border
-        setupPopup(selectedCell);
-        popupActive = true;
-        popupSelecting = true; // Now in popup selection mode
-        popupIndex = 0;
-        drawPopup();
-        popupStartTime = millis();
-        playSound(44);
+        if (scanMode == SCAN_HALVES) {
+            keepHalf(true);
+        } else if (scanMode == SCAN_ROWS && rowSelected < 0) {
+            selectedCell = nextStop(rowFirst(scanRow));
+            if (rowStops(scanRow) == 1) {
+                openPopup(); // e.g. the word row, a single stop
+                return;
+            }
+            rowSelected = scanRow;
+            paintScan();
+            playSound(44);
+        } else {
+            openPopup();
+        }
     } else if (popupActive && popupSelecting) {
         // Double blink in popup: select current popup button, add to message bar, clear popup
         drawPopupSelection(popupIndex); // green highlight
-        delay(150); // brief visual feedback
-        String sel = lastPopupChars[popupIndex];
-       
-        if (sel == "<") {
-            if (typedMessage.length()) typedMessage.remove(typedMessage.length() - 1);
-        } else if (sel == "_") {
-            typedMessage += " ";
-        } else if (sel == "toilet" || sel == "food" || sel == "doctor") {
-            // Send notification request based on selection
-            String type;
-            if (sel == "toilet") type = "RESTROOM";
-            else if (sel == "doctor") type = "DOCTOR_CALL";
-            else if (sel == "food") type = "FOOD";
-           sendNotificationRequest(userId, type); 
-        }  else if (sel=="."){ 
-            typedMessage = "";
-          } else {
-            typedMessage += sel;
-            
+        const PopupItem &sel = popupItems[popupIndex];
+        scanOrderRecord(selectedCell, popupIndex);
+        if (sel.action == POPUP_PHRASES) {
+            closePopup();
+            showPhrasePage(0);
+            playSound(44);
+            return;
+        }
+
+        switch (sel.action) {
+            case POPUP_BACKSPACE: typedMessage.removeLast(); break;
+            case POPUP_SPACE:     learnLastWord(); typedMessage.append(' '); break;
+            case POPUP_CLEAR:     typedMessage.clear(); break;
+            case POPUP_CHAR:      typedMessage.append(sel.text[0]); break;
+            case POPUP_WORD:      completeWord(sel.text); break;
+            default:
+                sendNotificationRequest(userId.c_str(), popupNotification(sel.action));
+                break;
         }
-        drawMessageBox();
+        updateMessageBox();
+        refreshPredictions();
         playSound(44);
-        delay(800);
-        speakCharacter(sel);
-        clearPopupText();
-        drawButton(selectedCell, false, false); // white border
-        highlightCell(selectedCell);
-        popupActive = false;
+        speakPopupItem(sel); // preempts the click, no need to wait for it
+        // Leave the green highlight up briefly; gui3Loop closes the popup.
         popupSelecting = false;
+        popupCloseTime = millis() + popupSelectionFlash;
+    }
+}
+
+static void closePopup() {
+    clearPopupText();
+    // After a selection the scan carries on from the learned home stop.
+    restartScan(popupSelecting ? selectedCell : scanOrderHome(selectedCell, predictionCount > 0));
+    paintScan();
+    popupActive = false;
+    popupSelecting = false;
+    autoRestart();
+}
+
+// A selection is still being shown: finish it before handling new input.
+static void finishPopupSelection() {
+    if (popupActive && !popupSelecting) closePopup();
+    if (phraseTimer.armed) showKeyboard();
+}
+
+// --- Blink event: triple blink (back out of the popup, a row, the halving or the phrase page) ---
+void gui3OnTripleBlink() {
+    finishPopupSelection();
+    autoRestart();
+    if (popupActive && popupSelecting) {
+        closePopup();
+    } else if (!popupActive && phrasePage && !scanNarrowed()) {
+        showKeyboard();
+    } else if (!popupActive && scanMode != SCAN_LINEAR) {
+        leaveRow();
     }
 }
 
 // --- Popup timeout handler (should be called periodically) ---
 void gui3CheckPopupTimeout() {
-    if (popupActive && popupSelecting && (millis() - popupStartTime >= popupTimeout)) {
-        clearPopupText();
-        drawButton(selectedCell, false, false); // white border
-        highlightCell(selectedCell);
-        popupActive = false;
-        popupSelecting = false;
+    // Timed scanning closes an unanswered popup after AUTO_PASSES passes instead.
+    if (popupActive && popupSelecting && !autoRunning && (millis() - popupStartTime >= popupTimeout)) {
+        closePopup();
+    } else if (popupActive && !popupSelecting && (long)(millis() - popupCloseTime) >= 0) {
+        closePopup();
     }
 }
 
 // --- Drawing and helper functions ---
+// Cells, popup buttons and the message box are retained: we remember
+// what is on the panel and only push the pixels that actually change.
+// A highlight change only repaints the 3 px border ring, never the
+// label or emoji inside it.
+static uint8_t cellBorder[SCAN_STOPS]; // BORDER_NONE = cell not on screen yet
+static FixedString<MESSAGE_MAX> drawnMessage; // text currently shown in the message box
+
+static const int msgTextX = 15;
+static const int msgTextY = 25;
+static const int msgTextMaxX = 305; // keep clear of the right border
+static const int cursorHeight = 24;
+
+// Popup bar and message text line are composed off-screen in sprites
+// and pushed to the panel in a single DMA transfer each. The transfer is
+// left running and only waited for (tftSync) before the next SPI access,
+// so the loop keeps servicing blinks while pixels go out. Sprites that
+// do not fit the budget fall back to drawing straight to the panel.
+#ifndef GUI_SPRITE_BUDGET_BYTES
+#define GUI_SPRITE_BUDGET_BYTES 40960
+#endif
+static const int msgBandX = 11;   // inside the message box border
+static const int msgBandY = msgTextY;
+static const int msgBandW = 298;
+static const int msgBandH = cursorHeight + 1;
+static TFT_eSprite popupSprite = TFT_eSprite(&tft);
+static TFT_eSprite msgSprite = TFT_eSprite(&tft);
+static bool popupSpriteReady = false;
+static bool msgSpriteReady = false;
+static bool dmaPending = false;
+static uint32_t frameBytes = 0;     // DMA bytes pushed since the last frame boundary
+static uint32_t lastFrameBytes = 0;
+static uint32_t maxFrameBytes = 0;
+static uint32_t totalPushedBytes = 0;
+
+static void guiSpritesSetup() {
+    if (popupSpriteReady || msgSpriteReady) return; // gui3Setup runs again after settings
+    tft.initDMA();
+    uint32_t budget = GUI_SPRITE_BUDGET_BYTES;
+    uint32_t popupBytes = 320UL * popupBarHeight * 2;
+    if (popupBytes <= budget && popupSprite.createSprite(320, popupBarHeight)) {
+        popupSpriteReady = true;
+        budget -= popupBytes;
+    }
+    uint32_t msgBytes = (uint32_t)msgBandW * msgBandH * 2;
+    if (msgBytes <= budget && msgSprite.createSprite(msgBandW, msgBandH)) {
+        msgSpriteReady = true;
+        budget -= msgBytes;
+    }
+    Serial.print("[GUI] Sprites - popup: ");
+    Serial.print(popupSpriteReady ? "yes" : "no");
+    Serial.print(", message: ");
+    Serial.print(msgSpriteReady ? "yes" : "no");
+    Serial.print(", budget left: ");
+    Serial.println(budget);
+}
+
+// Wait for an outstanding DMA push and release the bus.
+static void tftSync() {
+    if (!dmaPending) return;
+    tft.endWrite(); // blocks until the DMA transfer has completed
+    dmaPending = false;
+}
+
+static void pushSpriteDMA(TFT_eSprite &spr, int x, int y) {
+    tftSync();
+    uint32_t bytes = (uint32_t)spr.width() * spr.height() * 2;
+    tft.startWrite();
+    tft.pushImageDMA(x, y, spr.width(), spr.height(), (uint16_t*)spr.getPointer());
+    dmaPending = true;
+    frameBytes += bytes;
+    totalPushedBytes += bytes;
+}
+
+// Push only columns [sx, sx + sw) of a sprite that covers (x, y). The
+// rows of a sub-rectangle are not contiguous in the sprite, so each goes
+// out as its own transfer; the driver waits for the previous one.
+static void pushSpriteColumnsDMA(TFT_eSprite &spr, int x, int y, int sx, int sw) {
+    if (sx < 0) { sw += sx; sx = 0; }
+    if (sx + sw > spr.width()) sw = spr.width() - sx;
+    if (sw <= 0) return;
+    tftSync();
+    uint16_t *pixels = (uint16_t*)spr.getPointer();
+    uint32_t bytes = (uint32_t)sw * spr.height() * 2;
+    tft.startWrite();
+    for (int row = 0; row < spr.height(); row++) {
+        tft.pushImageDMA(x + sx, y + row, sw, 1, pixels + row * spr.width() + sx);
+    }
+    dmaPending = true;
+    frameBytes += bytes;
+    totalPushedBytes += bytes;
+}
+
+// Close the accounting for one frame (one pass of gui3Loop).
+static void endFrame() {
+    if (frameBytes == 0) return;
+    lastFrameBytes = frameBytes;
+    if (frameBytes > maxFrameBytes) maxFrameBytes = frameBytes;
+    frameBytes = 0;
+}
+
+void gui3PrintStats(Stream &out) {
+    out.print("GUI DMA Bytes (last/max frame, total): ");
+    out.print(lastFrameBytes); out.print("/"); out.print(maxFrameBytes); out.print(", ");
+    out.print(totalPushedBytes); out.print("\n");
+}
+
+// Repaint the border ring of a w x h box; the inside is left untouched.
+static void drawBorderRing(TFT_eSPI &g, int x, int y, int w, int h, uint8_t border, uint16_t fill) {
+    uint16_t color = TFT_WHITE;
+    int thickness = 1;
+    if (border == BORDER_GREEN) { color = TFT_GREEN; thickness = 3; }
+    else if (border == BORDER_YELLOW) { color = TFT_YELLOW; thickness = 3; }
+    else if (border == BORDER_CYAN) { color = TFT_CYAN; thickness = 3; }
+    for (int t = 0; t < 3; ++t) g.drawRect(x + t, y + t, w - 2 * t, h - 2 * t, t < thickness ? color : fill);
+}
+
 static void drawMessageBox() {
+    tftSync();
     tft.fillRect(10, 10, 300, 100, TFT_NAVY);
     tft.drawRect(10, 10, 300, 100, TFT_WHITE);
     tft.setTextColor(TFT_WHITE, TFT_NAVY);
     tft.setTextSize(3);
-    tft.setCursor(15, 25);
-    tft.print(typedMessage);
+    tft.setCursor(msgTextX, msgTextY);
+    tft.print(typedMessage.c_str());
+    drawnMessage = typedMessage;
     // Draw cursor (always on when message box is redrawn)
-    int textWidth = tft.textWidth(typedMessage);
-    cursorX = 15 + textWidth + 2; // Update global cursorX with offset
-    int cursorY = 25;
-    int cursorHeight = 24;
-    tft.drawLine(cursorX, cursorY, cursorX, cursorY + cursorHeight, TFT_WHITE);
+    int textWidth = tft.textWidth(typedMessage.c_str());
+    cursorX = msgTextX + textWidth + 2; // Update global cursorX with offset
+    tft.drawLine(cursorX, msgTextY, cursorX, msgTextY + cursorHeight, TFT_WHITE);
+}
+
+// Bring the message box in line with typedMessage, touching only the
+// characters after the longest common prefix plus the cursor.
+static void updateMessageBox() {
+    tftSync();
+    tft.setTextSize(3);
+    int newWidth = tft.textWidth(typedMessage.c_str());
+    if (msgTextX + newWidth + 2 >= msgTextMaxX || tft.textWidth(drawnMessage.c_str()) + msgTextX + 2 >= msgTextMaxX) {
+        drawMessageBox(); // text wraps, let the full redraw handle it
+        return;
+    }
+    unsigned int common = 0;
+    while (common < drawnMessage.length() && common < typedMessage.length() &&
+           drawnMessage[common] == typedMessage[common]) common++;
+    if (common == drawnMessage.length() && common == typedMessage.length()) return;
+
+    char prefix[MESSAGE_MAX + 1];
+    memcpy(prefix, typedMessage.c_str(), common);
+    prefix[common] = '\0';
+    int keepX = msgTextX + tft.textWidth(prefix);
+    int oldEnd = cursorX + 1;
+    if (msgSpriteReady) {
+        // Compose the whole text line off-screen, but push only from the
+        // first changed character to the further of the two cursors.
+        msgSprite.fillSprite(TFT_NAVY);
+        msgSprite.setTextColor(TFT_WHITE, TFT_NAVY);
+        msgSprite.setTextSize(3);
+        msgSprite.setCursor(msgTextX - msgBandX, 0);
+        msgSprite.print(typedMessage.c_str());
+        cursorX = msgTextX + newWidth + 2;
+        msgSprite.drawFastVLine(cursorX - msgBandX, 0, cursorHeight + 1, TFT_WHITE);
+        int dirtyEnd = (oldEnd > cursorX + 1) ? oldEnd : cursorX + 1;
+        pushSpriteColumnsDMA(msgSprite, msgBandX, msgBandY, keepX - msgBandX, dirtyEnd - keepX + 1);
+        drawnMessage = typedMessage;
+        cursorVisible = true;
+        timerWheelStart(cursorTimer, cursorBlinkInterval);
+        return;
+    }
+    // Erase the old tail and the old cursor in one rectangle.
+    if (oldEnd > keepX) tft.fillRect(keepX, msgTextY, oldEnd - keepX + 1, cursorHeight + 1, TFT_NAVY);
+    if (common < typedMessage.length()) {
+        tft.setTextColor(TFT_WHITE, TFT_NAVY);
+        tft.setCursor(keepX, msgTextY);
+        tft.print(typedMessage.c_str() + common);
+    }
+    drawnMessage = typedMessage;
+    cursorX = msgTextX + newWidth + 2;
+    tft.drawLine(cursorX, msgTextY, cursorX, msgTextY + cursorHeight, TFT_WHITE);
+    cursorVisible = true;
+    timerWheelStart(cursorTimer, cursorBlinkInterval);
 }
 
 static void drawT9Grid() {
-    for (int i = 0; i < 12; i++) drawButton(i, false, false);
+    for (int i = 0; i < SCAN_STOPS; i++) cellBorder[i] = BORDER_NONE; // screen was cleared
+    for (int i = 0; i < SCAN_STOPS; i++) drawButton(i, false, false);
 }
 
-static void highlightCell(int index) {
+static void cellRect(int index, int &x, int &y, int &w, int &h) {
+    if (index == WORD_ROW) {
+        x = 15; y = 455; w = 290; h = 24; // below the grid, to the bottom edge
+        return;
+    }
     int col = index % 3;
     int row = index / 3;
-    int x = 15 + col * (90 + 10);
-    int y = 180 + row * (60 + 10);
+    x = 15 + col * (90 + 10);
+    y = 180 + row * (60 + 10);
+    w = 90;
+    h = 60;
+}
+
+// Upper-case copy for display, the message is typed in capitals.
+static void upperCopy(char *dst, const char *src, size_t size) {
+    size_t i = 0;
+    for (; src[i] && i + 1 < size; i++) dst[i] = toupper((unsigned char)src[i]);
+    dst[i] = '\0';
+}
+
+// Text size 2 unless the text would not fit width, then 1. Returns the size.
+static int fitTextSize(TFT_eSPI &g, const char *text, int width) {
+    g.setTextSize(2);
+    if (g.textWidth(text) <= width) return 2;
+    g.setTextSize(1);
+    return 1;
+}
+
+static void drawWordRowContent(int x, int y, int w, int h) {
+    tft.fillRect(x, y, w, h, TFT_BLACK);
+    tft.setTextColor(TFT_CYAN, TFT_BLACK);
+    int slotW = w / PREDICT_MAX;
+    for (int i = 0; i < shownWords(); i++) {
+        char text[PREDICT_WORD_MAX];
+        upperCopy(text, predictions[i], sizeof(text));
+        int size = fitTextSize(tft, text, slotW - 8);
+        tft.setCursor(x + i * slotW + (slotW - tft.textWidth(text)) / 2, y + h / 2 - 4 * size);
+        tft.print(text);
+    }
+}
+
+// Break text at spaces into at most maxLines lines of perLine
+// characters, cutting words that are longer. Returns false if the text
+// did not fit.
+static bool wrapText(const char *s, int perLine, int maxLines, char lines[][PHRASE_TEXT_MAX + 1], int &n) {
+    n = 0;
+    for (;;) {
+        while (*s == ' ') s++;
+        if (!*s) return true;
+        if (n == maxLines) return false;
+        int len = strlen(s);
+        if (len > perLine) {
+            len = perLine;
+            while (len > 0 && s[len] != ' ') len--;
+            if (len == 0) len = perLine;
+        }
+        memcpy(lines[n], s, len);
+        lines[n++][len] = '\0';
+        s += len;
+    }
+}
+
+// A phrase in its cell, at text size 2 if it fits in three lines, else
+// size 1. Alerts are orange, text messages white.
+static void drawPhraseCell(int index, int x, int y) {
+    tft.fillRect(x, y, 90, 60, TFT_BLACK);
+    if (index >= pagePhraseCount) return;
+    const Phrase &p = phraseAt(pagePhrases[index]);
+    tft.setTextColor(phraseNotification(p) ? TFT_ORANGE : TFT_WHITE, TFT_BLACK);
+    char lines[5][PHRASE_TEXT_MAX + 1];
+    int n;
+    int lineH = 17;
+    tft.setTextSize(2); // 12 x 16 px characters
+    if (!wrapText(p.text, (90 - 8) / 12, 3, lines, n)) {
+        tft.setTextSize(1);
+        lineH = 10;
+        wrapText(p.text, (90 - 8) / 6, 5, lines, n);
+    }
+    int lineY = y + (60 - n * lineH) / 2 + 1;
+    for (int i = 0; i < n; i++) {
+        tft.setCursor(x + (90 - tft.textWidth(lines[i])) / 2, lineY + i * lineH);
+        tft.print(lines[i]);
+    }
+}
+
+// Phrase page: "MORE" with the name of the next page, and "BACK".
+static void drawPhrasePageCell(int index, int x, int y) {
     tft.fillRect(x, y, 90, 60, TFT_BLACK);
-    // Draw thick yellow border for highlight
-    for (int t = 0; t < 3; ++t) tft.drawRect(x + t, y + t, 90 - 2 * t, 60 - 2 * t, TFT_YELLOW);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.setTextSize(2);
-    int textWidth = tft.textWidth(labels[index]);
-    int textX = x + (90 - textWidth) / 2;
-    int textY = y + (60 / 2) + 4;
-    tft.setCursor(textX, textY);
-    tft.print(labels[index]);
-    if (index == 9) {
-        tft.pushImage(x + 5, y + 25, 24, 24, emoji_toilet);
-        tft.pushImage(x + 33, y + 25, 24, 24, emoji_food);
-        tft.pushImage(x + 61, y + 25, 24, 24, emoji_doctor);
-    } else if (index == 11) {
-        tft.pushImage(x + 20, y + 7, 48, 48, emoji_settings);
-    }
+    const char *label = index == PHRASE_MORE ? "MORE" : "BACK";
+    int labelY = index == PHRASE_MORE ? y + 14 : y + 22;
+    tft.setCursor(x + (90 - tft.textWidth(label)) / 2, labelY);
+    tft.print(label);
+    if (index != PHRASE_MORE) return;
+    char next[PHRASE_PAGE_NAME_SIZE];
+    phrasePageName(phrasePageNo + 1, next, sizeof(next));
+    tft.setTextColor(TFT_CYAN, TFT_BLACK);
+    tft.setTextSize(1);
+    tft.setCursor(x + (90 - tft.textWidth(next)) / 2, y + 38);
+    tft.print(next);
 }
 
-static void drawButton(int index, bool highlightYellow, bool highlightGreen) {
-    int col = index % 3;
-    int row = index / 3;
-    int x = 15 + col * (90 + 10);
-    int y = 180 + row * (60 + 10);
-    uint16_t fill = TFT_BLACK;
-    uint16_t border = TFT_WHITE;
-    int thickness = 1;
-    if (highlightGreen) { border = TFT_GREEN; thickness = 3; }
-    else if (highlightYellow) { border = TFT_YELLOW; thickness = 3; }
-    tft.fillRect(x, y, 90, 60, fill);
-    for (int t = 0; t < thickness; ++t) tft.drawRect(x + t, y + t, 90 - 2 * t, 60 - 2 * t, border);
-    if (thickness == 1) tft.drawRect(x, y, 90, 60, border); // ensure thin border for unselected
-    tft.setTextColor(TFT_WHITE, fill);
+// Page name in the popup bar while the phrase page is up; cleared otherwise.
+static void drawPhraseTitle() {
+    tftSync();
+    tft.fillRect(0, popupBarY, 320, popupBarHeight, TFT_BLACK);
+    if (!phrasePage) return;
+    char name[PHRASE_PAGE_NAME_SIZE];
+    phrasePageName(phrasePageNo, name, sizeof(name));
+    char title[PHRASE_CATEGORY_NAME_MAX + 20];
+    snprintf(title, sizeof(title), "PHRASES: %s", name);
+    tft.setTextColor(TFT_CYAN, TFT_BLACK);
+    tft.setTextSize(2);
+    tft.setCursor((320 - tft.textWidth(title)) / 2, popupBarY + popupBarHeight / 2 - 8);
+    tft.print(title);
+}
+
+// Full paint of a cell's inside: background, label and emoji.
+static void drawCellContent(int index) {
+    int x, y, w, h;
+    cellRect(index, x, y, w, h);
+    if (index == WORD_ROW) {
+        drawWordRowContent(x, y, w, h);
+        return;
+    }
+    if (phrasePage && index < PHRASE_CELLS) {
+        drawPhraseCell(index, x, y);
+        return;
+    }
+    if (phrasePage && (index == PHRASE_MORE || index == PHRASE_BACK)) {
+        drawPhrasePageCell(index, x, y);
+        return;
+    }
+    tft.fillRect(x, y, 90, 60, TFT_BLACK);
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.setTextSize(2);
     int textWidth = tft.textWidth(labels[index]);
     int textX = x + (90 - textWidth) / 2;
@@ -349,30 +1160,80 @@ static void drawButton(int index, bool highlightYellow, bool highlightGreen) {
     tft.setCursor(textX, textY);
     tft.print(labels[index]);
     if (index == 9) {
-        tft.pushImage(x + 5, y + 25, 24, 24, emoji_toilet);
-        tft.pushImage(x + 33, y + 25, 24, 24, emoji_food);
-        tft.pushImage(x + 61, y + 25, 24, 24, emoji_doctor);
+        drawEmoji(tft, x + 5, y + 25, EMOJI_TOILET);
+        drawEmoji(tft, x + 33, y + 25, EMOJI_FOOD);
+        drawEmoji(tft, x + 61, y + 25, EMOJI_DOCTOR);
     } else if (index == 11) {
-        tft.pushImage(x + 20, y + 7, 48, 48, emoji_settings);
+        drawEmoji(tft, x + 20, y + 7, EMOJI_SETTINGS);
     }
 }
 
+static void setCellBorder(int index, uint8_t border) {
+    if (cellBorder[index] == border) return;
+    tftSync();
+    if (cellBorder[index] == BORDER_NONE) drawCellContent(index);
+    int x, y, w, h;
+    cellRect(index, x, y, w, h);
+    drawBorderRing(tft, x, y, w, h, border, TFT_BLACK);
+    cellBorder[index] = border;
+}
+
+static void drawButton(int index, bool highlightYellow, bool highlightGreen) {
+    uint8_t border = BORDER_WHITE;
+    if (highlightGreen) border = BORDER_GREEN;
+    else if (highlightYellow) border = BORDER_YELLOW;
+    setCellBorder(index, border);
+}
+
+// Look up completions for the message; repaint the word row if they
+// changed. With none left the scan cannot stay on the row; the scan
+// highlight itself is redrawn when the popup closes.
+static void refreshPredictions() {
+    char fresh[PREDICT_MAX][PREDICT_WORD_MAX];
+    uint8_t n = predictComplete(typedMessage.c_str(), fresh, PREDICT_MAX);
+    bool same = n == predictionCount;
+    for (uint8_t i = 0; same && i < n; i++) same = strcmp(fresh[i], predictions[i]) == 0;
+    if (same) return;
+    memcpy(predictions, fresh, sizeof(fresh));
+    predictionCount = n;
+    uint8_t border = cellBorder[WORD_ROW];
+    if (border == BORDER_NONE) return; // drawn with the grid
+    if (predictionCount == 0 && selectedCell == WORD_ROW) selectedCell = 0;
+    cellBorder[WORD_ROW] = BORDER_NONE; // repaint the words as well
+    setCellBorder(WORD_ROW, border);
+}
+
+static void addPopupItem(PopupAction action, const char *text) {
+    PopupItem &item = popupItems[popupCount++];
+    item.action = action;
+    snprintf(item.text, sizeof(item.text), "%s", text);
+}
+
 static void setupPopup(int index) {
     popupCount = 0;
     if (index == 9) {
-        lastPopupChars[popupCount++] = "toilet";
-        lastPopupChars[popupCount++] = "food";
-        lastPopupChars[popupCount++] = "doctor";
-        popupWidth = 80;
+        addPopupItem(POPUP_TOILET, "toilet");
+        addPopupItem(POPUP_FOOD, "food");
+        addPopupItem(POPUP_DOCTOR, "doctor");
+        addPopupItem(POPUP_PHRASES, "phrases");
+        popupWidth = 75;
     } else if (index == 10) {
-        lastPopupChars[popupCount++] = "0";
-        lastPopupChars[popupCount++] = "_";
-        lastPopupChars[popupCount++] = "<";
+        addPopupItem(POPUP_CHAR, "0");
+        addPopupItem(POPUP_SPACE, "_");
+        addPopupItem(POPUP_BACKSPACE, "<");
         popupWidth = 50;
+    } else if (index == WORD_ROW) {
+        for (int i = 0; i < predictionCount; i++) {
+            char text[PREDICT_WORD_MAX];
+            upperCopy(text, predictions[i], sizeof(text));
+            addPopupItem(POPUP_WORD, text);
+        }
+        popupWidth = 100;
     } else {
-        String label = labels[index];
-        for (int i = 0; i < label.length(); i++) {
-            if (label[i] != ' ') lastPopupChars[popupCount++] = String(label[i]);
+        for (const char *c = labels[index]; *c; c++) {
+            if (*c == ' ') continue;
+            char text[2] = { *c, '\0' };
+            addPopupItem(*c == '.' ? POPUP_CLEAR : POPUP_CHAR, text);
         }
         popupWidth = 50;
     }
@@ -383,43 +1244,78 @@ static void setupPopup(int index) {
     }
 }
 
+static void drawPopupItem(TFT_eSPI &g, int barY, int i) {
+    int px = popupXPositions[i];
+    uint16_t fill = TFT_BLACK;
+    g.fillRect(px, barY, popupWidth, popupBarHeight, fill);
+    drawBorderRing(g, px, barY, popupWidth, popupBarHeight, (i == popupIndex) ? BORDER_YELLOW : BORDER_WHITE, fill);
+    g.setTextColor(TFT_WHITE, fill);
+    const char *boxText = popupItems[i].text;
+    int size = fitTextSize(g, boxText, popupWidth - 8);
+    int tw = g.textWidth(boxText);
+    int tx = px + (popupWidth - tw) / 2;
+    int ty = barY + (popupBarHeight / 2) - 3 * size;
+    g.setCursor(tx, ty);
+    g.print(boxText);
+}
+
+// Compose the whole popup bar off-screen and push it in one transfer.
+// The sprite keeps the bar for the highlight and selection updates.
+static void pushPopupSprite() {
+    tftSync(); // the sprite may still be streaming out
+    popupSprite.fillSprite(TFT_BLACK);
+    for (int i = 0; i < popupCount; i++) drawPopupItem(popupSprite, 0, i);
+    pushSpriteDMA(popupSprite, 0, popupBarY);
+}
+
 static void drawPopup() {
-    for (int i = 0; i < popupCount; i++) {
-        int px = popupXPositions[i];
-        uint16_t fill = TFT_BLACK;
-        uint16_t border = (i == popupIndex) ? TFT_YELLOW : TFT_WHITE;
-        int thickness = (i == popupIndex) ? 3 : 1;
-        tft.fillRect(px, popupBarY, popupWidth, popupBarHeight, fill);
-        for (int t = 0; t < thickness; ++t) tft.drawRect(px + t, popupBarY + t, popupWidth - 2 * t, popupBarHeight - 2 * t, border);
-        if (thickness == 1) tft.drawRect(px, popupBarY, popupWidth, popupBarHeight, border);
-        tft.setTextColor(TFT_WHITE, fill);
-        tft.setTextSize(2);
-        String boxText = lastPopupChars[i];
-        int tw = tft.textWidth(boxText);
-        int tx = px + (popupWidth - tw) / 2;
-        int ty = popupBarY + (popupBarHeight / 2) - 6;
-        tft.setCursor(tx, ty);
-        tft.print(boxText);
+    if (popupSpriteReady) {
+        pushPopupSprite();
+        return;
+    }
+    tftSync();
+    for (int i = 0; i < popupCount; i++) drawPopupItem(tft, popupBarY, i);
+}
+
+// Redraw one button's ring in the popup sprite and push just that button.
+static void pushPopupRing(int i, uint8_t border) {
+    tftSync(); // the sprite may still be streaming out
+    drawBorderRing(popupSprite, popupXPositions[i], 0, popupWidth, popupBarHeight, border, TFT_BLACK);
+    pushSpriteColumnsDMA(popupSprite, 0, popupBarY, popupXPositions[i], popupWidth);
+}
+
+// Move the yellow ring from one popup button to another.
+static void movePopupHighlight(int from, int to) {
+    if (from == to) return;
+    if (popupSpriteReady) {
+        pushPopupRing(from, BORDER_WHITE);
+        pushPopupRing(to, BORDER_YELLOW);
+        return;
     }
+    tftSync();
+    drawBorderRing(tft, popupXPositions[from], popupBarY, popupWidth, popupBarHeight, BORDER_WHITE, TFT_BLACK);
+    drawBorderRing(tft, popupXPositions[to], popupBarY, popupWidth, popupBarHeight, BORDER_YELLOW, TFT_BLACK);
 }
 
 static void drawPopupSelection(int idx) {
-    int px = popupXPositions[idx];
-    tft.fillRect(px, popupBarY, popupWidth, popupBarHeight, TFT_BLACK);
-    for (int t = 0; t < 3; ++t) tft.drawRect(px + t, popupBarY + t, popupWidth - 2 * t, popupBarHeight - 2 * t, TFT_GREEN);
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setTextSize(2);
-    String sel = lastPopupChars[idx];
-    int tw = tft.textWidth(sel);
-    int tx = px + (popupWidth - tw) / 2;
-    int ty = popupBarY + (popupBarHeight / 2) - 6;
-    tft.setCursor(tx, ty);
-    tft.print(sel);
+    if (popupSpriteReady) {
+        pushPopupRing(idx, BORDER_GREEN);
+        return;
+    }
+    tftSync();
+    drawBorderRing(tft, popupXPositions[idx], popupBarY, popupWidth, popupBarHeight, BORDER_GREEN, TFT_BLACK);
 }
 
 static void clearPopupText() {
+    if (popupSpriteReady) {
+        tftSync();
+        popupSprite.fillSprite(TFT_BLACK);
+        pushSpriteDMA(popupSprite, 0, popupBarY);
+        return;
+    }
+    tftSync();
     for (int i = 0; i < popupCount; i++) {
         int px = popupXPositions[i];
         tft.fillRect(px, popupBarY, popupWidth, popupBarHeight, TFT_BLACK);
     }
-} 
+}
\ No newline at end of file
@@ -11,8 +11,29 @@ void gui3OnSingleBlink();
 
 void gui3OnDoubleBlink();
 
+void gui3OnTripleBlink();
+
 void gui3CheckPopupTimeout();
 
 void gui3InitAudio(); 
 
+// How blinks move over the grid, chosen under Blink Settings:
+//   SCAN_LINEAR  a single blink steps cell by cell, a double blink opens it
+//   SCAN_ROWS    single blinks step rows, a double blink enters the row,
+//                then single blinks step its cells
+//   SCAN_HALVES  the cells left are split in two; a single blink keeps
+//                the yellow half, a double blink the cyan half, and the
+//                popup opens once one cell is left
+// A triple blink backs out of a row or starts the halving again. With
+// auto scan on (auto_scan.h) the single-blink steps are timed instead and
+// any blink selects; halving stays blinked, its popups are timed.
+enum ScanMode : uint8_t { SCAN_LINEAR, SCAN_ROWS, SCAN_HALVES, SCAN_MODE_COUNT };
+
+ScanMode gui3ScanMode();
+void gui3SetScanMode(ScanMode mode); // saved to Preferences
+const char *gui3ScanModeName(ScanMode mode);
+
+// Bytes pushed to the panel by DMA per frame, for STATUS.
+void gui3PrintStats(Stream &out);
+
 #endif // GUI_H
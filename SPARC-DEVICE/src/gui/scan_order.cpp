@@ -0,0 +1,107 @@
+#include "scan_order.h"
+
+#include <Preferences.h>
+
+// tools/scan_sim.py replays a corpus through this model; keep the
+// constants and the rules below in step with it.
+static const uint16_t USE_WEIGHT = 16;
+static const uint16_t DECAY_EVERY = 100;  // selections between halving all counts
+// A new start has to bring the expected cost down to 7/8 of the current one.
+static const uint32_t SWITCH_NUM = 7;
+static const uint32_t SWITCH_DEN = 8;
+static const unsigned long SAVE_DELAY_MS = 30000;
+
+struct ScanUsage {
+  uint16_t stop[SCAN_ORDER_STOPS];
+  uint16_t item[SCAN_ORDER_CELLS][SCAN_ORDER_ITEMS];
+  uint16_t sinceDecay;
+};
+static ScanUsage usage;
+static int home = -1;  // -1 = not chosen yet
+static int8_t popupStart[SCAN_ORDER_CELLS];
+static bool usageDirty = false;
+static unsigned long usageChangedAt = 0;
+static Preferences scanPrefs;
+
+void scanOrderSetup() {
+  scanPrefs.begin("scan", true);
+  if (scanPrefs.getBytesLength("usage") == sizeof(usage)) scanPrefs.getBytes("usage", &usage, sizeof(usage));
+  scanPrefs.end();
+}
+
+void scanOrderLoop() {
+  if (!usageDirty || millis() - usageChangedAt < SAVE_DELAY_MS) return;
+  scanPrefs.begin("scan", false);
+  scanPrefs.putBytes("usage", &usage, sizeof(usage));
+  scanPrefs.end();
+  usageDirty = false;
+}
+
+void scanOrderRecord(int stop, int item) {
+  if (stop < 0 || stop >= SCAN_ORDER_STOPS) return;
+  usage.stop[stop] += USE_WEIGHT;
+  if (stop < SCAN_ORDER_CELLS && item >= 0 && item < SCAN_ORDER_ITEMS) usage.item[stop][item] += USE_WEIGHT;
+  if (++usage.sinceDecay >= DECAY_EVERY) {
+    for (uint16_t &u : usage.stop) u /= 2;
+    for (auto &cell : usage.item) {
+      for (uint16_t &u : cell) u /= 2;
+    }
+    usage.sinceDecay = 0;
+  }
+  usageDirty = true;
+  usageChangedAt = millis();
+}
+
+// Single blinks needed on average (times the total use) to get from
+// start s to the next target in a cycle of n stops.
+static uint32_t startCost(const uint16_t *use, int n, int s) {
+  uint32_t cost = 0;
+  for (int t = 0; t < n; t++) cost += (uint32_t)use[t] * ((t - s + n) % n);
+  return cost;
+}
+
+// Cheapest start; current (if valid) is kept unless that one is clearly
+// better. Ties go to the lowest index.
+static int pickStart(const uint16_t *use, int n, int current) {
+  int best = 0;
+  uint32_t bestCost = startCost(use, n, 0);
+  for (int s = 1; s < n; s++) {
+    uint32_t cost = startCost(use, n, s);
+    if (cost < bestCost) {
+      best = s;
+      bestCost = cost;
+    }
+  }
+  if (current < 0 || current >= n) return best;
+  if (bestCost * SWITCH_DEN >= startCost(use, n, current) * SWITCH_NUM) return current;
+  return best;
+}
+
+int scanOrderHome(int current, bool wordRow) {
+  int n = wordRow ? SCAN_ORDER_STOPS : SCAN_ORDER_CELLS;
+  uint32_t total = 0;
+  for (int t = 0; t < n; t++) total += usage.stop[t];
+  if (total == 0) return current;  // nothing learned yet: stay put
+  int start = pickStart(usage.stop, n, home);
+  // A home on the word row is kept for when the row comes back.
+  if (wordRow || home < n) home = start;
+  return start;
+}
+
+int scanOrderPopupStart(int stop, int count) {
+  if (stop < 0 || stop >= SCAN_ORDER_CELLS || count <= 0 || count > SCAN_ORDER_ITEMS) return 0;
+  popupStart[stop] = pickStart(usage.item[stop], count, popupStart[stop]);
+  return popupStart[stop];
+}
+
+void scanOrderPrintStatus(Stream &out) {
+  out.print("Scan home: ");
+  if (home < 0) out.print("-");
+  else out.print(home);
+  out.print(", popup starts:");
+  for (int8_t s : popupStart) {
+    out.print(" "); out.print(s);
+  }
+  out.print(", selections since decay: "); out.print(usage.sinceDecay);
+  out.print(usageDirty ? " (unsaved)\n" : "\n");
+}
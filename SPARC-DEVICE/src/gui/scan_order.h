@@ -0,0 +1,37 @@
+#ifndef SCAN_ORDER_H
+#define SCAN_ORDER_H
+
+#include <Arduino.h>
+
+// Where scanning starts, learned from use. The grid layout and the order
+// of the popup buttons never change, so the patient's sense of where
+// things are is kept; what adapts is where the highlight lands:
+//   - after a selection the scan restarts at the "home" stop that needs
+//     the fewest single blinks on average to reach the next target,
+//   - a popup opens on the button that does the same for that cell.
+// Usage is counted per stop and per popup button with decay, so old
+// habits fade, and is kept in NVS. A start only moves when the new one
+// is clearly better, so it does not wander from one selection to the
+// next.
+
+static const uint8_t SCAN_ORDER_CELLS = 12;  // T9 cells
+static const uint8_t SCAN_ORDER_STOPS = 13;  // cells + the word row
+static const uint8_t SCAN_ORDER_ITEMS = 4;   // most buttons in a cell's popup
+
+void scanOrderSetup();  // load usage from NVS
+
+// Popup button `item` of scan stop `stop` was selected.
+void scanOrderRecord(int stop, int item);
+
+// Stop to continue scanning from after a selection made on `current`.
+// wordRow says whether the word row is in the cycle right now.
+int scanOrderHome(int current, bool wordRow);
+
+// Button to highlight first when the popup of `stop` opens with count buttons.
+int scanOrderPopupStart(int stop, int count);
+
+void scanOrderLoop();  // UI task: writes usage back to NVS after a quiet spell
+
+void scanOrderPrintStatus(Stream &out);
+
+#endif // SCAN_ORDER_H
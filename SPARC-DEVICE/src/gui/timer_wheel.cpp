@@ -0,0 +1,63 @@
+#include "timer_wheel.h"
+
+static WheelTimer *slots[TIMER_WHEEL_SLOTS];
+static uint32_t doneTick = 0;  // last tick whose slot has been run
+// Ticks are counted rather than derived as millis() / TICK_MS, which
+// would wrap to 0 at 2^32 / TICK_MS after 49.7 days and leave every
+// armed timer looking far in the future. tickMs is the millis() the
+// current tick started at; the remainder carries into the next call.
+static uint32_t tickCount = 0;
+static uint32_t tickMs = 0;
+
+static uint32_t nowTick() {
+  uint32_t ticks = (millis() - tickMs) / TIMER_WHEEL_TICK_MS;
+  tickCount += ticks;
+  tickMs += ticks * TIMER_WHEEL_TICK_MS;
+  return tickCount;
+}
+
+static void unlink(WheelTimer &t) {
+  for (WheelTimer **p = &slots[t.due % TIMER_WHEEL_SLOTS]; *p; p = &(*p)->next) {
+    if (*p == &t) {
+      *p = t.next;
+      break;
+    }
+  }
+  t.armed = false;
+}
+
+void timerWheelStart(WheelTimer &t, uint32_t delayMs) {
+  if (t.armed) unlink(t);
+  uint32_t ticks = (delayMs + TIMER_WHEEL_TICK_MS - 1) / TIMER_WHEEL_TICK_MS;
+  // Due after the current tick, so a callback re-arming itself cannot
+  // run again in the same pass.
+  t.due = nowTick() + (ticks ? ticks : 1);
+  WheelTimer *&head = slots[t.due % TIMER_WHEEL_SLOTS];
+  t.next = head;
+  head = &t;
+  t.armed = true;
+}
+
+void timerWheelStop(WheelTimer &t) {
+  if (t.armed) unlink(t);
+}
+
+// One timer at a time, looked up from the slot head again after each
+// callback: a callback may start or stop any timer, this slot included.
+static void runSlot(uint32_t tick) {
+  for (;;) {
+    WheelTimer *t = slots[tick % TIMER_WHEEL_SLOTS];
+    while (t && (int32_t)(t->due - tick) > 0) t = t->next;  // a later turn of the wheel
+    if (!t) return;
+    unlink(*t);
+    t->fire();
+  }
+}
+
+void timerWheelRun() {
+  uint32_t now = nowTick();
+  // After a long stall (e.g. the settings screen) one turn of the wheel
+  // still visits every slot and fires whatever is overdue.
+  if (now - doneTick > TIMER_WHEEL_SLOTS) doneTick = now - TIMER_WHEEL_SLOTS;
+  while ((int32_t)(now - doneTick) > 0) runSlot(++doneTick);
+}
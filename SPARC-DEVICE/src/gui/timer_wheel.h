@@ -0,0 +1,30 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <Arduino.h>
+
+// One-shot timers for the UI task, run cooperatively from gui3Loop():
+// nothing blocks and callbacks run on the UI task, so they may draw and
+// touch UI state freely. Timers are hashed into a wheel of
+// TIMER_WHEEL_SLOTS slots of TIMER_WHEEL_TICK_MS each, so a pass only
+// looks at the timers due in the ticks that went by, however many are
+// armed. The timer structs belong to the caller; nothing is allocated.
+static const uint16_t TIMER_WHEEL_TICK_MS = 10;  // the UI task frame
+static const uint16_t TIMER_WHEEL_SLOTS = 64;
+
+struct WheelTimer {
+  void (*fire)();
+  WheelTimer *next;  // slot list
+  uint32_t due;      // tick it fires on
+  bool armed;
+};
+
+// Arm t to fire once, delayMs from now to the tick (never in the current
+// one); an armed timer is moved. Callbacks may re-arm their own timer.
+void timerWheelStart(WheelTimer &t, uint32_t delayMs);
+void timerWheelStop(WheelTimer &t);
+
+// Fire every timer that has come due since the last call.
+void timerWheelRun();
+
+#endif // TIMER_WHEEL_H
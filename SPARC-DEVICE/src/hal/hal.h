@@ -0,0 +1,26 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <stdint.h>
+
+// Thin hardware seam for the blink/sensor path. Everything that touches
+// the clock or a GPIO goes through here so the classifier logic links
+// against either backend: hal_esp32.cpp on the board, or the virtual
+// clock and simulated pins of the host build (host/sim/hal_sim.cpp).
+// Keep this header free of board headers so both can include it.
+
+// Clock
+unsigned long halMillis();
+unsigned long halMicros();       // ISR safe
+void halDelay(unsigned long ms);
+uint32_t halCycleCount();        // CPU cycle counter, for benchmarks
+
+// GPIO
+void halPinsSetup();
+bool halIrSensorRead();          // HIGH = eye open, LOW = eye closed (ISR safe)
+void halAttachIrInterrupt(void (*isr)()); // fires on every IR sensor edge
+void halSetBlinkLed(bool on);
+void halSetEmergencyOutputs(bool on); // emergency LED + buzzer
+bool halEmergencyButtonPressed();
+
+#endif // HAL_H
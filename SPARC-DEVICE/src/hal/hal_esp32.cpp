@@ -0,0 +1,62 @@
+#include "hal.h"
+
+#include <Arduino.h>
+
+// Pin assignments (update as needed)
+static const int IR_SENSOR_PIN = 36;
+static const int BLINK_LED_PIN = 25; // Changed from 19 to 25
+static const int EMERGENCY_LED_PIN = 27; // Changed from 2 to 27
+static const int BUZZER_PIN = 26;
+// static const int NAVIGATION_LED_PIN = 14; // Removed navigation LED
+static const int EMERGENCY_BUTTON_PIN = 12; // Emergency reset button moved to 14 from 22
+
+unsigned long halMillis() {
+  return millis();
+}
+
+unsigned long IRAM_ATTR halMicros() {
+  return micros();
+}
+
+void halDelay(unsigned long ms) {
+  delay(ms);
+}
+
+uint32_t halCycleCount() {
+  return ESP.getCycleCount();
+}
+
+void halPinsSetup() {
+  pinMode(IR_SENSOR_PIN, INPUT);
+  pinMode(BLINK_LED_PIN, OUTPUT);
+  pinMode(EMERGENCY_LED_PIN, OUTPUT);
+  pinMode(BUZZER_PIN, OUTPUT);
+  // pinMode(NAVIGATION_LED_PIN, OUTPUT); // Removed navigation LED
+  pinMode(EMERGENCY_BUTTON_PIN, INPUT_PULLUP); // Emergency reset button
+  digitalWrite(BLINK_LED_PIN, LOW);
+  digitalWrite(EMERGENCY_LED_PIN, LOW);
+  digitalWrite(BUZZER_PIN, LOW);
+  // digitalWrite(NAVIGATION_LED_PIN, LOW); // Removed navigation LED
+}
+
+bool IRAM_ATTR halIrSensorRead() {
+  return digitalRead(IR_SENSOR_PIN);  // LOW = Eye closed
+}
+
+void halAttachIrInterrupt(void (*isr)()) {
+  attachInterrupt(digitalPinToInterrupt(IR_SENSOR_PIN), isr, CHANGE);
+}
+
+void halSetBlinkLed(bool on) {
+  digitalWrite(BLINK_LED_PIN, on ? HIGH : LOW);
+}
+
+void halSetEmergencyOutputs(bool on) {
+  digitalWrite(EMERGENCY_LED_PIN, on ? HIGH : LOW);
+  //tone(BUZZER_PIN, 3000); // 2kHz tone
+  digitalWrite(BUZZER_PIN, on ? HIGH : LOW);
+}
+
+bool halEmergencyButtonPressed() {
+  return digitalRead(EMERGENCY_BUTTON_PIN) == HIGH;
+}
@@ -0,0 +1,40 @@
+#include "heap_stats.h"
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+static size_t markBlocks = 0;
+static size_t markBytes = 0;
+static unsigned long markMs = 0;
+static bool marked = false;
+
+void heapStatsMark() {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+  markBlocks = info.allocated_blocks;
+  markBytes = info.total_allocated_bytes;
+  markMs = millis();
+  marked = true;
+}
+
+void heapStatsPrintStatus(Stream &out) {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+  // Share of free memory that is not usable as one block.
+  uint32_t fragmentation = info.total_free_bytes
+      ? 100 - (uint32_t)((uint64_t)info.largest_free_block * 100 / info.total_free_bytes) : 0;
+
+  out.print("Heap free: "); out.print((uint32_t)info.total_free_bytes);
+  out.print(", low water: "); out.print((uint32_t)info.minimum_free_bytes);
+  out.print(", largest block: "); out.print((uint32_t)info.largest_free_block);
+  out.print(", fragmentation: "); out.print(fragmentation); out.print("%\n");
+  out.print("Heap blocks: "); out.print((uint32_t)info.allocated_blocks);
+  if (marked) {
+    long blocks = (long)info.allocated_blocks - (long)markBlocks;
+    long bytes = (long)info.total_allocated_bytes - (long)markBytes;
+    out.print(" ("); out.print(blocks >= 0 ? "+" : ""); out.print(blocks);
+    out.print(" blocks, "); out.print(bytes >= 0 ? "+" : ""); out.print(bytes);
+    out.print(" bytes since mark "); out.print((millis() - markMs) / 1000); out.print(" s ago)");
+  }
+  out.print("\n");
+}
@@ -0,0 +1,14 @@
+#ifndef HEAP_STATS_H
+#define HEAP_STATS_H
+
+#include <Arduino.h>
+
+// Heap health for STATUS: free bytes, low-water mark, largest free block,
+// fragmentation and the number of allocated blocks compared with a mark.
+// The mark is taken once boot has finished (and again on HEAP_MARK), so a
+// steady "+0 blocks" shows the running loops do not allocate.
+
+void heapStatsMark();
+void heapStatsPrintStatus(Stream &out);
+
+#endif // HEAP_STATS_H
@@ -1,92 +1,200 @@
 #include "gui/gui.h"
+#include "gui/auto_scan.h"
+#include "gui/scan_order.h"
 #include "network/blink_wifi.h"
+#include "network/discovery.h"
+#include "network/net_events.h"
+#include "network/commands.h"
 #include "settings/settings.h"
 #include "notifications/notif.h"
+#include "sensor/blink_calibration.h"
+#include "audio/audio.h"
+#include "sensor/ir_capture.h"
+#include "sensor/blink_events.h"
+#include "sensor/blink_calibration.h"
+#include "hal/heap_stats.h"
+#include "predict/predict.h"
+#include "phrases/phrases.h"
 #include "../include/common_variables.h"
 
 #include <WiFi.h>
 
 int uiState = 0;
-bool tftConnected = true;
 
 void openSettingsInterface() {
     uiState = 1;
     setting2Setup();
 }
 
+// DHCP by default: the device announces its address through discovery
+// beacons. Set useStaticIP to pin the address below instead.
+bool useStaticIP = false;
 IPAddress local_IP(192, 168, 120, 13); // Set your static IP
 IPAddress gateway(192, 168, 120, 1);
 IPAddress subnet(255, 255, 255, 0);
 
 
-void setup() {
-  Serial.begin(115200);  
-  loadWiFiFromPreferences();
-  loadBlinkSettingsFromPreferences();
+// --- Tasks ---
+// Blink capture gets core 1 to itself at high priority so classification
+// never waits behind a TFT redraw or a socket call. UI, network and audio
+// share core 0 with the WiFi stack. Tasks talk through queues only:
+// gestures via blink_events, sounds via audioPlay(), notifications via
+// sendNotificationRequest(), phrase page messages via
+// clientLinkPostText(). The exceptions are calibrated blink thresholds,
+// flagged for the network task to save, blink_events' flag for a gesture
+// being blinked, which timed scanning polls, and a phrase library loaded
+// by a client, handed to the UI task through NVS and a flag.
+static const BaseType_t SENSOR_CORE = 1;
+static const BaseType_t APP_CORE = 0;
+static const UBaseType_t SENSOR_PRIORITY = 5;
+static const UBaseType_t NET_PRIORITY = 3;
+static const UBaseType_t UI_PRIORITY = 2;
+static const UBaseType_t AUDIO_PRIORITY = 2;
+static const uint32_t SENSOR_STACK = 4096;
+static const uint32_t UI_STACK = 8192;
+static const uint32_t NET_STACK = 8192;
+static const uint32_t AUDIO_STACK = 4096;
+
+// The sensor task wakes on every IR edge and at least this often for the
+// debounce and gap/hold timers.
+static const TickType_t SENSOR_TICK = pdMS_TO_TICKS(5);
+static const TickType_t UI_FRAME = pdMS_TO_TICKS(10);
+// The network task sleeps in select() (net_events.h); while WiFi is
+// still coming up it also checks the boot timeout this often.
+static const unsigned long NET_BOOT_POLL_MS = 100;
 
-  WiFi.config(local_IP, gateway, subnet);
-  WiFi.begin(ssid, password);
-  
-  // Try to connect for 10 seconds
-  unsigned long startTime = millis();
-  while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < 10000) {
-    delay(1000);
-    Serial.println("Connecting to WiFi...");
+// --- Staged boot ---
+// Display and blink input come up synchronously so the T9 grid is
+// usable right away; WiFi association and the TCP servers are brought up
+// by the network task, the DFPlayer by the audio task.
+static const unsigned long WIFI_BOOT_TIMEOUT = 10000;
+static const unsigned long AUDIO_BOOT_DELAY = 1500; // DFPlayer needs time after power-up
+
+static bool serversStarted = false;
+static unsigned long bootStageStart = 0;
+
+static void bootLog(const char* phase) {
+  Serial.print("[BOOT] ");
+  Serial.print(phase);
+  Serial.print(" at ");
+  Serial.print(millis());
+  Serial.println(" ms");
+}
+
+static void bootLoop() {
+  if (serversStarted) return;
+  if (WiFi.status() == WL_CONNECTED || millis() - bootStageStart > WIFI_BOOT_TIMEOUT) {
+    if (WiFi.status() == WL_CONNECTED) {
+      bootLog("WiFi connected");
+    } else {
+      bootLog("WiFi connection failed - continuing without WiFi");
+    }
+    notificationServerSetup();
+    blinkWifiServerSetup();
+    bootLog("servers started");
+    serversStarted = true;
+    heapStatsMark();  // everything from here on should run without allocating
   }
-  
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("Connected to WiFi");
-  } else {
-    Serial.println("WiFi connection failed - continuing without WiFi");
+}
+
+static void sensorTask(void*) {
+  irCaptureNotifyTask(xTaskGetCurrentTaskHandle());
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, SENSOR_TICK);
+    getBlinks();
+    emergencyLoop();
   }
-  
-  notificationServerSetup();
-  blinkWifiSetup();
-  gui3Setup();
-  gui3InitAudio(); 
 }
 
-void loop() {
-  getBlinks();
-    // 1. Always check for new client connection
-    if (!clientFound && !clientConnected) {
-        WiFiClient tempClient = server.available();
-        if (tempClient) {
-            client = tempClient;
-            Serial.println("*** NEW CLIENT CONNECTED - SENDING CONFIG ***");
-            delay(500); // Give client time to be ready
-            String config = String(blinkDuration) + ";" + String(blinkGap) + ";" + ssid + ";" + password + ";" + userId;
-            size_t bytesWritten = client.print(config);
-            client.flush();
-            Serial.print("Config string sent to client: ");
-            Serial.println(config);
-            Serial.print("Bytes written: ");
-            Serial.println(bytesWritten);
-            clientConnected = true;
-            clientFound = true;
-            Serial.println("*** CLIENT CONNECTED, CONFIG SENT, SWITCHING TO CLIENT MODE ***");
-        }
+static void uiTask(void*) {
+  for (;;) {
+    BlinkEvent e;
+    bool haveEvent = blinkEventsReceive(BLINK_CONSUMER_UI, e, UI_FRAME);
+    if (uiState == 0) {
+      gui3Loop();
+      if (haveEvent) {
+        if (e.gesture == GESTURE_SINGLE) gui3OnSingleBlink();
+        else if (e.gesture == GESTURE_DOUBLE) gui3OnDoubleBlink();
+        else if (e.gesture == GESTURE_TRIPLE) gui3OnTripleBlink();
+        blinkEventsHandled(BLINK_CONSUMER_UI, e);
+      }
+    } else if (uiState == 1) {
+      setting2Loop();
+      // The settings screen is touch-only. A gesture made there is taken
+      // and deliberately not acted on: queued, it would type on the
+      // keyboard once settings close.
+      if (haveEvent) blinkEventsHandled(BLINK_CONSUMER_UI, e);
     }
+  }
+}
 
-    // 2. Set tftConnected based on clientConnected
-    tftConnected = !clientConnected;
-
-    // 3. Run the appropriate mode
-    if (tftConnected) {
-        // GUI mode
-        if (uiState == 0) {
-            notificationServerLoop();
-            gui3Loop();
-            if (blinkWifiCheckSingleBlink()) gui3OnSingleBlink();
-            else if (blinkWifiCheckDoubleBlink()) gui3OnDoubleBlink();
-        } else if (uiState == 1) {
-            setting2Loop();
-        }
+static void netTask(void*) {
+  for (;;) {
+    netEventsBegin();
+    if (serversStarted) {
+      discoveryWatch();
+      notificationWatch();
+      blinkWifiWatch();
     } else {
-        // Client mode
-        blinkWifiLoop();
-        // blinkWifiLoop() should handle client disconnection and set clientConnected = false if needed
+      netEventsWakeWithin(NET_BOOT_POLL_MS);
     }
+    netEventsWait();
 
-    blinkWifiResetFlags();
+    BlinkEvent e;
+    while (blinkEventsReceive(BLINK_CONSUMER_NET, e, 0)) {
+      blinkWifiOnGesture(e.gesture);
+      blinkEventsHandled(BLINK_CONSUMER_NET, e);
+    }
+    calibrationLoop();
+    commandSerialLoop();
+    notificationQueueLoop();
+    bootLoop();
+    if (!serversStarted) continue;
+    discoveryLoop();
+    notificationServerLoop();
+    blinkWifiLoop();
+  }
+}
+
+static void audioTask(void*) {
+  vTaskDelay(pdMS_TO_TICKS(AUDIO_BOOT_DELAY));
+  gui3InitAudio();
+  bootLog("audio ready");
+  for (;;) {
+    audioLoop();
+  }
+}
+
+void setup() {
+  Serial.begin(115200);  
+  bootLog("reset");
+  loadWiFiFromPreferences();
+  loadBlinkSettingsFromPreferences();
+  audioTaskSetup();
+  notificationSetup();
+  predictSetup();
+  scanOrderSetup();
+  autoScanSetup();
+  phrasesSetup();
+
+  gui3Setup();
+  bootLog("display ready");
+  blinkWifiSetup();
+  commandSerialSetup();
+  bootLog("blink input ready");
+
+  beginWiFiAsync();
+  bootStageStart = millis();
+  bootLog("WiFi association started");
+
+  xTaskCreatePinnedToCore(sensorTask, "sensor", SENSOR_STACK, nullptr, SENSOR_PRIORITY, nullptr, SENSOR_CORE);
+  xTaskCreatePinnedToCore(uiTask, "ui", UI_STACK, nullptr, UI_PRIORITY, nullptr, APP_CORE);
+  xTaskCreatePinnedToCore(netTask, "net", NET_STACK, nullptr, NET_PRIORITY, nullptr, APP_CORE);
+  xTaskCreatePinnedToCore(audioTask, "audio", AUDIO_STACK, nullptr, AUDIO_PRIORITY, nullptr, APP_CORE);
+  bootLog("tasks started");
+}
+
+void loop() {
+  // Everything runs in the tasks started by setup().
+  vTaskDelete(NULL);
 }
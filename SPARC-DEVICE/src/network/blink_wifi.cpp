@@ -2,166 +2,111 @@
 
 #include "../settings/settings.h"
 #include "../notifications/notif.h"
+#include "../gui/gui.h"
+#include "../gui/auto_scan.h"
+#include "../gui/scan_order.h"
+#include "../hal/hal.h"
+#include "../hal/heap_stats.h"
+#include "../phrases/phrases.h"
+#include "../predict/predict.h"
+#include "../sensor/ir_capture.h"
+#include "../sensor/gesture.h"
+#include "../sensor/blink_calibration.h"
+#include "../sensor/blink_trace.h"
+#include "../sensor/blink_events.h"
+#include "../sensor/raw_stream.h"
+#include "discovery.h"
+#include "client_link.h"
+#include "net_events.h"
 #include "../../include/common_variables.h"
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <Preferences.h>
 #include <EEPROM.h>
 
-// Pin assignments (update as needed)
-static const int IR_SENSOR_PIN = 36;
-static const int BLINK_LED_PIN = 25; // Changed from 19 to 25
-static const int EMERGENCY_LED_PIN = 27; // Changed from 2 to 27
-static const int BUZZER_PIN = 26;
-// static const int NAVIGATION_LED_PIN = 14; // Removed navigation LED
-static const int EMERGENCY_BUTTON_PIN = 12; // Emergency reset button moved to 14 from 22
-
 // Configurable blink detection
-int blinkDuration = 400; // ms, default
-int blinkGap = 1200;     // ms, default
+std::atomic<int> blinkDuration(400); // ms, default
+std::atomic<int> blinkGap(1200);     // ms, default
 
 static const unsigned int DEBOUNCE_DELAY = 50;
 static const unsigned int EMERGENCY_TIMEOUT = 7000;
-static unsigned int emergency_blink_interval = 250; // For emergency blink detection
+static const unsigned long TRACE_POLL_MS = 20;
 
 // State variables
 static bool currentEyeState = true;
-static bool lastSensorReading = HIGH;
-static unsigned int eyeCloseTime = 0;
-static unsigned int lastDebounceTime = 0;
-static int consecutiveBlinks = 0;
-static unsigned int lastBlinkTime = 0;
-static unsigned int lastBlinkEndTime = 0; // For correct blink gap calculation
-static bool emergencyMode = false;
-static unsigned int emergencyStartTime = 0;
-
-// Blink event flags for GUI
-static bool singleBlinkDetected = false;
-static bool doubleBlinkDetected = false;
-static bool quadBlinkDetected = false; // For 4 blinks (emergency)
-
-static bool blinkProcessed = false;
-
+static IrEdge pendingEdge;            // last raw edge, waiting out the debounce window
+static bool pendingEdgeValid = false;
+static GestureContext liveGesture;
+static volatile bool emergencyMode = false;
+static unsigned long emergencyStartTime = 0;
+static volatile bool emergencyRequested = false;  // emergencyRaise()
 
-// For deferred blink event processing
-static unsigned int lastBlinkEventTime = 0;
-
-// Preferences for persistent storage
-Preferences prefs;
-
-// WiFi and TCP server
-WiFiServer server(45454);
-WiFiClient client;
 bool clientConnected = false;
-bool clientFound = false;  // Keep clientFound outside/static so it persists
-
-// Buffer for client commands
-static String clientCmdBuffer = "";
 
 // Configurable variables (moved from .ino)
 String ssid = "Pushpa";
 String password = "*#@09password";
 
 
-// Function declarations for WiFi logic
-void processCommand(String cmd, Stream &out, bool fromWifi);
-void reconnectWiFi();
-void loadConfig();
-void saveConfig();
-void sendStatus(Stream &out);
-void emergencyModeCheck();
-
-// Command buffers
-String wifiCmdBuffer = "";
-String serialCmdBuffer = "";
+// Hand a gesture reported by the classifier to the UI and network tasks.
+static void dispatchGesture(BlinkGesture g) {
+  if (g == GESTURE_NONE) return;
+  if (g == GESTURE_QUAD) {
+    if (emergencyMode) return;
+    emergencyMode = true;
+    emergencyStartTime = halMillis();
+    Serial.println("EMERGENCY MODE ACTIVATED!");
+  }
+  blinkEventsPublish(g);
+  netEventsWake();
+  Serial.print("[DEBUG] ");
+  Serial.print(gestureName(g));
+  Serial.println(" blink gesture detected and queued.");
+}
 
-// Helper functions for Preferences persistence
+// Apply a debounced eye transition that happened at edgeMs.
+static void handleEyeTransition(bool eyeOpen, unsigned long edgeMs) {
+  if (eyeOpen == currentEyeState) return;
+  halSetBlinkLed(!eyeOpen); // Blink LED on while the eye is closed
+  currentEyeState = eyeOpen;
+  blinkTraceRecordEdge(eyeOpen, edgeMs);
+  dispatchGesture(gestureFeedEdge(liveGesture, eyeOpen, edgeMs));
+}
 
-int getBlinks(){
-   // IR sensor logic
-   bool sensorReading = digitalRead(IR_SENSOR_PIN);  // LOW = Eye closed
+// Convert an ISR microsecond timestamp into the millis() time base.
+// Done relative to "now" so micros() wrap-around does not matter.
+// An edge captured after "now" was sampled counts as happening now.
+static unsigned long edgeToMillis(uint32_t edgeUs, uint32_t nowUs, unsigned long nowMs) {
+  int32_t ageUs = (int32_t)(nowUs - edgeUs);
+  if (ageUs < 0) ageUs = 0;
+  return nowMs - (unsigned long)(ageUs / 1000);
+}
 
-   // Debounce check
-   if (sensorReading != lastSensorReading) {
-     lastDebounceTime = millis();
-   }
- 
-   if ((millis() - lastDebounceTime) > DEBOUNCE_DELAY) {
-     bool eyeOpen = (sensorReading == HIGH);
-     if (eyeOpen != currentEyeState) {
-       if (!eyeOpen) {
-         // Eye just closed
-         eyeCloseTime = millis();
-         digitalWrite(BLINK_LED_PIN, HIGH); // Blink LED ON
-       } else {
-         // Eye just opened
-         unsigned long actualblinkDuration = millis() - eyeCloseTime;
-         digitalWrite(BLINK_LED_PIN, LOW); // Blink LED OFF
-         // Use different min duration for emergency blinks
-         unsigned long currentBlinkDuration = (consecutiveBlinks >= 2) ? emergency_blink_interval : blinkDuration;
-         if (actualblinkDuration >= currentBlinkDuration) {
-           unsigned long actualblinkGap = 0;
-           if (lastBlinkEndTime != 0) {
-             actualblinkGap = millis() - lastBlinkEndTime;
-           }
-           if (millis() - lastBlinkTime < blinkGap) {
-             consecutiveBlinks++;
-           } else {
-             consecutiveBlinks = 1;  // Reset count if too much time passed
-           }
-           lastBlinkTime = millis();
-           lastBlinkEndTime = millis(); // Update for next gap calculation
-           lastBlinkEventTime = millis(); // Update for deferred event
-           // Debug print
-           Serial.print("Blink #");
-           Serial.print(consecutiveBlinks);
-           Serial.print(", blinkDuration:");
-           Serial.print(blinkDuration);
-           Serial.print(", Duration: ");
-           Serial.print(actualblinkDuration);
-           Serial.print(" ms, Gap: ");
-           Serial.print(blinkGap);
-           Serial.print(" ms, Acutal Gap: ");
-           Serial.print(actualblinkGap);
-           Serial.println(" ms");
-         }
-       }
-       currentEyeState = eyeOpen;
+void getBlinks(){
+   // IR sensor logic: consume edges captured by the ISR. An edge only
+   // counts once the level has been stable for DEBOUNCE_DELAY, measured
+   // on the edge timestamps themselves rather than on loop() timing.
+   uint32_t nowUs = halMicros();
+   unsigned long nowMs = halMillis();
+   IrEdge edge;
+   while (irCapturePop(edge)) {
+     rawStreamPushEdge(edge);
+     if (pendingEdgeValid && (edge.timeUs - pendingEdge.timeUs) > DEBOUNCE_DELAY * 1000UL) {
+       handleEyeTransition(pendingEdge.eyeOpen, edgeToMillis(pendingEdge.timeUs, nowUs, nowMs));
      }
+     pendingEdge = edge;
+     pendingEdgeValid = true;
+   }
+   if (pendingEdgeValid && (int32_t)(nowUs - pendingEdge.timeUs) > (int32_t)(DEBOUNCE_DELAY * 1000UL)) {
+     handleEyeTransition(pendingEdge.eyeOpen, edgeToMillis(pendingEdge.timeUs, nowUs, nowMs));
+     pendingEdgeValid = false;
    }
-   lastSensorReading = sensorReading;
-
-   if (consecutiveBlinks > 0 && (millis() - lastBlinkEventTime > blinkGap+300)) {
-    consecutiveBlinks = 0;
-    blinkProcessed = false; // reset flag after full blink gap
-  }
- 
-
-  if (!blinkProcessed){
-    if (consecutiveBlinks == 1 &&(millis() - lastBlinkEventTime > blinkGap)) {
-      singleBlinkDetected = true;
-      blinkProcessed = true;
-      Serial.println("[DEBUG] Single blink detected and flagged.");
-    } else if (consecutiveBlinks == 2&&(millis() - lastBlinkEventTime > blinkGap)) {
-      doubleBlinkDetected = true;
-      blinkProcessed = true;
-      Serial.println("[DEBUG] Double blink detected and flagged.");
-    } 
-   
-      if (consecutiveBlinks >= 4 && !emergencyMode && (millis() - lastBlinkEventTime > blinkGap)) {
-      quadBlinkDetected = true;
-      blinkProcessed = true;
-      Serial.println("[DEBUG] Quad blink (emergency) detected and flagged.");
-      emergencyMode = true;
-      emergencyStartTime = millis();
-      Serial.println("EMERGENCY MODE ACTIVATED!");
-
-      emergencyModeCheck(); // added emergency mode check
-  }
-}
-  return consecutiveBlinks;
 
+   // Nothing is known past an edge still inside its debounce window, so
+   // do not let the gap/hold timers run beyond it.
+   unsigned long tickMs = pendingEdgeValid ? edgeToMillis(pendingEdge.timeUs, nowUs, nowMs) : nowMs;
+   dispatchGesture(gestureTick(liveGesture, tickMs));
+   blinkEventsSetPending(gestureInProgress(liveGesture), liveGesture.closeTime);
 }
 
 bool isServerAvailable(){  // bool 
@@ -172,21 +117,15 @@ bool isServerAvailable(){  // bool
 void blinkWifiSetup() {
   Serial.println("*** INSIDE BLINK WIFI SETUP ***");
   
-  pinMode(IR_SENSOR_PIN, INPUT);
-  pinMode(BLINK_LED_PIN, OUTPUT);
-  pinMode(EMERGENCY_LED_PIN, OUTPUT);
-  pinMode(BUZZER_PIN, OUTPUT);
-  // pinMode(NAVIGATION_LED_PIN, OUTPUT); // Removed navigation LED
-  pinMode(EMERGENCY_BUTTON_PIN, INPUT_PULLUP); // Emergency reset button
-  digitalWrite(BLINK_LED_PIN, LOW);
-  digitalWrite(EMERGENCY_LED_PIN, LOW);
-  digitalWrite(BUZZER_PIN, LOW);
-  // digitalWrite(NAVIGATION_LED_PIN, LOW); // Removed navigation LED
+  halPinsSetup();
+  currentEyeState = halIrSensorRead();
+  irCaptureSetup();
+  gestureReset(liveGesture, true);
+  blinkEventsSetup();
+  netEventsSetup();
+  clientLinkSetup();
   Serial.println("*** ALL PINS INITIALIZED ***");
 
-  // WiFi/Preferences setup
-  Serial.println("*** INITIALIZING PREFERENCES ***");
-  prefs.begin("blinkcfg", false);
   Serial.println("*** INITIALIZING EEPROM ***");
   EEPROM.begin(EEPROM_SIZE); // Initialize EEPROM for userId only
   Serial.println("*** READING USER ID FROM EEPROM ***");
@@ -194,233 +133,94 @@ void blinkWifiSetup() {
   Serial.print("*** USER ID READ: ");
   Serial.print(userId);
   Serial.println(" ***");
-  Serial.println("*** RECONNECTING TO WIFI ***");
-  reconnectWiFi();
+  calibrationSetup();
+}
+
+// Started from the boot sequence once WiFi is up (or has given up).
+void blinkWifiServerSetup() {
   Serial.println("*** STARTING SERVER ON PORT 45454 ***");
-  server.begin();
+  clientLinkBegin();
   Serial.println("*** SERVER STARTED SUCCESSFULLY ON PORT 45454 ***");
-  
 }
 
-void emergencyModeCheck() {
-  if (!emergencyMode) return;
-
-  sendNotificationRequest(userId, "EMERGENCY");
-
-  Serial.println("emergencyModeCheck function");
-
-  while (emergencyMode) {
-    unsigned long elapsed = millis() - emergencyStartTime;
-
-    // 500ms ON, 500ms OFF
-    if ((elapsed % 1000) < 500) {
-      digitalWrite(EMERGENCY_LED_PIN, HIGH);
-      //tone(BUZZER_PIN, 3000); // 2kHz tone
-      digitalWrite(BUZZER_PIN, HIGH);
-    } else {
-      digitalWrite(EMERGENCY_LED_PIN, LOW);
-      //noTone(BUZZER_PIN);
-      digitalWrite(BUZZER_PIN, LOW);
-    }
-
-    // Emergency button clears the mode
-    if (digitalRead(EMERGENCY_BUTTON_PIN) == HIGH) {
-      emergencyMode = false;
-      digitalWrite(EMERGENCY_LED_PIN, LOW);
-      digitalWrite(BUZZER_PIN, LOW);
-      Serial.println("EMERGENCY MODE CLEARED!");
-    }
-
-    delay(10);  // Prevent ESP32 watchdog reset
-  }
+void emergencyRaise() {
+  emergencyRequested = true;
 }
 
+// Runs on the sensor task next to getBlinks(): flashes the emergency
+// LED/buzzer until the emergency button is pressed.
+void emergencyLoop() {
+  if (emergencyRequested) {
+    emergencyRequested = false;
+    dispatchGesture(GESTURE_QUAD);
+  }
+  if (!emergencyMode) return;
 
+  unsigned long elapsed = halMillis() - emergencyStartTime;
 
-void blinkWifiLoop() {
-    if (WiFi.status() == WL_CONNECTED) {
-        // --- Ongoing communication with connected client ---
-       // Serial.println("*** INSIDE MAIN WIFI LOOP (CLIENT MODE) ***");
-
-        // Send blink data to client
-        if (clientConnected && singleBlinkDetected) {
-            Serial.println("*** SENDING SINGLE BLINK TO CLIENT ***");
-            client.print('1');
-        } else if (clientConnected && doubleBlinkDetected) {
-            Serial.println("*** SENDING DOUBLE BLINK TO CLIENT ***");
-            client.print('2');
-        } else if (clientConnected && quadBlinkDetected && emergencyMode) {
-            Serial.println("*** SENDING QUAD BLINK TO CLIENT ***");
-            client.print('4');
-        }
-
-        // Handle emergency mode
-        emergencyModeCheck();
-        // Process incoming commands from client (if any)
-        if (clientConnected && client.available()) {
-            while (client.available()) {
-                char c = client.read();
-                Serial.print("Received from client: ");
-                Serial.println(c);
-                // Buffer until newline or carriage return
-                if (c == '\n' || c == '\r') {
-                    if (clientCmdBuffer.length() > 0) {
-                        processCommand(clientCmdBuffer, client, true);
-                        clientCmdBuffer = "";
-                    }
-                } else {
-                    clientCmdBuffer += c;
-                }
-            }
-        }
-
-        
-       // Serial.println("*** CHECKING FOR CLIENT CONNECTION STATUS ***");
-
-        // Check if client is still connected
-        if (clientConnected && !client.connected()) {
-            Serial.println("*** CLIENT DISCONNECTED - RESETTING FLAGS ***");
-            clientConnected = false;
-            clientFound = false;
-            client.stop();
-            Serial.println("*** CLIENT STOPPED AND FLAGS RESET ***");
-        }
-    } else {
-        Serial.println("*** WIFI NOT CONNECTED - CANNOT HANDLE CLIENTS ***");
-    }
-}
+  // 500ms ON, 500ms OFF
+  halSetEmergencyOutputs((elapsed % 1000) < 500);
 
-
-bool blinkWifiCheckSingleBlink() {
-  if (singleBlinkDetected) {
-    singleBlinkDetected = false;
-    Serial.println("[DEBUG] Single blink event consumed by GUI.");
-    return true;
+  // Emergency button clears the mode
+  if (halEmergencyButtonPressed()) {
+    emergencyMode = false;
+    halSetEmergencyOutputs(false);
+    Serial.println("EMERGENCY MODE CLEARED!");
   }
-  return false;
 }
 
-bool blinkWifiCheckDoubleBlink() {
-  if (doubleBlinkDetected) {
-    doubleBlinkDetected = false;
-    Serial.println("[DEBUG] Double blink event consumed by GUI.");
-    return true;
-  }
-  return false;
+// Network side of a gesture: forward it to the PC client and raise the
+// emergency notification.
+void blinkWifiOnGesture(BlinkGesture g) {
+  if (g == GESTURE_QUAD) sendNotificationRequest(userId.c_str(), "EMERGENCY");
+  clientLinkOnGesture(g, halMillis());
 }
 
-// Optionally, for emergency/quad blink
-bool blinkWifiCheckQuadBlink() {
-  if (quadBlinkDetected) {
-    quadBlinkDetected = false;
-    Serial.println("[DEBUG] Quad blink event consumed by GUI.");
-    return true;
-  }
-  return false;
+void blinkWifiWatch() {
+  // Trace edges are written out from here; TRACE:ON is a short-lived
+  // debugging session, so plain polling is fine for it.
+  if (blinkTraceRecording()) netEventsWakeWithin(TRACE_POLL_MS);
+  if (WiFi.status() == WL_CONNECTED) clientLinkWatch();
 }
 
-void processCommand(String cmd, Stream &out, bool fromWifi) {
-  cmd.trim();
-  cmd.toUpperCase();
-  
-  Serial.println("Processing command: " + cmd);
-   if (cmd.startsWith("SET_MINBLINK:")) {
-    String val = cmd.substring(13);
-    unsigned long v = val.toInt();
-    if (v >= 100 && v <= 5000) {
-      blinkDuration = v;
-      saveBlinkSettingsToPreferences();
-      out.print("Min blink duration updated to: "); out.print(blinkDuration); out.print("\n");
-    } else {
-      out.print("Invalid min blink duration\n");
-    }
-  } else if (cmd.startsWith("SET_BLINKINT:")) {
-    String val = cmd.substring(13);
-    unsigned long v = val.toInt();
-    if (v >= 200 && v <= 10000) {
-      blinkGap = v;
-      saveBlinkSettingsToPreferences();
-      out.print("Blink interval updated to: "); out.print(blinkGap); out.print("\n");
-    } else {
-      out.print("Invalid blink interval\n");
-    }
-  } else if (cmd == "STATUS") {
-    sendStatus(out);
-  } else {
-    out.print("Unknown command\n");
-  }
+void blinkWifiLoop() {
+  blinkTraceLoop();
+  if (WiFi.status() != WL_CONNECTED) return;
+  clientLinkLoop();
 }
 
-void sendStatus(Stream &out) {
+void sendStatus(Stream &out, bool fromWifi) {
   out.print("SSID: "); out.print(ssid); out.print("\n");
-  out.print("Password: "); out.print(password); out.print("\n");
+  // Clients get the password only through WIFI_CREDS with the link key.
+  if (!fromWifi) {
+    out.print("Password: "); out.print(password); out.print("\n");
+  }
   out.print("Min Blink Duration: "); out.print(blinkDuration); out.print("\n");
   out.print("Blink Interval: "); out.print(blinkGap); out.print("\n");
   out.print("WiFi IP: "); out.print(WiFi.localIP()); out.print("\n");
+  notificationPrintStatus(out);
+  discoveryPrintStatus(out);
+  netEventsPrintStatus(out);
+  clientLinkPrintStatus(out);
+  rawStreamPrintStatus(out);
+  calibrationPrintStatus(out);
+  gui3PrintStats(out);
+  predictPrintStatus(out);
+  scanOrderPrintStatus(out);
+  autoScanPrintStatus(out);
+  phrasesPrintStatus(out);
+  blinkEventsPrintStats(out);
+  heapStatsPrintStatus(out);
 }
 
-void loadConfig() {
-  Serial.println("Loading configuration from Preferences...");
-  // Load or set defaults
-  if (prefs.isKey("ssid")) {
-    ssid=prefs.getString("ssid","");
-    Serial.print("Loaded SSID: ");
-    Serial.println(ssid);
-  } else {
-    Serial.print("Using default SSID: ");
-    Serial.println(ssid);
-  }
-  if (prefs.isKey("pass")) {
-    password=prefs.getString("pass","");
-    Serial.println("Loaded password from Preferences");
-  } else {
-    Serial.println("Using default password");
-  }
-  blinkDuration = prefs.getULong("blinkDuration", blinkDuration);
-  blinkGap = prefs.getULong("blinkGap", blinkGap);
-  Serial.print("Min blink duration: ");
-  Serial.println(blinkDuration);
-  Serial.print("Blink interval: ");
-  Serial.println(blinkGap);
-}
-
-void saveConfig() {
-  prefs.putULong("blinkDuration", blinkDuration);
-  prefs.putULong("blinkGap", blinkGap);
-}
-
-void reconnectWiFi() {
-  Serial.println("Disconnecting from WiFi...");
-  WiFi.disconnect();
-  delay(100);
+// Kick off association and return immediately; progress is polled via
+// WiFi.status(). The station keeps retrying on its own afterwards.
+void beginWiFiAsync() {
   Serial.println("Setting WiFi mode to STA...");
   WiFi.mode(WIFI_STA);
+  if (useStaticIP) WiFi.config(local_IP, gateway, subnet);
+  WiFi.setAutoReconnect(true);
   Serial.print("Connecting to WiFi SSID: ");
   Serial.println(ssid);
   WiFi.begin(ssid, password);
-  unsigned long startAttempt = millis();
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && millis() - startAttempt < 10000) {
-    delay(500);
-    attempts++;
-    Serial.print("WiFi connection attempt ");
-    Serial.print(attempts);
-    Serial.print(" - Status: ");
-    Serial.println(WiFi.status());
-  }
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.print("Connected to WiFi! IP: ");
-    Serial.println(WiFi.localIP());
-  } else {
-    Serial.println("WiFi connection failed after 10 seconds.");
-    Serial.print("Final WiFi status: ");
-    Serial.println(WiFi.status());
-  }
-} 
-
-
-void blinkWifiResetFlags() {
-  doubleBlinkDetected = false;
-  singleBlinkDetected = false;
-  quadBlinkDetected = false;
 }
@@ -3,13 +3,24 @@
 
 #include <WiFi.h>
 
+#include "../sensor/gesture.h"
+
 void blinkWifiSetup();
+void blinkWifiServerSetup();
+// Network task: register sockets and timers (net_events.h), then loop.
+void blinkWifiWatch();
 void blinkWifiLoop();
-bool blinkWifiCheckSingleBlink();
-bool blinkWifiCheckDoubleBlink();
-void reconnectWiFi();
-int getBlinks();
-void blinkWifiResetFlags();
+void blinkWifiOnGesture(BlinkGesture g);
+// STATUS command output; the WiFi password is left out for PC clients.
+void sendStatus(Stream &out, bool fromWifi);
+// Start (or restart, with new credentials) association without waiting.
+void beginWiFiAsync();
+// Sensor task: drain IR edges, classify, publish gestures (blink_events.h).
+void getBlinks();
+void emergencyLoop();
+// Any task: raise the emergency as a quad blink does (LED, buzzer,
+// EMERGENCY alert, the gesture to PC clients). Taken up by emergencyLoop().
+void emergencyRaise();
 
 bool isServerAvailable();
 
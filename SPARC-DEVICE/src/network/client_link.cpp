@@ -0,0 +1,631 @@
+#include "client_link.h"
+
+#include "link_protocol.h"
+#include "blink_wifi.h"
+#include "commands.h"
+#include "net_events.h"
+#include "../sensor/raw_stream.h"
+#include "../sensor/blink_trace.h"
+#include "../../include/common_variables.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include <lwip/sockets.h>
+#include <errno.h>
+
+// How long a new client has to send the magic bytes before it is treated
+// as a legacy client (which expects the config string unprompted).
+static const unsigned long HANDSHAKE_WAIT_MS = 500;
+// After a WIFI_CREDS request with the wrong key, refuse the next ones for
+// this long, so the key cannot be guessed at network speed.
+static const unsigned long CREDENTIALS_RETRY_MS = 2000;
+// BLINK frames kept for resending to a client that reconnects.
+static const uint8_t EVENT_HISTORY = 32;
+// Messages from the phrase page waiting for the network task.
+static const uint8_t TEXT_QUEUE_LENGTH = 4;
+
+// Several clients (desktop GUI, nurse-station monitor, logger) at once.
+// Everything sent goes through a per-client buffer drained with
+// non-blocking send(); a client whose buffer is full loses the frame
+// (binary clients see the gap in the sequence numbers), and one that has
+// not taken any data for STALL_TIMEOUT_MS is disconnected.
+static const uint16_t CLIENT_PORT = 45454;
+static const uint8_t MAX_CLIENTS = 4;
+static const uint16_t TX_BUFFER_SIZE = 1024;
+static const unsigned long STALL_TIMEOUT_MS = 5000;
+
+enum LinkMode : uint8_t { LINK_IDLE, LINK_PENDING, LINK_LEGACY, LINK_BINARY };
+
+struct ClientLink {
+  WiFiClient sock;
+  LinkMode mode;
+  unsigned long acceptedAt;
+  unsigned long lastProgress;  // last time the send buffer drained or was empty
+  uint8_t rx[LINK_MAX_FRAME];  // handshake bytes, then partial binary frames
+  uint16_t rxLen;
+  CommandLine line;            // legacy: command being typed
+  uint8_t tx[TX_BUFFER_SIZE];  // ring of bytes waiting for the socket
+  uint16_t txHead;
+  uint16_t txLen;
+  uint32_t dropped;            // frames lost to a full send buffer
+  bool rawStream;              // STREAM_RAW:ON
+};
+
+struct SentEvent {
+  uint16_t seq;
+  uint8_t gesture;
+  uint32_t timeMs;
+};
+
+struct PostedText {
+  char text[CLIENT_TEXT_MAX + 1];
+};
+
+static int listenFd = -1;
+static ClientLink links[MAX_CLIENTS];
+static uint8_t frameBuf[LINK_MAX_FRAME];
+
+static SentEvent history[EVENT_HISTORY];
+static uint8_t historyHead = 0;   // oldest entry
+static uint8_t historyCount = 0;
+static uint16_t nextEventSeq = 1;
+static uint16_t lastAckedSeq = 0;
+static uint32_t bootId = 0;
+
+static uint32_t framesSent = 0;
+static uint32_t framesReceived = 0;
+static uint32_t eventsResent = 0;
+static uint32_t eventsLost = 0;
+static uint32_t stalledClients = 0;
+
+static QueueHandle_t textQueue = nullptr;
+static uint16_t textSeq = 0;
+static uint32_t textsDropped = 0;
+
+// Key a client must give to be sent the WiFi credentials; empty = never.
+static Preferences linkPrefs;
+static char linkKey[CLIENT_LINK_KEY_MAX + 1];
+static unsigned long credentialsRefusedAt = 0;
+static bool credentialsRefused = false;
+
+// Client whose command processCommand() is running, for STREAM_RAW.
+static ClientLink *commandLink = nullptr;
+static uint16_t rawBatchSeq = 0;
+
+// --- Send buffers ---
+
+// Queue n bytes for the client, all or nothing.
+static bool linkQueue(ClientLink &l, const uint8_t *data, uint16_t n) {
+  if (n > TX_BUFFER_SIZE - l.txLen) {
+    l.dropped++;
+    return false;
+  }
+  uint16_t tail = (l.txHead + l.txLen) % TX_BUFFER_SIZE;
+  uint16_t first = n < TX_BUFFER_SIZE - tail ? n : TX_BUFFER_SIZE - tail;
+  memcpy(l.tx + tail, data, first);
+  memcpy(l.tx, data + first, n - first);
+  l.txLen += n;
+  return true;
+}
+
+// Push as much as the socket takes right now. Returns false if the
+// connection failed.
+static bool linkFlush(ClientLink &l) {
+  if (l.txLen == 0) {
+    l.lastProgress = millis();
+    return true;
+  }
+  int fd = l.sock.fd();
+  while (l.txLen > 0) {
+    uint16_t chunk = l.txLen < TX_BUFFER_SIZE - l.txHead ? l.txLen : TX_BUFFER_SIZE - l.txHead;
+    int sent = send(fd, l.tx + l.txHead, chunk, MSG_DONTWAIT);
+    if (sent < 0) {
+      return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+    l.txHead = (l.txHead + sent) % TX_BUFFER_SIZE;
+    l.txLen -= sent;
+    l.lastProgress = millis();
+    if (sent < chunk) break;
+  }
+  return true;
+}
+
+static void sendFrame(ClientLink &l, uint8_t type, uint16_t seq, const uint8_t *payload, uint16_t len) {
+  size_t n = linkEncodeFrame(frameBuf, type, seq, payload, len);
+  if (linkQueue(l, frameBuf, n)) framesSent++;
+}
+
+// Command replies for one client: RESPONSE frames for binary clients,
+// plain text for legacy ones. Each link also has a long-lived one with
+// seq 0 for output that is not a reply, such as a trace recording.
+class ReplyStream : public CommandReply {
+ public:
+  ReplyStream() : link(nullptr), seq(0) {}
+  ReplyStream(ClientLink &l, uint16_t seq) : link(&l), seq(seq) {}
+  void attach(ClientLink &l) { link = &l; }
+
+ protected:
+  void emit(const uint8_t *data, uint16_t n, bool last) override {
+    // A long reply (PHRASES:LIST) outgrows the send buffer; make room.
+    linkFlush(*link);
+    if (link->mode == LINK_BINARY) {
+      uint8_t p[LINK_MAX_PAYLOAD];
+      p[0] = last ? LINK_RESPONSE_LAST : 0;
+      memcpy(p + 1, data, n);
+      sendFrame(*link, LF_RESPONSE, seq, p, n + 1);
+    } else if (link->mode == LINK_LEGACY && n) {
+      linkQueue(*link, data, n);
+    }
+  }
+
+ private:
+  ClientLink *link;
+  uint16_t seq;
+};
+
+static ReplyStream linkStreams[MAX_CLIENTS];
+
+static void updateClientConnected() {
+  clientConnected = false;
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    if (links[i].mode == LINK_LEGACY || links[i].mode == LINK_BINARY) clientConnected = true;
+  }
+}
+
+static void updateRawStream() {
+  bool any = false;
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    if (links[i].mode != LINK_IDLE && links[i].rawStream) any = true;
+  }
+  rawStreamEnable(any);
+}
+
+static void runCommand(ClientLink &l, char *cmd, uint16_t seq) {
+  ReplyStream out(l, seq);
+  commandLink = &l;
+  processCommand(cmd, out, true);
+  commandLink = nullptr;
+  out.finish();
+}
+
+static void linkOpened(ClientLink &l, LinkMode mode) {
+  l.mode = mode;
+  l.rxLen = 0;
+  commandLineReset(l.line);
+  updateClientConnected();
+}
+
+static void linkClosed(ClientLink &l) {
+  Serial.println("*** CLIENT DISCONNECTED - RESETTING FLAGS ***");
+  l.sock.stop();
+  l.mode = LINK_IDLE;
+  l.rxLen = 0;
+  l.txLen = 0;
+  updateClientConnected();
+  blinkTraceDetach(linkStreams[&l - links]);
+  if (l.rawStream) {
+    l.rawStream = false;
+    updateRawStream();
+  }
+  Serial.println("*** CLIENT STOPPED AND FLAGS RESET ***");
+}
+
+// --- Legacy text protocol ---
+
+// The password field is left empty; see clientLinkSendCredentials().
+static void startLegacy(ClientLink &l) {
+  char config[160];
+  int n = snprintf(config, sizeof(config), "%d;%d;%s;;%s",
+                   blinkDuration.load(), blinkGap.load(), ssid.c_str(), userId.c_str());
+  linkQueue(l, (const uint8_t*)config, n);
+  Serial.print("Config string sent to client: ");
+  Serial.println(config);
+  linkOpened(l, LINK_LEGACY);
+  Serial.println("*** LEGACY CLIENT CONNECTED, CONFIG SENT ***");
+}
+
+static void legacyByte(ClientLink &l, char c) {
+  if (commandLineFeed(l.line, c)) runCommand(l, l.line.buf, 0);
+}
+
+// --- Binary protocol ---
+
+static void sendConfig(ClientLink &l) {
+  uint8_t p[LINK_MAX_PAYLOAD];
+  uint16_t n = 0;
+  linkPut16(p, blinkDuration);
+  linkPut16(p + 2, blinkGap);
+  n = 4;
+  const char *strs[2] = { userId.c_str(), ssid.c_str() };
+  for (const char *s : strs) {
+    uint8_t len = strnlen(s, 64);
+    p[n++] = len;
+    memcpy(p + n, s, len);
+    n += len;
+  }
+  sendFrame(l, LF_CONFIG, 0, p, n);
+}
+
+static void sendBlink(ClientLink &l, const SentEvent &e) {
+  uint8_t p[5];
+  p[0] = e.gesture;
+  linkPut32(p + 1, e.timeMs);
+  sendFrame(l, LF_BLINK, e.seq, p, sizeof(p));
+}
+
+static void handleHello(ClientLink &l, const LinkFrame &f) {
+  if (f.len < 7) return;
+  uint8_t version = f.payload[0] < LINK_VERSION ? f.payload[0] : LINK_VERSION;
+  uint32_t clientBootId = linkGet32(f.payload + 1);
+  uint16_t lastSeq = linkGet16(f.payload + 5);
+
+  // Events the client missed: resend what is still held, count the rest.
+  uint16_t lost = 0;
+  uint8_t resendFrom = historyCount;
+  if (clientBootId == bootId) {
+    uint16_t firstMissed = lastSeq + 1;
+    uint16_t oldestHeld = historyCount ? history[historyHead].seq : nextEventSeq;
+    if (linkSeqAfter(oldestHeld, firstMissed)) lost = oldestHeld - firstMissed;
+    for (resendFrom = 0; resendFrom < historyCount; resendFrom++) {
+      if (linkSeqAfter(history[(historyHead + resendFrom) % EVENT_HISTORY].seq, lastSeq)) break;
+    }
+  }
+
+  uint8_t p[9];
+  p[0] = version;
+  linkPut32(p + 1, bootId);
+  linkPut16(p + 5, nextEventSeq);
+  linkPut16(p + 7, lost);
+  sendFrame(l, LF_HELLO_ACK, f.seq, p, sizeof(p));
+  sendConfig(l);
+  for (uint8_t i = resendFrom; i < historyCount; i++) {
+    sendBlink(l, history[(historyHead + i) % EVENT_HISTORY]);
+    eventsResent++;
+  }
+  eventsLost += lost;
+  Serial.print("*** BINARY CLIENT v");
+  Serial.print(version);
+  Serial.print(" - resent ");
+  Serial.print(historyCount - resendFrom);
+  Serial.print(", lost ");
+  Serial.print(lost);
+  Serial.println(" ***");
+}
+
+static void handleFrame(ClientLink &l, const LinkFrame &f) {
+  framesReceived++;
+  switch (f.type) {
+    case LF_HELLO:
+      handleHello(l, f);
+      break;
+    case LF_ACK:
+      lastAckedSeq = f.seq;
+      break;
+    case LF_COMMAND: {
+      char cmd[LINK_MAX_PAYLOAD + 1];
+      memcpy(cmd, f.payload, f.len);
+      cmd[f.len] = '\0';
+      runCommand(l, cmd, f.seq);
+      break;
+    }
+    default:
+      break;  // unknown types are skipped so newer clients still work
+  }
+}
+
+static void binaryRead(ClientLink &l) {
+  while (l.sock.available() && l.mode == LINK_BINARY) {
+    int n = l.sock.read(l.rx + l.rxLen, sizeof(l.rx) - l.rxLen);
+    if (n <= 0) break;
+    l.rxLen += n;
+    uint16_t used = 0;
+    for (;;) {
+      LinkFrame f;
+      int r = linkDecodeFrame(l.rx + used, l.rxLen - used, f);
+      if (r < 0) {
+        Serial.println("*** BAD FRAME FROM CLIENT ***");
+        linkClosed(l);
+        return;
+      }
+      if (r == 0) break;
+      handleFrame(l, f);
+      used += r;
+    }
+    memmove(l.rx, l.rx + used, l.rxLen - used);
+    l.rxLen -= used;
+  }
+}
+
+// --- Connection handling ---
+
+static void acceptClients() {
+  for (;;) {
+    int fd = netAccept(listenFd);
+    if (fd < 0) return;
+    WiFiClient tempClient(fd);
+    ClientLink *slot = nullptr;
+    for (uint8_t i = 0; i < MAX_CLIENTS && !slot; i++) {
+      if (links[i].mode == LINK_IDLE) slot = &links[i];
+    }
+    if (!slot) {
+      Serial.println("*** CLIENT REJECTED - ALL SLOTS IN USE ***");
+      tempClient.stop();
+      continue;
+    }
+    slot->sock = tempClient;
+    slot->mode = LINK_PENDING;
+    slot->acceptedAt = millis();
+    slot->lastProgress = slot->acceptedAt;
+    slot->rxLen = 0;
+    slot->txHead = 0;
+    slot->txLen = 0;
+    slot->dropped = 0;
+    slot->rawStream = false;
+    Serial.println("*** NEW CLIENT CONNECTED - WAITING FOR HANDSHAKE ***");
+  }
+}
+
+// Binary clients identify themselves with the magic bytes; anything else
+// (or silence) is a legacy client.
+static void detectProtocol(ClientLink &l) {
+  while (l.rxLen < sizeof(LINK_MAGIC) && l.sock.available()) {
+    int c = l.sock.read();
+    if (c < 0) break;
+    if (c != LINK_MAGIC[l.rxLen]) {
+      // Not us: replay what was read as legacy input.
+      uint8_t seen[sizeof(LINK_MAGIC)];
+      uint8_t n = l.rxLen;
+      memcpy(seen, l.rx, n);
+      startLegacy(l);
+      for (uint8_t i = 0; i < n; i++) legacyByte(l, seen[i]);
+      legacyByte(l, (char)c);
+      return;
+    }
+    l.rx[l.rxLen++] = c;
+  }
+  if (l.rxLen == sizeof(LINK_MAGIC)) {
+    Serial.println("*** BINARY CLIENT HANDSHAKE ***");
+    linkOpened(l, LINK_BINARY);
+  } else if (millis() - l.acceptedAt >= HANDSHAKE_WAIT_MS) {
+    l.rxLen = 0;
+    startLegacy(l);
+  }
+}
+
+static void serviceLink(ClientLink &l) {
+  // A closed connection shows up as readable with nothing to read.
+  bool readable = netEventsReadable(l.sock.fd());
+  if (readable && !l.sock.connected()) {
+    linkClosed(l);
+    return;
+  }
+  if (l.mode == LINK_PENDING) {
+    detectProtocol(l);
+    readable = true;  // whatever followed the magic bytes is already buffered
+  }
+  if (readable && l.mode == LINK_LEGACY) {
+    while (l.sock.available()) {
+      int c = l.sock.read();
+      if (c < 0) break;
+      legacyByte(l, (char)c);
+    }
+  } else if (readable && l.mode == LINK_BINARY) {
+    binaryRead(l);
+  }
+  if (l.mode == LINK_IDLE) return;
+  if (!linkFlush(l)) {
+    linkClosed(l);
+  } else if (l.txLen > 0 && millis() - l.lastProgress > STALL_TIMEOUT_MS) {
+    Serial.println("*** CLIENT STALLED - DISCONNECTING ***");
+    stalledClients++;
+    linkClosed(l);
+  }
+}
+
+// Hand the next raw edge batch to every subscribed client: a RAW_EDGES
+// frame for binary clients, "RAW <hex>" for legacy ones.
+static void sendRawBatch() {
+  static uint8_t batch[RAW_BATCH_MAX];
+  uint16_t n = rawStreamTakeBatch(batch);
+  if (n == 0) return;
+  rawBatchSeq++;
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    ClientLink &l = links[i];
+    if (!l.rawStream) continue;
+    if (l.mode == LINK_BINARY) {
+      sendFrame(l, LF_RAW_EDGES, rawBatchSeq, batch, n);
+    } else if (l.mode == LINK_LEGACY) {
+      static const char hex[] = "0123456789ABCDEF";
+      static char line[4 + 2 * RAW_BATCH_MAX + 1];
+      uint16_t len = 4;
+      memcpy(line, "RAW ", 4);
+      for (uint16_t j = 0; j < n; j++) {
+        line[len++] = hex[batch[j] >> 4];
+        line[len++] = hex[batch[j] & 0x0F];
+      }
+      line[len++] = '\n';
+      linkQueue(l, (const uint8_t*)line, len);
+    }
+  }
+}
+
+// Hand queued phrase page messages to every binary client.
+static void sendTexts() {
+  PostedText t;
+  while (xQueueReceive(textQueue, &t, 0) == pdTRUE) {
+    uint16_t n = strlen(t.text);
+    textSeq++;
+    for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+      if (links[i].mode == LINK_BINARY) sendFrame(links[i], LF_TEXT, textSeq, (const uint8_t*)t.text, n);
+    }
+  }
+}
+
+Stream *clientLinkCommandStream() {
+  return commandLink ? &linkStreams[commandLink - links] : nullptr;
+}
+
+bool clientLinkSetRawStream(bool on) {
+  if (!commandLink) return false;
+  commandLink->rawStream = on;
+  updateRawStream();
+  return true;
+}
+
+void clientLinkBegin() {
+  listenFd = netListen(CLIENT_PORT, MAX_CLIENTS);
+  if (listenFd < 0) Serial.println("*** FAILED TO OPEN CLIENT PORT 45454 ***");
+}
+
+void clientLinkWatch() {
+  netEventsWatch(listenFd);
+  unsigned long now = millis();
+  bool raw = false;
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    const ClientLink &l = links[i];
+    if (l.mode == LINK_IDLE) continue;
+    netEventsWatch(l.sock.fd(), l.txLen > 0);
+    if (l.mode == LINK_PENDING) {
+      unsigned long waited = now - l.acceptedAt;
+      netEventsWakeWithin(waited < HANDSHAKE_WAIT_MS ? HANDSHAKE_WAIT_MS - waited : 0);
+    }
+    if (l.txLen > 0) {
+      unsigned long stalled = now - l.lastProgress;
+      netEventsWakeWithin(stalled < STALL_TIMEOUT_MS ? STALL_TIMEOUT_MS - stalled + 1 : 0);
+    }
+    raw |= l.rawStream;
+  }
+  if (raw) netEventsWakeWithin(RAW_BATCH_INTERVAL_MS);
+}
+
+void clientLinkSetup() {
+  bootId = esp_random() | 1;
+  linkPrefs.begin("clientlink", false);
+  linkPrefs.getString("key", linkKey, sizeof(linkKey));
+  textQueue = xQueueCreate(TEXT_QUEUE_LENGTH, sizeof(PostedText));
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    links[i].mode = LINK_IDLE;
+    linkStreams[i].attach(links[i]);
+  }
+}
+
+void clientLinkLoop() {
+  if (netEventsReadable(listenFd)) acceptClients();
+  sendRawBatch();
+  sendTexts();
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    if (links[i].mode == LINK_IDLE) continue;
+    linkStreams[i].sendPending();
+    serviceLink(links[i]);
+  }
+}
+
+void clientLinkOnGesture(BlinkGesture g, uint32_t timeMs) {
+  SentEvent e = { nextEventSeq++, (uint8_t)g, timeMs };
+  if (historyCount == EVENT_HISTORY) {
+    historyHead = (historyHead + 1) % EVENT_HISTORY;
+    historyCount--;
+  }
+  history[(historyHead + historyCount) % EVENT_HISTORY] = e;
+  historyCount++;
+
+  // Legacy clients only know single, double and emergency.
+  uint8_t legacy = 0;
+  if (g == GESTURE_SINGLE) legacy = '1';
+  else if (g == GESTURE_DOUBLE) legacy = '2';
+  else if (g == GESTURE_QUAD) legacy = '4';
+
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    ClientLink &l = links[i];
+    if (l.mode == LINK_BINARY) {
+      sendBlink(l, e);
+    } else if (l.mode == LINK_LEGACY && legacy) {
+      linkQueue(l, &legacy, 1);
+    } else {
+      continue;
+    }
+    // Try to get it on the wire now rather than on the next loop.
+    if (!linkFlush(l)) linkClosed(l);
+  }
+}
+
+void clientLinkPostText(const char *text) {
+  PostedText t;
+  strncpy(t.text, text, CLIENT_TEXT_MAX);
+  t.text[CLIENT_TEXT_MAX] = '\0';
+  if (!textQueue || xQueueSend(textQueue, &t, 0) != pdTRUE) {
+    textsDropped++;
+    return;
+  }
+  netEventsWake();
+}
+
+void clientLinkSetKey(const char *key, Stream &out, bool fromWifi) {
+  if (fromWifi) {
+    out.print("The link key can only be set from the serial console\n");
+    return;
+  }
+  size_t len = strlen(key);
+  if (len < CLIENT_LINK_KEY_MIN || len > CLIENT_LINK_KEY_MAX) {
+    out.print("Link key must be "); out.print(CLIENT_LINK_KEY_MIN);
+    out.print("-"); out.print(CLIENT_LINK_KEY_MAX); out.print(" characters\n");
+    return;
+  }
+  memcpy(linkKey, key, len + 1);
+  linkPrefs.putString("key", linkKey);
+  out.print("Link key set\n");
+}
+
+// Compares every byte whatever the first mismatch, so timing says
+// nothing about how much of the key was right.
+static bool linkKeyMatches(const char *key) {
+  size_t len = strlen(key);
+  size_t keyLen = strlen(linkKey);
+  uint8_t diff = len != keyLen;
+  for (size_t i = 0; i < keyLen; i++) diff |= linkKey[i] ^ (i < len ? key[i] : 0);
+  return keyLen > 0 && diff == 0;
+}
+
+void clientLinkSendCredentials(const char *key, Stream &out) {
+  if (credentialsRefused && millis() - credentialsRefusedAt < CREDENTIALS_RETRY_MS) {
+    out.print("Try again later\n");
+    return;
+  }
+  if (!linkKeyMatches(key)) {
+    credentialsRefused = true;
+    credentialsRefusedAt = millis();
+    Serial.println("*** WIFI CREDENTIALS REFUSED: WRONG LINK KEY ***");
+    out.print("Wrong link key\n");
+    return;
+  }
+  credentialsRefused = false;
+  out.print("WIFI_CREDS:"); out.print(ssid); out.print(";");
+  out.print(password); out.print("\n");
+}
+
+void clientLinkPrintStatus(Stream &out) {
+  static const char *const modeNames[] = { "idle", "handshake", "legacy", "binary" };
+  out.print("Client links:");
+  for (uint8_t i = 0; i < MAX_CLIENTS; i++) {
+    const ClientLink &l = links[i];
+    out.print(" ["); out.print(modeNames[l.mode]);
+    if (l.mode != LINK_IDLE) {
+      out.print(" "); out.print(l.txLen); out.print("B queued, ");
+      out.print(l.dropped); out.print(" dropped");
+      if (l.rawStream) out.print(", raw");
+    }
+    out.print("]");
+  }
+  out.print("\n");
+  out.print("Client frames tx/rx: "); out.print(framesSent);
+  out.print("/"); out.print(framesReceived);
+  out.print(", event seq: "); out.print(nextEventSeq);
+  out.print(", acked: "); out.print(lastAckedSeq);
+  out.print(", resent: "); out.print(eventsResent);
+  out.print(", lost: "); out.print(eventsLost);
+  out.print(", stalled: "); out.print(stalledClients);
+  out.print(", texts sent/dropped: "); out.print(textSeq);
+  out.print("/"); out.print(textsDropped);
+  out.print("\n");
+}
@@ -0,0 +1,48 @@
+#ifndef CLIENT_LINK_H
+#define CLIENT_LINK_H
+
+#include <Arduino.h>
+
+#include "../sensor/gesture.h"
+
+// PC clients on TCP 45454, up to four at once. Each one speaks the binary
+// protocol in link_protocol.h if it opens with the magic bytes, otherwise
+// the original text protocol ('1'/'2'/'4' blink bytes, config string,
+// text commands). A slow client only fills its own send buffer; it never
+// holds up the others, the sensor task or the on-device UI.
+
+void clientLinkSetup();
+// Open the listening socket once WiFi is up.
+void clientLinkBegin();
+// Network task: register sockets and timeouts with net_events, then
+// handle what is ready (accept, protocol detection, incoming
+// frames/commands, draining send buffers).
+void clientLinkWatch();
+void clientLinkLoop();
+// Forward a gesture to every client. Binary clients also get the ones sent while they
+// were away when they reconnect.
+void clientLinkOnGesture(BlinkGesture g, uint32_t timeMs);
+// Send a message chosen on the device to every binary client as a TEXT
+// frame. Legacy clients are left out: they read any '1', '2' or '4' byte
+// as a blink. Safe from any task, never blocks; texts longer than
+// CLIENT_TEXT_MAX are cut.
+static const uint8_t CLIENT_TEXT_MAX = 64;
+void clientLinkPostText(const char *text);
+// WiFi credentials go only to a client that asks with the link key
+// (WIFI_CREDS:<key>), never in the config string. The key is kept in NVS
+// and set from the serial console with LINK_KEY:<key>. It is
+// case-sensitive; keys set before it was are stored upper-cased and need
+// setting again.
+static const uint8_t CLIENT_LINK_KEY_MIN = 8;
+static const uint8_t CLIENT_LINK_KEY_MAX = 32;
+void clientLinkSetKey(const char *key, Stream &out, bool fromWifi);
+void clientLinkSendCredentials(const char *key, Stream &out);
+// Subscribe the client whose command is being processed to the raw edge
+// stream. Returns false outside of a client command (e.g. from serial).
+bool clientLinkSetRawStream(bool on);
+// Long-lived output stream for the client whose command is being
+// processed (e.g. for TRACE:ON), or nullptr outside of a client command.
+Stream *clientLinkCommandStream();
+void clientLinkPrintStatus(Stream &out);
+
+#endif // CLIENT_LINK_H
@@ -0,0 +1,278 @@
+#include "commands.h"
+
+#include "blink_wifi.h"
+#include "client_link.h"
+#include "net_events.h"
+#include "../settings/settings.h"
+#include "../gui/auto_scan.h"
+#include "../hal/heap_stats.h"
+#include "../phrases/phrases.h"
+#include "../sensor/blink_calibration.h"
+#include "../sensor/blink_trace.h"
+#include "../../include/common_variables.h"
+
+#include <Arduino.h>
+
+enum ArgKind : uint8_t {
+  ARG_NONE,    // "STATUS"
+  ARG_INT,     // "SET_MINBLINK:400", checked against min..max
+  ARG_CHOICE,  // "CALIBRATE:ON", value = index into choices ("OFF|ON")
+  ARG_TEXT,    // "TRACE_LABEL:Double", passed through
+  ARG_SECRET,  // "LINK_KEY:<key>", passed through as typed and never echoed
+};
+
+struct CommandArg {
+  int32_t value;
+  const char *text;
+};
+
+struct CommandSpec {
+  const char *name;
+  ArgKind kind;
+  const char *choices;
+  int32_t min, max;
+  const char *label;  // "Invalid <label>" for a bad value; null = unknown command
+  void (*run)(const CommandArg &arg, Stream &out, bool fromWifi);
+};
+
+// --- Handlers ---
+
+static void cmdSetMinBlink(const CommandArg &arg, Stream &out, bool) {
+  blinkDuration = arg.value;
+  saveBlinkSettingsToPreferences();
+  out.print("Min blink duration updated to: "); out.print(blinkDuration); out.print("\n");
+}
+
+static void cmdSetBlinkInterval(const CommandArg &arg, Stream &out, bool) {
+  blinkGap = arg.value;
+  saveBlinkSettingsToPreferences();
+  out.print("Blink interval updated to: "); out.print(blinkGap); out.print("\n");
+}
+
+static void cmdCalibrate(const CommandArg &arg, Stream &out, bool) {
+  calibrationSetEnabled(arg.value);
+  out.print("Auto calibration "); out.print(calibrationEnabled() ? "enabled" : "disabled"); out.print("\n");
+}
+
+static void cmdAutoScan(const CommandArg &arg, Stream &out, bool) {
+  autoScanSetEnabled(arg.value);
+  out.print("Auto scan "); out.print(autoScanEnabled() ? "enabled" : "disabled"); out.print("\n");
+}
+
+static void cmdStreamRaw(const CommandArg &arg, Stream &out, bool fromWifi) {
+  if (fromWifi && clientLinkSetRawStream(arg.value)) {
+    out.print("Raw edge stream "); out.print(arg.value ? "on" : "off"); out.print("\n");
+  } else {
+    out.print("Raw edge stream is only available to WiFi clients\n");
+  }
+}
+
+static void cmdTrace(const CommandArg &arg, Stream &out, bool fromWifi) {
+  // The trace outlives this reply, so it needs a stream that stays put.
+  Stream *target = fromWifi ? clientLinkCommandStream() : &Serial;
+  blinkTraceRecord(arg.value && target ? target : nullptr, out);
+}
+
+static void cmdTraceLabel(const CommandArg &arg, Stream &out, bool) {
+  blinkTraceLabel(arg.text, out);
+}
+
+static void cmdPhrases(const CommandArg &arg, Stream &out, bool) {
+  switch (arg.value) {
+    case 0:  phrasesLoadBegin(out); break;
+    case 1:  phrasesLoadEnd(out); break;
+    case 2:  phrasesList(out); break;
+    default: phrasesLoadDefaults(out); break;
+  }
+}
+
+static void cmdPhrase(const CommandArg &arg, Stream &out, bool) {
+  phrasesLoadAdd(arg.text, out);
+}
+
+static void cmdLinkKey(const CommandArg &arg, Stream &out, bool fromWifi) {
+  clientLinkSetKey(arg.text, out, fromWifi);
+}
+
+static void cmdWifiCreds(const CommandArg &arg, Stream &out, bool) {
+  clientLinkSendCredentials(arg.text, out);
+}
+
+static void cmdStatus(const CommandArg &, Stream &out, bool fromWifi) {
+  sendStatus(out, fromWifi);
+}
+
+static void cmdHeapMark(const CommandArg &, Stream &out, bool) {
+  heapStatsMark();
+  out.print("Heap mark set\n");
+}
+
+static const CommandSpec COMMANDS[] = {
+  { "SET_MINBLINK", ARG_INT,    nullptr,                    BLINK_DURATION_MIN, BLINK_DURATION_MAX, "min blink duration", cmdSetMinBlink },
+  { "SET_BLINKINT", ARG_INT,    nullptr,                    BLINK_GAP_MIN, BLINK_GAP_MAX, "blink interval",     cmdSetBlinkInterval },
+  { "CALIBRATE",    ARG_CHOICE, "OFF|ON",                   0, 0,       nullptr,              cmdCalibrate },
+  { "AUTOSCAN",     ARG_CHOICE, "OFF|ON",                   0, 0,       nullptr,              cmdAutoScan },
+  { "STREAM_RAW",   ARG_CHOICE, "OFF|ON",                   0, 0,       nullptr,              cmdStreamRaw },
+  { "TRACE",        ARG_CHOICE, "OFF|ON",                   0, 0,       nullptr,              cmdTrace },
+  { "TRACE_LABEL",  ARG_TEXT,   nullptr,                    0, 0,       nullptr,              cmdTraceLabel },
+  { "PHRASES",      ARG_CHOICE, "BEGIN|END|LIST|DEFAULT",   0, 0,       nullptr,              cmdPhrases },
+  { "PHRASE",       ARG_TEXT,   nullptr,                    0, 0,       nullptr,              cmdPhrase },
+  { "LINK_KEY",     ARG_SECRET,   nullptr,                    0, 0,       nullptr,              cmdLinkKey },
+  { "WIFI_CREDS",   ARG_SECRET,   nullptr,                    0, 0,       nullptr,              cmdWifiCreds },
+  { "STATUS",       ARG_NONE,   nullptr,                    0, 0,       nullptr,              cmdStatus },
+  { "HEAP_MARK",    ARG_NONE,   nullptr,                    0, 0,       nullptr,              cmdHeapMark },
+};
+
+// --- Parsing ---
+
+static char *trimInPlace(char *s) {
+  while (*s == ' ' || *s == '\t') s++;
+  char *end = s + strlen(s);
+  while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n')) end--;
+  *end = '\0';
+  return s;
+}
+
+// Index of text in a "A|B|C" list, or -1.
+static int findChoice(const char *choices, const char *text) {
+  size_t len = strlen(text);
+  for (int i = 0; *choices; i++) {
+    const char *bar = strchr(choices, '|');
+    size_t n = bar ? (size_t)(bar - choices) : strlen(choices);
+    if (n == len && strncmp(choices, text, n) == 0) return i;
+    if (!bar) break;
+    choices = bar + 1;
+  }
+  return -1;
+}
+
+static bool parseArg(const CommandSpec &spec, const char *text, CommandArg &arg) {
+  arg.value = 0;
+  arg.text = text;
+  switch (spec.kind) {
+    case ARG_NONE:
+      return text == nullptr;
+    case ARG_INT: {
+      if (!text || !*text) return false;
+      char *end;
+      long v = strtol(text, &end, 10);
+      if (*end || v < spec.min || v > spec.max) return false;
+      arg.value = v;
+      return true;
+    }
+    case ARG_CHOICE:
+      arg.value = text ? findChoice(spec.choices, text) : -1;
+      return arg.value >= 0;
+    case ARG_TEXT:
+    case ARG_SECRET:
+      return text && *text;
+  }
+  return false;
+}
+
+static void upperInPlace(char *s) {
+  for (; *s; s++) *s = toupper((unsigned char)*s);
+}
+
+// Commands and their arguments are case-insensitive, except for secrets,
+// which are compared as typed.
+void processCommand(char *line, Stream &out, bool fromWifi) {
+  char *cmd = trimInPlace(line);
+  if (!*cmd) return;
+  char *arg = strchr(cmd, ':');
+  if (arg) *arg++ = '\0';
+  upperInPlace(cmd);
+
+  const CommandSpec *found = nullptr;
+  for (const CommandSpec &spec : COMMANDS) {
+    if (strcmp(spec.name, cmd) == 0) {
+      found = &spec;
+      break;
+    }
+  }
+  bool secret = found && found->kind == ARG_SECRET;
+  if (arg && !secret) upperInPlace(arg);
+
+  Serial.print("Processing command: ");
+  Serial.print(cmd);
+  if (arg) {
+    Serial.print(":");
+    Serial.print(secret ? "<redacted>" : arg);
+  }
+  Serial.println();
+
+  CommandArg parsed;
+  if (found && parseArg(*found, arg, parsed)) {
+    found->run(parsed, out, fromWifi);
+  } else if (found && found->label) {
+    out.print("Invalid "); out.print(found->label); out.print("\n");
+  } else {
+    out.print("Unknown command\n");
+  }
+}
+
+// --- Line assembly ---
+
+void commandLineReset(CommandLine &line) {
+  line.len = 0;
+  line.overflow = false;
+}
+
+bool commandLineFeed(CommandLine &line, char c) {
+  if (c == '\n' || c == '\r') {
+    bool ready = line.len > 0 && !line.overflow;
+    if (line.overflow) Serial.println("Command too long - ignored");
+    line.buf[line.len] = '\0';
+    line.len = 0;
+    line.overflow = false;
+    return ready;
+  }
+  if (line.len < COMMAND_LINE_MAX - 1) line.buf[line.len++] = c;
+  else line.overflow = true;
+  return false;
+}
+
+// --- Replies ---
+
+size_t CommandReply::write(uint8_t c) {
+  buf[len++] = c;
+  if (len == sizeof(buf)) sendPending();
+  return 1;
+}
+
+void CommandReply::sendPending(bool last) {
+  if (len == 0 && !last) return;
+  emit(buf, len, last);
+  len = 0;
+}
+
+// --- Serial console ---
+
+class SerialReply : public CommandReply {
+ protected:
+  void emit(const uint8_t *data, uint16_t n, bool) override {
+    if (n) Serial.write(data, n);
+  }
+};
+
+static CommandLine serialLine;
+
+static void onSerialReceive() {
+  netEventsWake();
+}
+
+void commandSerialSetup() {
+  commandLineReset(serialLine);
+  Serial.onReceive(onSerialReceive);
+}
+
+void commandSerialLoop() {
+  while (Serial.available()) {
+    int c = Serial.read();
+    if (c < 0) break;
+    if (!commandLineFeed(serialLine, (char)c)) continue;
+    SerialReply reply;
+    processCommand(serialLine.buf, reply, false);
+    reply.finish();
+  }
+}
@@ -0,0 +1,58 @@
+#ifndef COMMANDS_H
+#define COMMANDS_H
+
+#include <Arduino.h>
+
+// Text commands from the PC client (either protocol) and the serial
+// console, e.g. "SET_MINBLINK:400", "CALIBRATE:ON", "STATUS".
+//
+// Nothing here touches the heap: lines are collected in fixed buffers,
+// parsed in place against a constant command table (name, argument
+// schema, range limits, handler) and replies are gathered into chunks
+// before they are written out.
+
+static const uint8_t COMMAND_LINE_MAX = 128;
+// One chunk fits one RESPONSE frame on the binary client link.
+static const uint16_t COMMAND_REPLY_CHUNK = 255;
+
+// Run one command line. The line is trimmed and upper-cased in place.
+void processCommand(char *line, Stream &out, bool fromWifi);
+
+// Assembles a line from single bytes. Returns true when a complete line
+// is in buf; lines longer than COMMAND_LINE_MAX are discarded whole.
+struct CommandLine {
+  char buf[COMMAND_LINE_MAX];
+  uint8_t len;
+  bool overflow;
+};
+void commandLineReset(CommandLine &line);
+bool commandLineFeed(CommandLine &line, char c);
+
+// Collects a reply into COMMAND_REPLY_CHUNK sized pieces and hands each
+// one to emit(), so a reply costs one write per chunk rather than one
+// per print().
+class CommandReply : public Stream {
+ public:
+  CommandReply() : len(0) {}
+  size_t write(uint8_t c) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  // Send what is buffered; `last` marks the end of the reply.
+  void sendPending(bool last = false);
+  void finish() { sendPending(true); }
+
+ protected:
+  virtual void emit(const uint8_t *data, uint16_t n, bool last) = 0;
+
+ private:
+  uint8_t buf[COMMAND_REPLY_CHUNK];
+  uint16_t len;
+};
+
+// Network task: run commands typed on the serial console.
+void commandSerialSetup();
+void commandSerialLoop();
+
+#endif // COMMANDS_H
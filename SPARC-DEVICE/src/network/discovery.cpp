@@ -0,0 +1,146 @@
+#include "discovery.h"
+
+#include "net_events.h"
+#include "../notifications/notif.h"
+#include "../../include/common_variables.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <lwip/sockets.h>
+
+static const uint16_t DISCOVERY_PORT = 45455;
+static const uint16_t CLIENT_PORT = 45454;
+static const uint16_t NOTIFY_LISTEN_PORT = 5000;
+static const unsigned long DEVICE_BEACON_INTERVAL_MS = 5000;
+static const unsigned long DISCOVER_INTERVAL_MS = 2000;
+// Servers beacon every 2 s; after this long without one, start asking.
+static const unsigned long SERVER_STALE_MS = 6000;
+
+static int udpFd = -1;
+static unsigned long lastDeviceBeacon = 0;
+static unsigned long lastDiscover = 0;
+static unsigned long lastServerBeacon = 0;
+static bool serverHeard = false;
+static uint32_t serverBeacons = 0;
+
+static char packetBuf[64];
+
+static int openSocket() {
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0) return -1;
+  int yes = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &yes, sizeof(yes));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(DISCOVERY_PORT);
+  addr.sin_addr.s_addr = INADDR_ANY;
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  return fd;
+}
+
+static void sendPacket(const char *msg) {
+  struct sockaddr_in to;
+  memset(&to, 0, sizeof(to));
+  to.sin_family = AF_INET;
+  to.sin_port = htons(DISCOVERY_PORT);
+  to.sin_addr.s_addr = (uint32_t)WiFi.broadcastIP();
+  sendto(udpFd, msg, strlen(msg), 0, (struct sockaddr*)&to, sizeof(to));
+}
+
+static void sendDeviceBeacon() {
+  snprintf(packetBuf, sizeof(packetBuf), "SPARC-DEVICE 1 %s %u %u",
+           userId.c_str(), CLIENT_PORT, NOTIFY_LISTEN_PORT);
+  sendPacket(packetBuf);
+}
+
+static void sendDiscover() {
+  sendPacket("SPARC-DISCOVER 1");
+}
+
+// Returns false once there are no more datagrams waiting.
+static bool handlePacket() {
+  struct sockaddr_in from;
+  socklen_t fromLen = sizeof(from);
+  int n = recvfrom(udpFd, packetBuf, sizeof(packetBuf) - 1, MSG_DONTWAIT,
+                   (struct sockaddr*)&from, &fromLen);
+  if (n < 0) return false;
+  packetBuf[n] = '\0';
+  unsigned int httpPort = 0;
+  if (sscanf(packetBuf, "SPARC-NOTIFY 1 %u", &httpPort) != 1 || httpPort == 0 || httpPort > 65535) return true;
+  serverBeacons++;
+  serverHeard = true;
+  lastServerBeacon = millis();
+  notificationSetServer(IPAddress(from.sin_addr.s_addr), (uint16_t)httpPort);
+  return true;
+}
+
+static bool serverStale(unsigned long now) {
+  return !serverHeard || now - lastServerBeacon >= SERVER_STALE_MS;
+}
+
+static unsigned long untilDue(unsigned long now, unsigned long last, unsigned long interval) {
+  unsigned long since = now - last;
+  return since < interval ? interval - since : 0;
+}
+
+void discoveryWatch() {
+  if (udpFd < 0) return;
+  unsigned long now = millis();
+  netEventsWatch(udpFd);
+  netEventsWakeWithin(untilDue(now, lastDeviceBeacon, DEVICE_BEACON_INTERVAL_MS));
+  if (serverStale(now)) {
+    netEventsWakeWithin(untilDue(now, lastDiscover, DISCOVER_INTERVAL_MS));
+  } else {
+    netEventsWakeWithin(untilDue(now, lastServerBeacon, SERVER_STALE_MS));
+  }
+}
+
+void discoveryLoop() {
+  if (WiFi.status() != WL_CONNECTED) {
+    if (udpFd >= 0) {
+      close(udpFd);
+      udpFd = -1;
+    }
+    return;
+  }
+  unsigned long now = millis();
+  if (udpFd < 0) {
+    udpFd = openSocket();
+    if (udpFd < 0) return;
+    Serial.println("*** DISCOVERY LISTENING ON UDP 45455 ***");
+    // Fresh network: announce and ask right away.
+    sendDeviceBeacon();
+    sendDiscover();
+    lastDeviceBeacon = now;
+    lastDiscover = now;
+  }
+
+  if (netEventsReadable(udpFd)) {
+    while (handlePacket()) {}
+  }
+
+  if (now - lastDeviceBeacon >= DEVICE_BEACON_INTERVAL_MS) {
+    sendDeviceBeacon();
+    lastDeviceBeacon = now;
+  }
+  if (serverStale(now) && now - lastDiscover >= DISCOVER_INTERVAL_MS) {
+    sendDiscover();
+    lastDiscover = now;
+  }
+}
+
+void discoveryPrintStatus(Stream &out) {
+  out.print("Discovery: ");
+  out.print(udpFd >= 0 ? "listening" : "idle");
+  out.print(", server beacons: "); out.print(serverBeacons);
+  if (serverHeard) {
+    out.print(", last "); out.print(millis() - lastServerBeacon); out.print(" ms ago");
+  }
+  out.print("\n");
+}
@@ -0,0 +1,18 @@
+#ifndef DISCOVERY_H
+#define DISCOVERY_H
+
+#include <Arduino.h>
+
+// UDP discovery shared with notif-server/discovery.py (port 45455):
+//   SPARC-NOTIFY 1 <http_port>                          server beacon
+//   SPARC-DEVICE 1 <topic> <client_port> <notify_port>  our beacon
+//   SPARC-DISCOVER 1                                    ask servers to answer now
+// Every server beacon refreshes the notification server address, so a
+// server that moved is used within one beacon interval (~2 s). While no
+// server has been heard recently we also ask with SPARC-DISCOVER.
+
+void discoveryWatch(); // network task: socket and beacon timers for net_events
+void discoveryLoop();  // network task; (re)binds the socket when WiFi comes up
+void discoveryPrintStatus(Stream &out);
+
+#endif // DISCOVERY_H
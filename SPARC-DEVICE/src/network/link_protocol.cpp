@@ -0,0 +1,21 @@
+#include "link_protocol.h"
+
+size_t linkEncodeFrame(uint8_t *out, uint8_t type, uint16_t seq, const uint8_t *payload, uint16_t len) {
+  linkPut16(out, len);
+  out[2] = type;
+  linkPut16(out + 3, seq);
+  if (len) memcpy(out + LINK_HEADER_SIZE, payload, len);
+  return LINK_HEADER_SIZE + len;
+}
+
+int linkDecodeFrame(const uint8_t *buf, size_t avail, LinkFrame &frame) {
+  if (avail < LINK_HEADER_SIZE) return 0;
+  uint16_t len = linkGet16(buf);
+  if (len > LINK_MAX_PAYLOAD) return -1;
+  if (avail < (size_t)LINK_HEADER_SIZE + len) return 0;
+  frame.len = len;
+  frame.type = buf[2];
+  frame.seq = linkGet16(buf + 3);
+  frame.payload = buf + LINK_HEADER_SIZE;
+  return LINK_HEADER_SIZE + len;
+}
@@ -0,0 +1,79 @@
+#ifndef LINK_PROTOCOL_H
+#define LINK_PROTOCOL_H
+
+#include <Arduino.h>
+
+// Binary framing for the PC client link on TCP 45454.
+//
+// A client opts in by sending the 4 magic bytes "SPRC" right after
+// connecting, followed by a HELLO frame. A client that sends anything
+// else, or nothing within 500 ms, gets the legacy text protocol.
+//
+// Legacy: the device sends "duration;gap;ssid;password;userId" unprompted,
+// with the password field always empty (it used to carry the password in
+// plain text; older apps that read it from there get ""). Either kind of
+// client can fetch the credentials with the WIFI_CREDS:<key> command; see
+// client_link.h.
+//
+// Frame: len u16 | type u8 | seq u16 | payload[len]   (little endian)
+//
+//   HELLO      client  version u8, bootId u32, lastSeq u16
+//                      (bootId/lastSeq from the previous session, 0 if none)
+//   HELLO_ACK  device  version u8, bootId u32, nextSeq u16, lost u16
+//                      events after lastSeq that are still held are sent
+//                      again; `lost` counts the ones that are not
+//   CONFIG     device  blinkDuration u16, blinkGap u16, userId s8, ssid s8
+//                      (s8 = length u8 + bytes; the password is never sent)
+//   BLINK      device  gesture u8, timeMs u32; seq = event sequence number
+//   ACK        client  seq = last BLINK seq received
+//   COMMAND    client  text command as accepted over the legacy link
+//   RESPONSE   device  flags u8 (bit 0 = last frame), text; seq = COMMAND seq
+//                      (seq 0: output not tied to a command, e.g. TRACE:ON)
+//   RAW_EDGES  device  raw IR edge batch (raw_stream.h) after STREAM_RAW:ON;
+//                      seq counts batches
+//   TEXT       device  message sent from the phrase page, text; seq counts
+//                      messages
+static const uint8_t LINK_MAGIC[4] = { 'S', 'P', 'R', 'C' };
+static const uint8_t LINK_VERSION = 1;
+static const uint8_t LINK_HEADER_SIZE = 5;
+static const uint16_t LINK_MAX_PAYLOAD = 256;
+static const uint16_t LINK_MAX_FRAME = LINK_HEADER_SIZE + LINK_MAX_PAYLOAD;
+
+enum LinkFrameType : uint8_t {
+  LF_HELLO = 0x01,
+  LF_HELLO_ACK = 0x02,
+  LF_CONFIG = 0x03,
+  LF_BLINK = 0x10,
+  LF_ACK = 0x11,
+  LF_RAW_EDGES = 0x12,
+  LF_TEXT = 0x13,
+  LF_COMMAND = 0x20,
+  LF_RESPONSE = 0x21,
+};
+
+static const uint8_t LINK_RESPONSE_LAST = 0x01;
+
+struct LinkFrame {
+  uint8_t type;
+  uint16_t seq;
+  uint16_t len;
+  const uint8_t *payload;  // points into the decode buffer
+};
+
+inline void linkPut16(uint8_t *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+inline void linkPut32(uint8_t *p, uint32_t v) { linkPut16(p, v); linkPut16(p + 2, v >> 16); }
+inline uint16_t linkGet16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+inline uint32_t linkGet32(const uint8_t *p) { return linkGet16(p) | ((uint32_t)linkGet16(p + 2) << 16); }
+
+// Write header + payload into out (at least LINK_HEADER_SIZE + len bytes).
+// Returns the frame size.
+size_t linkEncodeFrame(uint8_t *out, uint8_t type, uint16_t seq, const uint8_t *payload, uint16_t len);
+
+// Parse one frame from the front of buf. Returns the bytes it used, 0 if
+// more data is needed, -1 if the data cannot be a valid frame.
+int linkDecodeFrame(const uint8_t *buf, size_t avail, LinkFrame &frame);
+
+// True if a is later than b in 16-bit sequence space.
+inline bool linkSeqAfter(uint16_t a, uint16_t b) { return (int16_t)(a - b) > 0; }
+
+#endif // LINK_PROTOCOL_H
@@ -0,0 +1,183 @@
+#include "net_events.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <sys/select.h>
+#include <esp_vfs_eventfd.h>
+
+// Nothing in the firmware needs the network task more rarely than this;
+// it also bounds how stale a missed wakeup can make things.
+static const unsigned long MAX_WAIT_MS = 1000;
+// Without a wake fd other tasks cannot interrupt select(), so fall back
+// to the old polling interval.
+static const unsigned long FALLBACK_WAIT_MS = 10;
+
+static int wakeFd = -1;
+static fd_set readSet, writeSet;
+static fd_set readyRead, readyWrite;
+static int maxFd = -1;
+static unsigned long waitMs = MAX_WAIT_MS;
+
+static uint32_t socketWakes = 0;
+static uint32_t signalWakes = 0;
+static uint32_t timerWakes = 0;
+static uint32_t selectErrors = 0;
+// Share of time spent asleep in select(), over 10 s windows.
+static const uint32_t IDLE_WINDOW_US = 10000000UL;
+static uint32_t windowStartUs = 0;
+static uint32_t windowIdleUs = 0;
+static float idlePercent = 100.0f;
+
+static void onWiFiEvent(WiFiEvent_t) {
+  netEventsWake();
+}
+
+void netEventsSetup() {
+  esp_vfs_eventfd_config_t config = ESP_VFS_EVENTD_CONFIG_DEFAULT();
+  if (esp_vfs_eventfd_register(&config) == ESP_OK) wakeFd = eventfd(0, 0);
+  if (wakeFd < 0) Serial.println("*** NO EVENTFD - NETWORK TASK WILL POLL ***");
+  WiFi.onEvent(onWiFiEvent);
+  FD_ZERO(&readyRead);
+  FD_ZERO(&readyWrite);
+  windowStartUs = micros();
+}
+
+void netEventsWake() {
+  if (wakeFd < 0) return;
+  uint64_t one = 1;
+  write(wakeFd, &one, sizeof(one));
+}
+
+void netEventsBegin() {
+  FD_ZERO(&readSet);
+  FD_ZERO(&writeSet);
+  maxFd = -1;
+  waitMs = wakeFd >= 0 ? MAX_WAIT_MS : FALLBACK_WAIT_MS;
+  if (wakeFd >= 0) netEventsWatch(wakeFd);
+}
+
+void netEventsWatch(int fd, bool wantWrite) {
+  if (fd < 0) return;
+  FD_SET(fd, &readSet);
+  if (wantWrite) FD_SET(fd, &writeSet);
+  if (fd > maxFd) maxFd = fd;
+}
+
+void netEventsWakeWithin(unsigned long ms) {
+  if (ms < waitMs) waitMs = ms;
+}
+
+void netEventsWait() {
+  readyRead = readSet;
+  readyWrite = writeSet;
+  struct timeval tv;
+  tv.tv_sec = waitMs / 1000;
+  tv.tv_usec = (waitMs % 1000) * 1000;
+
+  uint32_t start = micros();
+  int n = select(maxFd + 1, &readyRead, &readyWrite, nullptr, &tv);
+  uint32_t now = micros();
+  windowIdleUs += now - start;
+  if (now - windowStartUs >= IDLE_WINDOW_US) {
+    idlePercent = windowIdleUs * 100.0f / (now - windowStartUs);
+    windowStartUs = now;
+    windowIdleUs = 0;
+  }
+
+  if (n < 0) {
+    // Usually a socket closed between registering and waiting; the
+    // module loops notice that on their own. Do not spin on it.
+    selectErrors++;
+    FD_ZERO(&readyRead);
+    FD_ZERO(&readyWrite);
+    vTaskDelay(1);
+    return;
+  }
+  if (n == 0) {
+    timerWakes++;
+    return;
+  }
+  if (wakeFd >= 0 && FD_ISSET(wakeFd, &readyRead)) {
+    uint64_t count;
+    read(wakeFd, &count, sizeof(count));  // resets the counter
+    signalWakes++;
+    n--;
+  }
+  if (n > 0) socketWakes++;
+}
+
+bool netEventsReadable(int fd) {
+  return fd >= 0 && FD_ISSET(fd, &readyRead);
+}
+
+bool netEventsWritable(int fd) {
+  return fd >= 0 && FD_ISSET(fd, &readyWrite);
+}
+
+int netListen(uint16_t port, int backlog) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  int yes = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = INADDR_ANY;
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, backlog) < 0) {
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  return fd;
+}
+
+int netAccept(int listenFd) {
+  if (listenFd < 0) return -1;
+  struct sockaddr_in addr;
+  socklen_t len = sizeof(addr);
+  int fd = accept(listenFd, (struct sockaddr*)&addr, &len);
+  if (fd < 0) return -1;
+  int yes = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+  return fd;
+}
+
+int netConnectStart(uint32_t ip, uint16_t port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = ip;
+  if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 && errno != EINPROGRESS) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+int netConnectResult(int fd) {
+  if (!netEventsWritable(fd)) return 1;
+  int err = 0;
+  socklen_t len = sizeof(err);
+  if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err != 0) {
+    close(fd);
+    return -1;
+  }
+  int yes = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+  return 0;
+}
+
+void netEventsPrintStatus(Stream &out) {
+  out.print("Net wakeups socket/signal/timer: "); out.print(socketWakes);
+  out.print("/"); out.print(signalWakes);
+  out.print("/"); out.print(timerWakes);
+  out.print(", select errors: "); out.print(selectErrors);
+  out.print(", idle: "); out.print(idlePercent, 1);
+  out.print("%\n");
+}
@@ -0,0 +1,44 @@
+#ifndef NET_EVENTS_H
+#define NET_EVENTS_H
+
+#include <Arduino.h>
+
+// Readiness-driven wait for the network task. Instead of polling every
+// 10 ms, the task sleeps in one select() over all of its sockets and
+// wakes when one is ready, when another task calls netEventsWake()
+// (gesture published, alert queued, WiFi state change) or when the
+// earliest module deadline (beacon, retry, timeout) is due.
+//
+// Each round: netEventsBegin(), then every module registers its sockets
+// and deadlines, then netEventsWait(), then the module loops run.
+
+void netEventsSetup();
+
+// Any task: make the network task run its loops now.
+void netEventsWake();
+
+void netEventsBegin();
+void netEventsWatch(int fd, bool wantWrite = false);
+// Wake within `ms` even if no socket becomes ready.
+void netEventsWakeWithin(unsigned long ms);
+// Sleep until something registered above happens.
+void netEventsWait();
+
+bool netEventsReadable(int fd);
+bool netEventsWritable(int fd);
+
+// Non-blocking listening TCP socket on `port`, or -1.
+int netListen(uint16_t port, int backlog);
+// Next pending connection on a netListen() socket, or -1 if none. The
+// fd can be wrapped in a WiFiClient.
+int netAccept(int listenFd);
+
+// Start a non-blocking connect to ip (network byte order). Returns the
+// fd, or -1. Watch it for writing; netConnectResult() then says how it
+// went: 1 still connecting, 0 connected, -1 failed (fd closed).
+int netConnectStart(uint32_t ip, uint16_t port);
+int netConnectResult(int fd);
+
+void netEventsPrintStatus(Stream &out);
+
+#endif // NET_EVENTS_H
@@ -1,72 +1,473 @@
 #include "notif.h"
+#include "outbox_log.h"
+#include "../network/net_events.h"
 
 #include <Arduino.h>
 #include <WiFi.h>
+#include <Preferences.h>
+#include <lwip/sockets.h>
 
 
-WiFiServer notificationServer(5000);
+static const uint16_t NOTIFY_LISTEN_PORT = 5000;
+static int listenFd = -1;
 IPAddress notificationServerIP;
 
 bool notificationServerIPCaptured = false;
 
-void notificationServerSetup() {
-  notificationServer.begin();
+// The last server address is kept so alerts left in the outbox log can
+// be delivered after a reboot before the server has connected again.
+static Preferences notifyPrefs;
+
+static uint16_t notificationPort = 8080;  // from the server's discovery beacon
+
+// Requests are posted by the UI/network tasks and sent from the network
+// task so a slow connect never stalls the caller.
+struct Notification {
+  char topic[16];
+  char type[16];
+  uint32_t seq;       // outbox log sequence number, set by the network task
+  uint32_t queuedMs;
+};
+static const UBaseType_t NOTIFICATION_QUEUE_LENGTH = 8;
+static QueueHandle_t notificationQueue = nullptr;
+// One slot only an EMERGENCY can take, drained first, so a burst of other
+// alerts can never crowd one out.
+static QueueHandle_t emergencyQueue = nullptr;
+
+// --- Outbound queue ---
+// Alerts stay here until the server has answered 2xx for them, so they
+// survive a dropped connection or a server restart; outbox_log keeps a
+// copy in flash for reboots. EMERGENCY entries go ahead of everything
+// not already on the wire.
+static const uint8_t OUTBOX_SIZE = 16;
+static const uint8_t BATCH_MAX = 8;
+
+static Notification outbox[OUTBOX_SIZE];
+static uint8_t outboxHead = 0;
+static uint8_t outboxCount = 0;
+static uint8_t inFlight = 0;  // entries at the front sent, awaiting response
+
+// --- Keep-alive connection ---
+static const uint32_t CONNECT_TIMEOUT_MS = 1000;
+static const unsigned long RESPONSE_TIMEOUT_MS = 3000;
+static const unsigned long BACKOFF_MIN_MS = 250;
+static const unsigned long BACKOFF_MAX_MS = 8000;
+
+enum ResponseState : uint8_t { RS_STATUS, RS_HEADERS, RS_BODY };
+
+static WiFiClient notifClient;
+static int connectFd = -1;  // non-blocking connect in progress
+static unsigned long connectStarted = 0;
+static bool linkUp = false;
+static unsigned long backoffMs = BACKOFF_MIN_MS;
+static unsigned long nextConnectTime = 0;
+static unsigned long requestSentTime = 0;
+
+static ResponseState responseState = RS_STATUS;
+static char lineBuf[96];
+static uint8_t lineLen = 0;
+static int responseStatus = 0;
+static uint32_t bodyRemaining = 0;
+static bool closeAfterResponse = false;
+
+static char requestBuf[1024];
+static char bodyBuf[768];
+
+// --- Stats ---
+static uint32_t deliveredCount = 0;
+static uint32_t droppedCount = 0;
+static uint32_t reconnectCount = 0;
+static uint32_t lastLatencyMs = 0;
+static uint32_t maxLatencyMs = 0;
+
+static bool isEmergency(const Notification &n) {
+  return strcmp(n.type, "EMERGENCY") == 0;
 }
 
-void notificationServerLoop() {
-    if (!notificationServerIPCaptured) {
-      WiFiClient tempClient = notificationServer.available();
-      if (tempClient) {
-        notificationServerIP = tempClient.remoteIP();
-        notificationServerIPCaptured = true;
+static Notification &outboxAt(uint8_t i) {
+  return outbox[(outboxHead + i) % OUTBOX_SIZE];
+}
+
+static void outboxRemove(uint8_t i) {
+  for (uint8_t j = i; j + 1 < outboxCount; j++) outboxAt(j) = outboxAt(j + 1);
+  outboxCount--;
+}
 
-        Serial.print("Captured notification server IP: ");
-        Serial.println(notificationServerIP);
+// Make room for one more entry. Full: sacrifice the oldest queued
+// non-emergency; never touch what is on the wire. False when everything
+// queued is an emergency, in which case the newcomer is the one dropped.
+static bool outboxMakeRoom() {
+  if (outboxCount < OUTBOX_SIZE) return true;
+  uint8_t victim = inFlight;
+  while (victim < outboxCount && isEmergency(outboxAt(victim))) victim++;
+  if (victim >= outboxCount) {
+    Serial.println("Notification outbox full of emergencies. Dropping request.");
+    droppedCount++;
+    return false;
+  }
+  Serial.print("Notification outbox full. Dropping ");
+  Serial.println(outboxAt(victim).type);
+  outboxLogAck(&outboxAt(victim).seq, 1);
+  outboxRemove(victim);
+  droppedCount++;
+  return true;
+}
 
-        tempClient.println("ESP32 received your connection.");
-        delay(100);
-        tempClient.stop();
+// Caller has made room with outboxMakeRoom().
+static void outboxAdd(const Notification &n) {
+  uint8_t pos = outboxCount;
+  if (isEmergency(n)) {
+    pos = inFlight;
+    while (pos < outboxCount && isEmergency(outboxAt(pos))) pos++;
+  }
+  for (uint8_t j = outboxCount; j > pos; j--) outboxAt(j) = outboxAt(j - 1);
+  outboxCount++;
+  outboxAt(pos) = n;
+}
+
+// Take the first n entries off the outbox (delivered or rejected) and
+// truncate them from the log.
+static void outboxRelease(uint8_t n, bool delivered) {
+  unsigned long now = millis();
+  uint32_t seqs[BATCH_MAX];
+  for (uint8_t i = 0; i < n; i++) {
+    seqs[i] = outboxAt(i).seq;
+    if (!delivered) continue;
+    lastLatencyMs = now - outboxAt(i).queuedMs;
+    if (lastLatencyMs > maxLatencyMs) maxLatencyMs = lastLatencyMs;
+  }
+  outboxLogAck(seqs, n);
+  outboxHead = (outboxHead + n) % OUTBOX_SIZE;
+  outboxCount -= n;
+  if (delivered) deliveredCount += n;
+  else droppedCount += n;
+}
 
-        Serial.println("Closed initial connection.");
-      }
+static void linkDown(const char *why) {
+  if (linkUp) {
+    Serial.print("Notification link down: ");
+    Serial.println(why);
+  }
+  notifClient.stop();
+  if (connectFd >= 0) {
+    close(connectFd);
+    connectFd = -1;
+  }
+  linkUp = false;
+  inFlight = 0;  // unacknowledged entries are resent on the next link
+  nextConnectTime = millis() + backoffMs;
+  backoffMs = min(backoffMs * 2, BACKOFF_MAX_MS);
+}
+
+// Connects without blocking the network task: the socket is watched for
+// writability and checked on the following rounds.
+static void linkConnect() {
+  if (connectFd < 0) {
+    if ((long)(millis() - nextConnectTime) < 0) return;
+    reconnectCount++;
+    connectStarted = millis();
+    connectFd = netConnectStart((uint32_t)notificationServerIP, notificationPort);
+    if (connectFd < 0) {
+      Serial.println("Failed to connect to Python server.");
+      linkDown("connect failed");
     }
+    return;
+  }
+  int result = netConnectResult(connectFd);
+  if (result > 0) {
+    if (millis() - connectStarted < CONNECT_TIMEOUT_MS) return;
+    close(connectFd);
+    result = -1;
+  }
+  if (result < 0) {
+    connectFd = -1;
+    Serial.println("Failed to connect to Python server.");
+    linkDown("connect failed");
+    return;
+  }
+  notifClient = WiFiClient(connectFd);
+  connectFd = -1;
+  linkUp = true;
+  backoffMs = BACKOFF_MIN_MS;
+  Serial.print("Notification link up to ");
+  Serial.print(notificationServerIP);
+  Serial.print(":");
+  Serial.println(notificationPort);
 }
 
+// One request for up to BATCH_MAX queued alerts. A single alert uses the
+// original query-string form; several go to /batch, one per body line.
+// id=<epoch>-<seq> lets the server drop an alert it already has when a
+// response was lost and the alert is sent again.
+static void sendBatch() {
+  uint8_t n = outboxCount < BATCH_MAX ? outboxCount : BATCH_MAX;
+  IPAddress ip = notificationServerIP;
+  uint32_t epoch = outboxLogEpoch();
+  int len;
+  if (n == 1) {
+    const Notification &a = outboxAt(0);
+    len = snprintf(requestBuf, sizeof(requestBuf),
+                   "POST /?topic=%s&type=%s&id=%08lx-%lu HTTP/1.1\r\n"
+                   "Host: %u.%u.%u.%u:%u\r\n"
+                   "Content-Length: 0\r\n\r\n",
+                   a.topic, a.type, (unsigned long)epoch, (unsigned long)a.seq,
+                   ip[0], ip[1], ip[2], ip[3], notificationPort);
+  } else {
+    int bodyLen = 0;
+    for (uint8_t i = 0; i < n; i++) {
+      const Notification &a = outboxAt(i);
+      bodyLen += snprintf(bodyBuf + bodyLen, sizeof(bodyBuf) - bodyLen,
+                          "topic=%s&type=%s&id=%08lx-%lu\n", a.topic, a.type,
+                          (unsigned long)epoch, (unsigned long)a.seq);
+    }
+    len = snprintf(requestBuf, sizeof(requestBuf),
+                   "POST /batch HTTP/1.1\r\n"
+                   "Host: %u.%u.%u.%u:%u\r\n"
+                   "Content-Type: text/plain\r\n"
+                   "Content-Length: %d\r\n\r\n%s",
+                   ip[0], ip[1], ip[2], ip[3], notificationPort, bodyLen, bodyBuf);
+  }
 
-void sendNotificationRequest(const String& userId, const String& type) {
-  if (!notificationServerIPCaptured) {
-    Serial.println("No IP captured for notification server. Cannot send POST.");
+  if (notifClient.write((const uint8_t*)requestBuf, len) != (size_t)len) {
+    linkDown("write failed");
     return;
   }
+  inFlight = n;
+  requestSentTime = millis();
+  responseState = RS_STATUS;
+  lineLen = 0;
+  responseStatus = 0;
+  bodyRemaining = 0;
+  closeAfterResponse = false;
+  Serial.print("Sent ");
+  Serial.print(n);
+  Serial.println(" notification(s)");
+}
 
-  WiFiClient client;
-  const int port = 8080;
+static void responseComplete() {
+  if (responseStatus >= 200 && responseStatus < 300) {
+    outboxRelease(inFlight, true);
+  } else if (responseStatus >= 400 && responseStatus < 500) {
+    // The server will never accept these; do not retry forever.
+    Serial.print("Notification rejected with status ");
+    Serial.println(responseStatus);
+    outboxRelease(inFlight, false);
+  }
+  inFlight = 0;
+  if (closeAfterResponse) linkDown("server closed");
+}
 
-  Serial.print("Connecting to Python server at ");
-  Serial.print(notificationServerIP);
+static void responseLine() {
+  lineBuf[lineLen] = '\0';
+  if (responseState == RS_STATUS) {
+    // "HTTP/1.1 200 OK"
+    const char *sp = strchr(lineBuf, ' ');
+    responseStatus = sp ? atoi(sp + 1) : 0;
+    responseState = RS_HEADERS;
+  } else if (lineLen == 0) {
+    responseState = RS_BODY;
+    if (bodyRemaining == 0) responseComplete();
+  } else if (strncasecmp(lineBuf, "Content-Length:", 15) == 0) {
+    bodyRemaining = strtoul(lineBuf + 15, nullptr, 10);
+  } else if (strncasecmp(lineBuf, "Connection:", 11) == 0 && strstr(lineBuf, "close")) {
+    closeAfterResponse = true;
+  }
+  lineLen = 0;
+}
+
+static void readResponse() {
+  while (inFlight && notifClient.available()) {
+    int c = notifClient.read();
+    if (c < 0) break;
+    if (responseState == RS_BODY) {
+      if (--bodyRemaining == 0) responseComplete();
+      continue;
+    }
+    if (c == '\r') continue;
+    if (c == '\n') {
+      responseLine();
+    } else if (lineLen < sizeof(lineBuf) - 1) {
+      lineBuf[lineLen++] = (char)c;
+    }
+  }
+  // Stray bytes with nothing in flight: nothing to match them to.
+  while (!inFlight && notifClient.available()) notifClient.read();
+}
+
+static void notificationTransportLoop() {
+  if (!notificationServerIPCaptured || WiFi.status() != WL_CONNECTED) {
+    if (linkUp || connectFd >= 0) linkDown("WiFi lost");
+    return;
+  }
+  if (!linkUp) {
+    linkConnect();
+    if (!linkUp) return;
+  }
+  // A closed connection shows up as readable with nothing to read.
+  if (netEventsReadable(notifClient.fd())) {
+    if (!notifClient.connected()) {
+      linkDown("closed by server");
+      return;
+    }
+    readResponse();
+  }
+  if (inFlight && millis() - requestSentTime > RESPONSE_TIMEOUT_MS) {
+    linkDown("response timeout");
+    return;
+  }
+  if (!inFlight && outboxCount > 0) sendBatch();
+}
+
+// Alerts found in the outbox log at boot.
+static void restorePending(uint32_t seq, const char *topic, const char *type) {
+  if (!outboxMakeRoom()) {
+    outboxLogAck(&seq, 1);
+    return;
+  }
+  Notification n;
+  strncpy(n.topic, topic, sizeof(n.topic) - 1);
+  n.topic[sizeof(n.topic) - 1] = '\0';
+  strncpy(n.type, type, sizeof(n.type) - 1);
+  n.type[sizeof(n.type) - 1] = '\0';
+  n.seq = seq;
+  n.queuedMs = millis();
+  outboxAdd(n);
+}
+
+void notificationSetServer(IPAddress ip, uint16_t port) {
+  if (notificationServerIPCaptured && ip == notificationServerIP && port == notificationPort) return;
+  Serial.print("Notification server now at ");
+  Serial.print(ip);
   Serial.print(":");
   Serial.println(port);
+  notificationServerIP = ip;
+  notificationPort = port;
+  notificationServerIPCaptured = true;
+  notifyPrefs.putUInt("serverIP", (uint32_t)ip);
+  notifyPrefs.putUShort("serverPort", port);
+  if (linkUp || connectFd >= 0) linkDown("server moved");
+  backoffMs = BACKOFF_MIN_MS;
+  nextConnectTime = 0;
+}
 
-  if (!client.connect(notificationServerIP, port)) {
-    Serial.println("Failed to connect to Python server.");
-    return;
+void notificationSetup() {
+  notificationQueue = xQueueCreate(NOTIFICATION_QUEUE_LENGTH, sizeof(Notification));
+  emergencyQueue = xQueueCreate(1, sizeof(Notification));
+  notifyPrefs.begin("notify", false);
+  uint32_t savedIP = notifyPrefs.getUInt("serverIP", 0);
+  if (savedIP) {
+    notificationServerIP = IPAddress(savedIP);
+    notificationPort = notifyPrefs.getUShort("serverPort", notificationPort);
+    notificationServerIPCaptured = true;
   }
+  outboxLogSetup(restorePending);
+}
 
-  String url = "/?topic=" + userId + "&type=" + type;
-  String request =
-    "POST " + url + " HTTP/1.1\r\n" +
-    "Host: " + notificationServerIP.toString() + ":" + String(port) + "\r\n" +
-    "Connection: close\r\n" +
-    "Content-Length: 0\r\n\r\n";
+void notificationServerSetup() {
+  listenFd = netListen(NOTIFY_LISTEN_PORT, 1);
+}
 
-  const char* requestCstr = request.c_str();
-  size_t requestLength = request.length();
+void notificationWatch() {
+  netEventsWatch(listenFd);
+  if (!notificationServerIPCaptured || WiFi.status() != WL_CONNECTED) return;
+  unsigned long now = millis();
+  if (connectFd >= 0) {
+    netEventsWatch(connectFd, true);
+    unsigned long waited = now - connectStarted;
+    netEventsWakeWithin(waited < CONNECT_TIMEOUT_MS ? CONNECT_TIMEOUT_MS - waited : 0);
+  } else if (!linkUp) {
+    long wait = (long)(nextConnectTime - now);
+    netEventsWakeWithin(wait > 0 ? wait : 0);
+  } else {
+    netEventsWatch(notifClient.fd());
+    if (inFlight) {
+      unsigned long waited = now - requestSentTime;
+      netEventsWakeWithin(waited <= RESPONSE_TIMEOUT_MS ? RESPONSE_TIMEOUT_MS - waited + 1 : 0);
+    }
+  }
+}
+
+void notificationServerLoop() {
+    // Servers without discovery announce themselves by connecting here.
+    int fd = netEventsReadable(listenFd) ? netAccept(listenFd) : -1;
+    if (fd >= 0) {
+      WiFiClient tempClient(fd);
+      notificationSetServer(tempClient.remoteIP(), notificationPort);
+
+      Serial.print("Captured notification server IP: ");
+      Serial.println(notificationServerIP);
+
+      // close() still delivers this; no need to hold the task for it.
+      tempClient.println("ESP32 received your connection.");
+      tempClient.stop();
+
+      Serial.println("Closed initial connection.");
+    }
+
+    notificationTransportLoop();
+}
 
-  client.write((const uint8_t*)requestCstr, requestLength);
-  Serial.println("Sent POST:");
-  Serial.println(request);
+static void queueToOutbox(QueueHandle_t queue) {
+  Notification n;
+  while (xQueueReceive(queue, &n, 0) == pdTRUE) {
+    // Only log what the outbox will hold, or the record would linger
+    // unacked until a reboot replays it.
+    if (!outboxMakeRoom()) continue;
+    n.seq = outboxLogAppend(n.topic, n.type);
+    outboxAdd(n);
+  }
+}
 
-  client.stop();
-  Serial.println("Notification POST request completed and connection closed.");
+void notificationQueueLoop() {
+  queueToOutbox(emergencyQueue);
+  queueToOutbox(notificationQueue);
 }
 
+
+void sendNotificationRequest(const char *topic, const char *type) {
+  Notification n;
+  strncpy(n.topic, topic, sizeof(n.topic) - 1);
+  n.topic[sizeof(n.topic) - 1] = '\0';
+  strncpy(n.type, type, sizeof(n.type) - 1);
+  n.type[sizeof(n.type) - 1] = '\0';
+  n.queuedMs = millis();
+  BaseType_t ok;
+  if (isEmergency(n)) {
+    // Its own slot first; the front of the shared queue if an earlier
+    // emergency still holds it.
+    ok = xQueueSend(emergencyQueue, &n, 0);
+    if (ok != pdTRUE) ok = xQueueSendToFront(notificationQueue, &n, 0);
+    if (ok != pdTRUE) {
+      // Another emergency is already waiting for the network task.
+      Serial.println("Notification queue full. EMERGENCY already pending, dropping repeat.");
+    }
+  } else {
+    ok = xQueueSend(notificationQueue, &n, 0);
+    if (ok != pdTRUE) {
+      Serial.print("Notification queue full. Dropping ");
+      Serial.print(n.type);
+      Serial.print(" for ");
+      Serial.println(n.topic);
+    }
+  }
+  if (ok != pdTRUE) {
+    droppedCount++;
+    return;
+  }
+  netEventsWake();
+}
+
+void notificationPrintStatus(Stream &out) {
+  out.print("Notify server: ");
+  if (notificationServerIPCaptured) out.print(notificationServerIP);
+  else out.print("unknown");
+  out.print(linkUp ? " (connected)\n" : " (disconnected)\n");
+  out.print("Notify queued/in flight: "); out.print(outboxCount);
+  out.print("/"); out.print(inFlight); out.print("\n");
+  out.print("Notify delivered: "); out.print(deliveredCount);
+  out.print(", dropped: "); out.print(droppedCount);
+  out.print(", connects: "); out.print(reconnectCount); out.print("\n");
+  out.print("Notify latency ms last/max: "); out.print(lastLatencyMs);
+  out.print("/"); out.print(maxLatencyMs); out.print("\n");
+  outboxLogPrintStatus(out);
+}
@@ -2,9 +2,26 @@
 #define NOTIF_H
 
 #include <Arduino.h>
+#include <IPAddress.h>
 
-void notificationServerSetup();
-void notificationServerLoop();
-void sendNotificationRequest(const String& userId, const String& type);
+// Alerts go out over one keep-alive HTTP/1.1 connection to the
+// notification server (port 8080), reopened with exponential backoff.
+// Pending alerts wait in a bounded outbox, mirrored to flash, until the
+// server answers 2xx; after an outage or a reboot they are sent in /batch
+// requests. EMERGENCY always goes to the front of the queue, and has a
+// posting slot of its own so other alerts cannot crowd it out.
+void notificationSetup();        // before any sendNotificationRequest(); replays the outbox log
+void notificationServerSetup();  // listener that learns the server IP
+void notificationWatch();        // network task: sockets and timers for net_events
+// Network task, from boot on: moves posted alerts into the outbox and its
+// flash log, so they are kept while WiFi is still coming up.
+void notificationQueueLoop();
+void notificationServerLoop();   // network task, once the servers are up: sends
+// New server address, from discovery or the port 5000 listener. Saved in
+// NVS; the link moves over right away.
+void notificationSetServer(IPAddress ip, uint16_t port);
+// Queue an alert; safe from any task, never blocks.
+void sendNotificationRequest(const char *topic, const char *type);
+void notificationPrintStatus(Stream &out);
 
 #endif // NOTIF_H
@@ -0,0 +1,218 @@
+#include "outbox_log.h"
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+static const char *LOG_PATH = "/outbox.log";
+static const char *TMP_PATH = "/outbox.tmp";
+static const size_t COMPACT_BYTES = 4096;
+// The RAM outbox holds 16; this leaves room for alerts still on their
+// way from the request queue.
+static const uint8_t MAX_PENDING = 24;
+
+enum LogRecordKind : uint8_t { LR_NEW = 'N', LR_ACK = 'A', LR_HEAD = 'H' };
+
+struct LogRecord {
+  uint8_t kind;
+  uint8_t reserved[3];
+  uint32_t seq;
+  uint32_t aux;  // HEAD: epoch
+  char topic[16];
+  char type[16];
+  uint32_t crc;  // over everything above
+};
+static_assert(sizeof(LogRecord) == 48, "log records must stay fixed-size");
+
+static bool mounted = false;
+static uint32_t nextSeq = 1;
+static uint32_t epoch = 0;
+static size_t logBytes = 0;
+
+static LogRecord pendingRecs[MAX_PENDING];
+static uint8_t pendingCount = 0;
+
+static uint32_t compactions = 0;
+static uint32_t writeErrors = 0;
+
+static uint32_t crc32(const uint8_t *data, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (len--) {
+    crc ^= *data++;
+    for (int i = 0; i < 8; i++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static void seal(LogRecord &r) {
+  r.crc = crc32((const uint8_t*)&r, offsetof(LogRecord, crc));
+}
+
+static bool valid(const LogRecord &r) {
+  return r.crc == crc32((const uint8_t*)&r, offsetof(LogRecord, crc)) &&
+         (r.kind == LR_NEW || r.kind == LR_ACK || r.kind == LR_HEAD);
+}
+
+static LogRecord makeRecord(LogRecordKind kind, uint32_t seq) {
+  LogRecord r;
+  memset(&r, 0, sizeof(r));
+  r.kind = kind;
+  r.seq = seq;
+  return r;
+}
+
+static void pendingAdd(const LogRecord &r) {
+  if (pendingCount == MAX_PENDING) {
+    // Cannot happen while the RAM outbox is smaller; keep the newest.
+    memmove(pendingRecs, pendingRecs + 1, (MAX_PENDING - 1) * sizeof(LogRecord));
+    pendingCount--;
+  }
+  pendingRecs[pendingCount++] = r;
+}
+
+static void pendingRemove(uint32_t seq) {
+  for (uint8_t i = 0; i < pendingCount; i++) {
+    if (pendingRecs[i].seq != seq) continue;
+    memmove(pendingRecs + i, pendingRecs + i + 1, (pendingCount - i - 1) * sizeof(LogRecord));
+    pendingCount--;
+    return;
+  }
+}
+
+static bool appendRecords(const LogRecord *recs, uint8_t count) {
+  if (!mounted) return false;
+  File f = LittleFS.open(LOG_PATH, FILE_APPEND);
+  size_t len = count * sizeof(LogRecord);
+  bool ok = f && f.write((const uint8_t*)recs, len) == len;
+  if (f) f.close();
+  if (!ok) {
+    writeErrors++;
+    Serial.println("Outbox log write failed");
+    return false;
+  }
+  logBytes += len;
+  return true;
+}
+
+// Rewrite the log as HEAD + pending NEW records. The rename is atomic,
+// so a power cut leaves either the old or the new file.
+static void compact() {
+  if (!mounted) return;
+  File f = LittleFS.open(TMP_PATH, FILE_WRITE);
+  if (!f) {
+    writeErrors++;
+    return;
+  }
+  LogRecord head = makeRecord(LR_HEAD, nextSeq);
+  head.aux = epoch;
+  seal(head);
+  bool ok = f.write((const uint8_t*)&head, sizeof(head)) == sizeof(head);
+  for (uint8_t i = 0; ok && i < pendingCount; i++) {
+    ok = f.write((const uint8_t*)&pendingRecs[i], sizeof(LogRecord)) == sizeof(LogRecord);
+  }
+  f.close();
+  if (!ok || !LittleFS.rename(TMP_PATH, LOG_PATH)) {
+    writeErrors++;
+    LittleFS.remove(TMP_PATH);
+    Serial.println("Outbox log compaction failed");
+    return;
+  }
+  logBytes = (pendingCount + 1) * sizeof(LogRecord);
+  compactions++;
+}
+
+// Returns false if the file ends in a torn or corrupt record.
+static bool replay() {
+  File f = LittleFS.open(LOG_PATH, FILE_READ);
+  if (!f) return false;
+  LogRecord r;
+  bool clean = true;
+  for (;;) {
+    size_t n = f.read((uint8_t*)&r, sizeof(r));
+    if (n == 0) break;
+    if (n != sizeof(r) || !valid(r)) {
+      clean = false;
+      break;
+    }
+    switch (r.kind) {
+      case LR_NEW:
+        pendingAdd(r);
+        if (r.seq >= nextSeq) nextSeq = r.seq + 1;
+        break;
+      case LR_ACK:
+        pendingRemove(r.seq);
+        break;
+      case LR_HEAD:
+        if (r.seq > nextSeq) nextSeq = r.seq;
+        epoch = r.aux;
+        break;
+    }
+  }
+  logBytes = f.size();
+  f.close();
+  return clean && epoch != 0;
+}
+
+void outboxLogSetup(void (*pending)(uint32_t seq, const char *topic, const char *type)) {
+  Serial.println("*** MOUNTING OUTBOX LOG ***");
+  mounted = LittleFS.begin(true);  // format on first boot
+  if (!mounted) {
+    Serial.println("*** ERROR: LittleFS mount failed - alerts will not survive a reboot ***");
+    epoch = esp_random() | 1;
+    return;
+  }
+  if (!replay()) {
+    if (epoch == 0) epoch = esp_random() | 1;
+    compact();
+  }
+  Serial.print("*** OUTBOX LOG: ");
+  Serial.print(pendingCount);
+  Serial.println(" pending alert(s) ***");
+  // The callback may ack what it cannot keep, which edits pendingRecs.
+  static LogRecord replayed[MAX_PENDING];
+  uint8_t count = pendingCount;
+  memcpy(replayed, pendingRecs, count * sizeof(LogRecord));
+  for (uint8_t i = 0; i < count; i++) {
+    pending(replayed[i].seq, replayed[i].topic, replayed[i].type);
+  }
+}
+
+uint32_t outboxLogAppend(const char *topic, const char *type) {
+  LogRecord r = makeRecord(LR_NEW, nextSeq++);
+  strncpy(r.topic, topic, sizeof(r.topic) - 1);
+  strncpy(r.type, type, sizeof(r.type) - 1);
+  seal(r);
+  appendRecords(&r, 1);
+  pendingAdd(r);
+  return r.seq;
+}
+
+void outboxLogAck(const uint32_t *seqs, uint8_t count) {
+  static const uint8_t ACK_CHUNK = 8;
+  LogRecord recs[ACK_CHUNK];
+  while (count > 0) {
+    uint8_t n = count < ACK_CHUNK ? count : ACK_CHUNK;
+    for (uint8_t i = 0; i < n; i++) {
+      recs[i] = makeRecord(LR_ACK, seqs[i]);
+      seal(recs[i]);
+      pendingRemove(seqs[i]);
+    }
+    appendRecords(recs, n);
+    seqs += n;
+    count -= n;
+  }
+  if (logBytes >= COMPACT_BYTES) compact();
+}
+
+uint32_t outboxLogEpoch() {
+  return epoch;
+}
+
+void outboxLogPrintStatus(Stream &out) {
+  out.print("Outbox log: ");
+  out.print(mounted ? "mounted" : "unavailable");
+  out.print(", pending: "); out.print(pendingCount);
+  out.print(", bytes: "); out.print((uint32_t)logBytes);
+  out.print(", compactions: "); out.print(compactions);
+  out.print(", write errors: "); out.print(writeErrors);
+  out.print("\n");
+}
@@ -0,0 +1,33 @@
+#ifndef OUTBOX_LOG_H
+#define OUTBOX_LOG_H
+
+#include <Arduino.h>
+
+// Durable copy of the notification outbox: an append-only LittleFS file
+// of fixed-size, CRC-checked records.
+//   NEW   seq, topic, type   an alert was queued
+//   ACK   seq                the server took it (or it was dropped)
+//   HEAD  next seq, epoch    first record after a compaction
+// At boot every NEW without a matching ACK is handed back so it is
+// delivered after a reboot or brownout. Once the file grows past 4 KB it
+// is rewritten with only the pending alerts (temp file, then rename), so
+// flash sees one small rewrite per ~40 alerts on top of the appends; a
+// torn record from a power cut is dropped by the same rewrite at boot.
+
+// Mount the file system and replay the log; `pending` is called for
+// every unacknowledged alert in the order they were queued.
+void outboxLogSetup(void (*pending)(uint32_t seq, const char *topic, const char *type));
+
+// Record a new alert. Returns its sequence number (never 0).
+uint32_t outboxLogAppend(const char *topic, const char *type);
+
+// Record that these alerts no longer need delivering.
+void outboxLogAck(const uint32_t *seqs, uint8_t count);
+
+// Random per-log value; with the sequence number it identifies an alert
+// uniquely even if the log is ever wiped and numbering restarts.
+uint32_t outboxLogEpoch();
+
+void outboxLogPrintStatus(Stream &out);
+
+#endif // OUTBOX_LOG_H
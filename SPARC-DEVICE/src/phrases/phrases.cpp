@@ -0,0 +1,363 @@
+#include "phrases.h"
+
+#include <Preferences.h>
+
+static const uint16_t USE_WEIGHT = 16;
+static const uint16_t DECAY_EVERY = 50;   // uses between halving all counts
+// A phrase used in the last RECENT_USES uses ranks RECENT_WEIGHT higher
+// for each use it is more recent than that: two uses' worth right after.
+static const uint16_t RECENT_USES = 8;
+static const uint16_t RECENT_WEIGHT = 4;
+static const unsigned long SAVE_DELAY_MS = 30000;
+
+static const char *const KIND_NAMES[PHRASE_KIND_COUNT] = {
+  "TEXT", "FOOD", "RESTROOM", "DOCTOR_CALL", "EMERGENCY"
+};
+
+struct PhraseLibrary {
+  uint8_t categoryCount;
+  uint8_t count;
+  char categories[PHRASE_CATEGORY_MAX][PHRASE_CATEGORY_NAME_MAX + 1];
+  Phrase phrases[PHRASE_MAX];
+};
+
+struct PhraseUsage {
+  uint16_t score[PHRASE_MAX];
+  uint16_t last[PHRASE_MAX];  // clock at the last use, 0 = never
+  uint16_t clock;             // counts uses
+  uint16_t sinceDecay;
+};
+
+struct DefaultPhrase {
+  const char *category;
+  PhraseKind kind;
+  const char *text;
+};
+
+// Used until a library is loaded; the first page lists them in this order.
+static const DefaultPhrase DEFAULTS[] = {
+  { "NEEDS",   PHRASE_RESTROOM,    "I NEED THE TOILET" },
+  { "NEEDS",   PHRASE_FOOD,        "I AM HUNGRY" },
+  { "NEEDS",   PHRASE_TEXT,        "I AM THIRSTY" },
+  { "NEEDS",   PHRASE_DOCTOR_CALL, "PLEASE CALL THE DOCTOR" },
+  { "NEEDS",   PHRASE_DOCTOR_CALL, "I AM IN PAIN" },
+  { "NEEDS",   PHRASE_EMERGENCY,   "I NEED HELP NOW" },
+  { "NEEDS",   PHRASE_TEXT,        "PLEASE TURN ME OVER" },
+  { "NEEDS",   PHRASE_TEXT,        "I NEED MY MEDICINE" },
+  { "COMFORT", PHRASE_TEXT,        "I AM COLD" },
+  { "COMFORT", PHRASE_TEXT,        "I AM TOO HOT" },
+  { "COMFORT", PHRASE_TEXT,        "PLEASE DIM THE LIGHTS" },
+  { "COMFORT", PHRASE_TEXT,        "PLEASE OPEN THE WINDOW" },
+  { "COMFORT", PHRASE_TEXT,        "PLEASE ADJUST MY PILLOW" },
+  { "COMFORT", PHRASE_TEXT,        "I AM UNCOMFORTABLE" },
+  { "COMFORT", PHRASE_TEXT,        "I WANT TO SLEEP" },
+  { "TALK",    PHRASE_TEXT,        "YES" },
+  { "TALK",    PHRASE_TEXT,        "NO" },
+  { "TALK",    PHRASE_TEXT,        "THANK YOU" },
+  { "TALK",    PHRASE_TEXT,        "PLEASE WAIT" },
+  { "TALK",    PHRASE_TEXT,        "I LOVE YOU" },
+  { "TALK",    PHRASE_TEXT,        "HOW ARE YOU?" },
+  { "TALK",    PHRASE_TEXT,        "PLEASE CALL MY FAMILY" },
+  { "TALK",    PHRASE_TEXT,        "I WANT TO WATCH TV" },
+};
+
+// UI task: the library in use and its usage.
+static PhraseLibrary lib;
+static PhraseUsage usage;
+static bool builtIn = true;
+static bool usageDirty = false;
+static unsigned long usageChangedAt = 0;
+static Preferences phrasePrefs;
+
+// Network task: a load in progress, or the library read back for
+// PHRASES:LIST. A load reaches the UI task through NVS.
+static PhraseLibrary staged;
+static bool loading = false;
+static Preferences loadPrefs;
+static volatile bool reloadPending = false;
+
+// --- Library ---
+
+static int findCategory(const PhraseLibrary &l, const char *name) {
+  for (uint8_t c = 0; c < l.categoryCount; c++) {
+    if (strcmp(l.categories[c], name) == 0) return c;
+  }
+  return -1;
+}
+
+// Append a phrase, adding its category if it is new. Returns why it
+// was refused, or nullptr.
+static const char *libraryAdd(PhraseLibrary &l, const char *category, uint8_t kind, const char *text) {
+  size_t len = strlen(text);
+  if (len == 0) return "Empty phrase";
+  if (len > PHRASE_TEXT_MAX) return "Phrase too long";
+  for (const char *c = text; *c; c++) {
+    if (*c < ' ' || *c > '~') return "Invalid character in phrase";
+  }
+  size_t nameLen = strlen(category);
+  if (nameLen == 0 || nameLen > PHRASE_CATEGORY_NAME_MAX) return "Invalid phrase category";
+  if (l.count == PHRASE_MAX) return "Phrase library full";
+  int c = findCategory(l, category);
+  if (c < 0) {
+    if (l.categoryCount == PHRASE_CATEGORY_MAX) return "Too many phrase categories";
+    c = l.categoryCount++;
+    strcpy(l.categories[c], category);
+  }
+  Phrase &p = l.phrases[l.count++];
+  strcpy(p.text, text);
+  p.category = c;
+  p.kind = kind;
+  return nullptr;
+}
+
+static void loadDefaults(PhraseLibrary &l) {
+  memset(&l, 0, sizeof(l));
+  for (const DefaultPhrase &d : DEFAULTS) libraryAdd(l, d.category, d.kind, d.text);
+}
+
+// A stored library is only used if it is consistent.
+static bool libraryValid(const PhraseLibrary &l) {
+  if (l.count == 0 || l.count > PHRASE_MAX || l.categoryCount > PHRASE_CATEGORY_MAX) return false;
+  for (uint8_t c = 0; c < l.categoryCount; c++) {
+    if (l.categories[c][PHRASE_CATEGORY_NAME_MAX] != '\0') return false;
+  }
+  for (uint8_t i = 0; i < l.count; i++) {
+    const Phrase &p = l.phrases[i];
+    if (p.text[PHRASE_TEXT_MAX] != '\0' || p.category >= l.categoryCount || p.kind >= PHRASE_KIND_COUNT) return false;
+  }
+  return true;
+}
+
+// The loaded library from NVS, or the built-in one. False for built-in.
+static bool readLibrary(Preferences &prefs, PhraseLibrary &l) {
+  prefs.begin("phrases", true);
+  bool stored = prefs.getBytesLength("lib") == sizeof(l) &&
+                prefs.getBytes("lib", &l, sizeof(l)) == sizeof(l) &&
+                libraryValid(l);
+  prefs.end();
+  if (!stored) loadDefaults(l);
+  return stored;
+}
+
+static void loadLibrary() {
+  builtIn = !readLibrary(phrasePrefs, lib);
+}
+
+static void saveUsage() {
+  phrasePrefs.begin("phrases", false);
+  phrasePrefs.putBytes("use", &usage, sizeof(usage));
+  phrasePrefs.end();
+  usageDirty = false;
+}
+
+static uint32_t textHash(const char *s) {
+  uint32_t h = 2166136261u;  // FNV-1a
+  while (*s) h = (h ^ (uint8_t)*s++) * 16777619u;
+  return h;
+}
+
+// Take over the library the network task stored; usage stays with the
+// phrases whose text is unchanged.
+static void reloadLibrary() {
+  uint32_t oldHash[PHRASE_MAX];
+  uint8_t oldCount = lib.count;
+  for (uint8_t i = 0; i < oldCount; i++) oldHash[i] = textHash(lib.phrases[i].text);
+  PhraseUsage old = usage;
+  loadLibrary();
+  memset(usage.score, 0, sizeof(usage.score));
+  memset(usage.last, 0, sizeof(usage.last));
+  for (uint8_t i = 0; i < lib.count; i++) {
+    uint32_t h = textHash(lib.phrases[i].text);
+    for (uint8_t j = 0; j < oldCount; j++) {
+      if (oldHash[j] != h) continue;
+      usage.score[i] = old.score[j];
+      usage.last[i] = old.last[j];
+      break;
+    }
+  }
+  saveUsage();  // indexes moved, the stored table no longer fits
+}
+
+void phrasesSetup() {
+  loadLibrary();
+  phrasePrefs.begin("phrases", true);
+  if (phrasePrefs.getBytesLength("use") == sizeof(usage)) phrasePrefs.getBytes("use", &usage, sizeof(usage));
+  phrasePrefs.end();
+}
+
+uint8_t phraseCount() {
+  return lib.count;
+}
+
+const Phrase &phraseAt(uint8_t i) {
+  return lib.phrases[i < lib.count ? i : 0];
+}
+
+uint8_t phraseCategoryCount() {
+  return lib.categoryCount;
+}
+
+const char *phraseCategoryName(uint8_t category) {
+  return category < lib.categoryCount ? lib.categories[category] : "";
+}
+
+const char *phraseNotification(const Phrase &p) {
+  return p.kind != PHRASE_TEXT && p.kind < PHRASE_KIND_COUNT ? KIND_NAMES[p.kind] : nullptr;
+}
+
+// --- Ranking ---
+
+static uint32_t rank(uint8_t i) {
+  uint32_t r = usage.score[i];
+  uint16_t age = usage.clock - usage.last[i];
+  if (usage.last[i] && age < RECENT_USES) r += (uint32_t)(RECENT_USES - age) * RECENT_WEIGHT;
+  return r;
+}
+
+uint8_t phrasesRanked(int category, uint8_t *out) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < lib.count; i++) {
+    if (category >= 0 && lib.phrases[i].category != category) continue;
+    // Insertion sort; equal ranks keep library order.
+    uint32_t r = rank(i);
+    uint8_t j = n++;
+    for (; j > 0 && rank(out[j - 1]) < r; j--) out[j] = out[j - 1];
+    out[j] = i;
+  }
+  return n;
+}
+
+void phraseUsed(uint8_t i) {
+  if (i >= lib.count) return;
+  if (++usage.clock == 0) {
+    // Wrapped: old stamps would pass for recent ones.
+    memset(usage.last, 0, sizeof(usage.last));
+    usage.clock = 1;
+  }
+  usage.score[i] += USE_WEIGHT;
+  usage.last[i] = usage.clock;
+  if (++usage.sinceDecay >= DECAY_EVERY) {
+    for (uint16_t &s : usage.score) s /= 2;
+    usage.sinceDecay = 0;
+  }
+  usageDirty = true;
+  usageChangedAt = millis();
+}
+
+bool phrasesLoop() {
+  bool replaced = reloadPending;
+  if (replaced) {
+    reloadPending = false;
+    reloadLibrary();
+  }
+  if (usageDirty && millis() - usageChangedAt >= SAVE_DELAY_MS) saveUsage();
+  return replaced;
+}
+
+// --- Bulk load ---
+
+static char *trimField(char *s) {
+  while (*s == ' ') s++;
+  char *end = s + strlen(s);
+  while (end > s && end[-1] == ' ') end--;
+  *end = '\0';
+  return s;
+}
+
+void phrasesLoadBegin(Stream &out) {
+  memset(&staged, 0, sizeof(staged));
+  loading = true;
+  out.print("Phrase load started\n");
+}
+
+void phrasesLoadAdd(const char *line, Stream &out) {
+  if (!loading) {
+    out.print("Send PHRASES:BEGIN first\n");
+    return;
+  }
+  char spec[PHRASE_CATEGORY_NAME_MAX + PHRASE_TEXT_MAX + 24];  // room for the kind and spacing
+  if (strlen(line) >= sizeof(spec)) {
+    out.print("Phrase too long\n");
+    return;
+  }
+  strcpy(spec, line);
+  char *kind = strchr(spec, '|');
+  char *text = kind ? strchr(kind + 1, '|') : nullptr;
+  if (!text) {
+    out.print("Invalid phrase, expected CATEGORY|KIND|TEXT\n");
+    return;
+  }
+  *kind++ = '\0';
+  *text++ = '\0';
+  kind = trimField(kind);
+  int k = 0;
+  while (k < PHRASE_KIND_COUNT && strcmp(KIND_NAMES[k], kind) != 0) k++;
+  if (k == PHRASE_KIND_COUNT) {
+    out.print("Invalid phrase kind\n");
+    return;
+  }
+  const char *err = libraryAdd(staged, trimField(spec), k, trimField(text));
+  if (err) {
+    out.print(err); out.print("\n");
+    return;
+  }
+  out.print("Phrase "); out.print(staged.count); out.print(" added\n");
+}
+
+void phrasesLoadEnd(Stream &out) {
+  if (!loading) {
+    out.print("Send PHRASES:BEGIN first\n");
+    return;
+  }
+  loading = false;
+  if (staged.count == 0) {
+    out.print("No phrases loaded - library unchanged\n");
+    return;
+  }
+  loadPrefs.begin("phrases", false);
+  bool saved = loadPrefs.putBytes("lib", &staged, sizeof(staged)) == sizeof(staged);
+  loadPrefs.end();
+  if (!saved) {
+    out.print("Could not save the phrase library\n");
+    return;
+  }
+  reloadPending = true;
+  out.print("Phrase library saved: "); out.print(staged.count);
+  out.print(" phrases in "); out.print(staged.categoryCount); out.print(" categories\n");
+}
+
+void phrasesLoadDefaults(Stream &out) {
+  loading = false;
+  loadPrefs.begin("phrases", false);
+  loadPrefs.remove("lib");
+  loadPrefs.end();
+  reloadPending = true;
+  out.print("Built-in phrases restored\n");
+}
+
+// Read back from NVS into the network task's own buffer: lib belongs to
+// the UI task, which may be replacing it at this very moment.
+void phrasesList(Stream &out) {
+  if (loading) {
+    out.print("Phrase load in progress, send PHRASES:END first\n");
+    return;
+  }
+  readLibrary(loadPrefs, staged);
+  for (uint8_t i = 0; i < staged.count; i++) {
+    const Phrase &p = staged.phrases[i];
+    out.print(staged.categories[p.category]); out.print("|");
+    out.print(KIND_NAMES[p.kind]); out.print("|");
+    out.print(p.text); out.print("\n");
+  }
+}
+
+void phrasesPrintStatus(Stream &out) {
+  out.print("Phrases: "); out.print(lib.count);
+  out.print(" in "); out.print(lib.categoryCount);
+  out.print(builtIn ? " categories (built-in)" : " categories (loaded)");
+  out.print(", uses: "); out.print(usage.clock);
+  if (loading) {
+    out.print(", loading: "); out.print(staged.count);
+  }
+  out.print(usageDirty ? " (unsaved)\n" : "\n");
+}
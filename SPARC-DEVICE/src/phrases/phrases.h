@@ -0,0 +1,76 @@
+#ifndef PHRASES_H
+#define PHRASES_H
+
+#include <Arduino.h>
+
+// Phrase library: whole messages the patient sends with one selection
+// from the phrase page instead of spelling them out. Every phrase has a
+// category and a kind: it either raises one of the alerts the
+// notification server knows or is a text message for the PC clients.
+//
+// The library is kept in NVS and replaced as a whole from a PC client or
+// the serial console:
+//   PHRASES:BEGIN
+//   PHRASE:NEEDS|RESTROOM|I NEED THE TOILET   (category|kind|text)
+//   PHRASE:COMFORT|TEXT|I AM COLD
+//   PHRASES:END
+// PHRASES:LIST prints the stored library in the same form, PHRASES:DEFAULT goes
+// back to the built-in set. Commands are upper-cased, so phrases are too.
+//
+// Uses are counted per phrase with decay and the last few get a recency
+// bonus on top, so the phrase page lists what the patient picks most
+// and lately first. Usage is kept in NVS and follows a phrase across a
+// reload as long as its text is unchanged.
+
+static const uint8_t PHRASE_MAX = 48;
+static const uint8_t PHRASE_CATEGORY_MAX = 8;
+static const uint8_t PHRASE_TEXT_MAX = 40;      // characters
+static const uint8_t PHRASE_CATEGORY_NAME_MAX = 12;
+
+enum PhraseKind : uint8_t {
+  PHRASE_TEXT,  // text message
+  PHRASE_FOOD,  // the rest raise the alert of the same name
+  PHRASE_RESTROOM,
+  PHRASE_DOCTOR_CALL,
+  PHRASE_EMERGENCY,  // enters emergency mode, as a quad blink does
+  PHRASE_KIND_COUNT
+};
+
+struct Phrase {
+  char text[PHRASE_TEXT_MAX + 1];
+  uint8_t category;
+  uint8_t kind;  // PhraseKind
+};
+
+void phrasesSetup();  // load the library and usage from NVS
+
+// UI task only, like everything down to phrasesLoop().
+uint8_t phraseCount();
+const Phrase &phraseAt(uint8_t i);
+uint8_t phraseCategoryCount();
+const char *phraseCategoryName(uint8_t category);
+// Notification type a phrase raises, or nullptr for a text message.
+const char *phraseNotification(const Phrase &p);
+
+// Library indexes of the phrases in category (-1 = all of them), best
+// ranked first, written to out[PHRASE_MAX]. Returns how many.
+uint8_t phrasesRanked(int category, uint8_t *out);
+
+// Phrase i was sent.
+void phraseUsed(uint8_t i);
+
+// Takes over a library loaded by the commands below and writes usage
+// back to NVS after a quiet spell. True when the library was replaced.
+bool phrasesLoop();
+
+// Network task: the PHRASES and PHRASE commands. The library in use is
+// only replaced at PHRASES:END.
+void phrasesLoadBegin(Stream &out);
+void phrasesLoadAdd(const char *spec, Stream &out);  // "CATEGORY|KIND|TEXT"
+void phrasesLoadEnd(Stream &out);
+void phrasesLoadDefaults(Stream &out);
+void phrasesList(Stream &out);
+
+void phrasesPrintStatus(Stream &out);
+
+#endif // PHRASES_H
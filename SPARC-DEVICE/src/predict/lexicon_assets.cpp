@@ -0,0 +1,1080 @@
+// Auto-generated by tools/lexicon_pack.py - do not edit
+
+#include "../../include/lexicon/lexicon_assets.h"
+
+const uint8_t lexiconTrie[13085] = {
+  0x19, 0xFF, 0x69, 0x66, 0x00, 0x00, 0x79, 0x91, 0x01, 0x00, 0x74, 0xF9, 0x01, 0x00, 0x61, 0x69,
+  0x06, 0x00, 0x6E, 0xF8, 0x09, 0x00, 0x6D, 0xBC, 0x0B, 0x00, 0x77, 0x19, 0x0E, 0x00, 0x64, 0x63,
+  0x11, 0x00, 0x70, 0xFF, 0x13, 0x00, 0x6F, 0x71, 0x16, 0x00, 0x68, 0xA2, 0x17, 0x00, 0x63, 0x4D,
+  0x1A, 0x00, 0x62, 0xA6, 0x1D, 0x00, 0x66, 0x40, 0x22, 0x00, 0x67, 0x79, 0x24, 0x00, 0x6A, 0x9E,
+  0x25, 0x00, 0x6B, 0xD9, 0x25, 0x00, 0x73, 0x41, 0x26, 0x00, 0x6C, 0xBF, 0x2B, 0x00, 0x75, 0x34,
+  0x2E, 0x00, 0x72, 0x17, 0x2F, 0x00, 0x76, 0xA8, 0x30, 0x00, 0x65, 0x3D, 0x31, 0x00, 0x71, 0xA7,
+  0x32, 0x00, 0x78, 0x06, 0x33, 0x00, 0x87, 0xFF, 0xFF, 0x13, 0x01, 0x74, 0x87, 0x00, 0x00, 0x73,
+  0xB9, 0x00, 0x00, 0x6E, 0xBE, 0x00, 0x00, 0x66, 0x41, 0x01, 0x00, 0x63, 0x46, 0x01, 0x00, 0x64,
+  0x51, 0x01, 0x00, 0x6D, 0x62, 0x01, 0x00, 0x81, 0xDE, 0xDE, 0x1E, 0x01, 0x63, 0x90, 0x00, 0x00,
+  0x01, 0xA1, 0x68, 0x96, 0x00, 0x00, 0x82, 0xA1, 0xA1, 0x1F, 0x01, 0x79, 0xA3, 0x00, 0x00, 0x69,
+  0xA8, 0x00, 0x00, 0x80, 0xA1, 0xA1, 0x21, 0x01, 0x01, 0x89, 0x6E, 0xAE, 0x00, 0x00, 0x01, 0x89,
+  0x67, 0xB4, 0x00, 0x00, 0x80, 0x89, 0x89, 0x20, 0x01, 0x80, 0xDB, 0xDB, 0x1D, 0x01, 0x83, 0xCA,
+  0xCA, 0x18, 0x01, 0x6A, 0xCF, 0x00, 0x00, 0x73, 0xF8, 0x00, 0x00, 0x74, 0x36, 0x01, 0x00, 0x01,
+  0x9E, 0x65, 0xD5, 0x00, 0x00, 0x01, 0x9E, 0x63, 0xDB, 0x00, 0x00, 0x01, 0x9E, 0x74, 0xE1, 0x00,
+  0x00, 0x01, 0x9E, 0x69, 0xE7, 0x00, 0x00, 0x01, 0x9E, 0x6F, 0xED, 0x00, 0x00, 0x01, 0x9E, 0x6E,
+  0xF3, 0x00, 0x00, 0x80, 0x9E, 0x9E, 0x19, 0x01, 0x02, 0x91, 0x69, 0x02, 0x01, 0x00, 0x75, 0x13,
+  0x01, 0x00, 0x01, 0x91, 0x64, 0x08, 0x01, 0x00, 0x01, 0x91, 0x65, 0x0E, 0x01, 0x00, 0x80, 0x91,
+  0x91, 0x1A, 0x01, 0x01, 0x89, 0x72, 0x19, 0x01, 0x00, 0x01, 0x89, 0x61, 0x1F, 0x01, 0x00, 0x01,
+  0x89, 0x6E, 0x25, 0x01, 0x00, 0x01, 0x89, 0x63, 0x2B, 0x01, 0x00, 0x01, 0x89, 0x65, 0x31, 0x01,
+  0x00, 0x80, 0x89, 0x89, 0x1B, 0x01, 0x01, 0x91, 0x6F, 0x3C, 0x01, 0x00, 0x80, 0x91, 0x91, 0x1C,
+  0x01, 0x80, 0xB5, 0xB5, 0x16, 0x01, 0x01, 0x9B, 0x65, 0x4C, 0x01, 0x00, 0x80, 0x9B, 0x9B, 0x14,
+  0x01, 0x01, 0x8E, 0x65, 0x57, 0x01, 0x00, 0x01, 0x8E, 0x61, 0x5D, 0x01, 0x00, 0x80, 0x8E, 0x8E,
+  0x15, 0x01, 0x01, 0x8B, 0x70, 0x68, 0x01, 0x00, 0x01, 0x8B, 0x6F, 0x6E, 0x01, 0x00, 0x01, 0x8B,
+  0x72, 0x74, 0x01, 0x00, 0x01, 0x8B, 0x74, 0x7A, 0x01, 0x00, 0x01, 0x8B, 0x61, 0x80, 0x01, 0x00,
+  0x01, 0x8B, 0x6E, 0x86, 0x01, 0x00, 0x01, 0x8B, 0x74, 0x8C, 0x01, 0x00, 0x80, 0x8B, 0x8B, 0x17,
+  0x01, 0x02, 0xF2, 0x6F, 0x9B, 0x01, 0x00, 0x65, 0xAF, 0x01, 0x00, 0x01, 0xF2, 0x75, 0xA1, 0x01,
+  0x00, 0x81, 0xF2, 0xF2, 0x93, 0x02, 0x72, 0xAA, 0x01, 0x00, 0x80, 0xBE, 0xBE, 0x94, 0x02, 0x03,
+  0xCE, 0x73, 0xBD, 0x01, 0x00, 0x74, 0xE9, 0x01, 0x00, 0x61, 0xEE, 0x01, 0x00, 0x81, 0xCE, 0xCE,
+  0x90, 0x02, 0x74, 0xC6, 0x01, 0x00, 0x01, 0x8E, 0x65, 0xCC, 0x01, 0x00, 0x01, 0x8E, 0x72, 0xD2,
+  0x01, 0x00, 0x01, 0x8E, 0x64, 0xD8, 0x01, 0x00, 0x01, 0x8E, 0x61, 0xDE, 0x01, 0x00, 0x01, 0x8E,
+  0x79, 0xE4, 0x01, 0x00, 0x80, 0x8E, 0x8E, 0x91, 0x02, 0x80, 0x97, 0x97, 0x92, 0x02, 0x01, 0x8F,
+  0x72, 0xF4, 0x01, 0x00, 0x80, 0x8F, 0x8F, 0x8F, 0x02, 0x08, 0xEB, 0x68, 0x1B, 0x02, 0x00, 0x6F,
+  0x55, 0x03, 0x00, 0x69, 0x4A, 0x04, 0x00, 0x61, 0xB8, 0x04, 0x00, 0x75, 0xF3, 0x04, 0x00, 0x65,
+  0x34, 0x05, 0x00, 0x76, 0x20, 0x06, 0x00, 0x72, 0x25, 0x06, 0x00, 0x06, 0xEB, 0x65, 0x35, 0x02,
+  0x00, 0x61, 0x70, 0x02, 0x00, 0x69, 0x96, 0x02, 0x00, 0x72, 0xE9, 0x02, 0x00, 0x6F, 0x15, 0x03,
+  0x00, 0x75, 0x32, 0x03, 0x00, 0x83, 0xEB, 0xEB, 0x27, 0x02, 0x72, 0x46, 0x02, 0x00, 0x79, 0x66,
+  0x02, 0x00, 0x6E, 0x6B, 0x02, 0x00, 0x02, 0xB8, 0x65, 0x50, 0x02, 0x00, 0x61, 0x55, 0x02, 0x00,
+  0x80, 0xB8, 0xB8, 0x2A, 0x02, 0x01, 0x89, 0x70, 0x5B, 0x02, 0x00, 0x01, 0x89, 0x79, 0x61, 0x02,
+  0x00, 0x80, 0x89, 0x89, 0x29, 0x02, 0x80, 0xB7, 0xB7, 0x2B, 0x02, 0x80, 0x98, 0x98, 0x28, 0x02,
+  0x02, 0xCD, 0x74, 0x7A, 0x02, 0x00, 0x6E, 0x7F, 0x02, 0x00, 0x80, 0xCD, 0xCD, 0x26, 0x02, 0x81,
+  0xAF, 0x98, 0x23, 0x02, 0x6B, 0x88, 0x02, 0x00, 0x81, 0xAF, 0xAF, 0x24, 0x02, 0x73, 0x91, 0x02,
+  0x00, 0x80, 0xAF, 0xAF, 0x25, 0x02, 0x03, 0xC3, 0x73, 0xA4, 0x02, 0x00, 0x72, 0xA9, 0x02, 0x00,
+  0x6E, 0xCC, 0x02, 0x00, 0x80, 0xC3, 0xC3, 0x32, 0x02, 0x02, 0xA8, 0x73, 0xB3, 0x02, 0x00, 0x64,
+  0xC7, 0x02, 0x00, 0x01, 0xA8, 0x74, 0xB9, 0x02, 0x00, 0x81, 0xA8, 0x89, 0x30, 0x02, 0x79, 0xC2,
+  0x02, 0x00, 0x80, 0xA8, 0xA8, 0x31, 0x02, 0x80, 0x8E, 0x8E, 0x2F, 0x02, 0x02, 0x96, 0x67, 0xD6,
+  0x02, 0x00, 0x6B, 0xE4, 0x02, 0x00, 0x81, 0x96, 0x96, 0x2C, 0x02, 0x73, 0xDF, 0x02, 0x00, 0x80,
+  0x96, 0x96, 0x2D, 0x02, 0x80, 0x91, 0x91, 0x2E, 0x02, 0x01, 0xA2, 0x6F, 0xEF, 0x02, 0x00, 0x02,
+  0xA2, 0x61, 0xF9, 0x02, 0x00, 0x75, 0x04, 0x03, 0x00, 0x01, 0xA2, 0x74, 0xFF, 0x02, 0x00, 0x80,
+  0xA2, 0xA2, 0x34, 0x02, 0x01, 0x91, 0x67, 0x0A, 0x03, 0x00, 0x01, 0x91, 0x68, 0x10, 0x03, 0x00,
+  0x80, 0x91, 0x91, 0x35, 0x02, 0x01, 0x91, 0x75, 0x1B, 0x03, 0x00, 0x01, 0x91, 0x67, 0x21, 0x03,
+  0x00, 0x01, 0x91, 0x68, 0x27, 0x03, 0x00, 0x01, 0x91, 0x74, 0x2D, 0x03, 0x00, 0x80, 0x91, 0x91,
+  0x33, 0x02, 0x01, 0x8E, 0x72, 0x38, 0x03, 0x00, 0x01, 0x8E, 0x73, 0x3E, 0x03, 0x00, 0x01, 0x8E,
+  0x64, 0x44, 0x03, 0x00, 0x01, 0x8E, 0x61, 0x4A, 0x03, 0x00, 0x01, 0x8E, 0x79, 0x50, 0x03, 0x00,
+  0x80, 0x8E, 0x8E, 0x36, 0x02, 0x89, 0xE5, 0xE5, 0x3B, 0x02, 0x6F, 0x7E, 0x03, 0x00, 0x69, 0x83,
+  0x03, 0x00, 0x64, 0x9A, 0x03, 0x00, 0x6D, 0xAB, 0x03, 0x00, 0x6E, 0xCE, 0x03, 0x00, 0x77, 0x00,
+  0x04, 0x00, 0x65, 0x17, 0x04, 0x00, 0x70, 0x22, 0x04, 0x00, 0x67, 0x27, 0x04, 0x00, 0x80, 0xB4,
+  0xB4, 0x43, 0x02, 0x01, 0xB0, 0x6C, 0x89, 0x03, 0x00, 0x01, 0xB0, 0x65, 0x8F, 0x03, 0x00, 0x01,
+  0xB0, 0x74, 0x95, 0x03, 0x00, 0x80, 0xB0, 0xB0, 0x3F, 0x02, 0x01, 0xAA, 0x61, 0xA0, 0x03, 0x00,
+  0x01, 0xAA, 0x79, 0xA6, 0x03, 0x00, 0x80, 0xAA, 0xAA, 0x3C, 0x02, 0x01, 0xAA, 0x6F, 0xB1, 0x03,
+  0x00, 0x01, 0xAA, 0x72, 0xB7, 0x03, 0x00, 0x01, 0xAA, 0x72, 0xBD, 0x03, 0x00, 0x01, 0xAA, 0x6F,
+  0xC3, 0x03, 0x00, 0x01, 0xAA, 0x77, 0xC9, 0x03, 0x00, 0x80, 0xAA, 0xAA, 0x40, 0x02, 0x02, 0xAA,
+  0x69, 0xD8, 0x03, 0x00, 0x67, 0xEF, 0x03, 0x00, 0x01, 0xAA, 0x67, 0xDE, 0x03, 0x00, 0x01, 0xAA,
+  0x68, 0xE4, 0x03, 0x00, 0x01, 0xAA, 0x74, 0xEA, 0x03, 0x00, 0x80, 0xAA, 0xAA, 0x42, 0x02, 0x01,
+  0x8D, 0x75, 0xF5, 0x03, 0x00, 0x01, 0x8D, 0x65, 0xFB, 0x03, 0x00, 0x80, 0x8D, 0x8D, 0x41, 0x02,
+  0x01, 0x91, 0x61, 0x06, 0x04, 0x00, 0x01, 0x91, 0x72, 0x0C, 0x04, 0x00, 0x01, 0x91, 0x64, 0x12,
+  0x04, 0x00, 0x80, 0x91, 0x91, 0x45, 0x02, 0x01, 0x8D, 0x73, 0x1D, 0x04, 0x00, 0x80, 0x8D, 0x8D,
+  0x3D, 0x02, 0x80, 0x8C, 0x8C, 0x44, 0x02, 0x01, 0x8B, 0x65, 0x2D, 0x04, 0x00, 0x01, 0x8B, 0x74,
+  0x33, 0x04, 0x00, 0x01, 0x8B, 0x68, 0x39, 0x04, 0x00, 0x01, 0x8B, 0x65, 0x3F, 0x04, 0x00, 0x01,
+  0x8B, 0x72, 0x45, 0x04, 0x00, 0x80, 0x8B, 0x8B, 0x3E, 0x02, 0x04, 0xB2, 0x6D, 0x5C, 0x04, 0x00,
+  0x72, 0x67, 0x04, 0x00, 0x6E, 0x78, 0x04, 0x00, 0x67, 0x9B, 0x04, 0x00, 0x01, 0xB2, 0x65, 0x62,
+  0x04, 0x00, 0x80, 0xB2, 0xB2, 0x38, 0x02, 0x01, 0xA9, 0x65, 0x6D, 0x04, 0x00, 0x01, 0xA9, 0x64,
+  0x73, 0x04, 0x00, 0x80, 0xA9, 0xA9, 0x3A, 0x02, 0x01, 0x8A, 0x67, 0x7E, 0x04, 0x00, 0x01, 0x8A,
+  0x6C, 0x84, 0x04, 0x00, 0x01, 0x8A, 0x69, 0x8A, 0x04, 0x00, 0x01, 0x8A, 0x6E, 0x90, 0x04, 0x00,
+  0x01, 0x8A, 0x67, 0x96, 0x04, 0x00, 0x80, 0x8A, 0x8A, 0x39, 0x02, 0x01, 0x88, 0x68, 0xA1, 0x04,
+  0x00, 0x01, 0x88, 0x74, 0xA7, 0x04, 0x00, 0x01, 0x88, 0x65, 0xAD, 0x04, 0x00, 0x01, 0x88, 0x6E,
+  0xB3, 0x04, 0x00, 0x80, 0x88, 0x88, 0x37, 0x02, 0x03, 0xAD, 0x6B, 0xC6, 0x04, 0x00, 0x62, 0xD1,
+  0x04, 0x00, 0x6C, 0xE8, 0x04, 0x00, 0x01, 0xAD, 0x65, 0xCC, 0x04, 0x00, 0x80, 0xAD, 0xAD, 0x17,
+  0x02, 0x01, 0x9E, 0x6C, 0xD7, 0x04, 0x00, 0x01, 0x9E, 0x65, 0xDD, 0x04, 0x00, 0x01, 0x9E, 0x74,
+  0xE3, 0x04, 0x00, 0x80, 0x9E, 0x9E, 0x16, 0x02, 0x01, 0x95, 0x6B, 0xEE, 0x04, 0x00, 0x80, 0x95,
+  0x95, 0x18, 0x02, 0x03, 0xAD, 0x72, 0x01, 0x05, 0x00, 0x62, 0x0C, 0x05, 0x00, 0x65, 0x17, 0x05,
+  0x00, 0x01, 0xAD, 0x6E, 0x07, 0x05, 0x00, 0x80, 0xAD, 0xAD, 0x4C, 0x02, 0x01, 0x9E, 0x65, 0x12,
+  0x05, 0x00, 0x80, 0x9E, 0x9E, 0x4A, 0x02, 0x01, 0x8E, 0x73, 0x1D, 0x05, 0x00, 0x01, 0x8E, 0x64,
+  0x23, 0x05, 0x00, 0x01, 0x8E, 0x61, 0x29, 0x05, 0x00, 0x01, 0x8E, 0x79, 0x2F, 0x05, 0x00, 0x80,
+  0x8E, 0x8E, 0x4B, 0x02, 0x07, 0xAC, 0x6C, 0x52, 0x05, 0x00, 0x6D, 0x8A, 0x05, 0x00, 0x61, 0xBF,
+  0x05, 0x00, 0x65, 0xCD, 0x05, 0x00, 0x72, 0xDE, 0x05, 0x00, 0x73, 0x01, 0x06, 0x00, 0x78, 0x15,
+  0x06, 0x00, 0x02, 0xAC, 0x6C, 0x5C, 0x05, 0x00, 0x65, 0x61, 0x05, 0x00, 0x80, 0xAC, 0xAC, 0x1D,
+  0x02, 0x01, 0xA0, 0x76, 0x67, 0x05, 0x00, 0x01, 0xA0, 0x69, 0x6D, 0x05, 0x00, 0x01, 0xA0, 0x73,
+  0x73, 0x05, 0x00, 0x01, 0xA0, 0x69, 0x79, 0x05, 0x00, 0x01, 0xA0, 0x6F, 0x7F, 0x05, 0x00, 0x01,
+  0xA0, 0x6E, 0x85, 0x05, 0x00, 0x80, 0xA0, 0xA0, 0x1C, 0x02, 0x01, 0x9D, 0x70, 0x90, 0x05, 0x00,
+  0x01, 0x9D, 0x65, 0x96, 0x05, 0x00, 0x01, 0x9D, 0x72, 0x9C, 0x05, 0x00, 0x01, 0x9D, 0x61, 0xA2,
+  0x05, 0x00, 0x01, 0x9D, 0x74, 0xA8, 0x05, 0x00, 0x01, 0x9D, 0x75, 0xAE, 0x05, 0x00, 0x01, 0x9D,
+  0x72, 0xB4, 0x05, 0x00, 0x01, 0x9D, 0x65, 0xBA, 0x05, 0x00, 0x80, 0x9D, 0x9D, 0x1E, 0x02, 0x81,
+  0x9C, 0x9C, 0x19, 0x02, 0x6D, 0xC8, 0x05, 0x00, 0x80, 0x8E, 0x8E, 0x1A, 0x02, 0x01, 0x8D, 0x74,
+  0xD3, 0x05, 0x00, 0x01, 0x8D, 0x68, 0xD9, 0x05, 0x00, 0x80, 0x8D, 0x8D, 0x1B, 0x02, 0x01, 0x8B,
+  0x72, 0xE4, 0x05, 0x00, 0x01, 0x8B, 0x69, 0xEA, 0x05, 0x00, 0x01, 0x8B, 0x62, 0xF0, 0x05, 0x00,
+  0x01, 0x8B, 0x6C, 0xF6, 0x05, 0x00, 0x01, 0x8B, 0x65, 0xFC, 0x05, 0x00, 0x80, 0x8B, 0x8B, 0x1F,
+  0x02, 0x01, 0x89, 0x74, 0x07, 0x06, 0x00, 0x81, 0x89, 0x89, 0x20, 0x02, 0x73, 0x10, 0x06, 0x00,
+  0x80, 0x89, 0x89, 0x21, 0x02, 0x01, 0x87, 0x74, 0x1B, 0x06, 0x00, 0x80, 0x87, 0x87, 0x22, 0x02,
+  0x80, 0xA0, 0xA0, 0x4D, 0x02, 0x03, 0x91, 0x79, 0x33, 0x06, 0x00, 0x69, 0x4D, 0x06, 0x00, 0x75,
+  0x5E, 0x06, 0x00, 0x81, 0x91, 0x91, 0x48, 0x02, 0x69, 0x3C, 0x06, 0x00, 0x01, 0x90, 0x6E, 0x42,
+  0x06, 0x00, 0x01, 0x90, 0x67, 0x48, 0x06, 0x00, 0x80, 0x90, 0x90, 0x49, 0x02, 0x01, 0x90, 0x65,
+  0x53, 0x06, 0x00, 0x01, 0x90, 0x64, 0x59, 0x06, 0x00, 0x80, 0x90, 0x90, 0x46, 0x02, 0x01, 0x8B,
+  0x65, 0x64, 0x06, 0x00, 0x80, 0x8B, 0x8B, 0x47, 0x02, 0x8E, 0xE1, 0xE1, 0x00, 0x00, 0x6E, 0xA6,
+  0x06, 0x00, 0x6D, 0x41, 0x07, 0x00, 0x72, 0x7C, 0x07, 0x00, 0x6C, 0xAB, 0x07, 0x00, 0x74, 0x34,
+  0x08, 0x00, 0x66, 0x39, 0x08, 0x00, 0x69, 0x86, 0x08, 0x00, 0x70, 0x91, 0x08, 0x00, 0x67, 0xFC,
+  0x08, 0x00, 0x73, 0x22, 0x09, 0x00, 0x62, 0x48, 0x09, 0x00, 0x63, 0x6E, 0x09, 0x00, 0x77, 0xAF,
+  0x09, 0x00, 0x64, 0xDB, 0x09, 0x00, 0x05, 0xD9, 0x64, 0xBC, 0x06, 0x00, 0x67, 0xC1, 0x06, 0x00,
+  0x6F, 0xD2, 0x06, 0x00, 0x79, 0xEF, 0x06, 0x00, 0x73, 0x2A, 0x07, 0x00, 0x80, 0xD9, 0xD9, 0x17,
+  0x00, 0x01, 0xA4, 0x72, 0xC7, 0x06, 0x00, 0x01, 0xA4, 0x79, 0xCD, 0x06, 0x00, 0x80, 0xA4, 0xA4,
+  0x18, 0x00, 0x01, 0x9A, 0x74, 0xD8, 0x06, 0x00, 0x01, 0x9A, 0x68, 0xDE, 0x06, 0x00, 0x01, 0x9A,
+  0x65, 0xE4, 0x06, 0x00, 0x01, 0x9A, 0x72, 0xEA, 0x06, 0x00, 0x80, 0x9A, 0x9A, 0x19, 0x00, 0x82,
+  0x97, 0x93, 0x1B, 0x00, 0x6F, 0xFC, 0x06, 0x00, 0x74, 0x0D, 0x07, 0x00, 0x01, 0x97, 0x6E, 0x02,
+  0x07, 0x00, 0x01, 0x97, 0x65, 0x08, 0x07, 0x00, 0x80, 0x97, 0x97, 0x1C, 0x00, 0x01, 0x97, 0x68,
+  0x13, 0x07, 0x00, 0x01, 0x97, 0x69, 0x19, 0x07, 0x00, 0x01, 0x97, 0x6E, 0x1F, 0x07, 0x00, 0x01,
+  0x97, 0x67, 0x25, 0x07, 0x00, 0x80, 0x97, 0x97, 0x1D, 0x00, 0x01, 0x94, 0x77, 0x30, 0x07, 0x00,
+  0x01, 0x94, 0x65, 0x36, 0x07, 0x00, 0x01, 0x94, 0x72, 0x3C, 0x07, 0x00, 0x80, 0x94, 0x94, 0x1A,
+  0x00, 0x82, 0xC5, 0xC5, 0x14, 0x00, 0x6F, 0x4E, 0x07, 0x00, 0x61, 0x5F, 0x07, 0x00, 0x01, 0x92,
+  0x6E, 0x54, 0x07, 0x00, 0x01, 0x92, 0x67, 0x5A, 0x07, 0x00, 0x80, 0x92, 0x92, 0x16, 0x00, 0x01,
+  0x8B, 0x7A, 0x65, 0x07, 0x00, 0x01, 0x8B, 0x69, 0x6B, 0x07, 0x00, 0x01, 0x8B, 0x6E, 0x71, 0x07,
+  0x00, 0x01, 0x8B, 0x67, 0x77, 0x07, 0x00, 0x80, 0x8B, 0x8B, 0x15, 0x00, 0x03, 0xC4, 0x65, 0x8A,
+  0x07, 0x00, 0x6D, 0x8F, 0x07, 0x00, 0x6F, 0x94, 0x07, 0x00, 0x80, 0xC4, 0xC4, 0x21, 0x00, 0x80,
+  0xA3, 0xA3, 0x22, 0x00, 0x01, 0x92, 0x75, 0x9A, 0x07, 0x00, 0x01, 0x92, 0x6E, 0xA0, 0x07, 0x00,
+  0x01, 0x92, 0x64, 0xA6, 0x07, 0x00, 0x80, 0x92, 0x92, 0x23, 0x00, 0x06, 0xBB, 0x6C, 0xC5, 0x07,
+  0x00, 0x73, 0xCA, 0x07, 0x00, 0x77, 0xD5, 0x07, 0x00, 0x72, 0xEC, 0x07, 0x00, 0x6F, 0x09, 0x08,
+  0x00, 0x69, 0x23, 0x08, 0x00, 0x80, 0xBB, 0xBB, 0x0E, 0x00, 0x01, 0x98, 0x6F, 0xD0, 0x07, 0x00,
+  0x80, 0x98, 0x98, 0x12, 0x00, 0x01, 0x98, 0x61, 0xDB, 0x07, 0x00, 0x01, 0x98, 0x79, 0xE1, 0x07,
+  0x00, 0x01, 0x98, 0x73, 0xE7, 0x07, 0x00, 0x80, 0x98, 0x98, 0x13, 0x00, 0x01, 0x97, 0x65, 0xF2,
+  0x07, 0x00, 0x01, 0x97, 0x61, 0xF8, 0x07, 0x00, 0x01, 0x97, 0x64, 0xFE, 0x07, 0x00, 0x01, 0x97,
+  0x79, 0x04, 0x08, 0x00, 0x80, 0x97, 0x97, 0x11, 0x00, 0x01, 0x92, 0x6E, 0x0F, 0x08, 0x00, 0x02,
+  0x92, 0x67, 0x19, 0x08, 0x00, 0x65, 0x1E, 0x08, 0x00, 0x80, 0x92, 0x92, 0x10, 0x00, 0x80, 0x8B,
+  0x8B, 0x0F, 0x00, 0x01, 0x8D, 0x76, 0x29, 0x08, 0x00, 0x01, 0x8D, 0x65, 0x2F, 0x08, 0x00, 0x80,
+  0x8D, 0x8D, 0x0D, 0x00, 0x80, 0xB9, 0xB9, 0x26, 0x00, 0x02, 0xA4, 0x72, 0x43, 0x08, 0x00, 0x74,
+  0x5A, 0x08, 0x00, 0x01, 0xA4, 0x61, 0x49, 0x08, 0x00, 0x01, 0xA4, 0x69, 0x4F, 0x08, 0x00, 0x01,
+  0xA4, 0x64, 0x55, 0x08, 0x00, 0x80, 0xA4, 0xA4, 0x07, 0x00, 0x01, 0x99, 0x65, 0x60, 0x08, 0x00,
+  0x01, 0x99, 0x72, 0x66, 0x08, 0x00, 0x81, 0x99, 0x99, 0x08, 0x00, 0x6E, 0x6F, 0x08, 0x00, 0x01,
+  0x8F, 0x6F, 0x75, 0x08, 0x00, 0x01, 0x8F, 0x6F, 0x7B, 0x08, 0x00, 0x01, 0x8F, 0x6E, 0x81, 0x08,
+  0x00, 0x80, 0x8F, 0x8F, 0x09, 0x00, 0x01, 0xA1, 0x72, 0x8C, 0x08, 0x00, 0x80, 0xA1, 0xA1, 0x0C,
+  0x00, 0x01, 0x9B, 0x70, 0x97, 0x08, 0x00, 0x03, 0x9B, 0x6C, 0xA5, 0x08, 0x00, 0x65, 0xB0, 0x08,
+  0x00, 0x6F, 0xCD, 0x08, 0x00, 0x01, 0x9B, 0x65, 0xAB, 0x08, 0x00, 0x80, 0x9B, 0x9B, 0x1F, 0x00,
+  0x01, 0x89, 0x74, 0xB6, 0x08, 0x00, 0x01, 0x89, 0x69, 0xBC, 0x08, 0x00, 0x01, 0x89, 0x74, 0xC2,
+  0x08, 0x00, 0x01, 0x89, 0x65, 0xC8, 0x08, 0x00, 0x80, 0x89, 0x89, 0x1E, 0x00, 0x01, 0x89, 0x69,
+  0xD3, 0x08, 0x00, 0x01, 0x89, 0x6E, 0xD9, 0x08, 0x00, 0x01, 0x89, 0x74, 0xDF, 0x08, 0x00, 0x01,
+  0x89, 0x6D, 0xE5, 0x08, 0x00, 0x01, 0x89, 0x65, 0xEB, 0x08, 0x00, 0x01, 0x89, 0x6E, 0xF1, 0x08,
+  0x00, 0x01, 0x89, 0x74, 0xF7, 0x08, 0x00, 0x80, 0x89, 0x89, 0x20, 0x00, 0x01, 0x9A, 0x61, 0x02,
+  0x09, 0x00, 0x01, 0x9A, 0x69, 0x08, 0x09, 0x00, 0x01, 0x9A, 0x6E, 0x0E, 0x09, 0x00, 0x81, 0x9A,
+  0x9A, 0x0A, 0x00, 0x73, 0x17, 0x09, 0x00, 0x01, 0x92, 0x74, 0x1D, 0x09, 0x00, 0x80, 0x92, 0x92,
+  0x0B, 0x00, 0x02, 0x94, 0x6B, 0x2C, 0x09, 0x00, 0x6C, 0x31, 0x09, 0x00, 0x80, 0x94, 0x94, 0x24,
+  0x00, 0x01, 0x89, 0x65, 0x37, 0x09, 0x00, 0x01, 0x89, 0x65, 0x3D, 0x09, 0x00, 0x01, 0x89, 0x70,
+  0x43, 0x09, 0x00, 0x80, 0x89, 0x89, 0x25, 0x00, 0x01, 0x92, 0x6F, 0x4E, 0x09, 0x00, 0x02, 0x92,
+  0x75, 0x58, 0x09, 0x00, 0x76, 0x63, 0x09, 0x00, 0x01, 0x92, 0x74, 0x5E, 0x09, 0x00, 0x80, 0x92,
+  0x92, 0x01, 0x00, 0x01, 0x92, 0x65, 0x69, 0x09, 0x00, 0x80, 0x92, 0x92, 0x02, 0x00, 0x02, 0x92,
+  0x72, 0x78, 0x09, 0x00, 0x68, 0x8F, 0x09, 0x00, 0x01, 0x92, 0x6F, 0x7E, 0x09, 0x00, 0x01, 0x92,
+  0x73, 0x84, 0x09, 0x00, 0x01, 0x92, 0x73, 0x8A, 0x09, 0x00, 0x80, 0x92, 0x92, 0x05, 0x00, 0x02,
+  0x8A, 0x65, 0x99, 0x09, 0x00, 0x69, 0x9E, 0x09, 0x00, 0x80, 0x8A, 0x8A, 0x03, 0x00, 0x01, 0x8A,
+  0x6E, 0xA4, 0x09, 0x00, 0x01, 0x8A, 0x67, 0xAA, 0x09, 0x00, 0x80, 0x8A, 0x8A, 0x04, 0x00, 0x02,
+  0x8B, 0x66, 0xB9, 0x09, 0x00, 0x61, 0xCA, 0x09, 0x00, 0x01, 0x8B, 0x75, 0xBF, 0x09, 0x00, 0x01,
+  0x8B, 0x6C, 0xC5, 0x09, 0x00, 0x80, 0x8B, 0x8B, 0x28, 0x00, 0x01, 0x89, 0x6B, 0xD0, 0x09, 0x00,
+  0x01, 0x89, 0x65, 0xD6, 0x09, 0x00, 0x80, 0x89, 0x89, 0x27, 0x00, 0x01, 0x88, 0x6A, 0xE1, 0x09,
+  0x00, 0x01, 0x88, 0x75, 0xE7, 0x09, 0x00, 0x01, 0x88, 0x73, 0xED, 0x09, 0x00, 0x01, 0x88, 0x74,
+  0xF3, 0x09, 0x00, 0x80, 0x88, 0x88, 0x06, 0x00, 0x05, 0xD6, 0x6F, 0x0E, 0x0A, 0x00, 0x65, 0x6A,
+  0x0A, 0x00, 0x75, 0x11, 0x0B, 0x00, 0x69, 0x4F, 0x0B, 0x00, 0x61, 0x90, 0x0B, 0x00, 0x84, 0xD6,
+  0xD0, 0x81, 0x01, 0x74, 0x23, 0x0A, 0x00, 0x77, 0x43, 0x0A, 0x00, 0x73, 0x48, 0x0A, 0x00, 0x62,
+  0x53, 0x0A, 0x00, 0x81, 0xD6, 0xD6, 0x84, 0x01, 0x68, 0x2C, 0x0A, 0x00, 0x01, 0x97, 0x69, 0x32,
+  0x0A, 0x00, 0x01, 0x97, 0x6E, 0x38, 0x0A, 0x00, 0x01, 0x97, 0x67, 0x3E, 0x0A, 0x00, 0x80, 0x97,
+  0x97, 0x85, 0x01, 0x80, 0xBD, 0xBD, 0x86, 0x01, 0x01, 0xA1, 0x65, 0x4E, 0x0A, 0x00, 0x80, 0xA1,
+  0xA1, 0x83, 0x01, 0x01, 0x97, 0x6F, 0x59, 0x0A, 0x00, 0x01, 0x97, 0x64, 0x5F, 0x0A, 0x00, 0x01,
+  0x97, 0x79, 0x65, 0x0A, 0x00, 0x80, 0x97, 0x97, 0x82, 0x01, 0x07, 0xC2, 0x65, 0x88, 0x0A, 0x00,
+  0x63, 0x93, 0x0A, 0x00, 0x77, 0x9E, 0x0A, 0x00, 0x76, 0xCD, 0x0A, 0x00, 0x69, 0xDE, 0x0A, 0x00,
+  0x61, 0xFB, 0x0A, 0x00, 0x78, 0x06, 0x0B, 0x00, 0x01, 0xC2, 0x64, 0x8E, 0x0A, 0x00, 0x80, 0xC2,
+  0xC2, 0x77, 0x01, 0x01, 0xA3, 0x6B, 0x99, 0x0A, 0x00, 0x80, 0xA3, 0xA3, 0x76, 0x01, 0x81, 0x9A,
+  0x9A, 0x7A, 0x01, 0x73, 0xA7, 0x0A, 0x00, 0x81, 0x8E, 0x8E, 0x7B, 0x01, 0x70, 0xB0, 0x0A, 0x00,
+  0x01, 0x87, 0x61, 0xB6, 0x0A, 0x00, 0x01, 0x87, 0x70, 0xBC, 0x0A, 0x00, 0x01, 0x87, 0x65, 0xC2,
+  0x0A, 0x00, 0x01, 0x87, 0x72, 0xC8, 0x0A, 0x00, 0x80, 0x87, 0x87, 0x7C, 0x01, 0x01, 0x98, 0x65,
+  0xD3, 0x0A, 0x00, 0x01, 0x98, 0x72, 0xD9, 0x0A, 0x00, 0x80, 0x98, 0x98, 0x79, 0x01, 0x01, 0x92,
+  0x74, 0xE4, 0x0A, 0x00, 0x01, 0x92, 0x68, 0xEA, 0x0A, 0x00, 0x01, 0x92, 0x65, 0xF0, 0x0A, 0x00,
+  0x01, 0x92, 0x72, 0xF6, 0x0A, 0x00, 0x80, 0x92, 0x92, 0x78, 0x01, 0x01, 0x91, 0x72, 0x01, 0x0B,
+  0x00, 0x80, 0x91, 0x91, 0x75, 0x01, 0x01, 0x8E, 0x74, 0x0C, 0x0B, 0x00, 0x80, 0x8E, 0x8E, 0x7D,
+  0x01, 0x02, 0xB0, 0x72, 0x1B, 0x0B, 0x00, 0x6D, 0x35, 0x0B, 0x00, 0x01, 0xB0, 0x73, 0x21, 0x0B,
+  0x00, 0x01, 0xB0, 0x65, 0x27, 0x0B, 0x00, 0x81, 0xB0, 0xB0, 0x89, 0x01, 0x73, 0x30, 0x0B, 0x00,
+  0x80, 0x8A, 0x8A, 0x8A, 0x01, 0x01, 0x8E, 0x62, 0x3B, 0x0B, 0x00, 0x81, 0x8E, 0x8A, 0x87, 0x01,
+  0x65, 0x44, 0x0B, 0x00, 0x01, 0x8E, 0x72, 0x4A, 0x0B, 0x00, 0x80, 0x8E, 0x8E, 0x88, 0x01, 0x02,
+  0xA9, 0x67, 0x59, 0x0B, 0x00, 0x63, 0x85, 0x0B, 0x00, 0x01, 0xA9, 0x68, 0x5F, 0x0B, 0x00, 0x01,
+  0xA9, 0x74, 0x65, 0x0B, 0x00, 0x81, 0xA9, 0xA9, 0x7F, 0x01, 0x6D, 0x6E, 0x0B, 0x00, 0x01, 0x89,
+  0x61, 0x74, 0x0B, 0x00, 0x01, 0x89, 0x72, 0x7A, 0x0B, 0x00, 0x01, 0x89, 0x65, 0x80, 0x0B, 0x00,
+  0x80, 0x89, 0x89, 0x80, 0x01, 0x01, 0x8B, 0x65, 0x8B, 0x0B, 0x00, 0x80, 0x8B, 0x8B, 0x7E, 0x01,
+  0x02, 0x96, 0x6D, 0x9A, 0x0B, 0x00, 0x75, 0xA5, 0x0B, 0x00, 0x01, 0x96, 0x65, 0xA0, 0x0B, 0x00,
+  0x80, 0x96, 0x96, 0x73, 0x01, 0x01, 0x89, 0x73, 0xAB, 0x0B, 0x00, 0x01, 0x89, 0x65, 0xB1, 0x0B,
+  0x00, 0x01, 0x89, 0x61, 0xB7, 0x0B, 0x00, 0x80, 0x89, 0x89, 0x74, 0x01, 0x06, 0xD5, 0x65, 0xD6,
+  0x0B, 0x00, 0x79, 0x44, 0x0C, 0x00, 0x6F, 0x49, 0x0C, 0x00, 0x75, 0xF6, 0x0C, 0x00, 0x61, 0x3A,
+  0x0D, 0x00, 0x69, 0xAB, 0x0D, 0x00, 0x83, 0xD5, 0xD5, 0x59, 0x01, 0x64, 0xE7, 0x0B, 0x00, 0x61,
+  0x0A, 0x0C, 0x00, 0x73, 0x1E, 0x0C, 0x00, 0x01, 0x9E, 0x69, 0xED, 0x0B, 0x00, 0x01, 0x9E, 0x63,
+  0xF3, 0x0B, 0x00, 0x01, 0x9E, 0x69, 0xF9, 0x0B, 0x00, 0x01, 0x9E, 0x6E, 0xFF, 0x0B, 0x00, 0x01,
+  0x9E, 0x65, 0x05, 0x0C, 0x00, 0x80, 0x9E, 0x9E, 0x5C, 0x01, 0x01, 0x91, 0x6E, 0x10, 0x0C, 0x00,
+  0x81, 0x91, 0x91, 0x5A, 0x01, 0x73, 0x19, 0x0C, 0x00, 0x80, 0x91, 0x91, 0x5B, 0x01, 0x01, 0x87,
+  0x73, 0x24, 0x0C, 0x00, 0x01, 0x87, 0x61, 0x2A, 0x0C, 0x00, 0x01, 0x87, 0x67, 0x30, 0x0C, 0x00,
+  0x01, 0x87, 0x65, 0x36, 0x0C, 0x00, 0x81, 0x87, 0x87, 0x5D, 0x01, 0x73, 0x3F, 0x0C, 0x00, 0x80,
+  0x87, 0x87, 0x5E, 0x01, 0x80, 0xD3, 0xD3, 0x72, 0x01, 0x06, 0xB4, 0x72, 0x63, 0x0C, 0x00, 0x6D,
+  0x89, 0x0C, 0x00, 0x74, 0x8E, 0x0C, 0x00, 0x76, 0xA5, 0x0C, 0x00, 0x75, 0xB0, 0x0C, 0x00, 0x6E,
+  0xC1, 0x0C, 0x00, 0x02, 0xB4, 0x65, 0x6D, 0x0C, 0x00, 0x6E, 0x72, 0x0C, 0x00, 0x80, 0xB4, 0xB4,
+  0x69, 0x01, 0x01, 0xAA, 0x69, 0x78, 0x0C, 0x00, 0x01, 0xAA, 0x6E, 0x7E, 0x0C, 0x00, 0x01, 0xAA,
+  0x67, 0x84, 0x0C, 0x00, 0x80, 0xAA, 0xAA, 0x6A, 0x01, 0x80, 0xA6, 0xA6, 0x65, 0x01, 0x01, 0xA6,
+  0x68, 0x94, 0x0C, 0x00, 0x01, 0xA6, 0x65, 0x9A, 0x0C, 0x00, 0x01, 0xA6, 0x72, 0xA0, 0x0C, 0x00,
+  0x80, 0xA6, 0xA6, 0x6B, 0x01, 0x01, 0xA3, 0x65, 0xAB, 0x0C, 0x00, 0x80, 0xA3, 0xA3, 0x6D, 0x01,
+  0x01, 0xA2, 0x74, 0xB6, 0x0C, 0x00, 0x01, 0xA2, 0x68, 0xBC, 0x0C, 0x00, 0x80, 0xA2, 0xA2, 0x6C,
+  0x01, 0x03, 0x96, 0x65, 0xCF, 0x0C, 0x00, 0x74, 0xDA, 0x0C, 0x00, 0x64, 0xE5, 0x0C, 0x00, 0x01,
+  0x96, 0x79, 0xD5, 0x0C, 0x00, 0x80, 0x96, 0x96, 0x67, 0x01, 0x01, 0x8F, 0x68, 0xE0, 0x0C, 0x00,
+  0x80, 0x8F, 0x8F, 0x68, 0x01, 0x01, 0x8E, 0x61, 0xEB, 0x0C, 0x00, 0x01, 0x8E, 0x79, 0xF1, 0x0C,
+  0x00, 0x80, 0x8E, 0x8E, 0x66, 0x01, 0x02, 0xAE, 0x63, 0x00, 0x0D, 0x00, 0x73, 0x0B, 0x0D, 0x00,
+  0x01, 0xAE, 0x68, 0x06, 0x0D, 0x00, 0x80, 0xAE, 0xAE, 0x6E, 0x01, 0x03, 0xA0, 0x69, 0x19, 0x0D,
+  0x00, 0x74, 0x24, 0x0D, 0x00, 0x63, 0x29, 0x0D, 0x00, 0x01, 0xA0, 0x63, 0x1F, 0x0D, 0x00, 0x80,
+  0xA0, 0xA0, 0x70, 0x01, 0x80, 0x93, 0x93, 0x71, 0x01, 0x01, 0x8D, 0x6C, 0x2F, 0x0D, 0x00, 0x01,
+  0x8D, 0x65, 0x35, 0x0D, 0x00, 0x80, 0x8D, 0x8D, 0x6F, 0x01, 0x05, 0xAD, 0x6B, 0x50, 0x0D, 0x00,
+  0x79, 0x5B, 0x0D, 0x00, 0x6E, 0x6F, 0x0D, 0x00, 0x64, 0x7D, 0x0D, 0x00, 0x73, 0x8E, 0x0D, 0x00,
+  0x01, 0xAD, 0x65, 0x56, 0x0D, 0x00, 0x80, 0xAD, 0xAD, 0x53, 0x01, 0x81, 0x97, 0x93, 0x57, 0x01,
+  0x62, 0x64, 0x0D, 0x00, 0x01, 0x97, 0x65, 0x6A, 0x0D, 0x00, 0x80, 0x97, 0x97, 0x58, 0x01, 0x81,
+  0x96, 0x96, 0x54, 0x01, 0x79, 0x78, 0x0D, 0x00, 0x80, 0x93, 0x93, 0x55, 0x01, 0x01, 0x8A, 0x61,
+  0x83, 0x0D, 0x00, 0x01, 0x8A, 0x6D, 0x89, 0x0D, 0x00, 0x80, 0x8A, 0x8A, 0x52, 0x01, 0x01, 0x88,
+  0x73, 0x94, 0x0D, 0x00, 0x01, 0x88, 0x61, 0x9A, 0x0D, 0x00, 0x01, 0x88, 0x67, 0xA0, 0x0D, 0x00,
+  0x01, 0x88, 0x65, 0xA6, 0x0D, 0x00, 0x80, 0x88, 0x88, 0x56, 0x01, 0x04, 0xA5, 0x73, 0xBD, 0x0D,
+  0x00, 0x6C, 0xDD, 0x0D, 0x00, 0x67, 0xE8, 0x0D, 0x00, 0x6E, 0xF9, 0x0D, 0x00, 0x02, 0xA5, 0x73,
+  0xC7, 0x0D, 0x00, 0x74, 0xCC, 0x0D, 0x00, 0x80, 0xA5, 0xA5, 0x63, 0x01, 0x01, 0x8A, 0x65, 0xD2,
+  0x0D, 0x00, 0x01, 0x8A, 0x72, 0xD8, 0x0D, 0x00, 0x80, 0x8A, 0x8A, 0x64, 0x01, 0x01, 0x9C, 0x6B,
+  0xE3, 0x0D, 0x00, 0x80, 0x9C, 0x9C, 0x60, 0x01, 0x01, 0x93, 0x68, 0xEE, 0x0D, 0x00, 0x01, 0x93,
+  0x74, 0xF4, 0x0D, 0x00, 0x80, 0x93, 0x93, 0x5F, 0x01, 0x01, 0x8F, 0x75, 0xFF, 0x0D, 0x00, 0x01,
+  0x8F, 0x74, 0x05, 0x0E, 0x00, 0x01, 0x8F, 0x65, 0x0B, 0x0E, 0x00, 0x81, 0x8F, 0x8F, 0x61, 0x01,
+  0x73, 0x14, 0x0E, 0x00, 0x80, 0x8E, 0x8E, 0x62, 0x01, 0x06, 0xD1, 0x68, 0x33, 0x0E, 0x00, 0x61,
+  0xCE, 0x0E, 0x00, 0x65, 0x63, 0x0F, 0x00, 0x69, 0x0D, 0x10, 0x00, 0x6F, 0x8A, 0x10, 0x00, 0x72,
+  0x37, 0x11, 0x00, 0x05, 0xD1, 0x61, 0x49, 0x0E, 0x00, 0x65, 0x54, 0x0E, 0x00, 0x69, 0x9B, 0x0E,
+  0x00, 0x6F, 0xAC, 0x0E, 0x00, 0x79, 0xC9, 0x0E, 0x00, 0x01, 0xD1, 0x74, 0x4F, 0x0E, 0x00, 0x80,
+  0xD1, 0xD1, 0x73, 0x02, 0x03, 0xB5, 0x6E, 0x62, 0x0E, 0x00, 0x72, 0x67, 0x0E, 0x00, 0x65, 0x72,
+  0x0E, 0x00, 0x80, 0xB5, 0xB5, 0x75, 0x02, 0x01, 0x99, 0x65, 0x6D, 0x0E, 0x00, 0x80, 0x99, 0x99,
+  0x76, 0x02, 0x01, 0x95, 0x6C, 0x78, 0x0E, 0x00, 0x01, 0x95, 0x63, 0x7E, 0x0E, 0x00, 0x01, 0x95,
+  0x68, 0x84, 0x0E, 0x00, 0x01, 0x95, 0x61, 0x8A, 0x0E, 0x00, 0x01, 0x95, 0x69, 0x90, 0x0E, 0x00,
+  0x01, 0x95, 0x72, 0x96, 0x0E, 0x00, 0x80, 0x95, 0x95, 0x74, 0x02, 0x01, 0x99, 0x63, 0xA1, 0x0E,
+  0x00, 0x01, 0x99, 0x68, 0xA7, 0x0E, 0x00, 0x80, 0x99, 0x99, 0x77, 0x02, 0x82, 0x99, 0x99, 0x78,
+  0x02, 0x6D, 0xB9, 0x0E, 0x00, 0x73, 0xBE, 0x0E, 0x00, 0x80, 0x98, 0x98, 0x79, 0x02, 0x01, 0x98,
+  0x65, 0xC4, 0x0E, 0x00, 0x80, 0x98, 0x98, 0x7A, 0x02, 0x80, 0x99, 0x99, 0x7B, 0x02, 0x07, 0xC6,
+  0x6E, 0xEC, 0x0E, 0x00, 0x73, 0xF7, 0x0E, 0x00, 0x74, 0x05, 0x0F, 0x00, 0x69, 0x34, 0x0F, 0x00,
+  0x79, 0x3F, 0x0F, 0x00, 0x6C, 0x44, 0x0F, 0x00, 0x72, 0x4F, 0x0F, 0x00, 0x01, 0xC6, 0x74, 0xF2,
+  0x0E, 0x00, 0x80, 0xC6, 0xC6, 0x60, 0x02, 0x81, 0xB4, 0xB4, 0x63, 0x02, 0x68, 0x00, 0x0F, 0x00,
+  0x80, 0x9F, 0x9F, 0x64, 0x02, 0x02, 0xB1, 0x65, 0x0F, 0x0F, 0x00, 0x63, 0x1A, 0x0F, 0x00, 0x01,
+  0xB1, 0x72, 0x15, 0x0F, 0x00, 0x80, 0xB1, 0xB1, 0x67, 0x02, 0x01, 0x90, 0x68, 0x20, 0x0F, 0x00,
+  0x81, 0x90, 0x90, 0x65, 0x02, 0x65, 0x29, 0x0F, 0x00, 0x01, 0x90, 0x64, 0x2F, 0x0F, 0x00, 0x80,
+  0x90, 0x90, 0x66, 0x02, 0x01, 0xAB, 0x74, 0x3A, 0x0F, 0x00, 0x80, 0xAB, 0xAB, 0x5E, 0x02, 0x80,
+  0x96, 0x96, 0x68, 0x02, 0x01, 0x95, 0x6B, 0x4A, 0x0F, 0x00, 0x80, 0x95, 0x95, 0x5F, 0x02, 0x02,
+  0x95, 0x64, 0x59, 0x0F, 0x00, 0x6D, 0x5E, 0x0F, 0x00, 0x80, 0x95, 0x95, 0x61, 0x02, 0x80, 0x8C,
+  0x8C, 0x62, 0x02, 0x87, 0xBF, 0xBF, 0x69, 0x02, 0x6C, 0x84, 0x0F, 0x00, 0x74, 0x8F, 0x0F, 0x00,
+  0x6E, 0x94, 0x0F, 0x00, 0x72, 0x9F, 0x0F, 0x00, 0x65, 0xAA, 0x0F, 0x00, 0x64, 0xBE, 0x0F, 0x00,
+  0x61, 0xE7, 0x0F, 0x00, 0x01, 0xA7, 0x6C, 0x8A, 0x0F, 0x00, 0x80, 0xA7, 0xA7, 0x6F, 0x02, 0x80,
+  0x9C, 0x9C, 0x72, 0x02, 0x01, 0x94, 0x74, 0x9A, 0x0F, 0x00, 0x80, 0x94, 0x94, 0x70, 0x02, 0x01,
+  0x93, 0x65, 0xA5, 0x0F, 0x00, 0x80, 0x93, 0x93, 0x71, 0x02, 0x01, 0x8F, 0x6B, 0xB0, 0x0F, 0x00,
+  0x81, 0x8F, 0x8F, 0x6D, 0x02, 0x73, 0xB9, 0x0F, 0x00, 0x80, 0x8E, 0x8E, 0x6E, 0x02, 0x01, 0x8E,
+  0x6E, 0xC4, 0x0F, 0x00, 0x01, 0x8E, 0x65, 0xCA, 0x0F, 0x00, 0x01, 0x8E, 0x73, 0xD0, 0x0F, 0x00,
+  0x01, 0x8E, 0x64, 0xD6, 0x0F, 0x00, 0x01, 0x8E, 0x61, 0xDC, 0x0F, 0x00, 0x01, 0x8E, 0x79, 0xE2,
+  0x0F, 0x00, 0x80, 0x8E, 0x8E, 0x6C, 0x02, 0x02, 0x8A, 0x6B, 0xF1, 0x0F, 0x00, 0x74, 0xF6, 0x0F,
+  0x00, 0x80, 0x8A, 0x8A, 0x6A, 0x02, 0x01, 0x88, 0x68, 0xFC, 0x0F, 0x00, 0x01, 0x88, 0x65, 0x02,
+  0x10, 0x00, 0x01, 0x88, 0x72, 0x08, 0x10, 0x00, 0x80, 0x88, 0x88, 0x6B, 0x02, 0x05, 0xBE, 0x74,
+  0x23, 0x10, 0x00, 0x6C, 0x52, 0x10, 0x00, 0x66, 0x5D, 0x10, 0x00, 0x6E, 0x68, 0x10, 0x00, 0x73,
+  0x7F, 0x10, 0x00, 0x01, 0xBE, 0x68, 0x29, 0x10, 0x00, 0x82, 0xBE, 0xBE, 0x80, 0x02, 0x69, 0x36,
+  0x10, 0x00, 0x6F, 0x41, 0x10, 0x00, 0x01, 0x91, 0x6E, 0x3C, 0x10, 0x00, 0x80, 0x91, 0x91, 0x81,
+  0x02, 0x01, 0x91, 0x75, 0x47, 0x10, 0x00, 0x01, 0x91, 0x74, 0x4D, 0x10, 0x00, 0x80, 0x91, 0x91,
+  0x82, 0x02, 0x01, 0xBC, 0x6C, 0x58, 0x10, 0x00, 0x80, 0xBC, 0xBC, 0x7D, 0x02, 0x01, 0xA7, 0x65,
+  0x63, 0x10, 0x00, 0x80, 0xA7, 0xA7, 0x7C, 0x02, 0x01, 0xA1, 0x64, 0x6E, 0x10, 0x00, 0x01, 0xA1,
+  0x6F, 0x74, 0x10, 0x00, 0x01, 0xA1, 0x77, 0x7A, 0x10, 0x00, 0x80, 0xA1, 0xA1, 0x7E, 0x02, 0x01,
+  0x8F, 0x68, 0x85, 0x10, 0x00, 0x80, 0x8F, 0x8F, 0x7F, 0x02, 0x04, 0xA8, 0x72, 0x9C, 0x10, 0x00,
+  0x6D, 0xE9, 0x10, 0x00, 0x75, 0xFA, 0x10, 0x00, 0x6E, 0x0B, 0x11, 0x00, 0x04, 0xA8, 0x73, 0xAE,
+  0x10, 0x00, 0x72, 0xC2, 0x10, 0x00, 0x6B, 0xD9, 0x10, 0x00, 0x6C, 0xDE, 0x10, 0x00, 0x02, 0xA8,
+  0x65, 0xB8, 0x10, 0x00, 0x74, 0xBD, 0x10, 0x00, 0x80, 0xA8, 0xA8, 0x89, 0x02, 0x80, 0x8B, 0x8B,
+  0x8A, 0x02, 0x01, 0xA4, 0x69, 0xC8, 0x10, 0x00, 0x01, 0xA4, 0x65, 0xCE, 0x10, 0x00, 0x01, 0xA4,
+  0x64, 0xD4, 0x10, 0x00, 0x80, 0xA4, 0xA4, 0x88, 0x02, 0x80, 0x96, 0x96, 0x86, 0x02, 0x01, 0x8D,
+  0x64, 0xE4, 0x10, 0x00, 0x80, 0x8D, 0x8D, 0x87, 0x02, 0x01, 0x96, 0x61, 0xEF, 0x10, 0x00, 0x01,
+  0x96, 0x6E, 0xF5, 0x10, 0x00, 0x80, 0x96, 0x96, 0x83, 0x02, 0x01, 0x93, 0x6C, 0x00, 0x11, 0x00,
+  0x01, 0x93, 0x64, 0x06, 0x11, 0x00, 0x80, 0x93, 0x93, 0x8B, 0x02, 0x01, 0x8F, 0x64, 0x11, 0x11,
+  0x00, 0x01, 0x8F, 0x65, 0x17, 0x11, 0x00, 0x01, 0x8F, 0x72, 0x1D, 0x11, 0x00, 0x81, 0x8F, 0x8F,
+  0x84, 0x02, 0x66, 0x26, 0x11, 0x00, 0x01, 0x8B, 0x75, 0x2C, 0x11, 0x00, 0x01, 0x8B, 0x6C, 0x32,
+  0x11, 0x00, 0x80, 0x8B, 0x8B, 0x85, 0x02, 0x02, 0x95, 0x69, 0x41, 0x11, 0x00, 0x6F, 0x52, 0x11,
+  0x00, 0x01, 0x95, 0x74, 0x47, 0x11, 0x00, 0x01, 0x95, 0x65, 0x4D, 0x11, 0x00, 0x80, 0x95, 0x95,
+  0x8C, 0x02, 0x01, 0x8B, 0x6E, 0x58, 0x11, 0x00, 0x01, 0x8B, 0x67, 0x5E, 0x11, 0x00, 0x80, 0x8B,
+  0x8B, 0x8D, 0x02, 0x07, 0xCC, 0x6F, 0x81, 0x11, 0x00, 0x61, 0xFB, 0x11, 0x00, 0x69, 0x4E, 0x12,
+  0x00, 0x72, 0x5E, 0x13, 0x00, 0x75, 0xA5, 0x13, 0x00, 0x65, 0xD1, 0x13, 0x00, 0x79, 0xE8, 0x13,
+  0x00, 0x86, 0xCC, 0xCC, 0x9A, 0x00, 0x63, 0x9E, 0x11, 0x00, 0x77, 0xBE, 0x11, 0x00, 0x6F, 0xC9,
+  0x11, 0x00, 0x65, 0xD4, 0x11, 0x00, 0x69, 0xDF, 0x11, 0x00, 0x6E, 0xF0, 0x11, 0x00, 0x01, 0xB0,
+  0x74, 0xA4, 0x11, 0x00, 0x01, 0xB0, 0x6F, 0xAA, 0x11, 0x00, 0x01, 0xB0, 0x72, 0xB0, 0x11, 0x00,
+  0x81, 0xB0, 0xB0, 0x9B, 0x00, 0x73, 0xB9, 0x11, 0x00, 0x80, 0x8A, 0x8A, 0x9C, 0x00, 0x01, 0xA3,
+  0x6E, 0xC4, 0x11, 0x00, 0x80, 0xA3, 0xA3, 0xA1, 0x00, 0x01, 0xA0, 0x72, 0xCF, 0x11, 0x00, 0x80,
+  0xA0, 0xA0, 0xA0, 0x00, 0x01, 0x94, 0x73, 0xDA, 0x11, 0x00, 0x80, 0x94, 0x94, 0x9D, 0x00, 0x01,
+  0x94, 0x6E, 0xE5, 0x11, 0x00, 0x01, 0x94, 0x67, 0xEB, 0x11, 0x00, 0x80, 0x94, 0x94, 0x9E, 0x00,
+  0x01, 0x94, 0x65, 0xF6, 0x11, 0x00, 0x80, 0x94, 0x94, 0x9F, 0x00, 0x04, 0xA9, 0x79, 0x0D, 0x12,
+  0x00, 0x64, 0x1B, 0x12, 0x00, 0x75, 0x20, 0x12, 0x00, 0x72, 0x43, 0x12, 0x00, 0x81, 0xA9, 0xA9,
+  0x8D, 0x00, 0x73, 0x16, 0x12, 0x00, 0x80, 0x8E, 0x8E, 0x8E, 0x00, 0x80, 0xA6, 0xA6, 0x8A, 0x00,
+  0x01, 0xA6, 0x67, 0x26, 0x12, 0x00, 0x01, 0xA6, 0x68, 0x2C, 0x12, 0x00, 0x01, 0xA6, 0x74, 0x32,
+  0x12, 0x00, 0x01, 0xA6, 0x65, 0x38, 0x12, 0x00, 0x01, 0xA6, 0x72, 0x3E, 0x12, 0x00, 0x80, 0xA6,
+  0xA6, 0x8C, 0x00, 0x01, 0x8C, 0x6B, 0x49, 0x12, 0x00, 0x80, 0x8C, 0x8C, 0x8B, 0x00, 0x08, 0x9E,
+  0x72, 0x70, 0x12, 0x00, 0x7A, 0x81, 0x12, 0x00, 0x61, 0x92, 0x12, 0x00, 0x6E, 0xCA, 0x12, 0x00,
+  0x64, 0xE1, 0x12, 0x00, 0x65, 0xE6, 0x12, 0x00, 0x66, 0xEB, 0x12, 0x00, 0x73, 0x35, 0x13, 0x00,
+  0x01, 0x9E, 0x74, 0x76, 0x12, 0x00, 0x01, 0x9E, 0x79, 0x7C, 0x12, 0x00, 0x80, 0x9E, 0x9E, 0x97,
+  0x00, 0x01, 0x9D, 0x7A, 0x87, 0x12, 0x00, 0x01, 0x9D, 0x79, 0x8D, 0x12, 0x00, 0x80, 0x9D, 0x9D,
+  0x99, 0x00, 0x02, 0x9C, 0x70, 0x9C, 0x12, 0x00, 0x72, 0xAD, 0x12, 0x00, 0x01, 0x9C, 0x65, 0xA2,
+  0x12, 0x00, 0x01, 0x9C, 0x72, 0xA8, 0x12, 0x00, 0x80, 0x9C, 0x9C, 0x90, 0x00, 0x01, 0x89, 0x72,
+  0xB3, 0x12, 0x00, 0x01, 0x89, 0x68, 0xB9, 0x12, 0x00, 0x01, 0x89, 0x65, 0xBF, 0x12, 0x00, 0x01,
+  0x89, 0x61, 0xC5, 0x12, 0x00, 0x80, 0x89, 0x89, 0x91, 0x00, 0x01, 0x9B, 0x6E, 0xD0, 0x12, 0x00,
+  0x01, 0x9B, 0x65, 0xD6, 0x12, 0x00, 0x01, 0x9B, 0x72, 0xDC, 0x12, 0x00, 0x80, 0x9B, 0x9B, 0x96,
+  0x00, 0x80, 0x94, 0x94, 0x92, 0x00, 0x80, 0x8D, 0x8D, 0x93, 0x00, 0x01, 0x8B, 0x66, 0xF1, 0x12,
+  0x00, 0x02, 0x8B, 0x65, 0xFB, 0x12, 0x00, 0x69, 0x18, 0x13, 0x00, 0x01, 0x8B, 0x72, 0x01, 0x13,
+  0x00, 0x01, 0x8B, 0x65, 0x07, 0x13, 0x00, 0x01, 0x8B, 0x6E, 0x0D, 0x13, 0x00, 0x01, 0x8B, 0x74,
+  0x13, 0x13, 0x00, 0x80, 0x8B, 0x8B, 0x94, 0x00, 0x01, 0x8B, 0x63, 0x1E, 0x13, 0x00, 0x01, 0x8B,
+  0x75, 0x24, 0x13, 0x00, 0x01, 0x8B, 0x6C, 0x2A, 0x13, 0x00, 0x01, 0x8B, 0x74, 0x30, 0x13, 0x00,
+  0x80, 0x8B, 0x8B, 0x95, 0x00, 0x01, 0x89, 0x63, 0x3B, 0x13, 0x00, 0x01, 0x89, 0x68, 0x41, 0x13,
+  0x00, 0x01, 0x89, 0x61, 0x47, 0x13, 0x00, 0x01, 0x89, 0x72, 0x4D, 0x13, 0x00, 0x01, 0x89, 0x67,
+  0x53, 0x13, 0x00, 0x01, 0x89, 0x65, 0x59, 0x13, 0x00, 0x80, 0x89, 0x89, 0x98, 0x00, 0x03, 0x9E,
+  0x69, 0x6C, 0x13, 0x00, 0x79, 0x86, 0x13, 0x00, 0x65, 0x8B, 0x13, 0x00, 0x02, 0x9E, 0x70, 0x76,
+  0x13, 0x00, 0x6E, 0x7B, 0x13, 0x00, 0x80, 0x9E, 0x9E, 0xA5, 0x00, 0x01, 0x9C, 0x6B, 0x81, 0x13,
+  0x00, 0x80, 0x9C, 0x9C, 0xA4, 0x00, 0x80, 0x9C, 0x9C, 0xA6, 0x00, 0x01, 0x89, 0x61, 0x91, 0x13,
+  0x00, 0x01, 0x89, 0x6D, 0x97, 0x13, 0x00, 0x81, 0x89, 0x89, 0xA2, 0x00, 0x73, 0xA0, 0x13, 0x00,
+  0x80, 0x89, 0x89, 0xA3, 0x00, 0x02, 0x92, 0x72, 0xAF, 0x13, 0x00, 0x6C, 0xC6, 0x13, 0x00, 0x01,
+  0x92, 0x69, 0xB5, 0x13, 0x00, 0x01, 0x92, 0x6E, 0xBB, 0x13, 0x00, 0x01, 0x92, 0x67, 0xC1, 0x13,
+  0x00, 0x80, 0x92, 0x92, 0xA8, 0x00, 0x01, 0x8A, 0x6C, 0xCC, 0x13, 0x00, 0x80, 0x8A, 0x8A, 0xA7,
+  0x00, 0x01, 0x8D, 0x61, 0xD7, 0x13, 0x00, 0x01, 0x8D, 0x74, 0xDD, 0x13, 0x00, 0x01, 0x8D, 0x68,
+  0xE3, 0x13, 0x00, 0x80, 0x8D, 0x8D, 0x8F, 0x00, 0x01, 0x8D, 0x69, 0xEE, 0x13, 0x00, 0x01, 0x8D,
+  0x6E, 0xF4, 0x13, 0x00, 0x01, 0x8D, 0x67, 0xFA, 0x13, 0x00, 0x80, 0x8D, 0x8D, 0xA9, 0x00, 0x08,
+  0xCB, 0x6C, 0x21, 0x14, 0x00, 0x61, 0x7A, 0x14, 0x00, 0x75, 0xA0, 0x14, 0x00, 0x68, 0xC9, 0x14,
+  0x00, 0x69, 0x13, 0x15, 0x00, 0x65, 0x63, 0x15, 0x00, 0x72, 0xA4, 0x15, 0x00, 0x6F, 0x27, 0x16,
+  0x00, 0x03, 0xCB, 0x65, 0x2F, 0x14, 0x00, 0x61, 0x46, 0x14, 0x00, 0x75, 0x6F, 0x14, 0x00, 0x01,
+  0xCB, 0x61, 0x35, 0x14, 0x00, 0x01, 0xCB, 0x73, 0x3B, 0x14, 0x00, 0x01, 0xCB, 0x65, 0x41, 0x14,
+  0x00, 0x80, 0xCB, 0xCB, 0xAC, 0x01, 0x02, 0x96, 0x63, 0x50, 0x14, 0x00, 0x79, 0x5B, 0x14, 0x00,
+  0x01, 0x96, 0x65, 0x56, 0x14, 0x00, 0x80, 0x96, 0x96, 0xA9, 0x01, 0x81, 0x90, 0x90, 0xAA, 0x01,
+  0x65, 0x64, 0x14, 0x00, 0x01, 0x90, 0x64, 0x6A, 0x14, 0x00, 0x80, 0x90, 0x90, 0xAB, 0x01, 0x01,
+  0x88, 0x67, 0x75, 0x14, 0x00, 0x80, 0x88, 0x88, 0xAD, 0x01, 0x01, 0xB1, 0x69, 0x80, 0x14, 0x00,
+  0x01, 0xB1, 0x6E, 0x86, 0x14, 0x00, 0x81, 0xB1, 0xB1, 0x9C, 0x01, 0x66, 0x8F, 0x14, 0x00, 0x01,
+  0x8A, 0x75, 0x95, 0x14, 0x00, 0x01, 0x8A, 0x6C, 0x9B, 0x14, 0x00, 0x80, 0x8A, 0x8A, 0x9D, 0x01,
+  0x03, 0xAC, 0x74, 0xAE, 0x14, 0x00, 0x6C, 0xB3, 0x14, 0x00, 0x73, 0xBE, 0x14, 0x00, 0x80, 0xAC,
+  0xAC, 0xB7, 0x01, 0x01, 0x95, 0x6C, 0xB9, 0x14, 0x00, 0x80, 0x95, 0x95, 0xB5, 0x01, 0x01, 0x95,
+  0x68, 0xC4, 0x14, 0x00, 0x80, 0x95, 0x95, 0xB6, 0x01, 0x02, 0xA0, 0x6F, 0xD3, 0x14, 0x00, 0x79,
+  0xFC, 0x14, 0x00, 0x02, 0xA0, 0x6E, 0xDD, 0x14, 0x00, 0x74, 0xE8, 0x14, 0x00, 0x01, 0xA0, 0x65,
+  0xE3, 0x14, 0x00, 0x80, 0xA0, 0xA0, 0xA1, 0x01, 0x01, 0x87, 0x6F, 0xEE, 0x14, 0x00, 0x81, 0x87,
+  0x87, 0xA2, 0x01, 0x73, 0xF7, 0x14, 0x00, 0x80, 0x87, 0x87, 0xA3, 0x01, 0x01, 0x89, 0x73, 0x02,
+  0x15, 0x00, 0x01, 0x89, 0x69, 0x08, 0x15, 0x00, 0x01, 0x89, 0x6F, 0x0E, 0x15, 0x00, 0x80, 0x89,
+  0x89, 0xA4, 0x01, 0x02, 0x9F, 0x6C, 0x1D, 0x15, 0x00, 0x63, 0x3D, 0x15, 0x00, 0x01, 0x9F, 0x6C,
+  0x23, 0x15, 0x00, 0x02, 0x9F, 0x6F, 0x2D, 0x15, 0x00, 0x73, 0x38, 0x15, 0x00, 0x01, 0x9F, 0x77,
+  0x33, 0x15, 0x00, 0x80, 0x9F, 0x9F, 0xA7, 0x01, 0x80, 0x9E, 0x9E, 0xA8, 0x01, 0x01, 0x87, 0x74,
+  0x43, 0x15, 0x00, 0x01, 0x87, 0x75, 0x49, 0x15, 0x00, 0x01, 0x87, 0x72, 0x4F, 0x15, 0x00, 0x01,
+  0x87, 0x65, 0x55, 0x15, 0x00, 0x81, 0x87, 0x87, 0xA5, 0x01, 0x73, 0x5E, 0x15, 0x00, 0x80, 0x87,
+  0x87, 0xA6, 0x01, 0x03, 0x9D, 0x65, 0x71, 0x15, 0x00, 0x6F, 0x76, 0x15, 0x00, 0x72, 0x8D, 0x15,
+  0x00, 0x80, 0x9D, 0x9D, 0x9E, 0x01, 0x01, 0x97, 0x70, 0x7C, 0x15, 0x00, 0x01, 0x97, 0x6C, 0x82,
+  0x15, 0x00, 0x01, 0x97, 0x65, 0x88, 0x15, 0x00, 0x80, 0x97, 0x97, 0x9F, 0x01, 0x01, 0x97, 0x73,
+  0x93, 0x15, 0x00, 0x01, 0x97, 0x6F, 0x99, 0x15, 0x00, 0x01, 0x97, 0x6E, 0x9F, 0x15, 0x00, 0x80,
+  0x97, 0x97, 0xA0, 0x01, 0x04, 0x9D, 0x65, 0xB6, 0x15, 0x00, 0x61, 0xD9, 0x15, 0x00, 0x6F, 0xF3,
+  0x15, 0x00, 0x69, 0x10, 0x16, 0x00, 0x01, 0x9D, 0x73, 0xBC, 0x15, 0x00, 0x01, 0x9D, 0x73, 0xC2,
+  0x15, 0x00, 0x01, 0x9D, 0x75, 0xC8, 0x15, 0x00, 0x01, 0x9D, 0x72, 0xCE, 0x15, 0x00, 0x01, 0x9D,
+  0x65, 0xD4, 0x15, 0x00, 0x80, 0x9D, 0x9D, 0xB2, 0x01, 0x01, 0x8F, 0x79, 0xDF, 0x15, 0x00, 0x81,
+  0x8F, 0x8F, 0xB0, 0x01, 0x65, 0xE8, 0x15, 0x00, 0x01, 0x8F, 0x72, 0xEE, 0x15, 0x00, 0x80, 0x8F,
+  0x8F, 0xB1, 0x01, 0x01, 0x8E, 0x62, 0xF9, 0x15, 0x00, 0x01, 0x8E, 0x6C, 0xFF, 0x15, 0x00, 0x01,
+  0x8E, 0x65, 0x05, 0x16, 0x00, 0x01, 0x8E, 0x6D, 0x0B, 0x16, 0x00, 0x80, 0x8E, 0x8E, 0xB4, 0x01,
+  0x01, 0x89, 0x65, 0x16, 0x16, 0x00, 0x01, 0x89, 0x73, 0x1C, 0x16, 0x00, 0x01, 0x89, 0x74, 0x22,
+  0x16, 0x00, 0x80, 0x89, 0x89, 0xB3, 0x01, 0x01, 0x8B, 0x73, 0x2D, 0x16, 0x00, 0x02, 0x8B, 0x73,
+  0x37, 0x16, 0x00, 0x69, 0x54, 0x16, 0x00, 0x01, 0x8B, 0x69, 0x3D, 0x16, 0x00, 0x01, 0x8B, 0x62,
+  0x43, 0x16, 0x00, 0x01, 0x8B, 0x6C, 0x49, 0x16, 0x00, 0x01, 0x8B, 0x65, 0x4F, 0x16, 0x00, 0x80,
+  0x8B, 0x8B, 0xAF, 0x01, 0x01, 0x88, 0x74, 0x5A, 0x16, 0x00, 0x01, 0x88, 0x69, 0x60, 0x16, 0x00,
+  0x01, 0x88, 0x6F, 0x66, 0x16, 0x00, 0x01, 0x88, 0x6E, 0x6C, 0x16, 0x00, 0x80, 0x88, 0x88, 0xAE,
+  0x01, 0x0A, 0xC9, 0x66, 0x9B, 0x16, 0x00, 0x6E, 0xBE, 0x16, 0x00, 0x75, 0xDB, 0x16, 0x00, 0x6B,
+  0x01, 0x17, 0x00, 0x76, 0x15, 0x17, 0x00, 0x70, 0x26, 0x17, 0x00, 0x78, 0x5E, 0x17, 0x00, 0x6C,
+  0x7B, 0x17, 0x00, 0x74, 0x86, 0x17, 0x00, 0x72, 0x9D, 0x17, 0x00, 0x82, 0xC9, 0xC9, 0x8B, 0x01,
+  0x66, 0xA8, 0x16, 0x00, 0x74, 0xAD, 0x16, 0x00, 0x80, 0xAD, 0xAD, 0x8C, 0x01, 0x01, 0x98, 0x65,
+  0xB3, 0x16, 0x00, 0x01, 0x98, 0x6E, 0xB9, 0x16, 0x00, 0x80, 0x98, 0x98, 0x8D, 0x01, 0x82, 0xC0,
+  0xC0, 0x91, 0x01, 0x65, 0xCB, 0x16, 0x00, 0x6C, 0xD0, 0x16, 0x00, 0x80, 0xB6, 0xB6, 0x92, 0x01,
+  0x01, 0x98, 0x79, 0xD6, 0x16, 0x00, 0x80, 0x98, 0x98, 0x93, 0x01, 0x01, 0xB6, 0x74, 0xE1, 0x16,
+  0x00, 0x81, 0xB6, 0xB6, 0x98, 0x01, 0x73, 0xEA, 0x16, 0x00, 0x01, 0x91, 0x69, 0xF0, 0x16, 0x00,
+  0x01, 0x91, 0x64, 0xF6, 0x16, 0x00, 0x01, 0x91, 0x65, 0xFC, 0x16, 0x00, 0x80, 0x91, 0x91, 0x99,
+  0x01, 0x81, 0xAF, 0xAF, 0x8E, 0x01, 0x61, 0x0A, 0x17, 0x00, 0x01, 0xAF, 0x79, 0x10, 0x17, 0x00,
+  0x80, 0xAF, 0xAF, 0x8F, 0x01, 0x01, 0xAE, 0x65, 0x1B, 0x17, 0x00, 0x01, 0xAE, 0x72, 0x21, 0x17,
+  0x00, 0x80, 0xAE, 0xAE, 0x9A, 0x01, 0x01, 0xAB, 0x65, 0x2C, 0x17, 0x00, 0x02, 0xAB, 0x6E, 0x36,
+  0x17, 0x00, 0x72, 0x3B, 0x17, 0x00, 0x80, 0xAB, 0xAB, 0x94, 0x01, 0x01, 0x89, 0x61, 0x41, 0x17,
+  0x00, 0x01, 0x89, 0x74, 0x47, 0x17, 0x00, 0x01, 0x89, 0x69, 0x4D, 0x17, 0x00, 0x01, 0x89, 0x6F,
+  0x53, 0x17, 0x00, 0x01, 0x89, 0x6E, 0x59, 0x17, 0x00, 0x80, 0x89, 0x89, 0x95, 0x01, 0x01, 0x9E,
+  0x79, 0x64, 0x17, 0x00, 0x01, 0x9E, 0x67, 0x6A, 0x17, 0x00, 0x01, 0x9E, 0x65, 0x70, 0x17, 0x00,
+  0x01, 0x9E, 0x6E, 0x76, 0x17, 0x00, 0x80, 0x9E, 0x9E, 0x9B, 0x01, 0x01, 0x9A, 0x64, 0x81, 0x17,
+  0x00, 0x80, 0x9A, 0x9A, 0x90, 0x01, 0x01, 0x9A, 0x68, 0x8C, 0x17, 0x00, 0x01, 0x9A, 0x65, 0x92,
+  0x17, 0x00, 0x01, 0x9A, 0x72, 0x98, 0x17, 0x00, 0x80, 0x9A, 0x9A, 0x97, 0x01, 0x80, 0x98, 0x98,
+  0x96, 0x01, 0x05, 0xC8, 0x61, 0xB8, 0x17, 0x00, 0x65, 0x3B, 0x18, 0x00, 0x6F, 0xE2, 0x18, 0x00,
+  0x75, 0xAD, 0x19, 0x00, 0x69, 0x18, 0x1A, 0x00, 0x07, 0xC8, 0x76, 0xD6, 0x17, 0x00, 0x70, 0xF6,
+  0x17, 0x00, 0x6E, 0x07, 0x18, 0x00, 0x64, 0x1B, 0x18, 0x00, 0x73, 0x20, 0x18, 0x00, 0x69, 0x25,
+  0x18, 0x00, 0x72, 0x30, 0x18, 0x00, 0x02, 0xC8, 0x65, 0xE0, 0x17, 0x00, 0x69, 0xE5, 0x17, 0x00,
+  0x80, 0xC8, 0xC8, 0xF1, 0x00, 0x01, 0x93, 0x6E, 0xEB, 0x17, 0x00, 0x01, 0x93, 0x67, 0xF1, 0x17,
+  0x00, 0x80, 0x93, 0x93, 0xF2, 0x00, 0x01, 0xA5, 0x70, 0xFC, 0x17, 0x00, 0x01, 0xA5, 0x79, 0x02,
+  0x18, 0x00, 0x80, 0xA5, 0xA5, 0xEE, 0x00, 0x01, 0xA3, 0x64, 0x0D, 0x18, 0x00, 0x81, 0xA3, 0xA3,
+  0xEC, 0x00, 0x73, 0x16, 0x18, 0x00, 0x80, 0x8D, 0x8D, 0xED, 0x00, 0x80, 0x94, 0x94, 0xEA, 0x00,
+  0x80, 0x93, 0x93, 0xF0, 0x00, 0x01, 0x8D, 0x72, 0x2B, 0x18, 0x00, 0x80, 0x8D, 0x8D, 0xEB, 0x00,
+  0x01, 0x8C, 0x64, 0x36, 0x18, 0x00, 0x80, 0x8C, 0x8C, 0xEF, 0x00, 0x83, 0xC1, 0xB8, 0xF3, 0x00,
+  0x6C, 0x4C, 0x18, 0x00, 0x72, 0x66, 0x18, 0x00, 0x61, 0x71, 0x18, 0x00, 0x02, 0xC1, 0x70, 0x56,
+  0x18, 0x00, 0x6C, 0x5B, 0x18, 0x00, 0x80, 0xC1, 0xC1, 0xFC, 0x00, 0x01, 0x8F, 0x6F, 0x61, 0x18,
+  0x00, 0x80, 0x8F, 0x8F, 0xFB, 0x00, 0x01, 0xBD, 0x65, 0x6C, 0x18, 0x00, 0x80, 0xBD, 0xBD, 0xFD,
+  0x00, 0x04, 0xAB, 0x72, 0x83, 0x18, 0x00, 0x64, 0x91, 0x18, 0x00, 0x76, 0xB1, 0x18, 0x00, 0x74,
+  0xBC, 0x18, 0x00, 0x81, 0xAB, 0xAB, 0xF6, 0x00, 0x74, 0x8C, 0x18, 0x00, 0x80, 0x8D, 0x8D, 0xF7,
+  0x00, 0x81, 0xA3, 0xA3, 0xF4, 0x00, 0x61, 0x9A, 0x18, 0x00, 0x01, 0x9D, 0x63, 0xA0, 0x18, 0x00,
+  0x01, 0x9D, 0x68, 0xA6, 0x18, 0x00, 0x01, 0x9D, 0x65, 0xAC, 0x18, 0x00, 0x80, 0x9D, 0x9D, 0xF5,
+  0x00, 0x01, 0x8C, 0x79, 0xB7, 0x18, 0x00, 0x80, 0x8C, 0x8C, 0xFA, 0x00, 0x02, 0x88, 0x65, 0xC6,
+  0x18, 0x00, 0x69, 0xD1, 0x18, 0x00, 0x01, 0x88, 0x72, 0xCC, 0x18, 0x00, 0x80, 0x88, 0x88, 0xF8,
+  0x00, 0x01, 0x88, 0x6E, 0xD7, 0x18, 0x00, 0x01, 0x88, 0x67, 0xDD, 0x18, 0x00, 0x80, 0x88, 0x88,
+  0xF9, 0x00, 0x08, 0xB5, 0x77, 0x04, 0x19, 0x00, 0x74, 0x09, 0x19, 0x00, 0x6D, 0x0E, 0x19, 0x00,
+  0x75, 0x19, 0x19, 0x00, 0x6C, 0x3C, 0x19, 0x00, 0x73, 0x47, 0x19, 0x00, 0x70, 0x6A, 0x19, 0x00,
+  0x72, 0x8A, 0x19, 0x00, 0x80, 0xB5, 0xB5, 0x0D, 0x01, 0x80, 0xA9, 0xA9, 0x09, 0x01, 0x01, 0xA7,
+  0x65, 0x14, 0x19, 0x00, 0x80, 0xA7, 0xA7, 0x04, 0x01, 0x02, 0x96, 0x73, 0x23, 0x19, 0x00, 0x72,
+  0x2E, 0x19, 0x00, 0x01, 0x96, 0x65, 0x29, 0x19, 0x00, 0x80, 0x96, 0x96, 0x0C, 0x01, 0x81, 0x8F,
+  0x8F, 0x0A, 0x01, 0x73, 0x37, 0x19, 0x00, 0x80, 0x8E, 0x8E, 0x0B, 0x01, 0x01, 0x95, 0x64, 0x42,
+  0x19, 0x00, 0x80, 0x95, 0x95, 0x03, 0x01, 0x01, 0x95, 0x70, 0x4D, 0x19, 0x00, 0x01, 0x95, 0x69,
+  0x53, 0x19, 0x00, 0x01, 0x95, 0x74, 0x59, 0x19, 0x00, 0x01, 0x95, 0x61, 0x5F, 0x19, 0x00, 0x01,
+  0x95, 0x6C, 0x65, 0x19, 0x00, 0x80, 0x95, 0x95, 0x08, 0x01, 0x02, 0x8F, 0x65, 0x74, 0x19, 0x00,
+  0x69, 0x79, 0x19, 0x00, 0x80, 0x8F, 0x8F, 0x05, 0x01, 0x01, 0x8F, 0x6E, 0x7F, 0x19, 0x00, 0x01,
+  0x8F, 0x67, 0x85, 0x19, 0x00, 0x80, 0x8F, 0x8F, 0x06, 0x01, 0x01, 0x8B, 0x72, 0x90, 0x19, 0x00,
+  0x01, 0x8B, 0x69, 0x96, 0x19, 0x00, 0x01, 0x8B, 0x62, 0x9C, 0x19, 0x00, 0x01, 0x8B, 0x6C, 0xA2,
+  0x19, 0x00, 0x01, 0x8B, 0x65, 0xA8, 0x19, 0x00, 0x80, 0x8B, 0x8B, 0x07, 0x01, 0x03, 0xB1, 0x72,
+  0xBB, 0x19, 0x00, 0x6E, 0xE4, 0x19, 0x00, 0x73, 0xFB, 0x19, 0x00, 0x01, 0xB1, 0x74, 0xC1, 0x19,
+  0x00, 0x82, 0xB1, 0x8A, 0x0F, 0x01, 0x73, 0xCE, 0x19, 0x00, 0x69, 0xD3, 0x19, 0x00, 0x80, 0xB1,
+  0xB1, 0x11, 0x01, 0x01, 0x8A, 0x6E, 0xD9, 0x19, 0x00, 0x01, 0x8A, 0x67, 0xDF, 0x19, 0x00, 0x80,
+  0x8A, 0x8A, 0x10, 0x01, 0x01, 0xA8, 0x67, 0xEA, 0x19, 0x00, 0x01, 0xA8, 0x72, 0xF0, 0x19, 0x00,
+  0x01, 0xA8, 0x79, 0xF6, 0x19, 0x00, 0x80, 0xA8, 0xA8, 0x0E, 0x01, 0x01, 0xA6, 0x62, 0x01, 0x1A,
+  0x00, 0x01, 0xA6, 0x61, 0x07, 0x1A, 0x00, 0x01, 0xA6, 0x6E, 0x0D, 0x1A, 0x00, 0x01, 0xA6, 0x64,
+  0x13, 0x1A, 0x00, 0x80, 0xA6, 0xA6, 0x12, 0x01, 0x82, 0x8F, 0x8F, 0xFE, 0x00, 0x67, 0x25, 0x1A,
+  0x00, 0x70, 0x3F, 0x1A, 0x00, 0x01, 0x8C, 0x68, 0x2B, 0x1A, 0x00, 0x81, 0x8C, 0x8C, 0xFF, 0x00,
+  0x65, 0x34, 0x1A, 0x00, 0x01, 0x88, 0x72, 0x3A, 0x1A, 0x00, 0x80, 0x88, 0x88, 0x00, 0x01, 0x81,
+  0x8C, 0x8C, 0x01, 0x01, 0x73, 0x48, 0x1A, 0x00, 0x80, 0x8C, 0x8C, 0x02, 0x01, 0x07, 0xC7, 0x61,
+  0x6B, 0x1A, 0x00, 0x6F, 0x42, 0x1B, 0x00, 0x6C, 0x5B, 0x1C, 0x00, 0x68, 0xA2, 0x1C, 0x00, 0x75,
+  0x40, 0x1D, 0x00, 0x69, 0x75, 0x1D, 0x00, 0x72, 0x86, 0x1D, 0x00, 0x04, 0xC7, 0x6E, 0x7D, 0x1A,
+  0x00, 0x6C, 0x82, 0x1A, 0x00, 0x72, 0xBA, 0x1A, 0x00, 0x6D, 0x37, 0x1B, 0x00, 0x80, 0xC7, 0xC7,
+  0x66, 0x00, 0x02, 0xB3, 0x6C, 0x8C, 0x1A, 0x00, 0x6D, 0xB5, 0x1A, 0x00, 0x82, 0xB3, 0xB3, 0x61,
+  0x00, 0x65, 0x99, 0x1A, 0x00, 0x69, 0xA4, 0x1A, 0x00, 0x01, 0x94, 0x64, 0x9F, 0x1A, 0x00, 0x80,
+  0x94, 0x94, 0x62, 0x00, 0x01, 0x94, 0x6E, 0xAA, 0x1A, 0x00, 0x01, 0x94, 0x67, 0xB0, 0x1A, 0x00,
+  0x80, 0x94, 0x94, 0x63, 0x00, 0x80, 0x8A, 0x8A, 0x64, 0x00, 0x03, 0x95, 0x72, 0xC8, 0x1A, 0x00,
+  0x65, 0xD3, 0x1A, 0x00, 0x69, 0x26, 0x1B, 0x00, 0x01, 0x95, 0x79, 0xCE, 0x1A, 0x00, 0x80, 0x95,
+  0x95, 0x6D, 0x00, 0x83, 0x8B, 0x8A, 0x67, 0x00, 0x66, 0xE4, 0x1A, 0x00, 0x64, 0x04, 0x1B, 0x00,
+  0x67, 0x09, 0x1B, 0x00, 0x01, 0x8B, 0x75, 0xEA, 0x1A, 0x00, 0x01, 0x8B, 0x6C, 0xF0, 0x1A, 0x00,
+  0x81, 0x8B, 0x8B, 0x69, 0x00, 0x6C, 0xF9, 0x1A, 0x00, 0x01, 0x8B, 0x79, 0xFF, 0x1A, 0x00, 0x80,
+  0x8B, 0x8B, 0x6A, 0x00, 0x80, 0x8A, 0x8A, 0x68, 0x00, 0x01, 0x8A, 0x69, 0x0F, 0x1B, 0x00, 0x01,
+  0x8A, 0x76, 0x15, 0x1B, 0x00, 0x01, 0x8A, 0x65, 0x1B, 0x1B, 0x00, 0x01, 0x8A, 0x72, 0x21, 0x1B,
+  0x00, 0x80, 0x8A, 0x8A, 0x6B, 0x00, 0x01, 0x8A, 0x6E, 0x2C, 0x1B, 0x00, 0x01, 0x8A, 0x67, 0x32,
+  0x1B, 0x00, 0x80, 0x8A, 0x8A, 0x6C, 0x00, 0x01, 0x94, 0x65, 0x3D, 0x1B, 0x00, 0x80, 0x94, 0x94,
+  0x65, 0x00, 0x06, 0xB3, 0x6D, 0x5C, 0x1B, 0x00, 0x6C, 0x9A, 0x1B, 0x00, 0x75, 0xA5, 0x1B, 0x00,
+  0x66, 0xE0, 0x1B, 0x00, 0x6F, 0xF7, 0x1B, 0x00, 0x6E, 0x26, 0x1C, 0x00, 0x02, 0xB3, 0x65, 0x66,
+  0x1B, 0x00, 0x66, 0x6B, 0x1B, 0x00, 0x80, 0xB3, 0xB3, 0x7C, 0x00, 0x01, 0xA4, 0x6F, 0x71, 0x1B,
+  0x00, 0x01, 0xA4, 0x72, 0x77, 0x1B, 0x00, 0x01, 0xA4, 0x74, 0x7D, 0x1B, 0x00, 0x01, 0xA4, 0x61,
+  0x83, 0x1B, 0x00, 0x01, 0xA4, 0x62, 0x89, 0x1B, 0x00, 0x01, 0xA4, 0x6C, 0x8F, 0x1B, 0x00, 0x01,
+  0xA4, 0x65, 0x95, 0x1B, 0x00, 0x80, 0xA4, 0xA4, 0x7D, 0x00, 0x01, 0xA9, 0x64, 0xA0, 0x1B, 0x00,
+  0x80, 0xA9, 0xA9, 0x7B, 0x00, 0x03, 0x9D, 0x67, 0xB3, 0x1B, 0x00, 0x6C, 0xBE, 0x1B, 0x00, 0x6E,
+  0xC9, 0x1B, 0x00, 0x01, 0x9D, 0x68, 0xB9, 0x1B, 0x00, 0x80, 0x9D, 0x9D, 0x82, 0x00, 0x01, 0x93,
+  0x64, 0xC4, 0x1B, 0x00, 0x80, 0x93, 0x93, 0x83, 0x00, 0x01, 0x8D, 0x74, 0xCF, 0x1B, 0x00, 0x01,
+  0x8D, 0x72, 0xD5, 0x1B, 0x00, 0x01, 0x8D, 0x79, 0xDB, 0x1B, 0x00, 0x80, 0x8D, 0x8D, 0x84, 0x00,
+  0x01, 0x9C, 0x66, 0xE6, 0x1B, 0x00, 0x01, 0x9C, 0x65, 0xEC, 0x1B, 0x00, 0x01, 0x9C, 0x65, 0xF2,
+  0x1B, 0x00, 0x80, 0x9C, 0x9C, 0x7A, 0x00, 0x01, 0x8C, 0x6C, 0xFD, 0x1B, 0x00, 0x82, 0x8C, 0x8C,
+  0x7F, 0x00, 0x65, 0x0A, 0x1C, 0x00, 0x69, 0x15, 0x1C, 0x00, 0x01, 0x88, 0x72, 0x10, 0x1C, 0x00,
+  0x80, 0x88, 0x88, 0x80, 0x00, 0x01, 0x88, 0x6E, 0x1B, 0x1C, 0x00, 0x01, 0x88, 0x67, 0x21, 0x1C,
+  0x00, 0x80, 0x88, 0x88, 0x81, 0x00, 0x01, 0x89, 0x73, 0x2C, 0x1C, 0x00, 0x01, 0x89, 0x74, 0x32,
+  0x1C, 0x00, 0x01, 0x89, 0x69, 0x38, 0x1C, 0x00, 0x01, 0x89, 0x70, 0x3E, 0x1C, 0x00, 0x01, 0x89,
+  0x61, 0x44, 0x1C, 0x00, 0x01, 0x89, 0x74, 0x4A, 0x1C, 0x00, 0x01, 0x89, 0x65, 0x50, 0x1C, 0x00,
+  0x01, 0x89, 0x64, 0x56, 0x1C, 0x00, 0x80, 0x89, 0x89, 0x7E, 0x00, 0x02, 0xAB, 0x6F, 0x65, 0x1C,
+  0x00, 0x65, 0x91, 0x1C, 0x00, 0x02, 0xAB, 0x73, 0x6F, 0x1C, 0x00, 0x74, 0x7A, 0x1C, 0x00, 0x01,
+  0xAB, 0x65, 0x75, 0x1C, 0x00, 0x80, 0xAB, 0xAB, 0x78, 0x00, 0x01, 0x9F, 0x68, 0x80, 0x1C, 0x00,
+  0x01, 0x9F, 0x65, 0x86, 0x1C, 0x00, 0x01, 0x9F, 0x73, 0x8C, 0x1C, 0x00, 0x80, 0x9F, 0x9F, 0x79,
+  0x00, 0x01, 0x9E, 0x61, 0x97, 0x1C, 0x00, 0x01, 0x9E, 0x6E, 0x9D, 0x1C, 0x00, 0x80, 0x9E, 0x9E,
+  0x77, 0x00, 0x03, 0xA2, 0x65, 0xB0, 0x1C, 0x00, 0x61, 0xC1, 0x1C, 0x00, 0x69, 0x1A, 0x1D, 0x00,
+  0x01, 0xA2, 0x73, 0xB6, 0x1C, 0x00, 0x01, 0xA2, 0x74, 0xBC, 0x1C, 0x00, 0x80, 0xA2, 0xA2, 0x73,
+  0x00, 0x03, 0x9E, 0x6E, 0xCF, 0x1C, 0x00, 0x69, 0xF5, 0x1C, 0x00, 0x72, 0x00, 0x1D, 0x00, 0x02,
+  0x9E, 0x67, 0xD9, 0x1C, 0x00, 0x6E, 0xE4, 0x1C, 0x00, 0x01, 0x9E, 0x65, 0xDF, 0x1C, 0x00, 0x80,
+  0x9E, 0x9E, 0x6F, 0x00, 0x01, 0x88, 0x65, 0xEA, 0x1C, 0x00, 0x01, 0x88, 0x6C, 0xF0, 0x1C, 0x00,
+  0x80, 0x88, 0x88, 0x70, 0x00, 0x01, 0x95, 0x72, 0xFB, 0x1C, 0x00, 0x80, 0x95, 0x95, 0x6E, 0x00,
+  0x01, 0x88, 0x67, 0x06, 0x1D, 0x00, 0x01, 0x88, 0x65, 0x0C, 0x1D, 0x00, 0x81, 0x88, 0x88, 0x71,
+  0x00, 0x72, 0x15, 0x1D, 0x00, 0x80, 0x88, 0x88, 0x72, 0x00, 0x01, 0x96, 0x6C, 0x20, 0x1D, 0x00,
+  0x01, 0x96, 0x64, 0x26, 0x1D, 0x00, 0x81, 0x96, 0x96, 0x74, 0x00, 0x72, 0x2F, 0x1D, 0x00, 0x01,
+  0x96, 0x65, 0x35, 0x1D, 0x00, 0x01, 0x96, 0x6E, 0x3B, 0x1D, 0x00, 0x80, 0x96, 0x96, 0x75, 0x00,
+  0x02, 0x9A, 0x70, 0x4A, 0x1D, 0x00, 0x72, 0x4F, 0x1D, 0x00, 0x80, 0x9A, 0x9A, 0x87, 0x00, 0x01,
+  0x88, 0x74, 0x55, 0x1D, 0x00, 0x01, 0x88, 0x61, 0x5B, 0x1D, 0x00, 0x01, 0x88, 0x69, 0x61, 0x1D,
+  0x00, 0x01, 0x88, 0x6E, 0x67, 0x1D, 0x00, 0x81, 0x88, 0x88, 0x88, 0x00, 0x73, 0x70, 0x1D, 0x00,
+  0x80, 0x88, 0x88, 0x89, 0x00, 0x01, 0x8D, 0x74, 0x7B, 0x1D, 0x00, 0x01, 0x8D, 0x79, 0x81, 0x1D,
+  0x00, 0x80, 0x8D, 0x8D, 0x76, 0x00, 0x01, 0x8A, 0x61, 0x8C, 0x1D, 0x00, 0x01, 0x8A, 0x6D, 0x92,
+  0x1D, 0x00, 0x01, 0x8A, 0x70, 0x98, 0x1D, 0x00, 0x81, 0x8A, 0x8A, 0x85, 0x00, 0x73, 0xA1, 0x1D,
+  0x00, 0x80, 0x8A, 0x8A, 0x86, 0x00, 0x08, 0xC4, 0x65, 0xC8, 0x1D, 0x00, 0x75, 0x68, 0x1F, 0x00,
+  0x61, 0xA3, 0x1F, 0x00, 0x72, 0x2C, 0x20, 0x00, 0x6F, 0x06, 0x21, 0x00, 0x6C, 0x8F, 0x21, 0x00,
+  0x69, 0x18, 0x22, 0x00, 0x79, 0x32, 0x22, 0x00, 0x8C, 0xC4, 0xC4, 0x30, 0x00, 0x64, 0xFD, 0x1D,
+  0x00, 0x74, 0x17, 0x1E, 0x00, 0x66, 0x49, 0x1E, 0x00, 0x63, 0x60, 0x1E, 0x00, 0x65, 0x7D, 0x1E,
+  0x00, 0x69, 0x88, 0x1E, 0x00, 0x68, 0x99, 0x1E, 0x00, 0x6C, 0xB0, 0x1E, 0x00, 0x6E, 0xEB, 0x1E,
+  0x00, 0x73, 0x08, 0x1F, 0x00, 0x79, 0x28, 0x1F, 0x00, 0x61, 0x3F, 0x1F, 0x00, 0x81, 0xB1, 0xB1,
+  0x33, 0x00, 0x70, 0x06, 0x1E, 0x00, 0x01, 0x9C, 0x61, 0x0C, 0x1E, 0x00, 0x01, 0x9C, 0x6E, 0x12,
+  0x1E, 0x00, 0x80, 0x9C, 0x9C, 0x34, 0x00, 0x02, 0xA8, 0x74, 0x21, 0x1E, 0x00, 0x77, 0x32, 0x1E,
+  0x00, 0x01, 0xA8, 0x65, 0x27, 0x1E, 0x00, 0x01, 0xA8, 0x72, 0x2D, 0x1E, 0x00, 0x80, 0xA8, 0xA8,
+  0x3F, 0x00, 0x01, 0x92, 0x65, 0x38, 0x1E, 0x00, 0x01, 0x92, 0x65, 0x3E, 0x1E, 0x00, 0x01, 0x92,
+  0x6E, 0x44, 0x1E, 0x00, 0x80, 0x92, 0x92, 0x40, 0x00, 0x01, 0x99, 0x6F, 0x4F, 0x1E, 0x00, 0x01,
+  0x99, 0x72, 0x55, 0x1E, 0x00, 0x01, 0x99, 0x65, 0x5B, 0x1E, 0x00, 0x80, 0x99, 0x99, 0x36, 0x00,
+  0x01, 0x98, 0x61, 0x66, 0x1E, 0x00, 0x01, 0x98, 0x75, 0x6C, 0x1E, 0x00, 0x01, 0x98, 0x73, 0x72,
+  0x1E, 0x00, 0x01, 0x98, 0x65, 0x78, 0x1E, 0x00, 0x80, 0x98, 0x98, 0x32, 0x00, 0x01, 0x93, 0x6E,
+  0x83, 0x1E, 0x00, 0x80, 0x93, 0x93, 0x35, 0x00, 0x01, 0x93, 0x6E, 0x8E, 0x1E, 0x00, 0x01, 0x93,
+  0x67, 0x94, 0x1E, 0x00, 0x80, 0x93, 0x93, 0x38, 0x00, 0x01, 0x92, 0x69, 0x9F, 0x1E, 0x00, 0x01,
+  0x92, 0x6E, 0xA5, 0x1E, 0x00, 0x01, 0x92, 0x64, 0xAB, 0x1E, 0x00, 0x80, 0x92, 0x92, 0x37, 0x00,
+  0x03, 0x92, 0x6F, 0xBE, 0x1E, 0x00, 0x69, 0xC9, 0x1E, 0x00, 0x6C, 0xE0, 0x1E, 0x00, 0x01, 0x92,
+  0x77, 0xC4, 0x1E, 0x00, 0x80, 0x92, 0x92, 0x3B, 0x00, 0x01, 0x91, 0x65, 0xCF, 0x1E, 0x00, 0x01,
+  0x91, 0x76, 0xD5, 0x1E, 0x00, 0x01, 0x91, 0x65, 0xDB, 0x1E, 0x00, 0x80, 0x91, 0x91, 0x39, 0x00,
+  0x01, 0x8C, 0x79, 0xE6, 0x1E, 0x00, 0x80, 0x8C, 0x8C, 0x3A, 0x00, 0x01, 0x92, 0x65, 0xF1, 0x1E,
+  0x00, 0x01, 0x92, 0x61, 0xF7, 0x1E, 0x00, 0x01, 0x92, 0x74, 0xFD, 0x1E, 0x00, 0x01, 0x92, 0x68,
+  0x03, 0x1F, 0x00, 0x80, 0x92, 0x92, 0x3C, 0x00, 0x02, 0x92, 0x69, 0x12, 0x1F, 0x00, 0x74, 0x23,
+  0x1F, 0x00, 0x01, 0x92, 0x64, 0x18, 0x1F, 0x00, 0x01, 0x92, 0x65, 0x1E, 0x1F, 0x00, 0x80, 0x92,
+  0x92, 0x3D, 0x00, 0x80, 0x8B, 0x8B, 0x3E, 0x00, 0x01, 0x92, 0x6F, 0x2E, 0x1F, 0x00, 0x01, 0x92,
+  0x6E, 0x34, 0x1F, 0x00, 0x01, 0x92, 0x64, 0x3A, 0x1F, 0x00, 0x80, 0x92, 0x92, 0x41, 0x00, 0x01,
+  0x8B, 0x75, 0x45, 0x1F, 0x00, 0x01, 0x8B, 0x74, 0x4B, 0x1F, 0x00, 0x01, 0x8B, 0x69, 0x51, 0x1F,
+  0x00, 0x01, 0x8B, 0x66, 0x57, 0x1F, 0x00, 0x01, 0x8B, 0x75, 0x5D, 0x1F, 0x00, 0x01, 0x8B, 0x6C,
+  0x63, 0x1F, 0x00, 0x80, 0x8B, 0x8B, 0x31, 0x00, 0x03, 0xB7, 0x74, 0x76, 0x1F, 0x00, 0x73, 0x7B,
+  0x1F, 0x00, 0x72, 0x86, 0x1F, 0x00, 0x80, 0xB7, 0xB7, 0x5E, 0x00, 0x01, 0x8C, 0x79, 0x81, 0x1F,
+  0x00, 0x80, 0x8C, 0x8C, 0x5D, 0x00, 0x01, 0x8A, 0x6E, 0x8C, 0x1F, 0x00, 0x01, 0x8A, 0x69, 0x92,
+  0x1F, 0x00, 0x01, 0x8A, 0x6E, 0x98, 0x1F, 0x00, 0x01, 0x8A, 0x67, 0x9E, 0x1F, 0x00, 0x80, 0x8A,
+  0x8A, 0x5C, 0x00, 0x05, 0xB3, 0x63, 0xB9, 0x1F, 0x00, 0x64, 0xC4, 0x1F, 0x00, 0x74, 0xC9, 0x1F,
+  0x00, 0x6E, 0x0A, 0x20, 0x00, 0x62, 0x21, 0x20, 0x00, 0x01, 0xB3, 0x6B, 0xBF, 0x1F, 0x00, 0x80,
+  0xB3, 0xB3, 0x2A, 0x00, 0x80, 0xA7, 0xA7, 0x2B, 0x00, 0x02, 0x9F, 0x68, 0xD3, 0x1F, 0x00, 0x74,
+  0xF3, 0x1F, 0x00, 0x81, 0x9F, 0x9F, 0x2D, 0x00, 0x72, 0xDC, 0x1F, 0x00, 0x01, 0x9D, 0x6F, 0xE2,
+  0x1F, 0x00, 0x01, 0x9D, 0x6F, 0xE8, 0x1F, 0x00, 0x01, 0x9D, 0x6D, 0xEE, 0x1F, 0x00, 0x80, 0x9D,
+  0x9D, 0x2E, 0x00, 0x01, 0x88, 0x65, 0xF9, 0x1F, 0x00, 0x01, 0x88, 0x72, 0xFF, 0x1F, 0x00, 0x01,
+  0x88, 0x79, 0x05, 0x20, 0x00, 0x80, 0x88, 0x88, 0x2F, 0x00, 0x01, 0x9B, 0x61, 0x10, 0x20, 0x00,
+  0x01, 0x9B, 0x6E, 0x16, 0x20, 0x00, 0x01, 0x9B, 0x61, 0x1C, 0x20, 0x00, 0x80, 0x9B, 0x9B, 0x2C,
+  0x00, 0x01, 0x96, 0x79, 0x27, 0x20, 0x00, 0x80, 0x96, 0x96, 0x29, 0x00, 0x04, 0xA5, 0x6F, 0x3E,
+  0x20, 0x00, 0x65, 0x70, 0x20, 0x00, 0x69, 0xCF, 0x20, 0x00, 0x61, 0xF5, 0x20, 0x00, 0x02, 0xA5,
+  0x74, 0x48, 0x20, 0x00, 0x6B, 0x5F, 0x20, 0x00, 0x01, 0xA5, 0x68, 0x4E, 0x20, 0x00, 0x01, 0xA5,
+  0x65, 0x54, 0x20, 0x00, 0x01, 0xA5, 0x72, 0x5A, 0x20, 0x00, 0x80, 0xA5, 0xA5, 0x5B, 0x00, 0x01,
+  0x88, 0x65, 0x65, 0x20, 0x00, 0x01, 0x88, 0x6E, 0x6B, 0x20, 0x00, 0x80, 0x88, 0x88, 0x5A, 0x00,
+  0x01, 0xA1, 0x61, 0x76, 0x20, 0x00, 0x03, 0xA1, 0x74, 0x84, 0x20, 0x00, 0x64, 0xAD, 0x20, 0x00,
+  0x6B, 0xB2, 0x20, 0x00, 0x01, 0xA1, 0x68, 0x8A, 0x20, 0x00, 0x82, 0xA1, 0x89, 0x55, 0x00, 0x65,
+  0x97, 0x20, 0x00, 0x69, 0x9C, 0x20, 0x00, 0x80, 0xA1, 0xA1, 0x56, 0x00, 0x01, 0xA1, 0x6E, 0xA2,
+  0x20, 0x00, 0x01, 0xA1, 0x67, 0xA8, 0x20, 0x00, 0x80, 0xA1, 0xA1, 0x57, 0x00, 0x80, 0x9B, 0x9B,
+  0x53, 0x00, 0x01, 0x9B, 0x66, 0xB8, 0x20, 0x00, 0x01, 0x9B, 0x61, 0xBE, 0x20, 0x00, 0x01, 0x9B,
+  0x73, 0xC4, 0x20, 0x00, 0x01, 0x9B, 0x74, 0xCA, 0x20, 0x00, 0x80, 0x9B, 0x9B, 0x54, 0x00, 0x02,
+  0x95, 0x6E, 0xD9, 0x20, 0x00, 0x67, 0xE4, 0x20, 0x00, 0x01, 0x95, 0x67, 0xDF, 0x20, 0x00, 0x80,
+  0x95, 0x95, 0x59, 0x00, 0x01, 0x8C, 0x68, 0xEA, 0x20, 0x00, 0x01, 0x8C, 0x74, 0xF0, 0x20, 0x00,
+  0x80, 0x8C, 0x8C, 0x58, 0x00, 0x01, 0x8D, 0x69, 0xFB, 0x20, 0x00, 0x01, 0x8D, 0x6E, 0x01, 0x21,
+  0x00, 0x80, 0x8D, 0x8D, 0x52, 0x00, 0x06, 0xA4, 0x72, 0x20, 0x21, 0x00, 0x6F, 0x31, 0x21, 0x00,
+  0x74, 0x3C, 0x21, 0x00, 0x79, 0x6B, 0x21, 0x00, 0x64, 0x70, 0x21, 0x00, 0x6E, 0x7B, 0x21, 0x00,
+  0x01, 0xA4, 0x65, 0x26, 0x21, 0x00, 0x01, 0xA4, 0x64, 0x2C, 0x21, 0x00, 0x80, 0xA4, 0xA4, 0x4D,
+  0x00, 0x01, 0xA0, 0x6B, 0x37, 0x21, 0x00, 0x80, 0xA0, 0xA0, 0x4C, 0x00, 0x02, 0x9C, 0x74, 0x46,
+  0x21, 0x00, 0x68, 0x66, 0x21, 0x00, 0x02, 0x9C, 0x6C, 0x50, 0x21, 0x00, 0x6F, 0x5B, 0x21, 0x00,
+  0x01, 0x9C, 0x65, 0x56, 0x21, 0x00, 0x80, 0x9C, 0x9C, 0x4F, 0x00, 0x01, 0x8C, 0x6D, 0x61, 0x21,
+  0x00, 0x80, 0x8C, 0x8C, 0x50, 0x00, 0x80, 0x92, 0x92, 0x4E, 0x00, 0x80, 0x96, 0x96, 0x51, 0x00,
+  0x01, 0x8D, 0x79, 0x76, 0x21, 0x00, 0x80, 0x8D, 0x8D, 0x49, 0x00, 0x01, 0x8D, 0x65, 0x81, 0x21,
+  0x00, 0x81, 0x8D, 0x8D, 0x4A, 0x00, 0x73, 0x8A, 0x21, 0x00, 0x80, 0x8D, 0x8D, 0x4B, 0x00, 0x04,
+  0x9F, 0x61, 0xA1, 0x21, 0x00, 0x65, 0xBE, 0x21, 0x00, 0x6F, 0xF0, 0x21, 0x00, 0x69, 0x01, 0x22,
+  0x00, 0x01, 0x9F, 0x6E, 0xA7, 0x21, 0x00, 0x01, 0x9F, 0x6B, 0xAD, 0x21, 0x00, 0x01, 0x9F, 0x65,
+  0xB3, 0x21, 0x00, 0x01, 0x9F, 0x74, 0xB9, 0x21, 0x00, 0x80, 0x9F, 0x9F, 0x44, 0x00, 0x02, 0x9D,
+  0x65, 0xC8, 0x21, 0x00, 0x73, 0xE5, 0x21, 0x00, 0x01, 0x9D, 0x64, 0xCE, 0x21, 0x00, 0x01, 0x9D,
+  0x69, 0xD4, 0x21, 0x00, 0x01, 0x9D, 0x6E, 0xDA, 0x21, 0x00, 0x01, 0x9D, 0x67, 0xE0, 0x21, 0x00,
+  0x80, 0x9D, 0x9D, 0x45, 0x00, 0x01, 0x8F, 0x73, 0xEB, 0x21, 0x00, 0x80, 0x8F, 0x8F, 0x46, 0x00,
+  0x01, 0x8D, 0x6F, 0xF6, 0x21, 0x00, 0x01, 0x8D, 0x64, 0xFC, 0x21, 0x00, 0x80, 0x8D, 0x8D, 0x48,
+  0x00, 0x01, 0x88, 0x6E, 0x07, 0x22, 0x00, 0x01, 0x88, 0x64, 0x0D, 0x22, 0x00, 0x01, 0x88, 0x73,
+  0x13, 0x22, 0x00, 0x80, 0x88, 0x88, 0x47, 0x00, 0x02, 0x9A, 0x67, 0x22, 0x22, 0x00, 0x6C, 0x27,
+  0x22, 0x00, 0x80, 0x9A, 0x9A, 0x42, 0x00, 0x01, 0x89, 0x6C, 0x2D, 0x22, 0x00, 0x80, 0x89, 0x89,
+  0x43, 0x00, 0x81, 0x92, 0x92, 0x5F, 0x00, 0x65, 0x3B, 0x22, 0x00, 0x80, 0x8F, 0x8F, 0x60, 0x00,
+  0x06, 0xC1, 0x6F, 0x5A, 0x22, 0x00, 0x65, 0xB6, 0x22, 0x00, 0x61, 0xEE, 0x22, 0x00, 0x69, 0x7D,
+  0x23, 0x00, 0x72, 0xF4, 0x23, 0x00, 0x75, 0x68, 0x24, 0x00, 0x03, 0xC1, 0x72, 0x68, 0x22, 0x00,
+  0x6F, 0x91, 0x22, 0x00, 0x75, 0xA5, 0x22, 0x00, 0x81, 0xC1, 0xC1, 0xD0, 0x00, 0x67, 0x71, 0x22,
+  0x00, 0x02, 0x91, 0x65, 0x7B, 0x22, 0x00, 0x6F, 0x86, 0x22, 0x00, 0x01, 0x91, 0x74, 0x81, 0x22,
+  0x00, 0x80, 0x91, 0x91, 0xD1, 0x00, 0x01, 0x91, 0x74, 0x8C, 0x22, 0x00, 0x80, 0x91, 0x91, 0xD2,
+  0x00, 0x02, 0xB0, 0x64, 0x9B, 0x22, 0x00, 0x74, 0xA0, 0x22, 0x00, 0x80, 0xB0, 0xB0, 0xCE, 0x00,
+  0x80, 0xA2, 0xA2, 0xCF, 0x00, 0x01, 0x90, 0x6E, 0xAB, 0x22, 0x00, 0x01, 0x90, 0x64, 0xB1, 0x22,
+  0x00, 0x80, 0x90, 0x90, 0xD3, 0x00, 0x03, 0xBC, 0x65, 0xC4, 0x22, 0x00, 0x76, 0xD8, 0x22, 0x00,
+  0x77, 0xE9, 0x22, 0x00, 0x02, 0xBC, 0x6C, 0xCE, 0x22, 0x00, 0x74, 0xD3, 0x22, 0x00, 0x80, 0xBC,
+  0xBC, 0xC3, 0x00, 0x80, 0x8D, 0x8D, 0xC4, 0x00, 0x01, 0x9D, 0x65, 0xDE, 0x22, 0x00, 0x01, 0x9D,
+  0x72, 0xE4, 0x22, 0x00, 0x80, 0x9D, 0x9D, 0xC5, 0x00, 0x80, 0x93, 0x93, 0xC6, 0x00, 0x06, 0xA7,
+  0x6D, 0x08, 0x23, 0x00, 0x74, 0x1F, 0x23, 0x00, 0x6E, 0x36, 0x23, 0x00, 0x73, 0x3B, 0x23, 0x00,
+  0x63, 0x46, 0x23, 0x00, 0x6C, 0x6C, 0x23, 0x00, 0x01, 0xA7, 0x69, 0x0E, 0x23, 0x00, 0x01, 0xA7,
+  0x6C, 0x14, 0x23, 0x00, 0x01, 0xA7, 0x79, 0x1A, 0x23, 0x00, 0x80, 0xA7, 0xA7, 0xBF, 0x00, 0x01,
+  0xA6, 0x68, 0x25, 0x23, 0x00, 0x01, 0xA6, 0x65, 0x2B, 0x23, 0x00, 0x01, 0xA6, 0x72, 0x31, 0x23,
+  0x00, 0x80, 0xA6, 0xA6, 0xC2, 0x00, 0x80, 0xA1, 0xA1, 0xC0, 0x00, 0x01, 0x99, 0x74, 0x41, 0x23,
+  0x00, 0x80, 0x99, 0x99, 0xC1, 0x00, 0x01, 0x8D, 0x65, 0x4C, 0x23, 0x00, 0x81, 0x8D, 0x8D, 0xBC,
+  0x00, 0x74, 0x55, 0x23, 0x00, 0x01, 0x87, 0x69, 0x5B, 0x23, 0x00, 0x01, 0x87, 0x6D, 0x61, 0x23,
+  0x00, 0x01, 0x87, 0x65, 0x67, 0x23, 0x00, 0x80, 0x87, 0x87, 0xBD, 0x00, 0x01, 0x8B, 0x73, 0x72,
+  0x23, 0x00, 0x01, 0x8B, 0x65, 0x78, 0x23, 0x00, 0x80, 0x8B, 0x8B, 0xBE, 0x00, 0x03, 0xA7, 0x6E,
+  0x8B, 0x23, 0x00, 0x72, 0xDE, 0x23, 0x00, 0x78, 0xEF, 0x23, 0x00, 0x04, 0xA7, 0x65, 0x9D, 0x23,
+  0x00, 0x64, 0xA2, 0x23, 0x00, 0x69, 0xA7, 0x23, 0x00, 0x67, 0xC7, 0x23, 0x00, 0x80, 0xA7, 0xA7,
+  0xC8, 0x00, 0x80, 0x90, 0x90, 0xC7, 0x00, 0x01, 0x90, 0x73, 0xAD, 0x23, 0x00, 0x01, 0x90, 0x68,
+  0xB3, 0x23, 0x00, 0x81, 0x90, 0x90, 0xCA, 0x00, 0x65, 0xBC, 0x23, 0x00, 0x01, 0x90, 0x64, 0xC2,
+  0x23, 0x00, 0x80, 0x90, 0x90, 0xCB, 0x00, 0x01, 0x8D, 0x65, 0xCD, 0x23, 0x00, 0x01, 0x8D, 0x72,
+  0xD3, 0x23, 0x00, 0x01, 0x8D, 0x73, 0xD9, 0x23, 0x00, 0x80, 0x8D, 0x8D, 0xC9, 0x00, 0x01, 0x8E,
+  0x73, 0xE4, 0x23, 0x00, 0x01, 0x8E, 0x74, 0xEA, 0x23, 0x00, 0x80, 0x8E, 0x8E, 0xCC, 0x00, 0x80,
+  0x88, 0x88, 0xCD, 0x00, 0x04, 0xA5, 0x69, 0x06, 0x24, 0x00, 0x75, 0x32, 0x24, 0x00, 0x6F, 0x43,
+  0x24, 0x00, 0x65, 0x5D, 0x24, 0x00, 0x02, 0xA5, 0x65, 0x10, 0x24, 0x00, 0x64, 0x21, 0x24, 0x00,
+  0x01, 0xA5, 0x6E, 0x16, 0x24, 0x00, 0x01, 0xA5, 0x64, 0x1C, 0x24, 0x00, 0x80, 0xA5, 0xA5, 0xD6,
+  0x00, 0x01, 0x8E, 0x61, 0x27, 0x24, 0x00, 0x01, 0x8E, 0x79, 0x2D, 0x24, 0x00, 0x80, 0x8E, 0x8E,
+  0xD5, 0x00, 0x01, 0x9B, 0x69, 0x38, 0x24, 0x00, 0x01, 0x9B, 0x74, 0x3E, 0x24, 0x00, 0x80, 0x9B,
+  0x9B, 0xD9, 0x00, 0x02, 0x92, 0x6D, 0x4D, 0x24, 0x00, 0x6E, 0x52, 0x24, 0x00, 0x80, 0x92, 0x92,
+  0xD7, 0x00, 0x01, 0x8C, 0x74, 0x58, 0x24, 0x00, 0x80, 0x8C, 0x8C, 0xD8, 0x00, 0x01, 0x8C, 0x65,
+  0x63, 0x24, 0x00, 0x80, 0x8C, 0x8C, 0xD4, 0x00, 0x01, 0x8C, 0x6C, 0x6E, 0x24, 0x00, 0x01, 0x8C,
+  0x6C, 0x74, 0x24, 0x00, 0x80, 0x8C, 0x8C, 0xDA, 0x00, 0x06, 0xC0, 0x65, 0x93, 0x24, 0x00, 0x6F,
+  0xC2, 0x24, 0x00, 0x69, 0x18, 0x25, 0x00, 0x6C, 0x38, 0x25, 0x00, 0x61, 0x5B, 0x25, 0x00, 0x72,
+  0x87, 0x25, 0x00, 0x02, 0xC0, 0x74, 0x9D, 0x24, 0x00, 0x6E, 0xA2, 0x24, 0x00, 0x80, 0xC0, 0xC0,
+  0xDF, 0x00, 0x01, 0x8B, 0x74, 0xA8, 0x24, 0x00, 0x01, 0x8B, 0x6C, 0xAE, 0x24, 0x00, 0x02, 0x8B,
+  0x65, 0xB8, 0x24, 0x00, 0x79, 0xBD, 0x24, 0x00, 0x80, 0x8B, 0x8B, 0xDD, 0x00, 0x80, 0x8B, 0x8B,
+  0xDE, 0x00, 0x84, 0xBA, 0xBA, 0xE3, 0x00, 0x6F, 0xD7, 0x24, 0x00, 0x69, 0xF7, 0x24, 0x00, 0x6E,
+  0x08, 0x25, 0x00, 0x64, 0x13, 0x25, 0x00, 0x01, 0xB2, 0x64, 0xDD, 0x24, 0x00, 0x81, 0xB2, 0xB2,
+  0xE7, 0x00, 0x62, 0xE6, 0x24, 0x00, 0x01, 0x8F, 0x79, 0xEC, 0x24, 0x00, 0x01, 0x8F, 0x65, 0xF2,
+  0x24, 0x00, 0x80, 0x8F, 0x8F, 0xE8, 0x00, 0x01, 0x94, 0x6E, 0xFD, 0x24, 0x00, 0x01, 0x94, 0x67,
+  0x03, 0x25, 0x00, 0x80, 0x94, 0x94, 0xE5, 0x00, 0x01, 0x94, 0x65, 0x0E, 0x25, 0x00, 0x80, 0x94,
+  0x94, 0xE6, 0x00, 0x80, 0x8F, 0x8F, 0xE4, 0x00, 0x02, 0xAC, 0x76, 0x22, 0x25, 0x00, 0x72, 0x2D,
+  0x25, 0x00, 0x01, 0xAC, 0x65, 0x28, 0x25, 0x00, 0x80, 0xAC, 0xAC, 0xE1, 0x00, 0x01, 0x96, 0x6C,
+  0x33, 0x25, 0x00, 0x80, 0x96, 0x96, 0xE0, 0x00, 0x01, 0x9F, 0x61, 0x3E, 0x25, 0x00, 0x01, 0x9F,
+  0x73, 0x44, 0x25, 0x00, 0x01, 0x9F, 0x73, 0x4A, 0x25, 0x00, 0x01, 0x9F, 0x65, 0x50, 0x25, 0x00,
+  0x01, 0x9F, 0x73, 0x56, 0x25, 0x00, 0x80, 0x9F, 0x9F, 0xE2, 0x00, 0x02, 0x8E, 0x6D, 0x65, 0x25,
+  0x00, 0x72, 0x70, 0x25, 0x00, 0x01, 0x8E, 0x65, 0x6B, 0x25, 0x00, 0x80, 0x8E, 0x8E, 0xDB, 0x00,
+  0x01, 0x88, 0x64, 0x76, 0x25, 0x00, 0x01, 0x88, 0x65, 0x7C, 0x25, 0x00, 0x01, 0x88, 0x6E, 0x82,
+  0x25, 0x00, 0x80, 0x88, 0x88, 0xDC, 0x00, 0x01, 0x8B, 0x65, 0x8D, 0x25, 0x00, 0x01, 0x8B, 0x61,
+  0x93, 0x25, 0x00, 0x01, 0x8B, 0x74, 0x99, 0x25, 0x00, 0x80, 0x8B, 0x8B, 0xE9, 0x00, 0x02, 0xBB,
+  0x75, 0xA8, 0x25, 0x00, 0x6F, 0xCE, 0x25, 0x00, 0x02, 0xBB, 0x73, 0xB2, 0x25, 0x00, 0x69, 0xBD,
+  0x25, 0x00, 0x01, 0xBB, 0x74, 0xB8, 0x25, 0x00, 0x80, 0xBB, 0xBB, 0x24, 0x01, 0x01, 0x9C, 0x63,
+  0xC3, 0x25, 0x00, 0x01, 0x9C, 0x65, 0xC9, 0x25, 0x00, 0x80, 0x9C, 0x9C, 0x23, 0x01, 0x01, 0x96,
+  0x62, 0xD4, 0x25, 0x00, 0x80, 0x96, 0x96, 0x22, 0x01, 0x03, 0xBA, 0x6E, 0xE7, 0x25, 0x00, 0x65,
+  0x10, 0x26, 0x00, 0x69, 0x30, 0x26, 0x00, 0x02, 0xBA, 0x6F, 0xF1, 0x25, 0x00, 0x65, 0xFC, 0x25,
+  0x00, 0x01, 0xBA, 0x77, 0xF7, 0x25, 0x00, 0x80, 0xBA, 0xBA, 0x2A, 0x01, 0x01, 0x8C, 0x65, 0x02,
+  0x26, 0x00, 0x81, 0x8C, 0x8C, 0x28, 0x01, 0x73, 0x0B, 0x26, 0x00, 0x80, 0x8C, 0x8C, 0x29, 0x01,
+  0x02, 0x90, 0x65, 0x1A, 0x26, 0x00, 0x70, 0x25, 0x26, 0x00, 0x01, 0x90, 0x70, 0x20, 0x26, 0x00,
+  0x80, 0x90, 0x90, 0x25, 0x01, 0x01, 0x90, 0x74, 0x2B, 0x26, 0x00, 0x80, 0x90, 0x90, 0x26, 0x01,
+  0x01, 0x8B, 0x6E, 0x36, 0x26, 0x00, 0x01, 0x8B, 0x64, 0x3C, 0x26, 0x00, 0x80, 0x8B, 0x8B, 0x27,
+  0x01, 0x0E, 0xBA, 0x6F, 0x7B, 0x26, 0x00, 0x68, 0x34, 0x27, 0x00, 0x65, 0x05, 0x28, 0x00, 0x74,
+  0x3A, 0x28, 0x00, 0x6C, 0x20, 0x29, 0x00, 0x69, 0x79, 0x29, 0x00, 0x61, 0xC6, 0x29, 0x00, 0x63,
+  0x2E, 0x2A, 0x00, 0x6B, 0x54, 0x2A, 0x00, 0x75, 0x65, 0x2A, 0x00, 0x6E, 0xE5, 0x2A, 0x00, 0x6D,
+  0xFC, 0x2A, 0x00, 0x70, 0x13, 0x2B, 0x00, 0x77, 0x54, 0x2B, 0x00, 0x86, 0xBA, 0xBA, 0xF3, 0x01,
+  0x6D, 0x98, 0x26, 0x00, 0x72, 0xF4, 0x26, 0x00, 0x6E, 0x0E, 0x27, 0x00, 0x75, 0x13, 0x27, 0x00,
+  0x6F, 0x1E, 0x27, 0x00, 0x66, 0x29, 0x27, 0x00, 0x01, 0xB3, 0x65, 0x9E, 0x26, 0x00, 0x82, 0xB3,
+  0xB3, 0xF5, 0x01, 0x74, 0xAB, 0x26, 0x00, 0x6F, 0xE3, 0x26, 0x00, 0x02, 0x98, 0x69, 0xB5, 0x26,
+  0x00, 0x68, 0xCC, 0x26, 0x00, 0x01, 0x98, 0x6D, 0xBB, 0x26, 0x00, 0x01, 0x98, 0x65, 0xC1, 0x26,
+  0x00, 0x01, 0x98, 0x73, 0xC7, 0x26, 0x00, 0x80, 0x98, 0x98, 0xF8, 0x01, 0x01, 0x97, 0x69, 0xD2,
+  0x26, 0x00, 0x01, 0x97, 0x6E, 0xD8, 0x26, 0x00, 0x01, 0x97, 0x67, 0xDE, 0x26, 0x00, 0x80, 0x97,
+  0x97, 0xF7, 0x01, 0x01, 0x97, 0x6E, 0xE9, 0x26, 0x00, 0x01, 0x97, 0x65, 0xEF, 0x26, 0x00, 0x80,
+  0x97, 0x97, 0xF6, 0x01, 0x02, 0xAE, 0x72, 0xFE, 0x26, 0x00, 0x65, 0x09, 0x27, 0x00, 0x01, 0xAE,
+  0x79, 0x04, 0x27, 0x00, 0x80, 0xAE, 0xAE, 0xFC, 0x01, 0x80, 0x8A, 0x8A, 0xFB, 0x01, 0x80, 0xA6,
+  0xA6, 0xF9, 0x01, 0x01, 0x9C, 0x70, 0x19, 0x27, 0x00, 0x80, 0x9C, 0x9C, 0xFD, 0x01, 0x01, 0x99,
+  0x6E, 0x24, 0x27, 0x00, 0x80, 0x99, 0x99, 0xFA, 0x01, 0x01, 0x8C, 0x74, 0x2F, 0x27, 0x00, 0x80,
+  0x8C, 0x8C, 0xF4, 0x01, 0x04, 0xB8, 0x65, 0x46, 0x27, 0x00, 0x69, 0x5A, 0x27, 0x00, 0x6F, 0x6B,
+  0x27, 0x00, 0x61, 0xCA, 0x27, 0x00, 0x81, 0xB8, 0xB8, 0xDC, 0x01, 0x65, 0x4F, 0x27, 0x00, 0x01,
+  0x9F, 0x74, 0x55, 0x27, 0x00, 0x80, 0x9F, 0x9F, 0xDD, 0x01, 0x01, 0x9F, 0x72, 0x60, 0x27, 0x00,
+  0x01, 0x9F, 0x74, 0x66, 0x27, 0x00, 0x80, 0x9F, 0x9F, 0xDE, 0x01, 0x03, 0x9F, 0x77, 0x79, 0x27,
+  0x00, 0x72, 0x96, 0x27, 0x00, 0x75, 0xA1, 0x27, 0x00, 0x81, 0x9F, 0x90, 0xE3, 0x01, 0x65, 0x82,
+  0x27, 0x00, 0x02, 0x9F, 0x72, 0x8C, 0x27, 0x00, 0x64, 0x91, 0x27, 0x00, 0x80, 0x9F, 0x9F, 0xE5,
+  0x01, 0x80, 0x90, 0x90, 0xE4, 0x01, 0x01, 0x99, 0x74, 0x9C, 0x27, 0x00, 0x80, 0x99, 0x99, 0xDF,
+  0x01, 0x01, 0x93, 0x6C, 0xA7, 0x27, 0x00, 0x01, 0x93, 0x64, 0xAD, 0x27, 0x00, 0x81, 0x93, 0x93,
+  0xE0, 0x01, 0x65, 0xB6, 0x27, 0x00, 0x01, 0x8C, 0x72, 0xBC, 0x27, 0x00, 0x81, 0x8C, 0x8C, 0xE1,
+  0x01, 0x73, 0xC5, 0x27, 0x00, 0x80, 0x8C, 0x8C, 0xE2, 0x01, 0x03, 0x93, 0x6C, 0xD8, 0x27, 0x00,
+  0x72, 0xE3, 0x27, 0x00, 0x6B, 0xEE, 0x27, 0x00, 0x01, 0x93, 0x6C, 0xDE, 0x27, 0x00, 0x80, 0x93,
+  0x93, 0xDA, 0x01, 0x01, 0x8A, 0x70, 0xE9, 0x27, 0x00, 0x80, 0x8A, 0x8A, 0xDB, 0x01, 0x01, 0x89,
+  0x69, 0xF4, 0x27, 0x00, 0x01, 0x89, 0x6E, 0xFA, 0x27, 0x00, 0x01, 0x89, 0x67, 0x00, 0x28, 0x00,
+  0x80, 0x89, 0x89, 0xD9, 0x01, 0x03, 0xAC, 0x65, 0x13, 0x28, 0x00, 0x6E, 0x18, 0x28, 0x00, 0x63,
+  0x23, 0x28, 0x00, 0x80, 0xAC, 0xAC, 0xD7, 0x01, 0x01, 0x95, 0x64, 0x1E, 0x28, 0x00, 0x80, 0x95,
+  0x95, 0xD8, 0x01, 0x01, 0x8E, 0x6F, 0x29, 0x28, 0x00, 0x01, 0x8E, 0x6E, 0x2F, 0x28, 0x00, 0x01,
+  0x8E, 0x64, 0x35, 0x28, 0x00, 0x80, 0x8E, 0x8E, 0xD6, 0x01, 0x04, 0xAB, 0x6F, 0x4C, 0x28, 0x00,
+  0x72, 0x81, 0x28, 0x00, 0x69, 0xC2, 0x28, 0x00, 0x61, 0xE2, 0x28, 0x00, 0x03, 0xAB, 0x70, 0x5A,
+  0x28, 0x00, 0x6D, 0x5F, 0x28, 0x00, 0x72, 0x76, 0x28, 0x00, 0x80, 0xAB, 0xAB, 0x08, 0x02, 0x01,
+  0xA2, 0x61, 0x65, 0x28, 0x00, 0x01, 0xA2, 0x63, 0x6B, 0x28, 0x00, 0x01, 0xA2, 0x68, 0x71, 0x28,
+  0x00, 0x80, 0xA2, 0xA2, 0x07, 0x02, 0x01, 0x8E, 0x79, 0x7C, 0x28, 0x00, 0x80, 0x8E, 0x8E, 0x09,
+  0x02, 0x03, 0x9A, 0x61, 0x8F, 0x28, 0x00, 0x6F, 0x9A, 0x28, 0x00, 0x65, 0xAB, 0x28, 0x00, 0x01,
+  0x9A, 0x77, 0x95, 0x28, 0x00, 0x80, 0x9A, 0x9A, 0x0A, 0x02, 0x01, 0x8A, 0x6E, 0xA0, 0x28, 0x00,
+  0x01, 0x8A, 0x67, 0xA6, 0x28, 0x00, 0x80, 0x8A, 0x8A, 0x0C, 0x02, 0x01, 0x88, 0x74, 0xB1, 0x28,
+  0x00, 0x01, 0x88, 0x63, 0xB7, 0x28, 0x00, 0x01, 0x88, 0x68, 0xBD, 0x28, 0x00, 0x80, 0x88, 0x88,
+  0x0B, 0x02, 0x02, 0x98, 0x6C, 0xCC, 0x28, 0x00, 0x66, 0xD7, 0x28, 0x00, 0x01, 0x98, 0x6C, 0xD2,
+  0x28, 0x00, 0x80, 0x98, 0x98, 0x06, 0x02, 0x01, 0x8A, 0x66, 0xDD, 0x28, 0x00, 0x80, 0x8A, 0x8A,
+  0x05, 0x02, 0x03, 0x95, 0x6E, 0xF0, 0x28, 0x00, 0x72, 0xFB, 0x28, 0x00, 0x66, 0x15, 0x29, 0x00,
+  0x01, 0x95, 0x64, 0xF6, 0x28, 0x00, 0x80, 0x95, 0x95, 0x02, 0x02, 0x01, 0x90, 0x74, 0x01, 0x29,
+  0x00, 0x81, 0x90, 0x90, 0x03, 0x02, 0x65, 0x0A, 0x29, 0x00, 0x01, 0x90, 0x64, 0x10, 0x29, 0x00,
+  0x80, 0x90, 0x90, 0x04, 0x02, 0x01, 0x8A, 0x66, 0x1B, 0x29, 0x00, 0x80, 0x8A, 0x8A, 0x01, 0x02,
+  0x02, 0xA9, 0x65, 0x2A, 0x29, 0x00, 0x6F, 0x5F, 0x29, 0x00, 0x01, 0xA9, 0x65, 0x30, 0x29, 0x00,
+  0x01, 0xA9, 0x70, 0x36, 0x29, 0x00, 0x82, 0xA9, 0xA9, 0xEC, 0x01, 0x79, 0x43, 0x29, 0x00, 0x6C,
+  0x48, 0x29, 0x00, 0x80, 0xA8, 0xA8, 0xEE, 0x01, 0x01, 0x89, 0x65, 0x4E, 0x29, 0x00, 0x01, 0x89,
+  0x73, 0x54, 0x29, 0x00, 0x01, 0x89, 0x73, 0x5A, 0x29, 0x00, 0x80, 0x89, 0x89, 0xED, 0x01, 0x01,
+  0x99, 0x77, 0x65, 0x29, 0x00, 0x81, 0x99, 0x99, 0xEF, 0x01, 0x6C, 0x6E, 0x29, 0x00, 0x01, 0x8B,
+  0x79, 0x74, 0x29, 0x00, 0x80, 0x8B, 0x8B, 0xF0, 0x01, 0x05, 0xA8, 0x63, 0x8F, 0x29, 0x00, 0x73,
+  0x9A, 0x29, 0x00, 0x74, 0xB1, 0x29, 0x00, 0x64, 0xB6, 0x29, 0x00, 0x72, 0xC1, 0x29, 0x00, 0x01,
+  0xA8, 0x6B, 0x95, 0x29, 0x00, 0x80, 0xA8, 0xA8, 0xE6, 0x01, 0x01, 0xA5, 0x74, 0xA0, 0x29, 0x00,
+  0x01, 0xA5, 0x65, 0xA6, 0x29, 0x00, 0x01, 0xA5, 0x72, 0xAC, 0x29, 0x00, 0x80, 0xA5, 0xA5, 0xE9,
+  0x01, 0x80, 0xA3, 0xA3, 0xEA, 0x01, 0x01, 0x8C, 0x65, 0xBC, 0x29, 0x00, 0x80, 0x8C, 0x8C, 0xE7,
+  0x01, 0x80, 0x8A, 0x8A, 0xE8, 0x01, 0x06, 0xA5, 0x64, 0xE0, 0x29, 0x00, 0x6C, 0xE5, 0x29, 0x00,
+  0x6D, 0xF0, 0x29, 0x00, 0x69, 0xFB, 0x29, 0x00, 0x79, 0x06, 0x2A, 0x00, 0x74, 0x0B, 0x2A, 0x00,
+  0x80, 0xA5, 0xA5, 0xCE, 0x01, 0x01, 0x9A, 0x74, 0xEB, 0x29, 0x00, 0x80, 0x9A, 0x9A, 0xD0, 0x01,
+  0x01, 0x9A, 0x65, 0xF6, 0x29, 0x00, 0x80, 0x9A, 0x9A, 0xD1, 0x01, 0x01, 0x94, 0x64, 0x01, 0x2A,
+  0x00, 0x80, 0x94, 0x94, 0xCF, 0x01, 0x80, 0x94, 0x94, 0xD3, 0x01, 0x01, 0x8E, 0x75, 0x11, 0x2A,
+  0x00, 0x01, 0x8E, 0x72, 0x17, 0x2A, 0x00, 0x01, 0x8E, 0x64, 0x1D, 0x2A, 0x00, 0x01, 0x8E, 0x61,
+  0x23, 0x2A, 0x00, 0x01, 0x8E, 0x79, 0x29, 0x2A, 0x00, 0x80, 0x8E, 0x8E, 0xD2, 0x01, 0x01, 0xA4,
+  0x61, 0x34, 0x2A, 0x00, 0x02, 0xA4, 0x72, 0x3E, 0x2A, 0x00, 0x6E, 0x4F, 0x2A, 0x00, 0x01, 0xA4,
+  0x65, 0x44, 0x2A, 0x00, 0x01, 0xA4, 0x64, 0x4A, 0x2A, 0x00, 0x80, 0xA4, 0xA4, 0xD5, 0x01, 0x80,
+  0x89, 0x89, 0xD4, 0x01, 0x01, 0xA1, 0x69, 0x5A, 0x2A, 0x00, 0x01, 0xA1, 0x6E, 0x60, 0x2A, 0x00,
+  0x80, 0xA1, 0xA1, 0xEB, 0x01, 0x04, 0x9D, 0x63, 0x77, 0x2A, 0x00, 0x67, 0x94, 0x2A, 0x00, 0x72,
+  0xA5, 0x2A, 0x00, 0x6E, 0xCB, 0x2A, 0x00, 0x01, 0x9D, 0x74, 0x7D, 0x2A, 0x00, 0x01, 0x9D, 0x69,
+  0x83, 0x2A, 0x00, 0x01, 0x9D, 0x6F, 0x89, 0x2A, 0x00, 0x01, 0x9D, 0x6E, 0x8F, 0x2A, 0x00, 0x80,
+  0x9D, 0x9D, 0x0D, 0x02, 0x01, 0x9B, 0x61, 0x9A, 0x2A, 0x00, 0x01, 0x9B, 0x72, 0xA0, 0x2A, 0x00,
+  0x80, 0x9B, 0x9B, 0x0E, 0x02, 0x02, 0x97, 0x65, 0xAF, 0x2A, 0x00, 0x67, 0xB4, 0x2A, 0x00, 0x80,
+  0x97, 0x97, 0x11, 0x02, 0x01, 0x89, 0x65, 0xBA, 0x2A, 0x00, 0x01, 0x89, 0x72, 0xC0, 0x2A, 0x00,
+  0x01, 0x89, 0x79, 0xC6, 0x2A, 0x00, 0x80, 0x89, 0x89, 0x12, 0x02, 0x81, 0x8E, 0x88, 0x0F, 0x02,
+  0x64, 0xD4, 0x2A, 0x00, 0x01, 0x8E, 0x61, 0xDA, 0x2A, 0x00, 0x01, 0x8E, 0x79, 0xE0, 0x2A, 0x00,
+  0x80, 0x8E, 0x8E, 0x10, 0x02, 0x01, 0x9B, 0x61, 0xEB, 0x2A, 0x00, 0x01, 0x9B, 0x63, 0xF1, 0x2A,
+  0x00, 0x01, 0x9B, 0x6B, 0xF7, 0x2A, 0x00, 0x80, 0x9B, 0x9B, 0xF2, 0x01, 0x01, 0x9A, 0x61, 0x02,
+  0x2B, 0x00, 0x01, 0x9A, 0x6C, 0x08, 0x2B, 0x00, 0x01, 0x9A, 0x6C, 0x0E, 0x2B, 0x00, 0x80, 0x9A,
+  0x9A, 0xF1, 0x01, 0x02, 0x9A, 0x6F, 0x1D, 0x2B, 0x00, 0x65, 0x2E, 0x2B, 0x00, 0x01, 0x9A, 0x6F,
+  0x23, 0x2B, 0x00, 0x01, 0x9A, 0x6E, 0x29, 0x2B, 0x00, 0x80, 0x9A, 0x9A, 0x00, 0x02, 0x02, 0x95,
+  0x61, 0x38, 0x2B, 0x00, 0x65, 0x43, 0x2B, 0x00, 0x01, 0x95, 0x6B, 0x3E, 0x2B, 0x00, 0x80, 0x95,
+  0x95, 0xFE, 0x01, 0x01, 0x88, 0x63, 0x49, 0x2B, 0x00, 0x01, 0x88, 0x68, 0x4F, 0x2B, 0x00, 0x80,
+  0x88, 0x88, 0xFF, 0x01, 0x02, 0x89, 0x65, 0x5E, 0x2B, 0x00, 0x6F, 0xA2, 0x2B, 0x00, 0x02, 0x89,
+  0x61, 0x68, 0x2B, 0x00, 0x6C, 0x85, 0x2B, 0x00, 0x01, 0x89, 0x74, 0x6E, 0x2B, 0x00, 0x01, 0x89,
+  0x69, 0x74, 0x2B, 0x00, 0x01, 0x89, 0x6E, 0x7A, 0x2B, 0x00, 0x01, 0x89, 0x67, 0x80, 0x2B, 0x00,
+  0x80, 0x89, 0x89, 0x13, 0x02, 0x01, 0x89, 0x6C, 0x8B, 0x2B, 0x00, 0x01, 0x89, 0x69, 0x91, 0x2B,
+  0x00, 0x01, 0x89, 0x6E, 0x97, 0x2B, 0x00, 0x01, 0x89, 0x67, 0x9D, 0x2B, 0x00, 0x80, 0x89, 0x89,
+  0x14, 0x02, 0x01, 0x89, 0x6C, 0xA8, 0x2B, 0x00, 0x01, 0x89, 0x6C, 0xAE, 0x2B, 0x00, 0x01, 0x89,
+  0x65, 0xB4, 0x2B, 0x00, 0x01, 0x89, 0x6E, 0xBA, 0x2B, 0x00, 0x80, 0x89, 0x89, 0x15, 0x02, 0x05,
+  0xB9, 0x69, 0xD5, 0x2B, 0x00, 0x65, 0x9D, 0x2C, 0x00, 0x6F, 0x20, 0x2D, 0x00, 0x61, 0xD9, 0x2D,
+  0x00, 0x75, 0x1D, 0x2E, 0x00, 0x08, 0xB9, 0x6B, 0xF7, 0x2B, 0x00, 0x65, 0x02, 0x2C, 0x00, 0x67,
+  0x07, 0x2C, 0x00, 0x74, 0x21, 0x2C, 0x00, 0x66, 0x38, 0x2C, 0x00, 0x73, 0x4C, 0x2C, 0x00, 0x70,
+  0x72, 0x2C, 0x00, 0x76, 0x7D, 0x2C, 0x00, 0x01, 0xB9, 0x65, 0xFD, 0x2B, 0x00, 0x80, 0xB9, 0xB9,
+  0x3D, 0x01, 0x80, 0xA3, 0xA3, 0x38, 0x01, 0x01, 0xA0, 0x68, 0x0D, 0x2C, 0x00, 0x01, 0xA0, 0x74,
+  0x13, 0x2C, 0x00, 0x81, 0xA0, 0xA0, 0x3B, 0x01, 0x73, 0x1C, 0x2C, 0x00, 0x80, 0xA0, 0xA0, 0x3C,
+  0x01, 0x01, 0x99, 0x74, 0x27, 0x2C, 0x00, 0x01, 0x99, 0x6C, 0x2D, 0x2C, 0x00, 0x01, 0x99, 0x65,
+  0x33, 0x2C, 0x00, 0x80, 0x99, 0x99, 0x41, 0x01, 0x02, 0x95, 0x74, 0x42, 0x2C, 0x00, 0x65, 0x47,
+  0x2C, 0x00, 0x80, 0x95, 0x95, 0x3A, 0x01, 0x80, 0x8D, 0x8D, 0x39, 0x01, 0x01, 0x8F, 0x74, 0x52,
+  0x2C, 0x00, 0x01, 0x8F, 0x65, 0x58, 0x2C, 0x00, 0x01, 0x8F, 0x6E, 0x5E, 0x2C, 0x00, 0x81, 0x8F,
+  0x8F, 0x3F, 0x01, 0x65, 0x67, 0x2C, 0x00, 0x01, 0x8F, 0x64, 0x6D, 0x2C, 0x00, 0x80, 0x8F, 0x8F,
+  0x40, 0x01, 0x01, 0x8D, 0x73, 0x78, 0x2C, 0x00, 0x80, 0x8D, 0x8D, 0x3E, 0x01, 0x02, 0x8D, 0x65,
+  0x87, 0x2C, 0x00, 0x69, 0x8C, 0x2C, 0x00, 0x80, 0x8D, 0x8D, 0x42, 0x01, 0x01, 0x8D, 0x6E, 0x92,
+  0x2C, 0x00, 0x01, 0x8D, 0x67, 0x98, 0x2C, 0x00, 0x80, 0x8D, 0x8D, 0x43, 0x01, 0x05, 0xAD, 0x74,
+  0xB3, 0x2C, 0x00, 0x67, 0xD6, 0x2C, 0x00, 0x73, 0xDB, 0x2C, 0x00, 0x61, 0xE6, 0x2C, 0x00, 0x66,
+  0x15, 0x2D, 0x00, 0x81, 0xAD, 0xAD, 0x35, 0x01, 0x74, 0xBC, 0x2C, 0x00, 0x01, 0x87, 0x65, 0xC2,
+  0x2C, 0x00, 0x01, 0x87, 0x72, 0xC8, 0x2C, 0x00, 0x81, 0x87, 0x87, 0x36, 0x01, 0x73, 0xD1, 0x2C,
+  0x00, 0x80, 0x87, 0x87, 0x37, 0x01, 0x80, 0xA2, 0xA2, 0x33, 0x01, 0x01, 0x9A, 0x73, 0xE1, 0x2C,
+  0x00, 0x80, 0x9A, 0x9A, 0x34, 0x01, 0x02, 0x90, 0x76, 0xF0, 0x2C, 0x00, 0x72, 0xFB, 0x2C, 0x00,
+  0x01, 0x90, 0x65, 0xF6, 0x2C, 0x00, 0x80, 0x90, 0x90, 0x31, 0x01, 0x01, 0x8F, 0x6E, 0x01, 0x2D,
+  0x00, 0x81, 0x8F, 0x8F, 0x2F, 0x01, 0x65, 0x0A, 0x2D, 0x00, 0x01, 0x8F, 0x64, 0x10, 0x2D, 0x00,
+  0x80, 0x8F, 0x8F, 0x30, 0x01, 0x01, 0x90, 0x74, 0x1B, 0x2D, 0x00, 0x80, 0x90, 0x90, 0x32, 0x01,
+  0x07, 0xAC, 0x6F, 0x3E, 0x2D, 0x00, 0x76, 0x5E, 0x2D, 0x00, 0x6E, 0x78, 0x2D, 0x00, 0x74, 0x98,
+  0x2D, 0x00, 0x73, 0xA6, 0x2D, 0x00, 0x75, 0xBA, 0x2D, 0x00, 0x77, 0xC5, 0x2D, 0x00, 0x02, 0xAC,
+  0x6B, 0x48, 0x2D, 0x00, 0x73, 0x4D, 0x2D, 0x00, 0x80, 0xAC, 0xAC, 0x46, 0x01, 0x01, 0x88, 0x65,
+  0x53, 0x2D, 0x00, 0x01, 0x88, 0x6E, 0x59, 0x2D, 0x00, 0x80, 0x88, 0x88, 0x47, 0x01, 0x01, 0xA5,
+  0x65, 0x64, 0x2D, 0x00, 0x81, 0xA5, 0xA5, 0x4D, 0x01, 0x6C, 0x6D, 0x2D, 0x00, 0x01, 0x8B, 0x79,
+  0x73, 0x2D, 0x00, 0x80, 0x8B, 0x8B, 0x4E, 0x01, 0x02, 0xA4, 0x65, 0x82, 0x2D, 0x00, 0x67, 0x93,
+  0x2D, 0x00, 0x01, 0xA4, 0x6C, 0x88, 0x2D, 0x00, 0x01, 0xA4, 0x79, 0x8E, 0x2D, 0x00, 0x80, 0xA4,
+  0xA4, 0x44, 0x01, 0x80, 0x99, 0x99, 0x45, 0x01, 0x81, 0x93, 0x93, 0x4A, 0x01, 0x73, 0xA1, 0x2D,
+  0x00, 0x80, 0x93, 0x93, 0x4B, 0x01, 0x02, 0x90, 0x65, 0xB0, 0x2D, 0x00, 0x74, 0xB5, 0x2D, 0x00,
+  0x80, 0x90, 0x90, 0x48, 0x01, 0x80, 0x90, 0x90, 0x49, 0x01, 0x01, 0x8C, 0x64, 0xC0, 0x2D, 0x00,
+  0x80, 0x8C, 0x8C, 0x4C, 0x01, 0x81, 0x8C, 0x8C, 0x4F, 0x01, 0x65, 0xCE, 0x2D, 0x00, 0x01, 0x88,
+  0x72, 0xD4, 0x2D, 0x00, 0x80, 0x88, 0x88, 0x50, 0x01, 0x03, 0xAA, 0x74, 0xE7, 0x2D, 0x00, 0x73,
+  0xFB, 0x2D, 0x00, 0x77, 0x06, 0x2E, 0x00, 0x01, 0xAA, 0x65, 0xED, 0x2D, 0x00, 0x81, 0xAA, 0x99,
+  0x2C, 0x01, 0x72, 0xF6, 0x2D, 0x00, 0x80, 0xAA, 0xAA, 0x2D, 0x01, 0x01, 0x8E, 0x74, 0x01, 0x2E,
+  0x00, 0x80, 0x8E, 0x8E, 0x2B, 0x01, 0x01, 0x89, 0x79, 0x0C, 0x2E, 0x00, 0x01, 0x89, 0x65, 0x12,
+  0x2E, 0x00, 0x01, 0x89, 0x72, 0x18, 0x2E, 0x00, 0x80, 0x89, 0x89, 0x2E, 0x01, 0x01, 0x9B, 0x6E,
+  0x23, 0x2E, 0x00, 0x01, 0x9B, 0x63, 0x29, 0x2E, 0x00, 0x01, 0x9B, 0x68, 0x2F, 0x2E, 0x00, 0x80,
+  0x9B, 0x9B, 0x51, 0x01, 0x04, 0xB6, 0x70, 0x46, 0x2E, 0x00, 0x6E, 0x5A, 0x2E, 0x00, 0x72, 0xEC,
+  0x2E, 0x00, 0x73, 0x03, 0x2F, 0x00, 0x81, 0xB6, 0xB6, 0x52, 0x02, 0x6F, 0x4F, 0x2E, 0x00, 0x01,
+  0x91, 0x6E, 0x55, 0x2E, 0x00, 0x80, 0x91, 0x91, 0x53, 0x02, 0x03, 0xA4, 0x63, 0x68, 0x2E, 0x00,
+  0x64, 0xA9, 0x2E, 0x00, 0x74, 0xDB, 0x2E, 0x00, 0x01, 0xA4, 0x6F, 0x6E, 0x2E, 0x00, 0x01, 0xA4,
+  0x6D, 0x74, 0x2E, 0x00, 0x01, 0xA4, 0x66, 0x7A, 0x2E, 0x00, 0x01, 0xA4, 0x6F, 0x80, 0x2E, 0x00,
+  0x01, 0xA4, 0x72, 0x86, 0x2E, 0x00, 0x01, 0xA4, 0x74, 0x8C, 0x2E, 0x00, 0x01, 0xA4, 0x61, 0x92,
+  0x2E, 0x00, 0x01, 0xA4, 0x62, 0x98, 0x2E, 0x00, 0x01, 0xA4, 0x6C, 0x9E, 0x2E, 0x00, 0x01, 0xA4,
+  0x65, 0xA4, 0x2E, 0x00, 0x80, 0xA4, 0xA4, 0x4E, 0x02, 0x01, 0x91, 0x65, 0xAF, 0x2E, 0x00, 0x01,
+  0x91, 0x72, 0xB5, 0x2E, 0x00, 0x81, 0x91, 0x91, 0x4F, 0x02, 0x73, 0xBE, 0x2E, 0x00, 0x01, 0x91,
+  0x74, 0xC4, 0x2E, 0x00, 0x01, 0x91, 0x61, 0xCA, 0x2E, 0x00, 0x01, 0x91, 0x6E, 0xD0, 0x2E, 0x00,
+  0x01, 0x91, 0x64, 0xD6, 0x2E, 0x00, 0x80, 0x91, 0x91, 0x50, 0x02, 0x01, 0x91, 0x69, 0xE1, 0x2E,
+  0x00, 0x01, 0x91, 0x6C, 0xE7, 0x2E, 0x00, 0x80, 0x91, 0x91, 0x51, 0x02, 0x01, 0x9C, 0x69, 0xF2,
+  0x2E, 0x00, 0x01, 0x9C, 0x6E, 0xF8, 0x2E, 0x00, 0x01, 0x9C, 0x65, 0xFE, 0x2E, 0x00, 0x80, 0x9C,
+  0x9C, 0x54, 0x02, 0x01, 0x90, 0x65, 0x09, 0x2F, 0x00, 0x81, 0x90, 0x90, 0x55, 0x02, 0x64, 0x12,
+  0x2F, 0x00, 0x80, 0x90, 0x90, 0x56, 0x02, 0x04, 0xB2, 0x69, 0x29, 0x2F, 0x00, 0x61, 0x4F, 0x2F,
+  0x00, 0x65, 0x84, 0x2F, 0x00, 0x6F, 0x88, 0x30, 0x00, 0x02, 0xB2, 0x67, 0x33, 0x2F, 0x00, 0x63,
+  0x44, 0x2F, 0x00, 0x01, 0xB2, 0x68, 0x39, 0x2F, 0x00, 0x01, 0xB2, 0x74, 0x3F, 0x2F, 0x00, 0x80,
+  0xB2, 0xB2, 0xCB, 0x01, 0x01, 0x9B, 0x65, 0x4A, 0x2F, 0x00, 0x80, 0x9B, 0x9B, 0xCA, 0x01, 0x02,
+  0xA0, 0x64, 0x59, 0x2F, 0x00, 0x69, 0x6A, 0x2F, 0x00, 0x01, 0xA0, 0x69, 0x5F, 0x2F, 0x00, 0x01,
+  0xA0, 0x6F, 0x65, 0x2F, 0x00, 0x80, 0xA0, 0xA0, 0xBB, 0x01, 0x02, 0x88, 0x6E, 0x74, 0x2F, 0x00,
+  0x73, 0x79, 0x2F, 0x00, 0x80, 0x88, 0x88, 0xBC, 0x01, 0x01, 0x88, 0x65, 0x7F, 0x2F, 0x00, 0x80,
+  0x88, 0x88, 0xBD, 0x01, 0x05, 0x9F, 0x61, 0x9A, 0x2F, 0x00, 0x6D, 0xB7, 0x2F, 0x00, 0x6C, 0xFE,
+  0x2F, 0x00, 0x73, 0x1E, 0x30, 0x00, 0x70, 0x59, 0x30, 0x00, 0x02, 0x9F, 0x64, 0xA4, 0x2F, 0x00,
+  0x6C, 0xB2, 0x2F, 0x00, 0x81, 0x9F, 0x9F, 0xBE, 0x01, 0x79, 0xAD, 0x2F, 0x00, 0x80, 0x8C, 0x8C,
+  0xBF, 0x01, 0x80, 0x8B, 0x8B, 0xC0, 0x01, 0x02, 0x91, 0x65, 0xC1, 0x2F, 0x00, 0x6F, 0xDE, 0x2F,
+  0x00, 0x01, 0x91, 0x6D, 0xC7, 0x2F, 0x00, 0x01, 0x91, 0x62, 0xCD, 0x2F, 0x00, 0x01, 0x91, 0x65,
+  0xD3, 0x2F, 0x00, 0x01, 0x91, 0x72, 0xD9, 0x2F, 0x00, 0x80, 0x91, 0x91, 0xC3, 0x01, 0x02, 0x88,
+  0x74, 0xE8, 0x2F, 0x00, 0x76, 0xF3, 0x2F, 0x00, 0x01, 0x88, 0x65, 0xEE, 0x2F, 0x00, 0x80, 0x88,
+  0x88, 0xC4, 0x01, 0x01, 0x88, 0x65, 0xF9, 0x2F, 0x00, 0x80, 0x88, 0x88, 0xC5, 0x01, 0x01, 0x8A,
+  0x61, 0x04, 0x30, 0x00, 0x01, 0x8A, 0x78, 0x0A, 0x30, 0x00, 0x81, 0x8A, 0x8A, 0xC1, 0x01, 0x65,
+  0x13, 0x30, 0x00, 0x01, 0x8A, 0x64, 0x19, 0x30, 0x00, 0x80, 0x8A, 0x8A, 0xC2, 0x01, 0x02, 0x8A,
+  0x74, 0x28, 0x30, 0x00, 0x75, 0x42, 0x30, 0x00, 0x81, 0x8A, 0x8A, 0xC7, 0x01, 0x69, 0x31, 0x30,
+  0x00, 0x01, 0x8A, 0x6E, 0x37, 0x30, 0x00, 0x01, 0x8A, 0x67, 0x3D, 0x30, 0x00, 0x80, 0x8A, 0x8A,
+  0xC8, 0x01, 0x01, 0x89, 0x6C, 0x48, 0x30, 0x00, 0x01, 0x89, 0x74, 0x4E, 0x30, 0x00, 0x01, 0x89,
+  0x73, 0x54, 0x30, 0x00, 0x80, 0x89, 0x89, 0xC9, 0x01, 0x01, 0x88, 0x6F, 0x5F, 0x30, 0x00, 0x01,
+  0x88, 0x73, 0x65, 0x30, 0x00, 0x01, 0x88, 0x69, 0x6B, 0x30, 0x00, 0x01, 0x88, 0x74, 0x71, 0x30,
+  0x00, 0x01, 0x88, 0x69, 0x77, 0x30, 0x00, 0x01, 0x88, 0x6F, 0x7D, 0x30, 0x00, 0x01, 0x88, 0x6E,
+  0x83, 0x30, 0x00, 0x80, 0x88, 0x88, 0xC6, 0x01, 0x02, 0x95, 0x6F, 0x92, 0x30, 0x00, 0x6C, 0x9D,
+  0x30, 0x00, 0x01, 0x95, 0x6D, 0x98, 0x30, 0x00, 0x80, 0x95, 0x95, 0xCD, 0x01, 0x01, 0x88, 0x6C,
+  0xA3, 0x30, 0x00, 0x80, 0x88, 0x88, 0xCC, 0x01, 0x03, 0xAE, 0x65, 0xB6, 0x30, 0x00, 0x6F, 0xC7,
+  0x30, 0x00, 0x69, 0xF9, 0x30, 0x00, 0x01, 0xAE, 0x72, 0xBC, 0x30, 0x00, 0x01, 0xAE, 0x79, 0xC2,
+  0x30, 0x00, 0x80, 0xAE, 0xAE, 0x57, 0x02, 0x02, 0x9D, 0x6D, 0xD1, 0x30, 0x00, 0x6C, 0xE2, 0x30,
+  0x00, 0x01, 0x9D, 0x69, 0xD7, 0x30, 0x00, 0x01, 0x9D, 0x74, 0xDD, 0x30, 0x00, 0x80, 0x9D, 0x9D,
+  0x5D, 0x02, 0x01, 0x88, 0x75, 0xE8, 0x30, 0x00, 0x01, 0x88, 0x6D, 0xEE, 0x30, 0x00, 0x01, 0x88,
+  0x65, 0xF4, 0x30, 0x00, 0x80, 0x88, 0x88, 0x5C, 0x02, 0x02, 0x94, 0x73, 0x03, 0x31, 0x00, 0x64,
+  0x2C, 0x31, 0x00, 0x01, 0x94, 0x69, 0x09, 0x31, 0x00, 0x01, 0x94, 0x74, 0x0F, 0x31, 0x00, 0x81,
+  0x94, 0x94, 0x59, 0x02, 0x6F, 0x18, 0x31, 0x00, 0x01, 0x94, 0x72, 0x1E, 0x31, 0x00, 0x81, 0x94,
+  0x94, 0x5A, 0x02, 0x73, 0x27, 0x31, 0x00, 0x80, 0x94, 0x94, 0x5B, 0x02, 0x01, 0x87, 0x65, 0x32,
+  0x31, 0x00, 0x01, 0x87, 0x6F, 0x38, 0x31, 0x00, 0x80, 0x87, 0x87, 0x58, 0x02, 0x06, 0xA2, 0x61,
+  0x57, 0x31, 0x00, 0x79, 0x98, 0x31, 0x00, 0x76, 0xA3, 0x31, 0x00, 0x69, 0x11, 0x32, 0x00, 0x78,
+  0x2E, 0x32, 0x00, 0x6D, 0x7B, 0x32, 0x00, 0x04, 0xA2, 0x72, 0x69, 0x31, 0x00, 0x74, 0x7D, 0x31,
+  0x00, 0x63, 0x82, 0x31, 0x00, 0x73, 0x8D, 0x31, 0x00, 0x81, 0xA2, 0xA2, 0xAB, 0x00, 0x6C, 0x72,
+  0x31, 0x00, 0x01, 0x99, 0x79, 0x78, 0x31, 0x00, 0x80, 0x99, 0x99, 0xAC, 0x00, 0x80, 0x9B, 0x9B,
+  0xAE, 0x00, 0x01, 0x93, 0x68, 0x88, 0x31, 0x00, 0x80, 0x93, 0x93, 0xAA, 0x00, 0x01, 0x8B, 0x79,
+  0x93, 0x31, 0x00, 0x80, 0x8B, 0x8B, 0xAD, 0x00, 0x01, 0xA2, 0x65, 0x9E, 0x31, 0x00, 0x80, 0xA2,
+  0xA2, 0xBB, 0x00, 0x01, 0x98, 0x65, 0xA9, 0x31, 0x00, 0x02, 0x98, 0x6E, 0xB3, 0x31, 0x00, 0x72,
+  0xCD, 0x31, 0x00, 0x81, 0x98, 0x98, 0xB2, 0x00, 0x69, 0xBC, 0x31, 0x00, 0x01, 0x8F, 0x6E, 0xC2,
+  0x31, 0x00, 0x01, 0x8F, 0x67, 0xC8, 0x31, 0x00, 0x80, 0x8F, 0x8F, 0xB3, 0x00, 0x81, 0x97, 0x97,
+  0xB4, 0x00, 0x79, 0xD6, 0x31, 0x00, 0x82, 0x97, 0x93, 0xB5, 0x00, 0x6F, 0xE3, 0x31, 0x00, 0x74,
+  0xF4, 0x31, 0x00, 0x01, 0x97, 0x6E, 0xE9, 0x31, 0x00, 0x01, 0x97, 0x65, 0xEF, 0x31, 0x00, 0x80,
+  0x97, 0x97, 0xB6, 0x00, 0x01, 0x97, 0x68, 0xFA, 0x31, 0x00, 0x01, 0x97, 0x69, 0x00, 0x32, 0x00,
+  0x01, 0x97, 0x6E, 0x06, 0x32, 0x00, 0x01, 0x97, 0x67, 0x0C, 0x32, 0x00, 0x80, 0x97, 0x97, 0xB7,
+  0x00, 0x01, 0x92, 0x74, 0x17, 0x32, 0x00, 0x01, 0x92, 0x68, 0x1D, 0x32, 0x00, 0x01, 0x92, 0x65,
+  0x23, 0x32, 0x00, 0x01, 0x92, 0x72, 0x29, 0x32, 0x00, 0x80, 0x92, 0x92, 0xAF, 0x00, 0x02, 0x92,
+  0x63, 0x38, 0x32, 0x00, 0x65, 0x4F, 0x32, 0x00, 0x01, 0x92, 0x65, 0x3E, 0x32, 0x00, 0x01, 0x92,
+  0x70, 0x44, 0x32, 0x00, 0x01, 0x92, 0x74, 0x4A, 0x32, 0x00, 0x80, 0x92, 0x92, 0xB8, 0x00, 0x01,
+  0x88, 0x72, 0x55, 0x32, 0x00, 0x01, 0x88, 0x63, 0x5B, 0x32, 0x00, 0x01, 0x88, 0x69, 0x61, 0x32,
+  0x00, 0x01, 0x88, 0x73, 0x67, 0x32, 0x00, 0x01, 0x88, 0x65, 0x6D, 0x32, 0x00, 0x81, 0x88, 0x88,
+  0xB9, 0x00, 0x73, 0x76, 0x32, 0x00, 0x80, 0x88, 0x88, 0xBA, 0x00, 0x02, 0x8C, 0x70, 0x85, 0x32,
+  0x00, 0x61, 0x96, 0x32, 0x00, 0x01, 0x8C, 0x74, 0x8B, 0x32, 0x00, 0x01, 0x8C, 0x79, 0x91, 0x32,
+  0x00, 0x80, 0x8C, 0x8C, 0xB1, 0x00, 0x01, 0x87, 0x69, 0x9C, 0x32, 0x00, 0x01, 0x87, 0x6C, 0xA2,
+  0x32, 0x00, 0x80, 0x87, 0x87, 0xB0, 0x00, 0x01, 0x8E, 0x75, 0xAD, 0x32, 0x00, 0x02, 0x8E, 0x65,
+  0xB7, 0x32, 0x00, 0x69, 0xDA, 0x32, 0x00, 0x01, 0x8E, 0x73, 0xBD, 0x32, 0x00, 0x01, 0x8E, 0x74,
+  0xC3, 0x32, 0x00, 0x01, 0x8E, 0x69, 0xC9, 0x32, 0x00, 0x01, 0x8E, 0x6F, 0xCF, 0x32, 0x00, 0x01,
+  0x8E, 0x6E, 0xD5, 0x32, 0x00, 0x80, 0x8E, 0x8E, 0xB8, 0x01, 0x02, 0x8C, 0x65, 0xE4, 0x32, 0x00,
+  0x63, 0xEF, 0x32, 0x00, 0x01, 0x8C, 0x74, 0xEA, 0x32, 0x00, 0x80, 0x8C, 0x8C, 0xBA, 0x01, 0x01,
+  0x8B, 0x6B, 0xF5, 0x32, 0x00, 0x01, 0x8B, 0x6C, 0xFB, 0x32, 0x00, 0x01, 0x8B, 0x79, 0x01, 0x33,
+  0x00, 0x80, 0x8B, 0x8B, 0xB9, 0x01, 0x01, 0x89, 0x72, 0x0C, 0x33, 0x00, 0x01, 0x89, 0x61, 0x12,
+  0x33, 0x00, 0x01, 0x89, 0x79, 0x18, 0x33, 0x00, 0x80, 0x89, 0x89, 0x8E, 0x02,
+};
+
+const char lexiconWords[] =
+  "a\0about\0above\0ache\0aching\0across\0adjust\0afraid\0after\0"
+  "afternoon\0again\0against\0air\0alive\0all\0alone\0along\0already\0"
+  "also\0always\0am\0amazing\0among\0and\0angry\0another\0answer\0any\0"
+  "anyone\0anything\0appetite\0apple\0appointment\0are\0arm\0around\0"
+  "ask\0asleep\0at\0awake\0awful\0baby\0back\0bad\0banana\0bath\0"
+  "bathroom\0battery\0be\0beautiful\0because\0bed\0bedpan\0been\0before\0"
+  "behind\0being\0believe\0belly\0below\0beneath\0beside\0best\0better\0"
+  "between\0beyond\0big\0bill\0blanket\0bleeding\0bless\0blinds\0blood\0"
+  "body\0bone\0bones\0book\0bored\0both\0bottle\0bottom\0boy\0brain\0"
+  "bread\0breakfast\0breath\0breathe\0breathing\0bright\0bring\0broken\0"
+  "brother\0burning\0busy\0but\0by\0bye\0call\0called\0calling\0calm\0"
+  "came\0can\0care\0cared\0careful\0carefully\0caregiver\0caring\0carry\0"
+  "chair\0change\0channel\0charge\0charger\0chest\0child\0children\0"
+  "city\0clean\0close\0clothes\0coffee\0cold\0come\0comfortable\0"
+  "constipated\0cool\0cooler\0cooling\0cough\0could\0country\0cramp\0"
+  "cramps\0cup\0curtain\0curtains\0dad\0dark\0daughter\0day\0days\0"
+  "death\0diaper\0diarrhea\0did\0die\0different\0difficult\0dinner\0"
+  "dirty\0discharge\0dizzy\0do\0doctor\0doctors\0does\0doing\0done\0"
+  "door\0down\0dream\0dreams\0drink\0drip\0dry\0dull\0during\0dying\0"
+  "each\0ear\0early\0easy\0eat\0either\0email\0empty\0even\0evening\0"
+  "ever\0every\0everyone\0everything\0except\0exercise\0exercises\0eye\0"
+  "face\0facetime\0false\0family\0fan\0fast\0father\0feel\0feet\0fever\0"
+  "few\0find\0fine\0fingers\0finish\0finished\0first\0fix\0food\0foot\0"
+  "for\0forget\0forgot\0found\0free\0friday\0friend\0from\0front\0fruit\0"
+  "full\0game\0garden\0gentle\0gently\0get\0girl\0give\0glasses\0go\0"
+  "god\0going\0gone\0good\0goodbye\0great\0had\0hair\0hand\0hands\0"
+  "happy\0hard\0has\0have\0having\0he\0head\0headache\0hear\0heart\0"
+  "heater\0heating\0heavy\0hello\0help\0here\0hi\0high\0higher\0hip\0"
+  "hips\0hold\0home\0hope\0hoping\0horrible\0hospital\0hot\0hour\0hours\0"
+  "house\0how\0hungry\0hurt\0hurting\0hurts\0husband\0i\0ice\0idea\0if\0"
+  "important\0in\0injection\0inside\0insurance\0into\0is\0it\0itch\0"
+  "itching\0itchy\0job\0juice\0just\0keep\0kept\0kind\0knee\0knees\0"
+  "know\0last\0late\0later\0lawyer\0learn\0learned\0leave\0left\0leg\0"
+  "less\0let\0letter\0letters\0lie\0life\0lift\0light\0lights\0like\0"
+  "lips\0listen\0listened\0little\0live\0living\0lonely\0long\0look\0"
+  "loosen\0lose\0lost\0lot\0lots\0loud\0love\0lovely\0low\0lower\0lunch\0"
+  "madam\0make\0man\0many\0massage\0may\0maybe\0me\0mean\0means\0"
+  "medicine\0message\0messages\0might\0milk\0minute\0minutes\0miss\0"
+  "mister\0mom\0monday\0money\0month\0more\0morning\0mother\0mouth\0"
+  "move\0much\0muscle\0music\0must\0my\0name\0nausea\0near\0neck\0need\0"
+  "neither\0never\0new\0news\0newspaper\0next\0nice\0night\0nightmare\0"
+  "no\0nobody\0nose\0not\0nothing\0now\0numb\0number\0nurse\0nurses\0of\0"
+  "off\0often\0ok\0okay\0old\0on\0one\0only\0open\0operation\0or\0other\0"
+  "out\0outside\0over\0oxygen\0pain\0painful\0pee\0people\0person\0"
+  "phone\0photo\0photos\0physio\0picture\0pictures\0pillow\0pills\0"
+  "place\0play\0played\0please\0plug\0position\0possible\0pray\0prayer\0"
+  "pressure\0priest\0problem\0pull\0push\0put\0question\0quickly\0quiet\0"
+  "radio\0rain\0raise\0read\0ready\0real\0relax\0relaxed\0remember\0"
+  "remote\0remove\0reposition\0rest\0resting\0results\0rice\0right\0"
+  "roll\0room\0sad\0said\0salt\0same\0saturday\0say\0scan\0scared\0"
+  "second\0see\0send\0shaking\0shall\0sharp\0she\0sheet\0shirt\0short\0"
+  "should\0shoulder\0shoulders\0show\0showed\0shower\0sick\0side\0sir\0"
+  "sister\0sit\0skin\0sleep\0sleepless\0sleepy\0slow\0slowly\0small\0"
+  "snack\0so\0soft\0some\0someone\0something\0sometimes\0son\0soon\0"
+  "sore\0sorry\0soup\0speak\0speech\0spoon\0staff\0stand\0start\0"
+  "started\0stiff\0still\0stomach\0stop\0story\0straw\0stretch\0strong\0"
+  "suction\0sugar\0sun\0sunday\0sure\0surgery\0sweating\0swelling\0"
+  "swollen\0tablet\0take\0talk\0tea\0team\0teeth\0television\0tell\0"
+  "temperature\0terrible\0test\0tests\0text\0than\0thank\0thanks\0that\0"
+  "the\0then\0therapy\0there\0they\0thing\0things\0think\0third\0thirst\0"
+  "thirsty\0this\0thought\0throat\0through\0thursday\0tighten\0time\0"
+  "tingling\0tired\0to\0today\0toes\0together\0toilet\0tomorrow\0tongue\0"
+  "tonight\0too\0top\0toward\0tried\0true\0try\0trying\0tube\0tuesday\0"
+  "turn\0tv\0uncomfortable\0under\0understand\0until\0up\0upon\0urine\0"
+  "use\0used\0very\0video\0visit\0visitor\0visitors\0volume\0vomit\0"
+  "wait\0walk\0want\0ward\0warm\0was\0wash\0watch\0watched\0water\0way\0"
+  "we\0weak\0weather\0wednesday\0week\0weeks\0well\0went\0were\0wet\0"
+  "what\0wheelchair\0when\0where\0which\0who\0whom\0whose\0why\0wife\0"
+  "will\0window\0wish\0with\0within\0without\0woman\0wonder\0wonderful\0"
+  "work\0world\0worried\0worse\0worst\0would\0write\0wrong\0xray\0year\0"
+  "yes\0yesterday\0yet\0you\0your\0";
+
+const uint16_t lexiconWordOffsets[LEXICON_WORD_COUNT] = {
+  0, 2, 8, 14, 19, 26, 33, 40, 47, 53, 63, 69,
+  77, 81, 87, 91, 97, 103, 111, 116, 123, 126, 134, 140,
+  144, 150, 158, 165, 169, 176, 185, 194, 200, 212, 216, 220,
+  227, 231, 238, 241, 247, 253, 258, 263, 267, 274, 279, 288,
+  296, 299, 309, 317, 321, 328, 333, 340, 347, 353, 361, 367,
+  373, 381, 388, 393, 400, 408, 415, 419, 424, 432, 441, 447,
+  454, 460, 465, 470, 476, 481, 487, 492, 499, 506, 510, 516,
+  522, 532, 539, 547, 557, 564, 570, 577, 585, 593, 598, 602,
+  605, 609, 614, 621, 629, 634, 639, 643, 648, 654, 662, 672,
+  682, 689, 695, 701, 708, 716, 723, 731, 737, 743, 752, 757,
+  763, 769, 777, 784, 789, 794, 806, 818, 823, 830, 838, 844,
+  850, 858, 864, 871, 875, 883, 892, 896, 901, 910, 914, 919,
+  925, 932, 941, 945, 949, 959, 969, 976, 982, 992, 998, 1001,
+  1008, 1016, 1021, 1027, 1032, 1037, 1042, 1048, 1055, 1061, 1066, 1070,
+  1075, 1082, 1088, 1093, 1097, 1103, 1108, 1112, 1119, 1125, 1131, 1136,
+  1144, 1149, 1155, 1164, 1175, 1182, 1191, 1201, 1205, 1210, 1219, 1225,
+  1232, 1236, 1241, 1248, 1253, 1258, 1264, 1268, 1273, 1278, 1286, 1293,
+  1302, 1308, 1312, 1317, 1322, 1326, 1333, 1340, 1346, 1351, 1358, 1365,
+  1370, 1376, 1382, 1387, 1392, 1399, 1406, 1413, 1417, 1422, 1427, 1435,
+  1438, 1442, 1448, 1453, 1458, 1466, 1472, 1476, 1481, 1486, 1492, 1498,
+  1503, 1507, 1512, 1519, 1522, 1527, 1536, 1541, 1547, 1554, 1562, 1568,
+  1574, 1579, 1584, 1587, 1592, 1599, 1603, 1608, 1613, 1618, 1623, 1630,
+  1639, 1648, 1652, 1657, 1663, 1669, 1673, 1680, 1685, 1693, 1699, 1707,
+  1709, 1713, 1718, 1721, 1731, 1734, 1744, 1751, 1761, 1766, 1769, 1772,
+  1777, 1785, 1791, 1795, 1801, 1806, 1811, 1816, 1821, 1826, 1832, 1837,
+  1842, 1847, 1853, 1860, 1866, 1874, 1880, 1885, 1889, 1894, 1898, 1905,
+  1913, 1917, 1922, 1927, 1933, 1940, 1945, 1950, 1957, 1966, 1973, 1978,
+  1985, 1992, 1997, 2002, 2009, 2014, 2019, 2023, 2028, 2033, 2038, 2045,
+  2049, 2055, 2061, 2067, 2072, 2076, 2081, 2089, 2093, 2099, 2102, 2107,
+  2113, 2122, 2130, 2139, 2145, 2150, 2157, 2165, 2170, 2177, 2181, 2188,
+  2194, 2200, 2205, 2213, 2220, 2226, 2231, 2236, 2243, 2249, 2254, 2257,
+  2262, 2269, 2274, 2279, 2284, 2292, 2298, 2302, 2307, 2317, 2322, 2327,
+  2333, 2343, 2346, 2353, 2358, 2362, 2370, 2374, 2379, 2386, 2392, 2399,
+  2402, 2406, 2412, 2415, 2420, 2424, 2427, 2431, 2436, 2441, 2451, 2454,
+  2460, 2464, 2472, 2477, 2484, 2489, 2497, 2501, 2508, 2515, 2521, 2527,
+  2534, 2541, 2549, 2558, 2565, 2571, 2577, 2582, 2589, 2596, 2601, 2610,
+  2619, 2624, 2631, 2640, 2647, 2655, 2660, 2665, 2669, 2678, 2686, 2692,
+  2698, 2703, 2709, 2714, 2720, 2725, 2731, 2739, 2748, 2755, 2762, 2773,
+  2778, 2786, 2794, 2799, 2805, 2810, 2815, 2819, 2824, 2829, 2834, 2843,
+  2847, 2852, 2859, 2866, 2870, 2875, 2883, 2889, 2895, 2899, 2905, 2911,
+  2917, 2924, 2933, 2943, 2948, 2955, 2962, 2967, 2972, 2976, 2983, 2987,
+  2992, 2998, 3008, 3015, 3020, 3027, 3033, 3039, 3042, 3047, 3052, 3060,
+  3070, 3080, 3084, 3089, 3094, 3100, 3105, 3111, 3118, 3124, 3130, 3136,
+  3142, 3150, 3156, 3162, 3170, 3175, 3181, 3187, 3195, 3202, 3210, 3216,
+  3220, 3227, 3232, 3240, 3249, 3258, 3266, 3273, 3278, 3283, 3287, 3292,
+  3298, 3309, 3314, 3326, 3335, 3340, 3346, 3351, 3356, 3362, 3369, 3374,
+  3378, 3383, 3391, 3397, 3402, 3408, 3415, 3421, 3427, 3434, 3442, 3447,
+  3455, 3462, 3470, 3479, 3487, 3492, 3501, 3507, 3510, 3516, 3521, 3530,
+  3537, 3546, 3553, 3561, 3565, 3569, 3576, 3582, 3587, 3591, 3598, 3603,
+  3611, 3616, 3619, 3633, 3639, 3650, 3656, 3659, 3664, 3670, 3674, 3679,
+  3684, 3690, 3696, 3704, 3713, 3720, 3726, 3731, 3736, 3741, 3746, 3751,
+  3755, 3760, 3766, 3774, 3780, 3784, 3787, 3792, 3800, 3810, 3815, 3821,
+  3826, 3831, 3836, 3840, 3845, 3856, 3861, 3867, 3873, 3877, 3882, 3888,
+  3892, 3897, 3902, 3909, 3914, 3919, 3926, 3934, 3940, 3947, 3957, 3962,
+  3968, 3976, 3982, 3988, 3994, 4000, 4006, 4011, 4016, 4020, 4030, 4034,
+  4038,
+};
+
+const LexiconBigram lexiconBigrams[LEXICON_BIGRAM_COUNT] = {
+  { 0x0000, 164, 211 },
+  { 0x0014, 280, 229 },
+  { 0x0014, 123, 211 },
+  { 0x0014, 265, 211 },
+  { 0x0014, 270, 211 },
+  { 0x0014, 561, 211 },
+  { 0x0014, 570, 211 },
+  { 0x0014, 399, 204 },
+  { 0x0014, 469, 196 },
+  { 0x0061, 551, 229 },
+  { 0x0061, 370, 226 },
+  { 0x0061, 155, 211 },
+  { 0x0061, 393, 211 },
+  { 0x0066, 659, 247 },
+  { 0x0066, 275, 229 },
+  { 0x00C3, 486, 221 },
+  { 0x00C3, 412, 216 },
+  { 0x00C3, 63, 211 },
+  { 0x00C3, 123, 204 },
+  { 0x00C3, 265, 196 },
+  { 0x00C3, 570, 196 },
+  { 0x00E1, 345, 229 },
+  { 0x00E3, 571, 229 },
+  { 0x00E3, 260, 221 },
+  { 0x00E7, 362, 221 },
+  { 0x00E7, 383, 221 },
+  { 0x00F1, 412, 221 },
+  { 0x00F1, 0, 211 },
+  { 0x00FC, 345, 236 },
+  { 0x0113, 608, 251 },
+  { 0x0113, 375, 249 },
+  { 0x0113, 20, 247 },
+  { 0x0113, 195, 236 },
+  { 0x0113, 241, 229 },
+  { 0x0113, 102, 221 },
+  { 0x0113, 333, 216 },
+  { 0x0113, 154, 211 },
+  { 0x0113, 355, 204 },
+  { 0x0113, 558, 196 },
+  { 0x0113, 637, 185 },
+  { 0x0118, 370, 236 },
+  { 0x011D, 370, 211 },
+  { 0x011D, 551, 211 },
+  { 0x014D, 659, 242 },
+  { 0x0163, 659, 221 },
+  { 0x0169, 615, 211 },
+  { 0x0172, 274, 221 },
+  { 0x0172, 636, 221 },
+  { 0x0172, 140, 216 },
+  { 0x0172, 191, 216 },
+  { 0x0172, 505, 216 },
+  { 0x0172, 42, 211 },
+  { 0x0172, 244, 211 },
+  { 0x0172, 34, 204 },
+  { 0x0172, 307, 204 },
+  { 0x0172, 417, 204 },
+  { 0x0172, 226, 196 },
+  { 0x0177, 571, 247 },
+  { 0x0177, 252, 229 },
+  { 0x0177, 615, 221 },
+  { 0x0177, 370, 211 },
+  { 0x0177, 551, 211 },
+  { 0x0177, 0, 204 },
+  { 0x018C, 551, 229 },
+  { 0x0191, 551, 229 },
+  { 0x019C, 280, 229 },
+  { 0x01AC, 252, 229 },
+  { 0x01AC, 97, 226 },
+  { 0x01AC, 225, 211 },
+  { 0x01AC, 588, 211 },
+  { 0x01AC, 124, 204 },
+  { 0x01AC, 606, 196 },
+  { 0x01D7, 659, 211 },
+  { 0x01F5, 615, 221 },
+  { 0x021D, 345, 211 },
+  { 0x0224, 659, 255 },
+  { 0x0227, 393, 229 },
+  { 0x0227, 575, 229 },
+  { 0x0227, 155, 226 },
+  { 0x0227, 51, 216 },
+  { 0x0227, 315, 211 },
+  { 0x0227, 589, 211 },
+  { 0x0227, 638, 204 },
+  { 0x0227, 160, 196 },
+  { 0x023B, 227, 229 },
+  { 0x023B, 551, 226 },
+  { 0x023B, 492, 221 },
+  { 0x023B, 164, 216 },
+  { 0x023B, 174, 216 },
+  { 0x023B, 471, 211 },
+  { 0x023B, 365, 204 },
+  { 0x023B, 536, 204 },
+  { 0x0243, 123, 221 },
+  { 0x0243, 265, 221 },
+  { 0x0243, 332, 204 },
+  { 0x024C, 396, 226 },
+  { 0x024C, 401, 221 },
+  { 0x024C, 345, 211 },
+  { 0x0260, 571, 251 },
+  { 0x0260, 615, 211 },
+  { 0x0260, 370, 204 },
+  { 0x0273, 285, 229 },
+  { 0x0273, 568, 221 },
+  { 0x0275, 285, 216 },
+  { 0x0276, 285, 236 },
+  { 0xFFFF, 275, 251 },
+  { 0xFFFF, 428, 236 },
+  { 0xFFFF, 102, 229 },
+  { 0xFFFF, 252, 221 },
+  { 0xFFFF, 375, 221 },
+  { 0xFFFF, 97, 216 },
+  { 0xFFFF, 370, 216 },
+  { 0xFFFF, 627, 211 },
+  { 0xFFFF, 630, 211 },
+  { 0xFFFF, 548, 204 },
+  { 0xFFFF, 629, 204 },
+  { 0xFFFF, 385, 196 },
+  { 0xFFFF, 615, 196 },
+  { 0xFFFF, 656, 196 },
+  { 0xFFFF, 588, 185 },
+  { 0xFFFF, 579, 177 },
+};
@@ -0,0 +1,312 @@
+#include "predict.h"
+
+#include "../../include/lexicon/lexicon_assets.h"
+
+#include <Preferences.h>
+
+// tools/lexicon_pack.py simulates this predictor for its benchmark; keep
+// the limits and the scoring below in step with it.
+static const uint8_t TRIE_CANDIDATES = 6;  // most frequent trie words considered
+static const uint8_t POOL_MAX = 24;        // candidates scored per lookup
+static const uint8_t LEARNED_MAX = 48;
+// Use adds at most LEARNED_CAP * LEARNED_STEP, so a learned word wins
+// between words of similar frequency but does not push out word pairs.
+static const uint8_t LEARNED_STEP = 8;
+static const uint8_t LEARNED_CAP = 4;
+// Halve all counts when one gets here: the top word drops back to the
+// cap, so counts stay in the range the score can tell apart.
+static const uint16_t LEARNED_DECAY_AT = LEARNED_CAP * 2;
+static const unsigned long SAVE_DELAY_MS = 30000;
+
+static const uint32_t NO_NODE = 0xFFFFFFFF;
+static const uint16_t NO_WORD = 0xFFFE;
+
+// Patient vocabulary: every finished word is counted, known or not. A
+// count adds to a word's score, so often used words rise to the top.
+// The table is kept most recently used first, also in NVS.
+struct LearnedWord {
+  char word[PREDICT_WORD_MAX];
+  uint16_t count;
+};
+static LearnedWord learned[LEARNED_MAX];
+static uint8_t learnedCount = 0;
+static bool learnedDirty = false;
+static unsigned long learnedChangedAt = 0;
+static Preferences wordPrefs;
+
+static uint32_t lookups = 0;
+static uint32_t lastLookupUs = 0;
+static uint32_t maxLookupUs = 0;
+
+void predictSetup() {
+  wordPrefs.begin("words", true);
+  size_t len = wordPrefs.getBytesLength("learned");
+  if (len && len % sizeof(LearnedWord) == 0 && len <= sizeof(learned)) {
+    wordPrefs.getBytes("learned", learned, len);
+    learnedCount = len / sizeof(LearnedWord);
+    for (uint8_t i = 0; i < learnedCount; i++) learned[i].word[PREDICT_WORD_MAX - 1] = '\0';
+  }
+  wordPrefs.end();
+  Serial.print("*** LEARNED WORDS: "); Serial.print(learnedCount); Serial.println(" ***");
+}
+
+static void saveLearned() {
+  wordPrefs.begin("words", false);
+  wordPrefs.putBytes("learned", learned, learnedCount * sizeof(LearnedWord));
+  wordPrefs.end();
+  learnedDirty = false;
+}
+
+void predictLoop() {
+  if (learnedDirty && millis() - learnedChangedAt >= SAVE_DELAY_MS) saveLearned();
+}
+
+// --- Trie ---
+
+static uint32_t readOffset(const uint8_t *p) {
+  return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16;
+}
+
+// Node reached by spelling text[0..len), or NO_NODE.
+static uint32_t nodeAt(const char *text, size_t len) {
+  uint32_t off = 0;
+  for (size_t i = 0; i < len; i++) {
+    const uint8_t *n = lexiconTrie + off;
+    const uint8_t *p = n + 2 + ((n[0] & LEXICON_TERMINAL) ? 3 : 0);
+    uint8_t kids = n[0] & LEXICON_CHILD_MASK;
+    uint8_t k = 0;
+    for (; k < kids; k++, p += 4) {
+      if (p[0] == (uint8_t)text[i]) break;
+    }
+    if (k == kids) return NO_NODE;
+    off = readOffset(p + 1);
+  }
+  return off;
+}
+
+static bool wordInfo(const char *word, uint16_t &id, uint8_t &freq) {
+  uint32_t off = nodeAt(word, strlen(word));
+  if (off == NO_NODE || !(lexiconTrie[off] & LEXICON_TERMINAL)) return false;
+  const uint8_t *n = lexiconTrie + off;
+  freq = n[2];
+  id = n[3] | n[4] << 8;
+  return true;
+}
+
+struct TrieTop {
+  uint16_t id[TRIE_CANDIDATES];
+  uint8_t freq[TRIE_CANDIDATES];
+  uint8_t count;
+};
+
+// Lowest frequency kept, the latest found on ties.
+static uint8_t lowestIndex(const TrieTop &top) {
+  uint8_t low = 0;
+  for (uint8_t i = 1; i < top.count; i++) {
+    if (top.freq[i] <= top.freq[low]) low = i;
+  }
+  return low;
+}
+
+static void offer(TrieTop &top, uint16_t id, uint8_t freq) {
+  if (top.count < TRIE_CANDIDATES) {
+    top.id[top.count] = id;
+    top.freq[top.count++] = freq;
+    return;
+  }
+  uint8_t low = lowestIndex(top);
+  if (freq > top.freq[low]) {
+    top.id[low] = id;
+    top.freq[low] = freq;
+  }
+}
+
+// Most frequent words below off. Children are stored best first, so the
+// walk stops at the first child whose best word cannot get in.
+static void collect(uint32_t off, uint32_t skip, TrieTop &top) {
+  const uint8_t *n = lexiconTrie + off;
+  const uint8_t *p = n + 2;
+  if (n[0] & LEXICON_TERMINAL) {
+    if (off != skip) offer(top, p[1] | p[2] << 8, p[0]);
+    p += 3;
+  }
+  uint8_t kids = n[0] & LEXICON_CHILD_MASK;
+  for (uint8_t k = 0; k < kids; k++, p += 4) {
+    uint32_t child = readOffset(p + 1);
+    if (top.count == TRIE_CANDIDATES && lexiconTrie[child + 1] <= top.freq[lowestIndex(top)]) break;
+    collect(child, skip, top);
+  }
+}
+
+// Pairs starting with prev occupy [first, end) of lexiconBigrams.
+static void pairRange(uint16_t prev, uint16_t &first, uint16_t &end) {
+  uint16_t lo = 0, hi = LEXICON_BIGRAM_COUNT;
+  while (lo < hi) {
+    uint16_t mid = (lo + hi) / 2;
+    if (lexiconBigrams[mid].prev < prev) lo = mid + 1;
+    else hi = mid;
+  }
+  first = end = lo;
+  while (end < LEXICON_BIGRAM_COUNT && lexiconBigrams[end].prev == prev) end++;
+}
+
+static const char *wordText(uint16_t id) {
+  return lexiconWords + lexiconWordOffsets[id];
+}
+
+// --- Scoring ---
+
+static int scoreWord(uint16_t prev, const char *word) {
+  int score = 0;
+  uint16_t id;
+  uint8_t freq;
+  if (wordInfo(word, id, freq)) {
+    score = freq;
+    if (prev != NO_WORD) {
+      uint16_t first, end;
+      pairRange(prev, first, end);
+      for (uint16_t i = first; i < end; i++) {
+        if (lexiconBigrams[i].next == id) score += 64 + lexiconBigrams[i].freq / 2;
+      }
+    }
+  }
+  for (uint8_t i = 0; i < learnedCount; i++) {
+    if (strcmp(learned[i].word, word) == 0) score += (learned[i].count < LEARNED_CAP ? learned[i].count : LEARNED_CAP) * LEARNED_STEP;
+  }
+  return score;
+}
+
+// Lower-case copy of a letters-only word; false for anything else.
+static bool copyWord(char *dst, const char *src, size_t len) {
+  if (len >= PREDICT_WORD_MAX) return false;
+  for (size_t i = 0; i < len; i++) {
+    if (!isAlpha(src[i])) return false;
+    dst[i] = tolower((unsigned char)src[i]);
+  }
+  dst[len] = '\0';
+  return true;
+}
+
+// Only the UI task looks words up, so the pool can live outside its stack.
+static char pool[POOL_MAX][PREDICT_WORD_MAX];
+static int poolScore[POOL_MAX];
+static uint8_t poolCount;
+
+static void propose(const char *word, const char *prefix, size_t prefixLen) {
+  if (poolCount == POOL_MAX) return;
+  if (strlen(word) <= prefixLen || strncmp(word, prefix, prefixLen) != 0) return;
+  for (uint8_t i = 0; i < poolCount; i++) {
+    if (strcmp(pool[i], word) == 0) return;
+  }
+  strcpy(pool[poolCount++], word);
+}
+
+// Higher score first, then the shorter word, then alphabetical.
+static bool ranksBefore(uint8_t a, uint8_t b) {
+  if (poolScore[a] != poolScore[b]) return poolScore[a] > poolScore[b];
+  size_t la = strlen(pool[a]), lb = strlen(pool[b]);
+  if (la != lb) return la < lb;
+  return strcmp(pool[a], pool[b]) < 0;
+}
+
+uint8_t predictComplete(const char *text, char out[][PREDICT_WORD_MAX], uint8_t max) {
+  uint32_t startUs = micros();
+  size_t len = strlen(text);
+  size_t start = len;
+  while (start > 0 && text[start - 1] != ' ') start--;
+  char prefix[PREDICT_WORD_MAX];
+  size_t prefixLen = len - start;
+  if (prefixLen >= PREDICT_WORD_MAX - 1 || !copyWord(prefix, text + start, prefixLen)) return 0;
+
+  // Previous word: its id picks the word pairs that apply.
+  uint16_t prev = LEXICON_START;
+  size_t end = start;
+  while (end > 0 && text[end - 1] == ' ') end--;
+  if (end > 0) {
+    size_t first = end;
+    while (first > 0 && text[first - 1] != ' ') first--;
+    char word[PREDICT_WORD_MAX];
+    uint8_t freq;
+    if (!copyWord(word, text + first, end - first) || !wordInfo(word, prev, freq)) prev = NO_WORD;
+  }
+
+  poolCount = 0;
+  uint32_t node = nodeAt(prefix, prefixLen);
+  if (node != NO_NODE) {
+    TrieTop top;
+    top.count = 0;
+    collect(node, node, top);
+    for (uint8_t i = 0; i < top.count; i++) propose(wordText(top.id[i]), prefix, prefixLen);
+  }
+  if (prev != NO_WORD) {
+    uint16_t first, last;
+    pairRange(prev, first, last);
+    for (uint16_t i = first; i < last; i++) propose(wordText(lexiconBigrams[i].next), prefix, prefixLen);
+  }
+  for (uint8_t i = 0; i < learnedCount; i++) propose(learned[i].word, prefix, prefixLen);
+
+  for (uint8_t i = 0; i < poolCount; i++) poolScore[i] = scoreWord(prev, pool[i]);
+  uint8_t found = 0;
+  bool taken[POOL_MAX] = {};
+  while (found < max) {
+    int best = -1;
+    for (uint8_t i = 0; i < poolCount; i++) {
+      if (!taken[i] && (best < 0 || ranksBefore(i, best))) best = i;
+    }
+    if (best < 0) break;
+    taken[best] = true;
+    strcpy(out[found++], pool[best]);
+  }
+
+  lastLookupUs = micros() - startUs;
+  if (lastLookupUs > maxLookupUs) maxLookupUs = lastLookupUs;
+  lookups++;
+  return found;
+}
+
+void predictLearn(const char *word) {
+  char w[PREDICT_WORD_MAX];
+  size_t len = strlen(word);
+  if (len < 2 || !copyWord(w, word, len)) return;
+
+  learnedDirty = true;
+  learnedChangedAt = millis();
+  LearnedWord entry;
+  uint8_t slot = learnedCount;
+  for (uint8_t i = 0; i < learnedCount; i++) {
+    if (strcmp(learned[i].word, w) == 0) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot < learnedCount) {
+    entry = learned[slot];
+    entry.count++;
+  } else {
+    if (learnedCount == LEARNED_MAX) {
+      // Evict the least used word; on a tie the one unused longest.
+      slot = LEARNED_MAX - 1;
+      for (uint8_t i = LEARNED_MAX - 1; i-- > 0;) {
+        if (learned[i].count < learned[slot].count) slot = i;
+      }
+    } else {
+      slot = learnedCount++;
+    }
+    strcpy(entry.word, w);
+    entry.count = 1;
+  }
+  // Move it to the front.
+  memmove(&learned[1], &learned[0], slot * sizeof(LearnedWord));
+  learned[0] = entry;
+  if (entry.count >= LEARNED_DECAY_AT) {
+    // Halving keeps recent use ahead of what was used a lot long ago.
+    for (uint8_t j = 0; j < learnedCount; j++) learned[j].count /= 2;
+  }
+}
+
+void predictPrintStatus(Stream &out) {
+  out.print("Word lookups: "); out.print(lookups);
+  out.print(", last/max us: "); out.print(lastLookupUs); out.print("/"); out.print(maxLookupUs);
+  out.print(", learned words: "); out.print(learnedCount); out.print("/"); out.print(LEARNED_MAX);
+  out.print(learnedDirty ? " (unsaved)\n" : "\n");
+}
@@ -0,0 +1,33 @@
+#ifndef PREDICT_H
+#define PREDICT_H
+
+#include <Arduino.h>
+
+// Word completion for the typed message. Words come from the vocabulary
+// packed into flash by tools/lexicon_pack.py (a letter trie with word
+// and word pair frequencies) plus the words the patient has used, which
+// are counted in a small table kept in NVS.
+//
+// A lookup walks at most a few dozen trie nodes and never allocates, so
+// it is run straight from the UI task after every change to the message.
+
+static const uint8_t PREDICT_MAX = 3;        // completions offered at once
+static const uint8_t PREDICT_WORD_MAX = 16;  // longest word + NUL
+
+void predictSetup();  // load the learned words from NVS
+
+// Completions for the word being typed at the end of text (any case),
+// ranked by frequency, by how often they follow the previous word and
+// by how often the patient has used them. Returns how many were written
+// to out, lower case. An empty last word predicts the next word.
+uint8_t predictComplete(const char *text, char out[][PREDICT_WORD_MAX], uint8_t max);
+
+// A word has been finished (completion taken or space typed).
+void predictLearn(const char *word);
+
+void predictLoop();  // UI task: writes learned words back to NVS after a quiet spell
+
+// Lookup timing and learned word count, for STATUS.
+void predictPrintStatus(Stream &out);
+
+#endif // PREDICT_H
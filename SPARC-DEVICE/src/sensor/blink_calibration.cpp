@@ -0,0 +1,229 @@
+#include "blink_calibration.h"
+
+#include "../settings/settings.h"
+#include "../hal/hal.h"
+#include "../network/net_events.h"
+#include "../../include/common_variables.h"
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Histogram layout: closed time in 20 ms bins up to 2 s, gaps in 50 ms
+// bins up to 5 s (the same ranges saveBlinkSettingsToPreferences allows).
+static const int HIST_BINS = 100;
+static const unsigned long DURATION_BIN_MS = 20;
+static const unsigned long GAP_BIN_MS = 50;
+// Every gap after a valid blink is recorded up to this fixed ceiling,
+// not only the ones shorter than the current blinkGap: a histogram cut
+// off at the threshold it is used to set could never see the patient
+// needing more time, and blinkGap could only ratchet one way. Longer
+// gaps cannot be within one gesture at any allowed blinkGap.
+static const unsigned long GAP_CEILING_MS = HIST_BINS * GAP_BIN_MS;
+// Halve all counts once a histogram holds this many samples, so old
+// behaviour fades out as the patient gets faster (or more tired).
+static const uint32_t HIST_DECAY_AT = 400;
+
+// Don't move thresholds before there is enough evidence.
+static const uint32_t MIN_DURATION_SAMPLES = 30;
+static const uint32_t MIN_CLASS_SAMPLES = 8;
+static const uint32_t MIN_GAP_SAMPLES = 15;
+// The gap histogram mixes gaps inside gestures with pauses between them.
+// Only trust its Otsu split when the two classes are clearly apart
+// (between-class / total variance); a patient who only ever blinks
+// singles has no gaps inside gestures, just one spread of pauses.
+static const double GAP_MIN_SEPARATION = 0.8;
+// Re-estimate after this many new samples.
+static const uint8_t UPDATE_EVERY = 8;
+// Move 1/4 of the way to the estimate per update.
+static const int STEP_DIVISOR = 4;
+// Gap threshold = 95th percentile of the gaps inside gestures * 5/4 + 100 ms.
+static const unsigned long GAP_MARGIN_MS = 100;
+// Only write flash when a value moved this much, and not too often.
+static const int PERSIST_MIN_CHANGE_MS = 20;
+static const unsigned long PERSIST_MIN_INTERVAL_MS = 30000;
+
+struct Histogram {
+  uint16_t bins[HIST_BINS];
+  uint32_t total;
+};
+
+static Histogram durationHist;
+static Histogram gapHist;
+static bool enabled = false;
+static uint8_t samplesSinceUpdate = 0;
+static int persistedDuration = 0;
+static int persistedGap = 0;
+static unsigned long lastPersistTime = 0;
+// Set on the sensor task, written to flash by calibrationLoop() on the
+// network task so a flash write never stalls blink capture.
+static volatile bool persistPending = false;
+static int durationEstimate = 0; // 0 = not enough data yet
+static int gapEstimate = 0;
+
+static void histAdd(Histogram &h, unsigned long value, unsigned long binMs) {
+  unsigned long bin = value / binMs;
+  if (bin >= HIST_BINS) bin = HIST_BINS - 1;
+  h.bins[bin]++;
+  h.total++;
+  if (h.total >= HIST_DECAY_AT) {
+    h.total = 0;
+    for (int i = 0; i < HIST_BINS; i++) {
+      h.bins[i] >>= 1;
+      h.total += h.bins[i];
+    }
+  }
+}
+
+// Otsu split: returns the first bin of the upper class, or -1 if there
+// are fewer than minTotal samples, either class is too small, or the
+// between-class share of the variance is below minSeparation.
+static int otsuSplit(const Histogram &h, uint32_t minTotal, double minSeparation) {
+  uint32_t total = 0;
+  uint64_t sumAll = 0;
+  uint64_t sumSqAll = 0;
+  for (int i = 0; i < HIST_BINS; i++) {
+    total += h.bins[i];
+    sumAll += (uint64_t)i * h.bins[i];
+    sumSqAll += (uint64_t)i * i * h.bins[i];
+  }
+  if (total < minTotal) return -1;
+
+  uint32_t wLow = 0;
+  uint64_t sumLow = 0;
+  double bestVar = -1.0;
+  int best = -1;
+  for (int t = 1; t < HIST_BINS; t++) {
+    wLow += h.bins[t - 1];
+    sumLow += (uint64_t)(t - 1) * h.bins[t - 1];
+    uint32_t wHigh = total - wLow;
+    if (wLow < MIN_CLASS_SAMPLES || wHigh < MIN_CLASS_SAMPLES) continue;
+    double meanLow = (double)sumLow / wLow;
+    double meanHigh = (double)(sumAll - sumLow) / wHigh;
+    double d = meanHigh - meanLow;
+    double var = (double)wLow * wHigh * d * d;
+    if (var > bestVar) {
+      bestVar = var;
+      best = t;
+    }
+  }
+  // bestVar / (total * sumSq - sumAll^2) is the between-class share of
+  // the variance; both sides are scaled by total^2.
+  double spread = (double)total * sumSqAll - (double)sumAll * sumAll;
+  if (best > 0 && minSeparation > 0 && (spread <= 0 || bestVar / spread < minSeparation)) return -1;
+  return best;
+}
+
+// Percentile over bins [0, endBin).
+static int percentileBin(const Histogram &h, int endBin, int percent) {
+  uint32_t total = 0;
+  for (int i = 0; i < endBin; i++) total += h.bins[i];
+  if (total < MIN_CLASS_SAMPLES) return -1;
+  uint32_t target = (total * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (int i = 0; i < endBin; i++) {
+    seen += h.bins[i];
+    if (seen >= target) return i;
+  }
+  return endBin - 1;
+}
+
+static int stepTowards(int current, int target) {
+  int delta = (target - current) / STEP_DIVISOR;
+  if (delta == 0 && target != current) delta = (target > current) ? 1 : -1;
+  return current + delta;
+}
+
+// Settings and commands write the thresholds from other tasks. Step from
+// the value read, and leave it alone if one of them changed it meanwhile.
+static void stepSetting(std::atomic<int> &setting, int target) {
+  int current = setting.load();
+  setting.compare_exchange_strong(current, stepTowards(current, target));
+}
+
+static void updateThresholds() {
+  samplesSinceUpdate = 0;
+
+  int split = otsuSplit(durationHist, MIN_DURATION_SAMPLES, 0);
+  if (split > 0) {
+    durationEstimate = split * DURATION_BIN_MS;
+    stepSetting(blinkDuration, durationEstimate);
+  }
+  int gapSplit = otsuSplit(gapHist, MIN_GAP_SAMPLES, GAP_MIN_SEPARATION);
+  int p95 = gapSplit > 0 ? percentileBin(gapHist, gapSplit, 95) : -1;
+  if (p95 >= 0) {
+    gapEstimate = ((p95 + 1) * GAP_BIN_MS) * 5 / 4 + GAP_MARGIN_MS;
+    stepSetting(blinkGap, gapEstimate);
+  }
+  clampBlinkSettings();
+
+  bool moved = abs(blinkDuration - persistedDuration) >= PERSIST_MIN_CHANGE_MS ||
+               abs(blinkGap - persistedGap) >= PERSIST_MIN_CHANGE_MS;
+  if (moved && halMillis() - lastPersistTime >= PERSIST_MIN_INTERVAL_MS) {
+    persistPending = true;
+    netEventsWake();
+    persistedDuration = blinkDuration;
+    persistedGap = blinkGap;
+    lastPersistTime = halMillis();
+    Serial.print("[CAL] Thresholds updated - min blink: ");
+    Serial.print(blinkDuration);
+    Serial.print(" ms, gap: ");
+    Serial.print(blinkGap);
+    Serial.println(" ms");
+  }
+}
+
+void calibrationSetup() {
+  Preferences prefs;
+  prefs.begin("blinkcfg", false);
+  enabled = prefs.getUChar("autoCal", 0) != 0;
+  prefs.end();
+  persistedDuration = blinkDuration;
+  persistedGap = blinkGap;
+}
+
+void calibrationSetEnabled(bool on) {
+  enabled = on;
+  if (on) {
+    memset(&durationHist, 0, sizeof(durationHist));
+    memset(&gapHist, 0, sizeof(gapHist));
+    samplesSinceUpdate = 0;
+    durationEstimate = 0;
+    gapEstimate = 0;
+    persistedDuration = blinkDuration;
+    persistedGap = blinkGap;
+  }
+  Preferences prefs;
+  prefs.begin("blinkcfg", false);
+  prefs.putUChar("autoCal", on ? 1 : 0);
+  prefs.end();
+}
+
+void calibrationLoop() {
+  if (!persistPending) return;
+  persistPending = false;
+  saveBlinkSettingsToPreferences();
+}
+
+bool calibrationEnabled() {
+  return enabled;
+}
+
+void calibrationRecordBlink(unsigned long closedMs) {
+  if (!enabled) return;
+  histAdd(durationHist, closedMs, DURATION_BIN_MS);
+  if (++samplesSinceUpdate >= UPDATE_EVERY) updateThresholds();
+}
+
+void calibrationRecordGap(unsigned long gapMs) {
+  if (!enabled || gapMs >= GAP_CEILING_MS) return;
+  histAdd(gapHist, gapMs, GAP_BIN_MS);
+}
+
+void calibrationPrintStatus(Stream &out) {
+  out.print("Auto Calibration: "); out.print(enabled ? "ON" : "OFF"); out.print("\n");
+  if (!enabled) return;
+  out.print("Calibration Samples (blink/gap): ");
+  out.print(durationHist.total); out.print("/"); out.print(gapHist.total); out.print("\n");
+  out.print("Calibration Estimate (blink/gap): ");
+  out.print(durationEstimate); out.print("/"); out.print(gapEstimate); out.print("\n");
+}
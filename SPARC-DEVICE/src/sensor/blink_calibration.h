@@ -0,0 +1,27 @@
+#ifndef BLINK_CALIBRATION_H
+#define BLINK_CALIBRATION_H
+
+#include <Arduino.h>
+
+// Online calibration of blinkDuration / blinkGap. While enabled, every
+// closed-eye duration and every gap from a valid blink to the next
+// closing (up to 5 s) is added to a decaying histogram. The duration
+// histogram is split into involuntary vs intentional blinks (Otsu), the
+// gap histogram into gaps inside gestures vs pauses between them, which
+// gives the patient's own inter-blink rhythm. Both thresholds are nudged
+// towards those estimates and persisted to the "blinkcfg" namespace
+// from the network task.
+void calibrationSetup();                  // load the enabled flag
+void calibrationSetEnabled(bool enabled); // persisted
+bool calibrationEnabled();
+
+// Sensor task.
+void calibrationRecordBlink(unsigned long closedMs);
+void calibrationRecordGap(unsigned long gapMs);  // eye open since a valid blink
+// Network task: writes thresholds the sensor task has settled on to NVS.
+void calibrationLoop();
+
+// Print histogram sizes and the current estimates.
+void calibrationPrintStatus(Stream &out);
+
+#endif // BLINK_CALIBRATION_H
@@ -0,0 +1,82 @@
+#include "blink_events.h"
+
+#include "../hal/hal.h"
+
+#include <Arduino.h>
+
+static const UBaseType_t EVENT_QUEUE_LENGTH = 8;
+
+struct LatencyStats {
+  uint32_t count;
+  uint32_t lastUs;
+  uint32_t maxUs;
+  uint32_t dropped;
+};
+
+static const char* const consumerNames[BLINK_CONSUMER_COUNT] = { "UI", "Net" };
+
+static QueueHandle_t eventQueues[BLINK_CONSUMER_COUNT];
+static LatencyStats stats[BLINK_CONSUMER_COUNT];
+static volatile bool gesturePending = false;
+static volatile unsigned long pendingSinceMs = 0;
+
+void blinkEventsSetup() {
+  for (int i = 0; i < BLINK_CONSUMER_COUNT; i++) {
+    eventQueues[i] = xQueueCreate(EVENT_QUEUE_LENGTH, sizeof(BlinkEvent));
+  }
+}
+
+void blinkEventsPublish(BlinkGesture g) {
+  BlinkEvent e = { g, (uint32_t)halMicros() };
+  for (int i = 0; i < BLINK_CONSUMER_COUNT; i++) {
+    if (xQueueSend(eventQueues[i], &e, 0) != pdTRUE) stats[i].dropped++;
+  }
+}
+
+void blinkEventsSetPending(bool pending, unsigned long sinceMs) {
+  if (pending && !gesturePending) pendingSinceMs = sinceMs;  // before the flag
+  gesturePending = pending;
+}
+
+bool blinkEventsPending(unsigned long &sinceMs) {
+  if (!gesturePending) return false;
+  sinceMs = pendingSinceMs;
+  return true;
+}
+
+// The raw sensor level covers the debounce window before the classifier
+// has seen the eye close.
+bool blinkEventsGestureActive() {
+  return gesturePending || !halIrSensorRead();
+}
+
+bool blinkEventsReceive(BlinkConsumer who, BlinkEvent &e, TickType_t wait) {
+  return xQueueReceive(eventQueues[who], &e, wait) == pdTRUE;
+}
+
+void blinkEventsHandled(BlinkConsumer who, const BlinkEvent &e) {
+  LatencyStats &s = stats[who];
+  uint32_t latency = halMicros() - e.decidedUs;
+  s.count++;
+  s.lastUs = latency;
+  if (latency > s.maxUs) {
+    s.maxUs = latency;
+    Serial.print("[LATENCY] new worst blink-to-");
+    Serial.print(consumerNames[who]);
+    Serial.print(" action: ");
+    Serial.print(latency);
+    Serial.println(" us");
+  }
+}
+
+void blinkEventsPrintStats(Stream &out) {
+  for (int i = 0; i < BLINK_CONSUMER_COUNT; i++) {
+    const LatencyStats &s = stats[i];
+    out.print(consumerNames[i]);
+    out.print(" blink events: "); out.print(s.count);
+    out.print(", latency us last/max: "); out.print(s.lastUs);
+    out.print("/"); out.print(s.maxUs);
+    out.print(", dropped: "); out.print(s.dropped);
+    out.print("\n");
+  }
+}
@@ -0,0 +1,47 @@
+#ifndef BLINK_EVENTS_H
+#define BLINK_EVENTS_H
+
+#include <Arduino.h>
+
+#include "gesture.h"
+
+// Gesture events from the sensor task to the tasks that act on them.
+// Every consumer has its own FreeRTOS queue so a slow one (e.g. the
+// network task stuck in a socket call) never delays the others.
+enum BlinkConsumer : uint8_t {
+  BLINK_CONSUMER_UI,
+  BLINK_CONSUMER_NET,
+  BLINK_CONSUMER_COUNT,
+};
+
+struct BlinkEvent {
+  BlinkGesture gesture;
+  uint32_t decidedUs;  // halMicros() when the classifier reported it
+};
+
+void blinkEventsSetup();
+
+// Sensor task: hand a gesture to every consumer. Never blocks; an event
+// for a full queue is dropped and counted.
+void blinkEventsPublish(BlinkGesture g);
+
+// Sensor task: whether a gesture is being blinked right now, and when
+// the eye closed for it (millis()).
+void blinkEventsSetPending(bool pending, unsigned long sinceMs);
+
+// Any task: a gesture is being blinked; sinceMs is when it started.
+bool blinkEventsPending(unsigned long &sinceMs);
+
+// Any task: the eye is closed or a gesture is still being blinked, so an
+// event may be on its way. Timed scanning holds the highlight meanwhile.
+bool blinkEventsGestureActive();
+
+// Wait up to `wait` ticks for the next event for `who`.
+bool blinkEventsReceive(BlinkConsumer who, BlinkEvent &e, TickType_t wait);
+
+// Call once the action for `e` is done; tracks blink-to-action latency.
+void blinkEventsHandled(BlinkConsumer who, const BlinkEvent &e);
+
+void blinkEventsPrintStats(Stream &out);
+
+#endif // BLINK_EVENTS_H
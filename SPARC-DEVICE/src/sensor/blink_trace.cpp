@@ -0,0 +1,80 @@
+#include "blink_trace.h"
+
+#include "gesture.h"
+
+#include <Arduino.h>
+
+struct TraceEdge {
+  uint32_t timeMs;
+  bool eyeOpen;
+};
+
+static Stream *recordOut = nullptr;
+static volatile unsigned long lastRecordedEdge = 0;
+
+// Edges are recorded on the sensor task and written out by whoever owns
+// recordOut (the network task), so they go through a small SPSC ring.
+static const uint16_t RECORD_RING_SIZE = 32;
+static TraceEdge recordRing[RECORD_RING_SIZE];
+static volatile uint16_t recordHead = 0;
+static volatile uint16_t recordTail = 0;
+static volatile bool recording = false;
+
+void blinkTraceRecordEdge(bool eyeOpen, unsigned long tMs) {
+  lastRecordedEdge = tMs;
+  if (!recording) return;
+  uint16_t next = (recordHead + 1) % RECORD_RING_SIZE;
+  if (next == recordTail) return;  // writer fell behind; drop
+  recordRing[recordHead] = { (uint32_t)tMs, eyeOpen };
+  __sync_synchronize();
+  recordHead = next;
+}
+
+bool blinkTraceRecording() {
+  return recording;
+}
+
+void blinkTraceLoop() {
+  while (recordTail != recordHead) {
+    TraceEdge e = recordRing[recordTail];
+    recordTail = (recordTail + 1) % RECORD_RING_SIZE;
+    if (!recordOut) continue;
+    recordOut->print("E ");
+    recordOut->print(e.timeMs);
+    recordOut->print(e.eyeOpen ? " 1\n" : " 0\n");
+  }
+}
+
+void blinkTraceRecord(Stream *target, Stream &out) {
+  if (target) {
+    recordOut = target;
+    recordTail = recordHead;
+    recording = true;
+    out.print("Trace recording started\n");
+  } else {
+    recording = false;
+    blinkTraceLoop();
+    recordOut = nullptr;
+    out.print("Trace recording stopped\n");
+  }
+}
+
+void blinkTraceDetach(Stream &target) {
+  if (recordOut != &target) return;
+  recording = false;
+  recordOut = nullptr;
+}
+
+void blinkTraceLabel(const char *gesture, Stream &out) {
+  BlinkGesture g = gestureFromName(gesture);
+  if (g == GESTURE_NONE) {
+    out.print("Unknown gesture label\n");
+  } else if (recordOut) {
+    blinkTraceLoop();  // keep the L line after the edges it labels
+    recordOut->print("L ");
+    recordOut->print(lastRecordedEdge);
+    recordOut->print(" ");
+    recordOut->print(gestureName(g));
+    recordOut->print("\n");
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef BLINK_TRACE_H
+#define BLINK_TRACE_H
+
+#include <Arduino.h>
+
+// Recorded IR traces for judging the gesture classifier on real data.
+//
+// Trace format: one record per line, times in ms, ascending.
+//   E <time> <level>     debounced eye transition, level 1 = open, 0 = closed
+//   L <time> <gesture>   ground truth: <gesture> (Single, Double, Triple,
+//                        Quad, Hold) was intended, ending at <time>
+//
+// Recording: TRACE:ON streams E lines for every live transition to the
+// stream that asked for it; TRACE_LABEL:<gesture> appends an L line for
+// the gesture just performed; TRACE:OFF stops.
+//
+// Replay runs on the host, not the device: build/trace_replay (host
+// build, host/bench/trace_replay.cpp) feeds saved traces through the same
+// classifier and reports detection latency percentiles, false
+// positives/negatives and cycles per edge.
+
+// Command handlers (network/commands.cpp); status lines go to out.
+// Recording writes to target until stopped (target == nullptr) or until
+// blinkTraceDetach() is called for it.
+void blinkTraceRecord(Stream *target, Stream &out);
+void blinkTraceDetach(Stream &target);
+void blinkTraceLabel(const char *gesture, Stream &out);
+
+// Called by getBlinks() (sensor task) for every debounced transition.
+void blinkTraceRecordEdge(bool eyeOpen, unsigned long tMs);
+
+bool blinkTraceRecording();
+
+// Write recorded edges to the TRACE:ON stream. Call from the task that
+// runs processCommand().
+void blinkTraceLoop();
+
+#endif // BLINK_TRACE_H
@@ -0,0 +1,167 @@
+#include "gesture.h"
+
+#include "blink_calibration.h"
+
+#include "../../include/common_variables.h"
+
+#include <Arduino.h>
+
+// Min closed time for the 3rd and later blink of a burst, so the
+// emergency pattern can be blinked quickly.
+static const unsigned long EMERGENCY_BLINK_MIN = 250;
+// Eye closed for longHoldFactor * blinkDuration (at least LONG_HOLD_MIN)
+// is a long hold rather than a blink.
+static const unsigned long LONG_HOLD_MIN = 1500;
+static const unsigned long LONG_HOLD_FACTOR = 3;
+
+// Gesture reported for N valid blinks. The longest entry is terminal:
+// it is reported as soon as its last blink ends, without waiting for
+// the gap to expire, because no longer pattern can follow it.
+static const BlinkGesture countGestures[] = {
+  GESTURE_NONE, GESTURE_SINGLE, GESTURE_DOUBLE, GESTURE_TRIPLE, GESTURE_QUAD
+};
+static const int MAX_GESTURE_BLINKS = sizeof(countGestures) / sizeof(countGestures[0]) - 1;
+
+enum GestureState : uint8_t {
+  GS_IDLE,    // eye open, nothing pending
+  GS_CLOSED,  // eye closed, blink in progress
+  GS_OPEN,    // eye open after >= 1 blink, waiting for the gap
+  GS_HOLD,    // long hold already reported, waiting for the eye to open
+  GS_COUNT
+};
+
+enum GestureInput : uint8_t {
+  GI_CLOSE,         // eye closed
+  GI_OPEN_VALID,    // eye opened after a long enough blink
+  GI_OPEN_SHORT,    // eye opened after an involuntary blink
+  GI_GAP_TIMEOUT,   // eye open for longer than blinkGap
+  GI_HOLD_TIMEOUT,  // eye closed for longer than the long hold time
+  GI_COUNT
+};
+
+enum GestureAction : uint8_t {
+  GA_NONE,
+  GA_MARK_CLOSE,   // remember when the eye closed
+  GA_COUNT_BLINK,  // count a valid blink, report it if it is terminal
+  GA_EMIT_COUNT,   // report the pending blink count
+  GA_EMIT_HOLD,    // report a long hold (or the pending count before it)
+};
+
+struct GestureTransition {
+  GestureState next;
+  GestureAction action;
+};
+
+static const GestureTransition transitions[GS_COUNT][GI_COUNT] = {
+  //            GI_CLOSE                   GI_OPEN_VALID                GI_OPEN_SHORT            GI_GAP_TIMEOUT           GI_HOLD_TIMEOUT
+  /* IDLE   */ { {GS_CLOSED, GA_MARK_CLOSE}, {GS_IDLE, GA_NONE},          {GS_IDLE, GA_NONE},      {GS_IDLE, GA_NONE},      {GS_IDLE, GA_NONE} },
+  /* CLOSED */ { {GS_CLOSED, GA_NONE},       {GS_OPEN, GA_COUNT_BLINK},   {GS_OPEN, GA_NONE},      {GS_CLOSED, GA_NONE},    {GS_HOLD, GA_EMIT_HOLD} },
+  /* OPEN   */ { {GS_CLOSED, GA_MARK_CLOSE}, {GS_OPEN, GA_NONE},          {GS_OPEN, GA_NONE},      {GS_IDLE, GA_EMIT_COUNT}, {GS_OPEN, GA_NONE} },
+  /* HOLD   */ { {GS_HOLD, GA_NONE},         {GS_IDLE, GA_NONE},          {GS_IDLE, GA_NONE},      {GS_HOLD, GA_NONE},      {GS_HOLD, GA_NONE} },
+};
+
+static unsigned long longHoldTime() {
+  unsigned long t = (unsigned long)blinkDuration * LONG_HOLD_FACTOR;
+  return t < LONG_HOLD_MIN ? LONG_HOLD_MIN : t;
+}
+
+static unsigned long minBlinkTime(const GestureContext &ctx) {
+  // Use different min duration for emergency blinks
+  return (ctx.blinkCount >= 2) ? EMERGENCY_BLINK_MIN : (unsigned long)blinkDuration;
+}
+
+static BlinkGesture step(GestureContext &ctx, GestureInput input, unsigned long tMs) {
+  const GestureTransition &tr = transitions[ctx.state][input];
+  BlinkGesture out = GESTURE_NONE;
+  ctx.state = tr.next;
+  switch (tr.action) {
+    case GA_MARK_CLOSE:
+      ctx.closeTime = tMs;
+      break;
+    case GA_COUNT_BLINK:
+      ctx.blinkCount++;
+      ctx.openTime = tMs;
+      ctx.gapOpen = true;
+      if (ctx.feedCalibration) {
+        Serial.print("Blink #");
+        Serial.print(ctx.blinkCount);
+        Serial.print(", Duration: ");
+        Serial.print(tMs - ctx.closeTime);
+        Serial.println(" ms");
+      }
+      if (ctx.blinkCount >= MAX_GESTURE_BLINKS) {
+        out = countGestures[MAX_GESTURE_BLINKS];
+        ctx.state = GS_IDLE;
+      }
+      break;
+    case GA_EMIT_COUNT:
+      out = countGestures[ctx.blinkCount];
+      break;
+    case GA_EMIT_HOLD:
+      out = ctx.blinkCount ? countGestures[ctx.blinkCount] : GESTURE_LONG_HOLD;
+      break;
+    default:
+      break;
+  }
+  if (ctx.state == GS_IDLE || ctx.state == GS_HOLD) ctx.blinkCount = 0;
+  return out;
+}
+
+void gestureReset(GestureContext &ctx, bool feedCalibration) {
+  ctx.state = GS_IDLE;
+  ctx.blinkCount = 0;
+  ctx.closeTime = 0;
+  ctx.openTime = 0;
+  ctx.gapOpen = false;
+  ctx.feedCalibration = feedCalibration;
+}
+
+BlinkGesture gestureTick(GestureContext &ctx, unsigned long nowMs) {
+  if (ctx.state == GS_CLOSED && nowMs - ctx.closeTime >= longHoldTime()) {
+    return step(ctx, GI_HOLD_TIMEOUT, nowMs);
+  }
+  if (ctx.state == GS_OPEN && nowMs - ctx.openTime >= (unsigned long)blinkGap) {
+    return step(ctx, GI_GAP_TIMEOUT, nowMs);
+  }
+  return GESTURE_NONE;
+}
+
+bool gestureInProgress(const GestureContext &ctx) {
+  return ctx.state == GS_CLOSED || (ctx.state == GS_OPEN && ctx.blinkCount > 0);
+}
+
+BlinkGesture gestureFeedEdge(GestureContext &ctx, bool eyeOpen, unsigned long tMs) {
+  // Timeouts that expired before this edge happened come first.
+  BlinkGesture out = gestureTick(ctx, tMs);
+  if (!eyeOpen) {
+    // Also after the gap timed out: calibration needs the gaps too long
+    // for the current blinkGap as well as the ones inside a gesture.
+    if (ctx.feedCalibration && ctx.gapOpen) calibrationRecordGap(tMs - ctx.openTime);
+    ctx.gapOpen = false;
+    step(ctx, GI_CLOSE, tMs);
+  } else {
+    if (ctx.feedCalibration && ctx.state == GS_CLOSED) calibrationRecordBlink(tMs - ctx.closeTime);
+    bool valid = (tMs - ctx.closeTime) >= minBlinkTime(ctx);
+    BlinkGesture g = step(ctx, valid ? GI_OPEN_VALID : GI_OPEN_SHORT, tMs);
+    if (g != GESTURE_NONE) out = g;
+  }
+  return out;
+}
+
+const char* gestureName(BlinkGesture g) {
+  switch (g) {
+    case GESTURE_SINGLE: return "Single";
+    case GESTURE_DOUBLE: return "Double";
+    case GESTURE_TRIPLE: return "Triple";
+    case GESTURE_QUAD: return "Quad";
+    case GESTURE_LONG_HOLD: return "Hold";
+    default: return "None";
+  }
+}
+
+BlinkGesture gestureFromName(const char* name) {
+  for (uint8_t g = GESTURE_SINGLE; g <= GESTURE_LONG_HOLD; g++) {
+    if (strcasecmp(name, gestureName((BlinkGesture)g)) == 0) return (BlinkGesture)g;
+  }
+  return GESTURE_NONE;
+}
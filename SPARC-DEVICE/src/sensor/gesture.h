@@ -0,0 +1,41 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <Arduino.h>
+
+enum BlinkGesture : uint8_t {
+  GESTURE_NONE = 0,
+  GESTURE_SINGLE,
+  GESTURE_DOUBLE,
+  GESTURE_TRIPLE,
+  GESTURE_QUAD,       // emergency
+  GESTURE_LONG_HOLD,
+};
+
+// Table-driven blink gesture classifier. Feed it debounced eye
+// transitions in time order and call gestureTick() regularly; each call
+// is O(1) and returns the gesture that just became unambiguous, if any.
+// Timing comes from blinkDuration / blinkGap (common_variables.h).
+// All state lives in a GestureContext so the live sensor path and a
+// trace replay can run side by side.
+struct GestureContext {
+  uint8_t state;
+  int blinkCount;              // valid blinks in the gesture being built
+  unsigned long closeTime;
+  unsigned long openTime;
+  bool gapOpen;                // eye open since the last valid blink
+  bool feedCalibration;        // report samples to blink_calibration
+};
+
+void gestureReset(GestureContext &ctx, bool feedCalibration);
+BlinkGesture gestureFeedEdge(GestureContext &ctx, bool eyeOpen, unsigned long tMs);
+BlinkGesture gestureTick(GestureContext &ctx, unsigned long nowMs);
+// The eye is closed, or counted blinks are waiting out the gap. An
+// involuntary blink stops counting as soon as the eye opens again.
+bool gestureInProgress(const GestureContext &ctx);
+
+const char* gestureName(BlinkGesture g);
+// Inverse of gestureName(), case-insensitive. GESTURE_NONE if unknown.
+BlinkGesture gestureFromName(const char* name);
+
+#endif // GESTURE_H
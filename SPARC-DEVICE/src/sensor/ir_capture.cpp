@@ -0,0 +1,60 @@
+#include "ir_capture.h"
+
+#include "../hal/hal.h"
+
+#include <Arduino.h>
+
+// Must be a power of two. 64 edges = 32 full blinks of slack, far more
+// than the sensor task can ever stall for.
+static const uint16_t IR_RING_SIZE = 64;
+static const uint16_t IR_RING_MASK = IR_RING_SIZE - 1;
+
+static IrEdge irRing[IR_RING_SIZE];
+// head is only written by the ISR, tail only by the consumer. Both are
+// free-running counters; the difference is the fill level.
+static volatile uint16_t irHead = 0;
+static volatile uint16_t irTail = 0;
+static volatile uint32_t irDropped = 0;
+static TaskHandle_t irNotifyTask = nullptr;
+
+static void IRAM_ATTR irCaptureIsr() {
+  uint32_t now = halMicros();
+  uint16_t head = irHead;
+  if ((uint16_t)(head - irTail) >= IR_RING_SIZE) {
+    irDropped++;
+    return;
+  }
+  irRing[head & IR_RING_MASK].timeUs = now;
+  irRing[head & IR_RING_MASK].eyeOpen = halIrSensorRead();
+  __sync_synchronize(); // publish the slot before moving head
+  irHead = head + 1;
+  if (irNotifyTask) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(irNotifyTask, &woken);
+    if (woken) portYIELD_FROM_ISR();
+  }
+}
+
+void irCaptureSetup() {
+  irHead = 0;
+  irTail = 0;
+  irDropped = 0;
+  halAttachIrInterrupt(irCaptureIsr);
+}
+
+void irCaptureNotifyTask(TaskHandle_t task) {
+  irNotifyTask = task;
+}
+
+bool irCapturePop(IrEdge &edge) {
+  uint16_t tail = irTail;
+  if (tail == irHead) return false;
+  __sync_synchronize(); // read the slot only after seeing head move
+  edge = irRing[tail & IR_RING_MASK];
+  irTail = tail + 1;
+  return true;
+}
+
+uint32_t irCaptureDropped() {
+  return irDropped;
+}
@@ -0,0 +1,25 @@
+#ifndef IR_CAPTURE_H
+#define IR_CAPTURE_H
+
+#include <Arduino.h>
+
+// One IR sensor transition as seen by the interrupt handler.
+struct IrEdge {
+  uint32_t timeUs;  // halMicros() at the edge
+  bool eyeOpen;     // sensor level after the edge (HIGH = open)
+};
+
+// Attach the edge ISR. Edges are queued into a lock-free
+// single-producer (ISR) / single-consumer (sensor task) ring buffer.
+void irCaptureSetup();
+
+// Wake `task` (ulTaskNotifyTake) on every captured edge.
+void irCaptureNotifyTask(TaskHandle_t task);
+
+// Pop the oldest captured edge. Returns false when the buffer is empty.
+bool irCapturePop(IrEdge &edge);
+
+// Number of edges lost because the consumer fell behind.
+uint32_t irCaptureDropped();
+
+#endif // IR_CAPTURE_H
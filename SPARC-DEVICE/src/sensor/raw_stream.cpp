@@ -0,0 +1,110 @@
+#include "raw_stream.h"
+
+#include <Arduino.h>
+
+// Must be a power of two: 128 edges covers more than one batch interval
+// at the full edge budget.
+static const uint16_t RAW_RING_SIZE = 128;
+static const uint16_t RAW_RING_MASK = RAW_RING_SIZE - 1;
+// Rate limit as a credit of sensor time: every edge costs
+// 1 s / RAW_MAX_EDGES_PER_SEC, credit builds up to one second's worth.
+static const uint32_t RAW_MAX_EDGES_PER_SEC = 500;
+static const uint32_t RAW_EDGE_COST_US = 1000000UL / RAW_MAX_EDGES_PER_SEC;
+static const uint32_t RAW_CREDIT_MAX_US = 1000000UL;
+static const uint8_t RAW_HEADER_SIZE = 7;
+static const uint8_t RAW_VARINT_MAX = 5;  // 33 bits
+
+// Same scheme as the IR ring: head written by the sensor task, tail by
+// the network task, both free running.
+static IrEdge rawRing[RAW_RING_SIZE];
+static volatile uint16_t rawHead = 0;
+static volatile uint16_t rawTail = 0;
+static volatile bool rawEnabled = false;
+
+// Sensor task only.
+static uint32_t creditUs = RAW_CREDIT_MAX_US;
+static uint32_t lastEdgeUs = 0;
+static volatile uint32_t droppedTotal = 0;
+
+// Network task only.
+static uint32_t droppedReported = 0;
+static unsigned long lastBatchMs = 0;
+static uint32_t edgesSent = 0;
+static uint32_t batchesSent = 0;
+
+void rawStreamEnable(bool on) {
+  if (on && !rawEnabled) {
+    rawTail = rawHead;
+    droppedReported = droppedTotal;
+    lastBatchMs = millis();
+  }
+  rawEnabled = on;
+}
+
+void rawStreamPushEdge(const IrEdge &edge) {
+  if (!rawEnabled) return;
+  uint32_t elapsed = edge.timeUs - lastEdgeUs;
+  lastEdgeUs = edge.timeUs;
+  creditUs = elapsed >= RAW_CREDIT_MAX_US - creditUs ? RAW_CREDIT_MAX_US : creditUs + elapsed;
+
+  uint16_t head = rawHead;
+  if (creditUs < RAW_EDGE_COST_US || (uint16_t)(head - rawTail) >= RAW_RING_SIZE) {
+    droppedTotal++;
+    return;
+  }
+  creditUs -= RAW_EDGE_COST_US;
+  rawRing[head & RAW_RING_MASK] = edge;
+  __sync_synchronize();
+  rawHead = head + 1;
+}
+
+static uint8_t putVarint(uint8_t *p, uint64_t v) {
+  uint8_t n = 0;
+  do {
+    uint8_t b = v & 0x7F;
+    v >>= 7;
+    p[n++] = v ? (b | 0x80) : b;
+  } while (v);
+  return n;
+}
+
+uint16_t rawStreamTakeBatch(uint8_t *out) {
+  if (!rawEnabled) return 0;
+  uint16_t tail = rawTail;
+  uint32_t dropped = droppedTotal - droppedReported;
+  if (tail == rawHead && dropped == 0) return 0;
+  if (millis() - lastBatchMs < RAW_BATCH_INTERVAL_MS) return 0;
+  __sync_synchronize();
+
+  uint16_t n = RAW_HEADER_SIZE;
+  uint8_t count = 0;
+  uint32_t base = tail != rawHead ? rawRing[tail & RAW_RING_MASK].timeUs : 0;
+  uint32_t prev = base;
+  while (tail != rawHead && count < 255 && n + RAW_VARINT_MAX <= RAW_BATCH_MAX) {
+    const IrEdge &e = rawRing[tail & RAW_RING_MASK];
+    n += putVarint(out + n, ((uint64_t)(e.timeUs - prev) << 1) | (e.eyeOpen ? 1 : 0));
+    prev = e.timeUs;
+    tail++;
+    count++;
+  }
+  rawTail = tail;
+
+  if (dropped > 0xFFFF) dropped = 0xFFFF;  // the rest goes in the next batch
+  for (uint8_t i = 0; i < 4; i++) out[i] = base >> (8 * i);
+  out[4] = dropped;
+  out[5] = dropped >> 8;
+  out[6] = count;
+  droppedReported += dropped;
+  lastBatchMs = millis();
+  edgesSent += count;
+  batchesSent++;
+  return n;
+}
+
+void rawStreamPrintStatus(Stream &out) {
+  out.print("Raw edge stream: "); out.print(rawEnabled ? "on" : "off");
+  out.print(", edges sent: "); out.print(edgesSent);
+  out.print(" in "); out.print(batchesSent); out.print(" batches");
+  out.print(", dropped: "); out.print(droppedTotal);
+  out.print("\n");
+}
@@ -0,0 +1,37 @@
+#ifndef RAW_STREAM_H
+#define RAW_STREAM_H
+
+#include <Arduino.h>
+
+#include "ir_capture.h"
+
+// Raw IR edges (before debouncing) for offline analysis on the PC.
+// Turned on per client with STREAM_RAW:ON; the normal blink events keep
+// flowing alongside.
+//
+// Edges are batched and delta encoded, at most one batch every 100 ms
+// and 500 edges per second. Anything over the budget is dropped and
+// counted in the next batch. Batch payload (little endian):
+//
+//   baseUs u32    halMicros() of the first edge
+//   dropped u16   edges lost since the previous batch
+//   count u8      edges in this batch
+//   count x varint((deltaUs << 1) | level)
+//                 deltaUs from the previous edge (0 for the first),
+//                 level 1 = open; LEB128, 7 bits per byte
+static const uint16_t RAW_BATCH_MAX = 256;
+static const unsigned long RAW_BATCH_INTERVAL_MS = 100;
+
+// Start/stop capturing. Captured edges are discarded on start.
+void rawStreamEnable(bool on);
+
+// Sensor task: called for every edge popped from the IR ring.
+void rawStreamPushEdge(const IrEdge &edge);
+
+// Network task: encode the next batch into out (RAW_BATCH_MAX bytes) if
+// one is due. Returns the payload size, or 0 if there is nothing to send.
+uint16_t rawStreamTakeBatch(uint8_t *out);
+
+void rawStreamPrintStatus(Stream &out);
+
+#endif // RAW_STREAM_H
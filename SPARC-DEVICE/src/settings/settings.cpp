@@ -3,6 +3,8 @@
 #include "../../include/common_variables.h"
 
 #include "../network/blink_wifi.h"
+#include "../gui/gui.h"
+#include "../gui/auto_scan.h"
 
 #include <EEPROM.h>
 #include <Preferences.h>
@@ -10,7 +12,6 @@
 #include <SPI.h>
 
 
-extern Preferences prefs;
 extern int uiState;
 extern void gui3Setup();
 
@@ -21,6 +22,8 @@ void drawPopupBar();
 void clearPopupBar();
 void drawValidBlinkT9EditScreen();
 void drawConsecutiveGapT9EditScreen();
+void drawScanModeButton();
+void drawAutoScanButton();
 
 // --- Popup state for T9 keyboard in settings edit screen (move to top for visibility) ---
 int popupCountEdit = 0;
@@ -169,6 +172,7 @@ void saveWiFiToPreferences() {
     Serial.println("saveWiFiToPreferences function called");
     String trimmedSSID = trimString(ssid);
     String trimmedPassword = removeAllSpaces(password);
+    Preferences prefs;
     prefs.begin("blinkcfg", false);
     prefs.putString("ssid", trimmedSSID);
     prefs.putString("pass", trimmedPassword);
@@ -187,6 +191,7 @@ void saveWiFiToPreferences() {
 }
 
 void loadWiFiFromPreferences() {
+    Preferences prefs;
     prefs.begin("blinkcfg", false);
     String loadedSSID = prefs.getString("ssid", "");
     String loadedPassword = prefs.getString("pass", "");
@@ -196,11 +201,19 @@ void loadWiFiFromPreferences() {
     password = removeAllSpaces(loadedPassword);
 }
 
+void clampBlinkSettings() {
+  if (blinkDuration < BLINK_DURATION_MIN) blinkDuration = BLINK_DURATION_MIN;
+  if (blinkDuration > BLINK_DURATION_MAX) blinkDuration = BLINK_DURATION_MAX;
+  if (blinkGap < BLINK_GAP_MIN) blinkGap = BLINK_GAP_MIN;
+  if (blinkGap > BLINK_GAP_MAX) blinkGap = BLINK_GAP_MAX;
+}
+
+// The "blinkcfg" namespace is written from the UI task (settings page)
+// and the network task (commands, calibration), so every access opens its
+// own Preferences handle rather than sharing one object between tasks.
 void saveBlinkSettingsToPreferences() {
-  if (blinkDuration < 100) blinkDuration = 100;
-  if (blinkDuration > 2000) blinkDuration = 2000;
-  if (blinkGap < 500) blinkGap = 500;
-  if (blinkGap > 5000) blinkGap = 5000;
+  clampBlinkSettings();
+  Preferences prefs;
   prefs.begin("blinkcfg", false);
   prefs.putULong("blinkDuration", blinkDuration);
   prefs.putULong("blinkGap", blinkGap);
@@ -208,14 +221,12 @@ void saveBlinkSettingsToPreferences() {
 }
 
 void loadBlinkSettingsFromPreferences() {
+  Preferences prefs;
   prefs.begin("blinkcfg", false);
   blinkDuration = prefs.getULong("blinkDuration", 400);
   blinkGap = prefs.getULong("blinkGap", 1200);
   prefs.end();
-  if (blinkDuration < 100) blinkDuration = 100;
-  if (blinkDuration > 2000) blinkDuration = 2000;
-  if (blinkGap < 500) blinkGap = 500;
-  if (blinkGap > 5000) blinkGap = 5000;
+  clampBlinkSettings();
 }
 
 
@@ -380,6 +391,7 @@ void drawBlinkMenu() {
   tft.setTextColor(TFT_BLACK);
   tft.setCursor(barX+barW+15, barY2+8);
   tft.print("+");
+  drawAutoScanButton();
   int noteY = 280;
   tft.setTextColor(TFT_YELLOW);
   tft.drawRect(10,noteY-20,300,100,TFT_WHITE);
@@ -396,6 +408,35 @@ void drawBlinkMenu() {
   tft.drawRect(10, 370, 100, 40, TFT_WHITE);
   tft.setCursor(30, 380);
   tft.print("Back");
+  drawScanModeButton();
+}
+
+// Scan mode button next to Back; each touch moves to the next mode.
+void drawScanModeButton() {
+  tft.fillRect(130, 370, 180, 40, TFT_DARKGREY);
+  tft.drawRect(130, 370, 180, 40, TFT_WHITE);
+  tft.setTextColor(TFT_WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(140, 382);
+  tft.print("Scan: ");
+  tft.print(gui3ScanModeName(gui3ScanMode()));
+}
+
+// Timed scanning on/off, with the dwell it has learned.
+void drawAutoScanButton() {
+  tft.fillRect(10, 216, 300, 36, TFT_DARKGREY);
+  tft.drawRect(10, 216, 300, 36, TFT_WHITE);
+  tft.setTextColor(TFT_WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(20, 226);
+  tft.print("Auto scan: ");
+  if (!autoScanEnabled()) {
+    tft.print("OFF");
+    return;
+  }
+  tft.print("ON ");
+  tft.print(autoScanDwell());
+  tft.print("ms");
 }
 
 
@@ -1088,7 +1129,9 @@ if (consecutiveGapT9EditMode) {
           Serial.println("WiFi credentials saved.");
           uiState = 0;
           gui3Setup();
-          reconnectWiFi();
+          // The network task notices the drop and follows the new association.
+          WiFi.disconnect();
+          beginWiFiAsync();
           return;
         }
         if(prevBlinkDuration != blinkDuration || prevBlinkGap != blinkGap){
@@ -1259,6 +1302,20 @@ if (consecutiveGapT9EditMode) {
         drawMainMenu();
         return;
       }
+      // Auto scan button
+      if (tx >= 10 && tx <= 310 && ty >= 216 && ty <= 252) {
+        autoScanSetEnabled(!autoScanEnabled());
+        drawAutoScanButton();
+        delay(200); // one toggle per touch
+        return;
+      }
+      // Scan mode button
+      if (tx >= 130 && tx <= 310 && ty >= 370 && ty <= 410) {
+        gui3SetScanMode((ScanMode)((gui3ScanMode() + 1) % SCAN_MODE_COUNT));
+        drawScanModeButton();
+        delay(200); // one step per touch
+        return;
+      }
     }
     return;
   }
@@ -9,8 +9,17 @@ void setting2Loop();
 
 void drawT9Cell(int index, bool highlightYellow, bool blinkMode = false);
 
-void saveBlinkSettingsToPreferences();
+// Any task; each call opens its own NVS handle.
+void saveBlinkSettingsToPreferences();  // clamps first
 void loadBlinkSettingsFromPreferences();
+void clampBlinkSettings();  // to the ranges below
+
+// Blink thresholds in ms, as the settings page, commands and calibration
+// allow them.
+static const int BLINK_DURATION_MIN = 100;
+static const int BLINK_DURATION_MAX = 2000;
+static const int BLINK_GAP_MIN = 500;
+static const int BLINK_GAP_MAX = 5000;
 
 void loadWiFiFromPreferences();
 
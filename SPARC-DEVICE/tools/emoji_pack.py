@@ -0,0 +1,182 @@
+"""
+Convert emoji/icon PNGs into the compressed RGB565 asset table used by
+the firmware (src/gui/emoji_assets.cpp + include/emoji/emoji_assets.h).
+
+Each icon is stored as a palette of up to 16 RGB565 colours plus a run
+length stream: one byte per run, high nibble = run length - 1 (1..16
+pixels), low nibble = palette index. drawEmoji() in src/gui/emoji.cpp
+decodes it one line at a time straight into pushImage.
+
+Usage (from SPARC-DEVICE/):
+    python tools/emoji_pack.py assets/emoji/*.png
+
+The asset name is the PNG file name without extension. Only the Python
+standard library is needed.
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+MAX_COLORS = 16
+MAX_RUN = 16
+
+HEADER_OUT = os.path.join("include", "emoji", "emoji_assets.h")
+SOURCE_OUT = os.path.join("src", "gui", "emoji_assets.cpp")
+
+
+def read_png(path):
+    """Minimal PNG reader: 8-bit RGB/RGBA, non-interlaced. Returns (w, h, rows of (r, g, b))."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG file")
+    pos = 8
+    idat = b""
+    width = height = bit_depth = color_type = interlace = None
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+    if bit_depth != 8 or color_type not in (2, 6) or interlace:
+        raise ValueError(f"{path}: only 8-bit non-interlaced RGB/RGBA PNGs are supported")
+
+    bpp = 3 if color_type == 2 else 4
+    stride = width * bpp
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append([tuple(line[x * bpp:x * bpp + 3]) for x in range(width)])
+        prev = line
+    return width, height, rows
+
+
+def rgb565(rgb):
+    r, g, b = rgb
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode(name, width, height, rows):
+    pixels = [rgb565(p) for row in rows for p in row]
+    palette = []
+    for p in pixels:
+        if p not in palette:
+            palette.append(p)
+    if len(palette) > MAX_COLORS:
+        raise ValueError(f"{name}: {len(palette)} colours, at most {MAX_COLORS} are supported")
+    stream = []
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_RUN and pixels[i + run] == pixels[i]:
+            run += 1
+        stream.append(((run - 1) << 4) | palette.index(pixels[i]))
+        i += run
+    return palette, stream
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main(paths):
+    if not paths:
+        print(__doc__)
+        return 1
+    assets = []
+    for path in sorted(paths):
+        name = os.path.splitext(os.path.basename(path))[0]
+        width, height, rows = read_png(path)
+        palette, stream = encode(name, width, height, rows)
+        assets.append((name, width, height, palette, stream))
+        print(f"{name}: {width}x{height}, {len(palette)} colours, "
+              f"{width * height * 2} -> {len(palette) * 2 + len(stream)} bytes")
+
+    header = [
+        "// Auto-generated by tools/emoji_pack.py - do not edit",
+        "",
+        "#ifndef EMOJI_ASSETS_H",
+        "#define EMOJI_ASSETS_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Palette + run-length compressed RGB565 icon. Each data byte is one",
+        "// run: high nibble = length - 1, low nibble = palette index.",
+        "struct EmojiAsset {",
+        "  uint8_t width;",
+        "  uint8_t height;",
+        "  const uint16_t *palette;",
+        "  const uint8_t *data;",
+        "  uint16_t dataLen;",
+        "};",
+        "",
+        "enum EmojiId : uint8_t {",
+    ]
+    header += [f"  EMOJI_{name.upper()}," for name, *_ in assets]
+    header += [
+        "  EMOJI_COUNT",
+        "};",
+        "",
+        "extern const EmojiAsset emojiAssets[EMOJI_COUNT];",
+        "",
+        "#endif // EMOJI_ASSETS_H",
+        "",
+    ]
+
+    source = [
+        "// Auto-generated by tools/emoji_pack.py - do not edit",
+        "",
+        '#include "../../include/emoji/emoji_assets.h"',
+        "",
+    ]
+    for name, width, height, palette, stream in assets:
+        source.append(f"static const uint16_t {name}Palette[{len(palette)}] = {{")
+        source.append(c_array(palette, "0x{:04X}", 8))
+        source.append("};")
+        source.append(f"static const uint8_t {name}Data[{len(stream)}] = {{")
+        source.append(c_array(stream, "0x{:02X}", 16))
+        source.append("};")
+        source.append("")
+    source.append("const EmojiAsset emojiAssets[EMOJI_COUNT] = {")
+    for name, width, height, palette, stream in assets:
+        source.append(f"  {{ {width}, {height}, {name}Palette, {name}Data, {len(stream)} }},")
+    source.append("};")
+    source.append("")
+
+    with open(HEADER_OUT, "w") as f:
+        f.write("\n".join(header))
+    with open(SOURCE_OUT, "w") as f:
+        f.write("\n".join(source))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,436 @@
+"""
+Pack the word completion vocabulary into the flash tables used by the
+firmware (src/predict/lexicon_assets.cpp + include/lexicon/lexicon_assets.h),
+or measure how many blinks the completions save on a text corpus.
+
+The vocabulary (assets/lexicon/words.txt, "word count" per line) becomes
+a letter trie stored as one byte array. Each node is
+
+    header   bit 7 = a word ends here, bits 0-5 = number of children
+    best     highest frequency of any word below (and at) this node
+    [freq, id lo, id hi]        only when a word ends here
+    children * [letter, offset 3 bytes little endian]
+
+with children sorted by their best frequency, so a top-k search can stop
+at the first child that cannot beat what it already has. Frequencies are
+log-quantised to 1..255. Word pairs (assets/lexicon/bigrams.txt,
+"previous next count", "^" = start of the message) become a table sorted
+by previous word id.
+
+Usage (from SPARC-DEVICE/):
+    python tools/lexicon_pack.py
+    python tools/lexicon_pack.py --benchmark assets/lexicon/corpus.txt
+
+The benchmark types every corpus word on a simulated T9 grid, once
+letter by letter and once taking a completion as soon as the wanted word
+is offered, and reports blinks per word (a double blink counts as two).
+The predictor here walks the packed bytes the same way src/predict/
+predict.cpp does. Only the Python standard library is needed.
+"""
+
+import math
+import os
+import sys
+
+WORDS_IN = os.path.join("assets", "lexicon", "words.txt")
+BIGRAMS_IN = os.path.join("assets", "lexicon", "bigrams.txt")
+HEADER_OUT = os.path.join("include", "lexicon", "lexicon_assets.h")
+SOURCE_OUT = os.path.join("src", "predict", "lexicon_assets.cpp")
+
+# Keep in step with src/predict/predict.h / predict.cpp.
+WORD_MAX = 15           # PREDICT_WORD_MAX - 1
+PREDICT_MAX = 3
+TRIE_CANDIDATES = 6
+POOL_MAX = 24
+LEARNED_MAX = 48
+LEARNED_STEP, LEARNED_CAP = 8, 4
+LEARNED_DECAY_AT = LEARNED_CAP * 2
+START = 0xFFFF
+TERMINAL = 0x80
+
+# Keep in step with the T9 grid in src/gui/gui.cpp.
+CELLS = ["ABC1", "DEF2", "GHI3", "JKL4", "MNO5", "PQR6", "STU7", "VWX8", "YZ.9"]
+SPACE_CELL, SPACE_INDEX = 10, 1
+GRID_CELLS = 12
+WORD_ROW = 12
+
+
+def read_lines(path):
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].split()
+            if line:
+                yield line
+
+
+def quantise(count, top):
+    if count <= 1 or top <= 1:
+        return 1
+    return max(1, min(255, round(255 * math.log(count) / math.log(top))))
+
+
+def load(words_path=WORDS_IN, bigrams_path=BIGRAMS_IN):
+    counts = {}
+    for fields in read_lines(words_path):
+        word, count = fields[0].lower(), int(fields[1])
+        if not word.isalpha() or not word.isascii() or len(word) > WORD_MAX:
+            print(f"skipping {word!r}: only a-z words up to {WORD_MAX} letters")
+            continue
+        counts[word] = counts.get(word, 0) + count
+    pairs = []
+    for fields in read_lines(bigrams_path):
+        prev, nxt, count = fields[0].lower(), fields[1].lower(), int(fields[2])
+        if (prev != "^" and prev not in counts) or nxt not in counts:
+            print(f"skipping pair {prev} {nxt}: word not in the vocabulary")
+            continue
+        pairs.append((prev, nxt, count))
+    return counts, pairs
+
+
+def build(counts, pairs):
+    """Returns (trie bytes, sorted words, bigram tuples (prev id, next id, freq))."""
+    words = sorted(counts)
+    ids = {w: i for i, w in enumerate(words)}
+    top = max(counts.values())
+    freq = {w: quantise(c, top) for w, c in counts.items()}
+
+    root = {"kids": {}, "word": None}
+    for w in words:
+        node = root
+        for ch in w:
+            node = node["kids"].setdefault(ch, {"kids": {}, "word": None})
+        node["word"] = w
+
+    def best(node):
+        b = freq[node["word"]] if node["word"] else 0
+        for kid in node["kids"].values():
+            b = max(b, best(kid))
+        node["best"] = b
+        return b
+    best(root)
+
+    # Lay nodes out depth first, then patch child offsets.
+    order = []
+
+    def visit(node):
+        order.append(node)
+        node["sorted"] = sorted(node["kids"].items(), key=lambda kv: (-kv[1]["best"], kv[0]))
+        for _, kid in node["sorted"]:
+            visit(kid)
+    visit(root)
+    offset = 0
+    for node in order:
+        node["offset"] = offset
+        offset += 2 + (3 if node["word"] else 0) + 4 * len(node["kids"])
+    if offset >= 1 << 24:
+        raise ValueError("trie does not fit 24-bit offsets")
+
+    trie = bytearray()
+    for node in order:
+        header = len(node["kids"]) | (TERMINAL if node["word"] else 0)
+        trie += bytes([header, node["best"]])
+        if node["word"]:
+            wid = ids[node["word"]]
+            trie += bytes([freq[node["word"]], wid & 0xFF, wid >> 8])
+        for ch, kid in node["sorted"]:
+            trie += bytes([ord(ch)]) + kid["offset"].to_bytes(3, "little")
+
+    top_pair = max((c for _, _, c in pairs), default=1)
+    bigrams = sorted(((START if p == "^" else ids[p], ids[n], quantise(c, top_pair))
+                      for p, n, c in pairs), key=lambda b: (b[0], -b[2], b[1]))
+    return bytes(trie), words, bigrams
+
+
+# --- Predictor (mirrors src/predict/predict.cpp) ---
+
+class Predictor:
+    def __init__(self, trie, words, bigrams):
+        self.trie, self.words, self.bigrams = trie, words, bigrams
+        self.learned = []  # [word, count], most recently used first
+
+    def node_at(self, text):
+        off = 0
+        for ch in text:
+            hdr = self.trie[off]
+            p = off + 2 + (3 if hdr & TERMINAL else 0)
+            for _ in range(hdr & 0x3F):
+                if self.trie[p] == ord(ch):
+                    off = int.from_bytes(self.trie[p + 1:p + 4], "little")
+                    break
+                p += 4
+            else:
+                return None
+        return off
+
+    def word_info(self, word):
+        off = self.node_at(word)
+        if off is None or not self.trie[off] & TERMINAL:
+            return None, 0
+        return self.trie[off + 3] | self.trie[off + 4] << 8, self.trie[off + 2]
+
+    def collect(self, off, skip, top):
+        hdr = self.trie[off]
+        p = off + 2
+        if hdr & TERMINAL:
+            if off != skip:
+                offer(top, self.trie[p + 1] | self.trie[p + 2] << 8, self.trie[p])
+            p += 3
+        for _ in range(hdr & 0x3F):
+            child = int.from_bytes(self.trie[p + 1:p + 4], "little")
+            if len(top) == TRIE_CANDIDATES and self.trie[child + 1] <= min(q for _, q in top):
+                break
+            self.collect(child, skip, top)
+            p += 4
+
+    def score(self, prev, word):
+        wid, s = self.word_info(word)
+        if wid is not None and prev is not None:
+            for p, n, q in self.bigrams:
+                if p == prev and n == wid:
+                    s += 64 + q // 2
+        for w, count in self.learned:
+            if w == word:
+                s += min(count, LEARNED_CAP) * LEARNED_STEP
+        return s
+
+    def complete(self, text):
+        text = text.lower()
+        cut = text.rfind(" ")
+        prefix = text[cut + 1:]
+        if not prefix.isalpha() and prefix or len(prefix) >= WORD_MAX:
+            return []
+        before = text[:cut].split() if cut >= 0 else []
+        prev = START
+        if before:
+            prev, _ = self.word_info(before[-1]) if before[-1].isalpha() else (None, 0)
+
+        pool = []
+
+        def propose(word):
+            if len(word) > len(prefix) and word.startswith(prefix) and word not in pool \
+                    and len(pool) < POOL_MAX:
+                pool.append(word)
+
+        node = self.node_at(prefix)
+        if node is not None:
+            top = []
+            self.collect(node, node, top)
+            for wid, _ in top:
+                propose(self.words[wid])
+        if prev is not None:
+            for p, n, _ in self.bigrams:
+                if p == prev:
+                    propose(self.words[n])
+        for w, _ in self.learned:
+            propose(w)
+
+        ranked = sorted(pool, key=lambda w: (-self.score(prev, w), len(w), w))
+        return ranked[:PREDICT_MAX]
+
+    def learn(self, word):
+        if not word.isalpha() or len(word) < 2 or len(word) > WORD_MAX:
+            return
+        for i, entry in enumerate(self.learned):
+            if entry[0] == word:
+                entry[1] += 1
+                del self.learned[i]
+                break
+        else:
+            entry = [word, 1]
+            if len(self.learned) == LEARNED_MAX:
+                # Evict the least used entry; on ties the one unused longest.
+                low = min(range(LEARNED_MAX), key=lambda i: (self.learned[i][1], -i))
+                del self.learned[low]
+        self.learned.insert(0, entry)
+        if entry[1] >= LEARNED_DECAY_AT:
+            for e in self.learned:
+                e[1] //= 2
+
+
+def offer(top, wid, q):
+    if len(top) < TRIE_CANDIDATES:
+        top.append((wid, q))
+        return
+    low = min(range(len(top)), key=lambda i: (top[i][1], -i))
+    if q > top[low][1]:
+        top[low] = (wid, q)
+
+
+# --- Benchmark ---
+
+def letter_key(ch):
+    for cell, keys in enumerate(CELLS):
+        if ch.upper() in keys:
+            return cell, keys.index(ch.upper())
+    raise ValueError(ch)
+
+
+class Grid:
+    """Scanning cost on the T9 grid: single blink = 1, double blink = 2."""
+
+    def __init__(self):
+        self.cell = 0
+        self.blinks = 0
+
+    def stops(self, row_shown):
+        return GRID_CELLS + (1 if row_shown else 0)
+
+    def press(self, target, index, row_shown):
+        self.blinks += (target - self.cell) % self.stops(row_shown)  # scan to the cell
+        self.blinks += 2 + index + 2                                 # open, move, select
+        self.cell = target
+
+
+def type_corpus(lines, predictor, learn):
+    grid = Grid()
+    words = 0
+    for line in lines:
+        text = ""
+        suggestions = predictor.complete(text) if predictor else []
+        for word in line.lower().split():
+            if not word.isalpha():
+                continue
+            words += 1
+            typed = ""
+            while True:
+                if word in suggestions:
+                    grid.press(WORD_ROW, suggestions.index(word), True)
+                    text += word[len(typed):] + " "
+                    break
+                if typed == word:
+                    grid.press(SPACE_CELL, SPACE_INDEX, bool(suggestions))
+                    text += " "
+                    break
+                ch = word[len(typed)]
+                cell, index = letter_key(ch)
+                grid.press(cell, index, bool(suggestions))
+                typed += ch
+                text += ch
+                suggestions = predictor.complete(text) if predictor else []
+            if predictor and learn:
+                predictor.learn(word)
+            suggestions = predictor.complete(text) if predictor else []
+            if not suggestions and grid.cell == WORD_ROW:
+                grid.cell = 0
+    return grid.blinks, words
+
+
+def benchmark(corpus_path):
+    trie, words, bigrams = build(*load())
+    lines = [" ".join(fields) for fields in read_lines(corpus_path)]
+    base, count = type_corpus(lines, None, False)
+    print(f"{count} words, {len(trie)} byte trie, {len(words)} words, {len(bigrams)} pairs")
+    print(f"letters only:      {base / count:6.2f} blinks/word")
+    for label, learn in (("with completions:", False), ("learning as well:", True)):
+        blinks, _ = type_corpus(lines, Predictor(trie, words, bigrams), learn)
+        saved = (base - blinks) / count
+        print(f"{label:18} {blinks / count:6.2f} blinks/word, "
+              f"{saved:.2f} saved ({100 * (base - blinks) / base:.0f}%)")
+    return 0
+
+
+# --- Output ---
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main(args):
+    if args[:1] == ["--benchmark"] and len(args) == 2:
+        return benchmark(args[1])
+    if args:
+        print(__doc__)
+        return 1
+    trie, words, bigrams = build(*load())
+    blob = "".join(w + "\0" for w in words)
+    offsets = []
+    pos = 0
+    for w in words:
+        offsets.append(pos)
+        pos += len(w) + 1
+    if pos >= 1 << 16:
+        raise ValueError("word list does not fit 16-bit offsets")
+    print(f"{len(words)} words, {len(bigrams)} pairs: trie {len(trie)} bytes, "
+          f"words {len(blob)} bytes, pairs {len(bigrams) * 5} bytes")
+
+    header = [
+        "// Auto-generated by tools/lexicon_pack.py - do not edit",
+        "",
+        "#ifndef LEXICON_ASSETS_H",
+        "#define LEXICON_ASSETS_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Letter trie, one node after another (root at offset 0):",
+        "//   header  bit 7 = a word ends here, bits 0-5 = number of children",
+        "//   best    highest word frequency at or below this node",
+        "//   [freq, id lo, id hi] when a word ends here",
+        "//   children * [letter, offset 3 bytes little endian], best first",
+        "// Frequencies are log-quantised to 1..255; ids index lexiconWordOffsets.",
+        "static const uint8_t LEXICON_TERMINAL = 0x80;",
+        "static const uint8_t LEXICON_CHILD_MASK = 0x3F;",
+        f"static const uint16_t LEXICON_WORD_COUNT = {len(words)};",
+        f"static const uint16_t LEXICON_BIGRAM_COUNT = {len(bigrams)};",
+        "// Previous word id for pairs that open a message.",
+        "static const uint16_t LEXICON_START = 0xFFFF;",
+        "",
+        "// Sorted by prev, then by falling freq.",
+        "struct LexiconBigram {",
+        "  uint16_t prev;",
+        "  uint16_t next;",
+        "  uint8_t freq;",
+        "};",
+        "",
+        "extern const uint8_t lexiconTrie[];",
+        "extern const char lexiconWords[];  // NUL separated",
+        "extern const uint16_t lexiconWordOffsets[LEXICON_WORD_COUNT];",
+        "extern const LexiconBigram lexiconBigrams[LEXICON_BIGRAM_COUNT];",
+        "",
+        "#endif // LEXICON_ASSETS_H",
+        "",
+    ]
+
+    source = [
+        "// Auto-generated by tools/lexicon_pack.py - do not edit",
+        "",
+        '#include "../../include/lexicon/lexicon_assets.h"',
+        "",
+        f"const uint8_t lexiconTrie[{len(trie)}] = {{",
+        c_array(trie, "0x{:02X}", 16),
+        "};",
+        "",
+        "const char lexiconWords[] =",
+    ]
+    line = ""
+    for w in words:
+        piece = w + "\\0"
+        if len(line) + len(piece) > 70:
+            source.append(f'  "{line}"')
+            line = ""
+        line += piece
+    source.append(f'  "{line}";')
+    source += [
+        "",
+        "const uint16_t lexiconWordOffsets[LEXICON_WORD_COUNT] = {",
+        c_array(offsets, "{}", 12),
+        "};",
+        "",
+        "const LexiconBigram lexiconBigrams[LEXICON_BIGRAM_COUNT] = {",
+    ]
+    source += [f"  {{ 0x{p:04X}, {n}, {q} }}," for p, n, q in bigrams]
+    source += ["};", ""]
+
+    for path in (HEADER_OUT, SOURCE_OUT):
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(HEADER_OUT, "w") as f:
+        f.write("\n".join(header))
+    with open(SOURCE_OUT, "w") as f:
+        f.write("\n".join(source))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
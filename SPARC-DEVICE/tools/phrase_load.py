@@ -0,0 +1,134 @@
+"""
+Replace the phrase library of a device over the client link (TCP 45454),
+print the library it has, or put the built-in one back.
+
+The phrase file has one phrase per line, CATEGORY|KIND|TEXT, with KIND
+TEXT for a text message or one of the alerts FOOD, RESTROOM, DOCTOR_CALL,
+EMERGENCY; blank lines and lines starting with # are skipped. The output
+of --list is in the same form. See src/phrases/phrases.h for the limits
+and the PHRASES/PHRASE commands this sends.
+
+Usage (from SPARC-DEVICE/):
+    python tools/phrase_load.py 192.168.1.50 phrases.txt
+    python tools/phrase_load.py --list 192.168.1.50
+    python tools/phrase_load.py --default 192.168.1.50
+
+The link is opened with the binary protocol of src/network/
+link_protocol.h, which the device serves alongside the desktop client.
+The whole file is checked before anything is sent; if the device refuses
+a phrase the load is abandoned and the library in use is left as it was.
+Only the Python standard library is needed.
+"""
+
+import socket
+import struct
+import sys
+
+# Keep in step with src/network/link_protocol.h and src/phrases/phrases.h.
+PORT = 45454
+MAGIC = b"SPRC"
+VERSION = 1
+HEADER = struct.Struct("<HBH")  # len, type, seq
+LF_HELLO, LF_COMMAND, LF_RESPONSE = 0x01, 0x20, 0x21
+RESPONSE_LAST = 0x01
+PHRASE_MAX = 48
+CATEGORY_MAX = 8
+TEXT_MAX = 40
+CATEGORY_NAME_MAX = 12
+KINDS = ("TEXT", "FOOD", "RESTROOM", "DOCTOR_CALL", "EMERGENCY")
+
+
+def read_phrases(path):
+    """(line number, "CATEGORY|KIND|TEXT") per phrase, checked and upper-cased."""
+    phrases = []
+    categories = set()
+    with open(path, encoding="ascii") as f:
+        for number, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = [x.strip() for x in line.upper().split("|", 2)]
+            if len(fields) != 3:
+                raise ValueError(f"{path}:{number}: expected CATEGORY|KIND|TEXT")
+            category, kind, text = fields
+            if not 0 < len(category) <= CATEGORY_NAME_MAX:
+                raise ValueError(f"{path}:{number}: category must be 1-{CATEGORY_NAME_MAX} characters")
+            if kind not in KINDS:
+                raise ValueError(f"{path}:{number}: kind must be one of {', '.join(KINDS)}")
+            if not 0 < len(text) <= TEXT_MAX:
+                raise ValueError(f"{path}:{number}: text must be 1-{TEXT_MAX} characters")
+            categories.add(category)
+            phrases.append((number, f"{category}|{kind}|{text}"))
+    if not phrases:
+        raise ValueError(f"{path}: no phrases")
+    if len(phrases) > PHRASE_MAX or len(categories) > CATEGORY_MAX:
+        raise ValueError(f"{path}: at most {PHRASE_MAX} phrases in {CATEGORY_MAX} categories")
+    return phrases
+
+
+class Link:
+    def __init__(self, host):
+        self.sock = socket.create_connection((host, PORT), timeout=5)
+        self.seq = 0
+        self.rx = b""
+        self.sock.sendall(MAGIC)
+        self.send(LF_HELLO, struct.pack("<BIH", VERSION, 0, 0))
+
+    def send(self, kind, payload):
+        self.seq += 1
+        self.sock.sendall(HEADER.pack(len(payload), kind, self.seq) + payload)
+
+    def frame(self):
+        while True:
+            if len(self.rx) >= HEADER.size:
+                length, kind, seq = HEADER.unpack_from(self.rx)
+                if len(self.rx) >= HEADER.size + length:
+                    payload = self.rx[HEADER.size:HEADER.size + length]
+                    self.rx = self.rx[HEADER.size + length:]
+                    return kind, seq, payload
+            data = self.sock.recv(4096)
+            if not data:
+                raise ConnectionError("device closed the connection")
+            self.rx += data
+
+    def command(self, text):
+        """Run one command, return its reply. Other frames are skipped."""
+        self.send(LF_COMMAND, text.encode("ascii"))
+        seq = self.seq
+        reply = b""
+        while True:
+            kind, frame_seq, payload = self.frame()
+            if kind != LF_RESPONSE or frame_seq != seq:
+                continue
+            reply += payload[1:]
+            if payload[0] & RESPONSE_LAST:
+                return reply.decode("ascii", "replace")
+
+
+def load(host, path):
+    phrases = read_phrases(path)
+    link = Link(host)
+    print(link.command("PHRASES:BEGIN"), end="")
+    for number, spec in phrases:
+        reply = link.command("PHRASE:" + spec)
+        if not reply.endswith(" added\n"):
+            print(f"{path}:{number}: {reply}", end="")
+            print("Load abandoned, the device keeps its phrases")
+            return 1
+    print(link.command("PHRASES:END"), end="")
+    return 0
+
+
+def main(args):
+    if len(args) == 2 and args[0] in ("--list", "--default"):
+        command = "PHRASES:LIST" if args[0] == "--list" else "PHRASES:DEFAULT"
+        print(Link(args[1]).command(command), end="")
+        return 0
+    if len(args) == 2 and not args[0].startswith("-"):
+        return load(args[0], args[1])
+    print(__doc__)
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
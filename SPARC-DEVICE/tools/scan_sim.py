@@ -0,0 +1,261 @@
+"""
+Replay a text corpus on a simulated T9 grid and report the cost per
+character and per selection, in blinks and in seconds, for each scan
+mode of src/gui/gui.cpp (linear, rows, halves). Each mode is run with
+the scan always continuing from the last selected cell and popups
+opening on their first button (fixed), and with the learned start
+positions of src/gui/scan_order.cpp (adaptive).
+
+Usage (from SPARC-DEVICE/):
+    python tools/scan_sim.py assets/lexicon/corpus.txt
+    python tools/scan_sim.py --completions assets/lexicon/corpus.txt
+
+The adaptive model learns while the corpus is typed; it is run over the
+corpus twice and both passes are reported, the second one showing the
+settled start positions. --completions adds the word row and takes a
+completion as soon as the wanted word is offered (see lexicon_pack.py).
+A single blink counts as one blink, a double blink as two. Seconds use
+the default blinkDuration and blinkGap of blink_wifi.cpp: a gesture is
+only recognised once the gap has passed without another blink. The
+timed rows assume a patient reacting in REACTION_MS with the dwell
+settled (src/gui/auto_scan.cpp). Only the Python standard library is
+needed.
+"""
+
+import sys
+
+import lexicon_pack as lexicon
+
+# Keep in step with src/gui/scan_order.cpp.
+USE_WEIGHT = 16
+DECAY_EVERY = 100
+SWITCH_NUM, SWITCH_DEN = 7, 8
+CELLS = 12
+STOPS = 13
+ITEMS = 4
+
+MODES = ("linear", "rows", "halves")
+
+# Defaults of blink_wifi.cpp, plus the eyes-open pause inside a double blink.
+BLINK_DURATION_MS = 400
+BLINK_GAP_MS = 1200
+DOUBLE_PAUSE_MS = 300
+SINGLE_S = (BLINK_DURATION_MS + BLINK_GAP_MS) / 1000
+DOUBLE_S = (2 * BLINK_DURATION_MS + DOUBLE_PAUSE_MS + BLINK_GAP_MS) / 1000
+
+# Timed scanning: a patient reacting in 700 +/- 150 ms settles on the
+# dwell auto_scan.cpp aims for (reaction + 4 * deviation).
+REACTION_MS = 700
+DEVIATION_MS = 150
+DWELL_MS = REACTION_MS + 4 * DEVIATION_MS
+
+
+class FixedScan:
+    """The scan stays where the last selection was made."""
+
+    def record(self, stop, item):
+        pass
+
+    def home(self, current, word_row):
+        return current
+
+    def popup_start(self, stop, count):
+        return 0
+
+
+class AdaptiveScan:
+    def __init__(self):
+        self.stop = [0] * STOPS
+        self.item = [[0] * ITEMS for _ in range(CELLS)]
+        self.since_decay = 0
+        self.home_stop = -1
+        self.starts = [0] * CELLS
+
+    def record(self, stop, item):
+        self.stop[stop] += USE_WEIGHT
+        if stop < CELLS:
+            self.item[stop][item] += USE_WEIGHT
+        self.since_decay += 1
+        if self.since_decay >= DECAY_EVERY:
+            self.stop = [u // 2 for u in self.stop]
+            self.item = [[u // 2 for u in cell] for cell in self.item]
+            self.since_decay = 0
+
+    @staticmethod
+    def cost(use, n, s):
+        return sum(use[t] * ((t - s) % n) for t in range(n))
+
+    def pick(self, use, n, current):
+        best = min(range(n), key=lambda s: (self.cost(use, n, s), s))
+        if current < 0 or current >= n:
+            return best
+        if self.cost(use, n, best) * SWITCH_DEN >= self.cost(use, n, current) * SWITCH_NUM:
+            return current
+        return best
+
+    def home(self, current, word_row):
+        n = STOPS if word_row else CELLS
+        if sum(self.stop[:n]) == 0:
+            return current
+        start = self.pick(self.stop, n, self.home_stop)
+        if word_row or self.home_stop < n:
+            self.home_stop = start
+        return start
+
+    def popup_start(self, stop, count):
+        if stop >= CELLS:
+            return 0
+        self.starts[stop] = self.pick(self.item[stop], count, self.starts[stop])
+        return self.starts[stop]
+
+
+def popup_size(cell):
+    return 3 if cell in (9, 10) else len(lexicon.CELLS[cell])
+
+
+class Grid:
+    """Counts the gestures needed per selection, following gui3OnSingleBlink
+    and gui3OnDoubleBlink for the chosen mode. Timed scanning (auto_scan.cpp)
+    replaces the stepping blinks by waiting and selects with one blink."""
+
+    def __init__(self, scan, mode="linear", timed=False):
+        self.scan = scan
+        self.mode = mode
+        self.timed = timed
+        self.cell = 0
+        self.singles = 0
+        self.doubles = 0
+        self.waited = 0.0   # seconds spent watching the highlight move
+        self.selections = 0
+
+    @property
+    def blinks(self):
+        return self.singles + 2 * self.doubles
+
+    @property
+    def seconds(self):
+        return self.singles * SINGLE_S + self.doubles * DOUBLE_S + self.waited
+
+    def move(self, steps):
+        """Highlight the stop `steps` on, then select it."""
+        if self.timed:
+            # The first stop shows for dwell * 3/2, the others for dwell.
+            if steps:
+                self.waited += (DWELL_MS * 3 // 2 + (steps - 1) * DWELL_MS) / 1000
+            self.waited += REACTION_MS / 1000
+            self.singles += 1
+        else:
+            self.singles += steps
+            self.doubles += 1
+
+    def reach(self, target, stops):
+        """Gestures from the scan start until the popup of target opens."""
+        if self.mode == "rows":
+            rows = (stops + 2) // 3
+            self.move((target // 3 - self.cell // 3) % rows)  # the row
+            if target != lexicon.WORD_ROW:                    # the word row opens at once
+                self.move(target % 3)                         # the cell, from the row's first
+        elif self.mode == "halves":
+            first, count = 0, stops
+            while count > 1:
+                half = (count + 1) // 2
+                if target < first + half:
+                    self.singles += 1   # keep the yellow half
+                    count = half
+                else:
+                    self.doubles += 1   # keep the cyan half
+                    first += half
+                    count -= half
+        else:
+            self.move((target - self.cell) % stops)
+
+    def select(self, target, index, count, row_shown, row_after):
+        self.reach(target, STOPS if row_shown else CELLS)
+        start = self.scan.popup_start(target, count)
+        self.move((index - start) % count)
+        self.selections += 1
+        self.scan.record(target, index)
+        if target == lexicon.WORD_ROW and not row_after:
+            target = 0
+        self.cell = self.scan.home(target, row_after)
+
+
+def type_corpus(lines, grid, predictor):
+    chars = 0
+    for line in lines:
+        text = ""
+        shown = predictor.complete(text) if predictor else []
+        for word in line.lower().split():
+            if not word.isalpha():
+                continue
+            typed = ""
+            while True:
+                if word in shown:
+                    text += word[len(typed):] + " "
+                    after = predictor.complete(text)
+                    grid.select(lexicon.WORD_ROW, shown.index(word), len(shown), True, bool(after))
+                    break
+                if typed == word:
+                    text += " "
+                    after = predictor.complete(text) if predictor else []
+                    grid.select(lexicon.SPACE_CELL, lexicon.SPACE_INDEX, 3, bool(shown), bool(after))
+                    break
+                ch = word[len(typed)]
+                cell, index = lexicon.letter_key(ch)
+                typed += ch
+                text += ch
+                after = predictor.complete(text) if predictor else []
+                grid.select(cell, index, popup_size(cell), bool(shown), bool(after))
+                shown = after
+            if predictor:
+                predictor.learn(word)
+            shown = predictor.complete(text) if predictor else []
+        chars += len(text)
+    return chars
+
+
+def report(label, grid, before, chars):
+    singles, doubles, waited, selections = before
+    s = grid.singles - singles
+    d = grid.doubles - doubles
+    n = grid.selections - selections
+    blinks = s + 2 * d
+    seconds = s * SINGLE_S + d * DOUBLE_S + grid.waited - waited
+    print(f"{label:35} {blinks / chars:6.2f} {seconds / chars:7.2f} {blinks / n:9.2f} {seconds / n:7.2f}")
+
+
+def main(args):
+    completions = "--completions" in args
+    paths = [a for a in args if a != "--completions"]
+    if len(paths) != 1:
+        print(__doc__)
+        return 1
+    lines = [" ".join(fields) for fields in lexicon.read_lines(paths[0])]
+    model = lexicon.build(*lexicon.load()) if completions else None
+
+    def predictor():
+        return lexicon.Predictor(*model) if model else None
+
+    chars = type_corpus(lines, Grid(FixedScan()), predictor())
+    print(f"{chars} characters{' with completions' if completions else ''}, "
+          f"single blink {SINGLE_S:.1f} s, double blink {DOUBLE_S:.1f} s, timed dwell {DWELL_MS} ms")
+    print(f"{'':35} {'blinks':>6} {'seconds':>7} {'blinks':>9} {'seconds':>7}")
+    print(f"{'':35} {'/char':>6} {'/char':>7} {'/select':>9} {'/select':>7}")
+    for timed in (False, True):
+        for mode in MODES:
+            name = f"{mode}{', timed' if timed else ''}"
+            grid = Grid(FixedScan(), mode, timed)
+            type_corpus(lines, grid, predictor())
+            report(f"{name}, fixed:", grid, (0, 0, 0.0, 0), chars)
+
+            grid = Grid(AdaptiveScan(), mode, timed)
+            words = predictor()
+            for label in ("1st pass", "2nd pass"):
+                before = (grid.singles, grid.doubles, grid.waited, grid.selections)
+                type_corpus(lines, grid, words)
+                report(f"{name}, adaptive {label}:", grid, before, chars)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
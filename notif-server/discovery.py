@@ -0,0 +1,164 @@
+"""
+UDP discovery between the notification server and SPARC devices.
+
+Every message is one ASCII datagram, fields separated by spaces:
+
+    SPARC-NOTIFY 1 <http_port>                       server -> devices
+    SPARC-DEVICE 1 <topic> <client_port> <notify_port> device -> servers
+    SPARC-DISCOVER 1                                 device -> servers
+
+The server broadcasts SPARC-NOTIFY every couple of seconds and answers a
+SPARC-DISCOVER straight away, so a device that changed network (or a
+server that changed address) is found again within seconds. Devices
+broadcast SPARC-DEVICE so the server knows where they are without any
+hard-coded address.
+
+Run this file directly to simulate a device, e.g. for a loopback test
+against server.py in another terminal:
+
+    python server.py --beacon-addr 127.0.0.1 --discovery-port 45456 --device-port 45457
+    python discovery.py --listen-port 45457 --server-port 45456 --addr 127.0.0.1
+"""
+
+import argparse
+import socket
+import threading
+import time
+
+DISCOVERY_PORT = 45455
+PROTOCOL_VERSION = "1"
+SERVER_BEACON_INTERVAL = 2.0
+DEVICE_BEACON_INTERVAL = 5.0
+BROADCAST_ADDR = "<broadcast>"
+
+
+def open_socket(port):
+    """UDP socket bound to `port` that may send broadcasts."""
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    s.setsockopt(socket.SOL_SOCKET, socket.SO_BROADCAST, 1)
+    s.bind(("", port))
+    return s
+
+
+def parse(data):
+    """Split a datagram into (kind, fields), or None if it is not ours."""
+    try:
+        parts = data.decode("ascii").split()
+    except UnicodeDecodeError:
+        return None
+    if len(parts) < 2 or not parts[0].startswith("SPARC-") or parts[1] != PROTOCOL_VERSION:
+        return None
+    return parts[0], parts[2:]
+
+
+class ServerAnnouncer(threading.Thread):
+    """Server side: announce the HTTP port and keep track of devices."""
+
+    def __init__(self, http_port, listen_port=DISCOVERY_PORT,
+                 device_port=DISCOVERY_PORT, beacon_addr=BROADCAST_ADDR):
+        super().__init__(daemon=True)
+        self.beacon = f"SPARC-NOTIFY {PROTOCOL_VERSION} {http_port}".encode("ascii")
+        self.device_port = device_port
+        self.beacon_addr = beacon_addr
+        self.sock = open_socket(listen_port)
+        self.sock.settimeout(0.5)
+        self.devices = {}  # topic -> {'ip', 'client_port', 'notify_port', 'seen'}
+        self.devices_changed = threading.Condition()
+
+    def run(self):
+        next_beacon = 0.0
+        while True:
+            now = time.monotonic()
+            if now >= next_beacon:
+                self.send_beacon((self.beacon_addr, self.device_port))
+                next_beacon = now + SERVER_BEACON_INTERVAL
+            try:
+                data, addr = self.sock.recvfrom(512)
+            except socket.timeout:
+                continue
+            msg = parse(data)
+            if msg is None:
+                continue
+            kind, fields = msg
+            if kind == "SPARC-DISCOVER":
+                self.send_beacon(addr)
+            elif kind == "SPARC-DEVICE":
+                try:
+                    topic, client_port, notify_port = fields[0], int(fields[1]), int(fields[2])
+                except (ValueError, IndexError):
+                    continue  # malformed announcement; keep beaconing
+                self.device_seen(topic, addr[0], client_port, notify_port)
+
+    def send_beacon(self, addr):
+        try:
+            self.sock.sendto(self.beacon, addr)
+        except OSError as e:
+            print(f"⚠️ Discovery beacon to {addr} failed: {e}")
+
+    def device_seen(self, topic, ip, client_port, notify_port):
+        with self.devices_changed:
+            known = self.devices.get(topic)
+            if known is None or known['ip'] != ip:
+                print(f"📡 Device {topic} at {ip} (client port {client_port}, notify port {notify_port})")
+            self.devices[topic] = {'ip': ip, 'client_port': client_port,
+                                   'notify_port': notify_port, 'seen': time.time()}
+            self.devices_changed.notify_all()
+
+    def wait_for_device(self, timeout):
+        """Return the first device heard from within `timeout` seconds, or None."""
+        deadline = time.monotonic() + timeout
+        with self.devices_changed:
+            while not self.devices:
+                remaining = deadline - time.monotonic()
+                if remaining <= 0:
+                    return None
+                self.devices_changed.wait(remaining)
+            return next(iter(self.devices.values()))
+
+
+def run_device_simulator(topic, listen_port, server_port, addr, client_port, notify_port):
+    """Device side, as the firmware does it: learn the server, announce ourselves."""
+    sock = open_socket(listen_port)
+    sock.settimeout(0.5)
+    server = None
+    beacon = f"SPARC-DEVICE {PROTOCOL_VERSION} {topic} {client_port} {notify_port}".encode("ascii")
+    discover = f"SPARC-DISCOVER {PROTOCOL_VERSION}".encode("ascii")
+    next_beacon = 0.0
+    while True:
+        now = time.monotonic()
+        if now >= next_beacon:
+            sock.sendto(beacon, (addr, server_port))
+            if server is None:
+                sock.sendto(discover, (addr, server_port))
+            next_beacon = now + DEVICE_BEACON_INTERVAL
+        try:
+            data, src = sock.recvfrom(512)
+        except socket.timeout:
+            continue
+        msg = parse(data)
+        if msg is None or msg[0] != "SPARC-NOTIFY":
+            continue
+        try:
+            found = (src[0], int(msg[1][0]))
+        except (ValueError, IndexError):
+            continue
+        if found != server:
+            server = found
+            print(f"Notification server at {server[0]}:{server[1]}")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Simulate a SPARC device's discovery traffic.")
+    parser.add_argument("--topic", default="12345")
+    parser.add_argument("--listen-port", type=int, default=DISCOVERY_PORT)
+    parser.add_argument("--server-port", type=int, default=DISCOVERY_PORT)
+    parser.add_argument("--addr", default=BROADCAST_ADDR, help="where to send device beacons")
+    parser.add_argument("--client-port", type=int, default=45454)
+    parser.add_argument("--notify-port", type=int, default=5000)
+    args = parser.parse_args()
+    try:
+        run_device_simulator(args.topic, args.listen_port, args.server_port, args.addr,
+                             args.client_port, args.notify_port)
+    except KeyboardInterrupt:
+        pass
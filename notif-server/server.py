@@ -6,14 +6,60 @@ from fcm_sender import send_fcm_notification, get_access_token # Import get_acce
 import threading
 import time
 import asyncio
-from concurrent.futures import ThreadPoolExecutor
+from concurrent.futures import ThreadPoolExecutor, wait
 import socket # Import socket for network connections
+from collections import OrderedDict
+import argparse
+from discovery import ServerAnnouncer, DISCOVERY_PORT, BROADCAST_ADDR
 
 VALID_TYPES = {"FOOD", "DOCTOR_CALL", "RESTROOM", "EMERGENCY"}
 
 # Thread pool for async FCM calls
 executor = ThreadPoolExecutor(max_workers=3)
 
+# The device resends an alert whose response it never saw, tagged with the
+# same id ("<epoch>-<seq>" from its outbox log). Remember recent ids so a
+# resend is acknowledged without paging anyone twice. An id only counts as
+# seen once FCM has taken the alert; until then it is pending, and a resend
+# is told to try again later.
+RECENT_IDS_MAX = 1024
+recent_ids = OrderedDict()
+pending_ids = set()
+recent_ids_lock = threading.Lock()
+
+# The device gives up on a response after 3 s; answer before that. An alert
+# FCM has not taken by then is still delivered, the device just resends it
+# and is acknowledged from recent_ids.
+FCM_REPLY_TIMEOUT_S = 2.5
+
+ALERT_NEW = "new"
+ALERT_SEEN = "seen"
+ALERT_PENDING = "pending"
+
+def claim_alert(alert_id):
+    """Return ALERT_SEEN, ALERT_PENDING, or ALERT_NEW and mark it pending."""
+    if not alert_id:
+        return ALERT_NEW
+    with recent_ids_lock:
+        if alert_id in recent_ids:
+            return ALERT_SEEN
+        if alert_id in pending_ids:
+            return ALERT_PENDING
+        pending_ids.add(alert_id)
+        return ALERT_NEW
+
+def finish_alert(alert_id, delivered):
+    """Mark alert_id seen if FCM took it; otherwise let a resend try again."""
+    if not alert_id:
+        return
+    with recent_ids_lock:
+        pending_ids.discard(alert_id)
+        if not delivered:
+            return
+        recent_ids[alert_id] = True
+        if len(recent_ids) > RECENT_IDS_MAX:
+            recent_ids.popitem(last=False)
+
 def send_fcm_async(type_val, topic_val):
     """
     Send FCM notification asynchronously with error handling.
@@ -26,7 +72,127 @@ def send_fcm_async(type_val, topic_val):
     except Exception as e:
         return "error", f"Async FCM error: {str(e)}"
 
+def validate_alert(type_val, topic_val):
+    """Return an error string for an invalid alert, or None."""
+    if type_val not in VALID_TYPES:
+        return f"Invalid 'type' value: {type_val}. Valid types: {list(VALID_TYPES)}"
+    if topic_val is None or len(topic_val) != 5:
+        return f"Invalid 'topic' value: {topic_val}. Must be 5 characters."
+    return None
+
+def fcm_delivered(future):
+    """True once the future holds a 200 from FCM."""
+    if not future.done():
+        return False
+    try:
+        status, _ = future.result()
+    except Exception:
+        return False
+    return status == 200
+
+def dispatch_alert(type_val, topic_val, alert_id):
+    """
+    Hand one alert to FCM on the thread pool and return its future. The id
+    is marked seen when FCM succeeds, even after the response has gone out.
+    """
+    future = executor.submit(send_fcm_async, type_val, topic_val)
+
+    def log_result(f):
+        delivered = fcm_delivered(f)
+        finish_alert(alert_id, delivered)
+        try:
+            status, text = f.result()
+        except Exception as fcm_error:
+            print(f"❌ FCM notification failed: {fcm_error}")
+            return
+        if delivered:
+            print(f"✅ FCM notification sent successfully ({type_val}, {topic_val})")
+        else:
+            print(f"⚠️ FCM notification failed: {status} - {text}")
+
+    future.add_done_callback(log_result)
+    return future
+
 class RequestHandler(http.server.BaseHTTPRequestHandler):
+    # Keep-alive: the device holds one connection open and sends every
+    # alert over it, so each response must carry a Content-Length.
+    protocol_version = "HTTP/1.1"
+
+    def send_json(self, code, response, close=False):
+        body = json.dumps(response, indent=2).encode('utf-8')
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Access-Control-Allow-Origin", "*")
+        self.send_header("Content-Length", str(len(body)))
+        if close:
+            self.close_connection = True
+            self.send_header("Connection", "close")
+        self.end_headers()
+        self.wfile.write(body)
+        self.wfile.flush()  # Ensure data is sent
+        print(f"📤 Response sent:")
+        print(body.decode('utf-8'))
+        print(f"{'='*50}\n")
+
+    def send_retry(self, response):
+        """
+        503 for alerts FCM has not taken (yet): the device keeps them and
+        sends them again on a new connection.
+        """
+        print(f"🔁 Asking the device to resend")
+        self.send_json(503, response, close=True)
+
+    def read_body(self):
+        length = int(self.headers.get("Content-Length", 0) or 0)
+        return self.rfile.read(length).decode('utf-8') if length > 0 else ""
+
+    def handle_batch(self):
+        """
+        POST /batch: one alert per body line, each line in the same
+        "topic=...&type=..." form as the single-alert query string.
+        Invalid lines are reported but do not fail the batch, so the device
+        never retries alerts that can never be accepted. If FCM has not taken
+        every valid line the whole batch is answered 503; the lines it did
+        take are acknowledged as duplicates when the batch comes again.
+        """
+        results = []
+        futures = []
+        retry = False
+        for line in self.read_body().splitlines():
+            if not line.strip():
+                continue
+            params = parse_qs(line.strip())
+            type_val = params.get("type", [None])[0]
+            topic_val = params.get("topic", [None])[0]
+            id_val = params.get("id", [None])[0]
+            error = validate_alert(type_val, topic_val)
+            if error:
+                print(f"❌ {error}")
+                results.append({'type': type_val, 'topic': topic_val, 'error': error})
+                continue
+            claim = claim_alert(id_val)
+            if claim == ALERT_SEEN:
+                print(f"↩️ Duplicate alert {id_val} ignored")
+                results.append({'type': type_val, 'topic': topic_val, 'duplicate': True})
+                continue
+            if claim == ALERT_PENDING:
+                retry = True
+                results.append({'type': type_val, 'topic': topic_val, 'fcm_status': "pending"})
+                continue
+            result = {'type': type_val, 'topic': topic_val}
+            futures.append((dispatch_alert(type_val, topic_val, id_val), result))
+            results.append(result)
+        wait([f for f, _ in futures], timeout=FCM_REPLY_TIMEOUT_S)
+        for future, result in futures:
+            delivered = fcm_delivered(future)
+            result['fcm_status'] = "sent" if delivered else "failed"
+            retry = retry or not delivered
+        print(f"✅ Batch of {len(results)} alert(s) processed")
+        if retry:
+            self.send_retry({'status': "Retry", 'results': results})
+            return
+        self.send_json(200, {'status': "Success", 'results': results})
+
     def do_POST(self):
         try:
             print(f"\n{'='*50}")
@@ -35,72 +201,47 @@ class RequestHandler(http.server.BaseHTTPRequestHandler):
             
             # Parse query parameters from the URL path
             parsed_url = urlparse(self.path)
+            if parsed_url.path == "/batch":
+                self.handle_batch()
+                return
+            self.read_body()  # keep the connection in sync if a body was sent
             query_params = parse_qs(parsed_url.query)
 
             type_val = query_params.get("type", [None])[0]
             topic_val = query_params.get("topic", [None])[0]
+            id_val = query_params.get("id", [None])[0]
 
-            print(f"Parsed parameters - type: {type_val}, topic: {topic_val}")
+            print(f"Parsed parameters - type: {type_val}, topic: {topic_val}, id: {id_val}")
 
-            response = {}
-            
-            # Validation
-            if type_val not in VALID_TYPES:
-                print(f"❌ Invalid type: {type_val}")
-                self.send_response(400)
-                response['error'] = f"Invalid 'type' value: {type_val}. Valid types: {list(VALID_TYPES)}"
-            elif topic_val is None or len(topic_val) != 5:
-                print(f"❌ Invalid topic: {topic_val}")
-                self.send_response(400)
-                response['error'] = f"Invalid 'topic' value: {topic_val}. Must be 5 characters."
-            else:
-                print(f"✅ Valid request - processing...")
-                self.send_response(200)
-                response['status'] = "Success"
-                response['type'] = type_val
-                response['topic'] = topic_val
-
-                # Send FCM notification asynchronously to avoid blocking
-                print(f"📱 Sending FCM notification asynchronously...")
-                
-                # Submit FCM task to thread pool and don't wait for it
-                future = executor.submit(send_fcm_async, type_val, topic_val)
-                
-                try:
-                    # Wait for FCM result with a short timeout to avoid blocking too long
-                    status, text = future.result(timeout=2.0)  # 2 second max wait
-                    response['fcm_status'] = status
-                    response['fcm_response'] = text
-                    
-                    if status == 200:
-                        print(f"✅ FCM notification sent successfully")
-                    else:
-                        print(f"⚠️ FCM notification failed: {status} - {text}")
-                        
-                except TimeoutError:
-                    print(f"⏰ FCM request taking too long, responding immediately")
-                    response['fcm_status'] = "pending"
-                    response['fcm_response'] = "FCM notification sent in background"
-                    
-                except Exception as fcm_error:
-                    print(f"❌ FCM notification failed: {fcm_error}")
-                    response['fcm_status'] = "error"
-                    response['fcm_response'] = str(fcm_error)
-
-            # Send response headers
-            self.send_header("Content-Type", "application/json")
-            self.send_header("Access-Control-Allow-Origin", "*")
-            self.send_header("Connection", "close")  # Important: close connection after response
-            self.end_headers()
-            
-            # Send response body
-            response_json = json.dumps(response, indent=2)
-            self.wfile.write(response_json.encode('utf-8'))
-            self.wfile.flush()  # Ensure data is sent
-            
-            print(f"📤 Response sent:")
-            print(response_json)
-            print(f"{'='*50}\n")
+            error = validate_alert(type_val, topic_val)
+            if error:
+                print(f"❌ {error}")
+                self.send_json(400, {'error': error})
+                return
+
+            claim = claim_alert(id_val)
+            if claim == ALERT_SEEN:
+                print(f"↩️ Duplicate alert {id_val} ignored")
+                self.send_json(200, {'status': "Success", 'type': type_val, 'topic': topic_val, 'duplicate': True})
+                return
+            if claim == ALERT_PENDING:
+                print(f"⏳ Alert {id_val} still with FCM")
+                self.send_retry({'status': "Retry", 'type': type_val, 'topic': topic_val, 'fcm_status': "pending"})
+                return
+
+            print(f"✅ Valid request - processing...")
+            print(f"📱 Sending FCM notification...")
+            future = dispatch_alert(type_val, topic_val, id_val)
+            wait([future], timeout=FCM_REPLY_TIMEOUT_S)
+            if not fcm_delivered(future):
+                self.send_retry({'status': "Retry", 'type': type_val, 'topic': topic_val, 'fcm_status': "failed"})
+                return
+            self.send_json(200, {
+                'status': "Success",
+                'type': type_val,
+                'topic': topic_val,
+                'fcm_status': "sent",
+            })
             
         except Exception as e:
             print(f"❌ Error handling request: {e}")
@@ -108,6 +249,7 @@ class RequestHandler(http.server.BaseHTTPRequestHandler):
             traceback.print_exc()
             
             try:
+                self.close_connection = True
                 self.send_response(500)
                 self.send_header("Content-Type", "application/json")
                 self.send_header("Connection", "close")
@@ -121,10 +263,12 @@ class RequestHandler(http.server.BaseHTTPRequestHandler):
     def do_GET(self):
         """Handle GET requests for testing"""
         print(f"Received GET request: {self.path}")
+        body = b"Server is running! Send POST requests with ?type=FOOD&topic=12345"
         self.send_response(200)
         self.send_header("Content-Type", "text/plain")
+        self.send_header("Content-Length", str(len(body)))
         self.end_headers()
-        self.wfile.write(b"Server is running! Send POST requests with ?type=FOOD&topic=12345")
+        self.wfile.write(body)
 
     def log_message(self, format, *args):
         """Override default logging to reduce noise"""
@@ -152,11 +296,18 @@ def test_fcm_function():
         print(f"⚠️ Server will continue without FCM")
         return False
 
-def test_hardware_connection(hardware_ip="192.168.120.13", hardware_port=5000, timeout=5):
+def test_hardware_connection(announcer, timeout=5):
     """
-    Tests connectivity to the specified hardware IP and port using sockets.
+    Waits for a device to announce itself over discovery, then tests
+    connectivity to its notification port using sockets.
     Returns True if connection is successful, False otherwise.
     """
+    print(f"🔎 Waiting up to {timeout}s for a device beacon...")
+    device = announcer.wait_for_device(timeout)
+    if device is None:
+        print("⏰ No device announced itself. It will find this server through its beacons.")
+        return False
+    hardware_ip, hardware_port = device['ip'], device['notify_port']
     print(f"🔌 Testing connection to hardware at {hardware_ip}:{hardware_port} using sockets...")
     try:
         # Create a socket object
@@ -182,12 +333,18 @@ def test_hardware_connection(hardware_ip="192.168.120.13", hardware_port=5000, t
         print(f"❌ An unexpected error occurred while testing hardware connection: {e}")
         return False
 
-def run_server(ip="0.0.0.0", port=8080):
+def run_server(ip="0.0.0.0", port=8080, discovery_port=DISCOVERY_PORT,
+               device_port=DISCOVERY_PORT, beacon_addr=BROADCAST_ADDR):
     print(f"🚀 Starting server...")
+
+    # Announce ourselves so devices find this server whatever its address
+    announcer = ServerAnnouncer(port, listen_port=discovery_port,
+                                device_port=device_port, beacon_addr=beacon_addr)
+    announcer.start()
+    print(f"📡 Discovery beacons to {beacon_addr}:{device_port}, listening on UDP {discovery_port}")
     
     # First, test connection to the hardware
-    # Note: I've changed the default port to 45454 to match your output
-    if not test_hardware_connection(): 
+    if not test_hardware_connection(announcer): 
         print("⚠️ Hardware connection test failed. Server will still start, but hardware communication might be impacted.")
         
     # Test FCM function next
@@ -222,5 +379,15 @@ def run_server(ip="0.0.0.0", port=8080):
             print("✅ Server closed cleanly.")
 
 if __name__ == "__main__":
-    run_server()
+    parser = argparse.ArgumentParser(description="SPARC notification proxy server.")
+    parser.add_argument("--ip", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--discovery-port", type=int, default=DISCOVERY_PORT,
+                        help="UDP port for device beacons and discover requests")
+    parser.add_argument("--device-port", type=int, default=DISCOVERY_PORT,
+                        help="UDP port devices listen on for server beacons")
+    parser.add_argument("--beacon-addr", default=BROADCAST_ADDR,
+                        help="where to send server beacons (127.0.0.1 for a loopback test)")
+    args = parser.parse_args()
+    run_server(args.ip, args.port, args.discovery_port, args.device_port, args.beacon_addr)
 